@@ -21,6 +21,11 @@
  */
 #include "aes.h"
 
+#include "utils-sys.h"
+
+#ifdef C_SYS_X86_SIMD
+#include <immintrin.h>
+#endif
 
 
 #ifdef BIG_ENDIAN
@@ -705,10 +710,10 @@ static int c_aes_key_setup_dec (uint32_t rk[/*4*(Nr + 1)*/], const uint8_t ciphe
 static int c_aes_key_setup_enc (uint32_t rk[/*4*(Nr + 1)*/], const uint8_t* cipherKey, uint32_t keyLen);
 
 
-void c_aes_encrypt_block(AesContext * ctx, uint8_t * input, uint8_t * output)
+static void aes_encrypt_block_soft(const AesContext * ctx, const uint8_t * input, uint8_t * output)
 {
     uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
-    uint32_t *pEnKey = ctx->enKey;
+    const uint32_t *pEnKey = ctx->enKey;
 
 #ifndef FULL_UNROLL
     int r;
@@ -887,10 +892,10 @@ void c_aes_encrypt_block(AesContext * ctx, uint8_t * input, uint8_t * output)
     PUTU32(output + 12, s3);
 }
 
-void c_aes_decrypt_block(AesContext * ctx, uint8_t * input, uint8_t * output)
+static void aes_decrypt_block_soft(const AesContext * ctx, const uint8_t * input, uint8_t * output)
 {
     uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
-    uint32_t *pDeKey = ctx->deKey;
+    const uint32_t *pDeKey = ctx->deKey;
 
 #ifndef FULL_UNROLL
     int r;
@@ -1987,10 +1992,10 @@ int c_aes_key_setup_dec(uint32_t rk[/*4*(Nr + 1)*/], const uint8_t cipherKey[],
     return nr;
 }
 
-void c_aes_encrypt_block(AesContext *ctx, uint8_t* input, uint8_t* output)
+static void aes_encrypt_block_soft(const AesContext *ctx, const uint8_t* input, uint8_t* output)
 {
     uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
-    uint32_t *pEnKey = ctx->enKey;
+    const uint32_t *pEnKey = ctx->enKey;
 
 #ifndef FULL_UNROLL
     int r;
@@ -2162,10 +2167,10 @@ void c_aes_encrypt_block(AesContext *ctx, uint8_t* input, uint8_t* output)
     PUTU32(output + 12, s3);
 }
 
-void c_aes_decrypt_block(AesContext *ctx, uint8_t* input, uint8_t* output)
+static void aes_decrypt_block_soft(const AesContext *ctx, const uint8_t* input, uint8_t* output)
 {
     uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
-    uint32_t *pDeKey = ctx->deKey;
+    const uint32_t *pDeKey = ctx->deKey;
 
 #ifndef FULL_UNROLL
     int r;
@@ -2342,6 +2347,228 @@ void c_aes_decrypt_block(AesContext *ctx, uint8_t* input, uint8_t* output)
 #endif
 
 
+#ifdef C_SYS_X86_SIMD
+/**
+ * AES-NI 实现
+ *
+ * 轮密钥以字节序保存在 hwEnKey/hwDeKey 中, 可直接被 AESENC/AESDEC 使用;
+ * 同时转换出 T 表格式的 enKey/deKey, 保证同一个 AesContext 在两条路径上都可用.
+ */
+C_SYS_TARGET("aes,sse2")
+static uint32_t aes_ni_sub_word(uint32_t w, int rot)
+{
+    /* AESKEYGENASSIST: dword0 = SubWord(X1), dword1 = RotWord(SubWord(X1)) ^ rcon (这里 rcon 取 0, 由调用者异或) */
+    __m128i t = _mm_aeskeygenassist_si128(_mm_set1_epi32((int) w), 0);
+    if (rot) {
+        t = _mm_shuffle_epi32(t, 0x55);
+    }
+    return (uint32_t) _mm_cvtsi128_si32(t);
+}
+
+C_SYS_TARGET("aes,sse2")
+static int aes_ni_key_setup_enc(uint8_t rk[/*16*(Nr + 1)*/], const uint8_t* cipherKey, uint32_t keyLen)
+{
+    static const uint8_t rcon[10] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36 };
+    uint32_t w[4 * (AES_MAX_ROUNDS + 1)];
+    uint32_t nk = keyLen / 4;
+    uint32_t nr = nk + 6;
+    uint32_t i, t;
+
+    memcpy(w, cipherKey, keyLen);
+    for (i = nk; i < 4 * (nr + 1); i++) {
+        t = w[i - 1];
+        if (0 == i % nk) {
+            t = aes_ni_sub_word(t, 1) ^ rcon[i / nk - 1];
+        }
+        else if (nk > 6 && 4 == i % nk) {
+            t = aes_ni_sub_word(t, 0);
+        }
+        w[i] = w[i - nk] ^ t;
+    }
+    memcpy(rk, w, 16 * (nr + 1));
+    memset(w, 0, sizeof(w));
+
+    return (int) nr;
+}
+
+C_SYS_TARGET("aes,sse2")
+static int aes_ni_key_setup_dec(uint8_t rk[/*16*(Nr + 1)*/], const uint8_t enKey[/*16*(Nr + 1)*/], int nr)
+{
+    int i;
+
+    _mm_storeu_si128((__m128i*) rk, _mm_loadu_si128((const __m128i*) (enKey + 16 * nr)));
+    for (i = 1; i < nr; i++) {
+        _mm_storeu_si128((__m128i*) (rk + 16 * i), _mm_aesimc_si128(_mm_loadu_si128((const __m128i*) (enKey + 16 * (nr - i)))));
+    }
+    _mm_storeu_si128((__m128i*) (rk + 16 * nr), _mm_loadu_si128((const __m128i*) enKey));
+
+    return nr;
+}
+
+C_SYS_TARGET("aes,sse2")
+static void aes_ni_encrypt_block(const AesContext* ctx, const uint8_t* input, uint8_t* output)
+{
+    const uint8_t* rk = ctx->hwEnKey;
+    __m128i s = _mm_loadu_si128((const __m128i*) input);
+    int r;
+
+    s = _mm_xor_si128(s, _mm_loadu_si128((const __m128i*) rk));
+    for (r = 1; r < ctx->nRound; r++) {
+        s = _mm_aesenc_si128(s, _mm_loadu_si128((const __m128i*) (rk + 16 * r)));
+    }
+    s = _mm_aesenclast_si128(s, _mm_loadu_si128((const __m128i*) (rk + 16 * r)));
+    _mm_storeu_si128((__m128i*) output, s);
+}
+
+C_SYS_TARGET("aes,sse2")
+static void aes_ni_decrypt_block(const AesContext* ctx, const uint8_t* input, uint8_t* output)
+{
+    const uint8_t* rk = ctx->hwDeKey;
+    __m128i s = _mm_loadu_si128((const __m128i*) input);
+    int r;
+
+    s = _mm_xor_si128(s, _mm_loadu_si128((const __m128i*) rk));
+    for (r = 1; r < ctx->nRound; r++) {
+        s = _mm_aesdec_si128(s, _mm_loadu_si128((const __m128i*) (rk + 16 * r)));
+    }
+    s = _mm_aesdeclast_si128(s, _mm_loadu_si128((const __m128i*) (rk + 16 * r)));
+    _mm_storeu_si128((__m128i*) output, s);
+}
+
+/* 8 个分组交错: AESENC 延迟约 4 个周期而吞吐为每周期 1~2 条, 需要足够多的独立分组才能填满流水线 */
+#define AES_NI_LANES        8
+
+#define AES_NI_LOAD8(b, in, k) \
+    b##0 = _mm_xor_si128(_mm_loadu_si128((const __m128i*) ((in)      )), k); \
+    b##1 = _mm_xor_si128(_mm_loadu_si128((const __m128i*) ((in) +  16)), k); \
+    b##2 = _mm_xor_si128(_mm_loadu_si128((const __m128i*) ((in) +  32)), k); \
+    b##3 = _mm_xor_si128(_mm_loadu_si128((const __m128i*) ((in) +  48)), k); \
+    b##4 = _mm_xor_si128(_mm_loadu_si128((const __m128i*) ((in) +  64)), k); \
+    b##5 = _mm_xor_si128(_mm_loadu_si128((const __m128i*) ((in) +  80)), k); \
+    b##6 = _mm_xor_si128(_mm_loadu_si128((const __m128i*) ((in) +  96)), k); \
+    b##7 = _mm_xor_si128(_mm_loadu_si128((const __m128i*) ((in) + 112)), k)
+
+#define AES_NI_ROUND8(op, b, k) \
+    b##0 = op(b##0, k); b##1 = op(b##1, k); b##2 = op(b##2, k); b##3 = op(b##3, k); \
+    b##4 = op(b##4, k); b##5 = op(b##5, k); b##6 = op(b##6, k); b##7 = op(b##7, k)
+
+#define AES_NI_STORE8(out, b) \
+    _mm_storeu_si128((__m128i*) ((out)      ), b##0); \
+    _mm_storeu_si128((__m128i*) ((out) +  16), b##1); \
+    _mm_storeu_si128((__m128i*) ((out) +  32), b##2); \
+    _mm_storeu_si128((__m128i*) ((out) +  48), b##3); \
+    _mm_storeu_si128((__m128i*) ((out) +  64), b##4); \
+    _mm_storeu_si128((__m128i*) ((out) +  80), b##5); \
+    _mm_storeu_si128((__m128i*) ((out) +  96), b##6); \
+    _mm_storeu_si128((__m128i*) ((out) + 112), b##7)
+
+C_SYS_TARGET("aes,sse2")
+static void aes_ni_encrypt_blocks(const AesContext* ctx, const uint8_t* input, uint8_t* output, size_t nBlocks)
+{
+    __m128i b0, b1, b2, b3, b4, b5, b6, b7;
+    const uint8_t* rk = ctx->hwEnKey;
+    int r;
+
+    for (; nBlocks >= AES_NI_LANES; nBlocks -= AES_NI_LANES) {
+        AES_NI_LOAD8(b, input, _mm_loadu_si128((const __m128i*) rk));
+        for (r = 1; r < ctx->nRound; r++) {
+            AES_NI_ROUND8(_mm_aesenc_si128, b, _mm_loadu_si128((const __m128i*) (rk + 16 * r)));
+        }
+        AES_NI_ROUND8(_mm_aesenclast_si128, b, _mm_loadu_si128((const __m128i*) (rk + 16 * r)));
+        AES_NI_STORE8(output, b);
+        input += AES_NI_LANES * AES_BLOCK_SIZE;
+        output += AES_NI_LANES * AES_BLOCK_SIZE;
+    }
+
+    for (; nBlocks > 0; nBlocks--) {
+        aes_ni_encrypt_block(ctx, input, output);
+        input += AES_BLOCK_SIZE;
+        output += AES_BLOCK_SIZE;
+    }
+}
+
+C_SYS_TARGET("aes,sse2")
+static void aes_ni_decrypt_blocks(const AesContext* ctx, const uint8_t* input, uint8_t* output, size_t nBlocks)
+{
+    __m128i b0, b1, b2, b3, b4, b5, b6, b7;
+    const uint8_t* rk = ctx->hwDeKey;
+    int r;
+
+    for (; nBlocks >= AES_NI_LANES; nBlocks -= AES_NI_LANES) {
+        AES_NI_LOAD8(b, input, _mm_loadu_si128((const __m128i*) rk));
+        for (r = 1; r < ctx->nRound; r++) {
+            AES_NI_ROUND8(_mm_aesdec_si128, b, _mm_loadu_si128((const __m128i*) (rk + 16 * r)));
+        }
+        AES_NI_ROUND8(_mm_aesdeclast_si128, b, _mm_loadu_si128((const __m128i*) (rk + 16 * r)));
+        AES_NI_STORE8(output, b);
+        input += AES_NI_LANES * AES_BLOCK_SIZE;
+        output += AES_NI_LANES * AES_BLOCK_SIZE;
+    }
+
+    for (; nBlocks > 0; nBlocks--) {
+        aes_ni_decrypt_block(ctx, input, output);
+        input += AES_BLOCK_SIZE;
+        output += AES_BLOCK_SIZE;
+    }
+}
+#endif
+
+void c_aes_encrypt_block(AesContext * ctx, uint8_t * input, uint8_t * output)
+{
+#ifdef C_SYS_X86_SIMD
+    if (ctx->hwAes) {
+        aes_ni_encrypt_block(ctx, input, output);
+        return;
+    }
+#endif
+    aes_encrypt_block_soft(ctx, input, output);
+}
+
+void c_aes_decrypt_block(AesContext * ctx, uint8_t * input, uint8_t * output)
+{
+#ifdef C_SYS_X86_SIMD
+    if (ctx->hwAes) {
+        aes_ni_decrypt_block(ctx, input, output);
+        return;
+    }
+#endif
+    aes_decrypt_block_soft(ctx, input, output);
+}
+
+void c_aes_encrypt_blocks(const AesContext* ctx, const uint8_t* input, uint8_t* output, size_t nBlocks)
+{
+#ifdef C_SYS_X86_SIMD
+    if (ctx->hwAes) {
+        aes_ni_encrypt_blocks(ctx, input, output, nBlocks);
+        return;
+    }
+#endif
+    /*
+     * T 表实现每轮已有 16 次互不依赖的查表, 受限于访存端口而不是延迟;
+     * 手工交错多个分组只会增加寄存器溢出(实测更慢), 因此逐块处理, 由乱序执行重叠相邻分组
+     */
+    for (; nBlocks > 0; nBlocks--) {
+        aes_encrypt_block_soft(ctx, input, output);
+        input += AES_BLOCK_SIZE;
+        output += AES_BLOCK_SIZE;
+    }
+}
+
+void c_aes_decrypt_blocks(const AesContext* ctx, const uint8_t* input, uint8_t* output, size_t nBlocks)
+{
+#ifdef C_SYS_X86_SIMD
+    if (ctx->hwAes) {
+        aes_ni_decrypt_blocks(ctx, input, output, nBlocks);
+        return;
+    }
+#endif
+    for (; nBlocks > 0; nBlocks--) {
+        aes_decrypt_block_soft(ctx, input, output);
+        input += AES_BLOCK_SIZE;
+        output += AES_BLOCK_SIZE;
+    }
+}
+
 void c_aes_setup(AesContext * ctx, const uint8_t * aesKey, uint32_t keyLen)
 {
     c_aes_setup_real(ctx, aesKey, keyLen, NULL, 1);
@@ -2349,6 +2576,10 @@ void c_aes_setup(AesContext * ctx, const uint8_t * aesKey, uint32_t keyLen)
 
 void c_aes_setup_real(AesContext * ctx, const uint8_t * aesKey, uint32_t keyLen, uint8_t * iv, uint32_t iMode)
 {
+#ifdef C_SYS_X86_SIMD
+    int i;
+#endif
+
     if (keyLen >= 32) {
         keyLen = 32;
     }
@@ -2360,8 +2591,23 @@ void c_aes_setup_real(AesContext * ctx, const uint8_t * aesKey, uint32_t keyLen,
         keyLen = 16;
     }
 
-    c_aes_key_setup_enc(ctx->enKey, aesKey, keyLen);
-    ctx->nRound = (uint8_t) c_aes_key_setup_dec(ctx->deKey, aesKey, keyLen);
+    ctx->hwAes = 0;
+#ifdef C_SYS_X86_SIMD
+    if (C_FLAG_ON(c_utils_sys_get_cpu_features(), C_SYS_CPU_AESNI)) {
+        ctx->nRound = (uint8_t) aes_ni_key_setup_enc(ctx->hwEnKey, aesKey, keyLen);
+        aes_ni_key_setup_dec(ctx->hwDeKey, ctx->hwEnKey, ctx->nRound);
+        for (i = 0; i < 4 * (ctx->nRound + 1); i++) {
+            ctx->enKey[i] = GETU32(ctx->hwEnKey + 4 * i);
+            ctx->deKey[i] = GETU32(ctx->hwDeKey + 4 * i);
+        }
+        ctx->hwAes = 1;
+    }
+    else
+#endif
+    {
+        c_aes_key_setup_enc(ctx->enKey, aesKey, keyLen);
+        ctx->nRound = (uint8_t) c_aes_key_setup_dec(ctx->deKey, aesKey, keyLen);
+    }
 
     if (ctx->nRound == 0) {
         ctx->nRound = 10;
@@ -2376,3 +2622,119 @@ void c_aes_setup_real(AesContext * ctx, const uint8_t * aesKey, uint32_t keyLen,
     ctx->iMode = (uint8_t) iMode;
 }
 
+static void aes_encrypt_blocks_cb(const void* key, const uint8_t* input, uint8_t* output, size_t nBlocks)
+{
+    c_aes_encrypt_blocks((const AesContext*) key, input, output, nBlocks);
+}
+
+static void aes_decrypt_blocks_cb(const void* key, const uint8_t* input, uint8_t* output, size_t nBlocks)
+{
+    c_aes_decrypt_blocks((const AesContext*) key, input, output, nBlocks);
+}
+
+void c_aes_encrypt_ctr(const AesContext* ctx, const uint8_t iv[AES_BLOCK_SIZE], uint64_t blockOffset, const uint8_t* input, uint8_t* output, size_t length)
+{
+    CipherCtrContext ctr;
+
+    c_cipher_mode_ctr_init(&ctr, iv, blockOffset);
+    c_cipher_mode_ctr_update(&ctr, ctx, aes_encrypt_blocks_cb, input, output, length);
+    memset(&ctr, 0, sizeof(ctr));
+}
+
+void c_aes_ctr_init(AesCtrContext* ctx, const AesContext* aes, const uint8_t iv[AES_BLOCK_SIZE], uint64_t blockOffset)
+{
+    ctx->aes = aes;
+    c_cipher_mode_ctr_init(&ctx->ctr, iv, blockOffset);
+}
+
+void c_aes_ctr_seek(AesCtrContext* ctx, uint64_t byteOffset)
+{
+    c_cipher_mode_ctr_seek(&ctx->ctr, ctx->aes, aes_encrypt_blocks_cb, byteOffset);
+}
+
+void c_aes_ctr_update(AesCtrContext* ctx, const uint8_t* input, uint8_t* output, size_t length)
+{
+    c_cipher_mode_ctr_update(&ctx->ctr, ctx->aes, aes_encrypt_blocks_cb, input, output, length);
+}
+
+void c_aes_gcm_init(AesGcmContext* ctx, const AesContext* aes, const uint8_t* iv, size_t ivLen)
+{
+    ctx->aes = aes;
+    c_gcm_init(&ctx->gcm, aes, aes_encrypt_blocks_cb, iv, ivLen);
+}
+
+bool c_aes_gcm_aad(AesGcmContext* ctx, const uint8_t* aad, size_t length)
+{
+    return c_gcm_aad(&ctx->gcm, aad, length);
+}
+
+bool c_aes_gcm_encrypt_update(AesGcmContext* ctx, const uint8_t* input, uint8_t* output, size_t length)
+{
+    return c_gcm_encrypt_update(&ctx->gcm, ctx->aes, aes_encrypt_blocks_cb, input, output, length);
+}
+
+bool c_aes_gcm_decrypt_update(AesGcmContext* ctx, const uint8_t* input, uint8_t* output, size_t length)
+{
+    return c_gcm_decrypt_update(&ctx->gcm, ctx->aes, aes_encrypt_blocks_cb, input, output, length);
+}
+
+void c_aes_gcm_final(AesGcmContext* ctx, uint8_t* tag, size_t tagLen)
+{
+    c_gcm_final(&ctx->gcm, tag, tagLen);
+}
+
+bool c_aes_gcm_verify(AesGcmContext* ctx, const uint8_t* tag, size_t tagLen)
+{
+    return c_gcm_verify(&ctx->gcm, tag, tagLen);
+}
+
+void c_aes_gcm_encrypt(const AesContext* aes, const uint8_t* iv, size_t ivLen, const uint8_t* aad, size_t aadLen, const uint8_t* input, uint8_t* output, size_t length, uint8_t* tag, size_t tagLen)
+{
+    AesGcmContext ctx;
+
+    c_aes_gcm_init(&ctx, aes, iv, ivLen);
+    c_aes_gcm_aad(&ctx, aad, aadLen);
+    c_aes_gcm_encrypt_update(&ctx, input, output, length);
+    c_aes_gcm_final(&ctx, tag, tagLen);
+    memset(&ctx, 0, sizeof(ctx));
+}
+
+bool c_aes_gcm_decrypt(const AesContext* aes, const uint8_t* iv, size_t ivLen, const uint8_t* aad, size_t aadLen, const uint8_t* input, uint8_t* output, size_t length, const uint8_t* tag, size_t tagLen)
+{
+    bool ret;
+    AesGcmContext ctx;
+
+    c_aes_gcm_init(&ctx, aes, iv, ivLen);
+    c_aes_gcm_aad(&ctx, aad, aadLen);
+    c_aes_gcm_decrypt_update(&ctx, input, output, length);
+    ret = c_aes_gcm_verify(&ctx, tag, tagLen);
+    memset(&ctx, 0, sizeof(ctx));
+    if (!ret) {
+        memset(output, 0, length);
+    }
+
+    return ret;
+}
+
+bool c_aes_xts_setup(AesXtsContext* ctx, const uint8_t* key, uint32_t keyLen)
+{
+    if (32 != keyLen && 64 != keyLen) {
+        return false;
+    }
+
+    keyLen /= 2;
+    c_aes_setup(&ctx->data, key, keyLen);
+    c_aes_setup(&ctx->tweak, key + keyLen, keyLen);
+
+    return true;
+}
+
+bool c_aes_xts_encrypt_sectors(const AesXtsContext* ctx, const uint8_t* input, uint8_t* output, size_t length, size_t sectorSize, uint64_t startSector)
+{
+    return c_cipher_mode_xts_sectors(&ctx->data, aes_encrypt_blocks_cb, &ctx->tweak, aes_encrypt_blocks_cb, input, output, length, sectorSize, startSector);
+}
+
+bool c_aes_xts_decrypt_sectors(const AesXtsContext* ctx, const uint8_t* input, uint8_t* output, size_t length, size_t sectorSize, uint64_t startSector)
+{
+    return c_cipher_mode_xts_sectors(&ctx->data, aes_decrypt_blocks_cb, &ctx->tweak, aes_encrypt_blocks_cb, input, output, length, sectorSize, startSector);
+}
@@ -22,6 +22,8 @@
 #ifndef purec_PUREC_AES_H
 #define purec_PUREC_AES_H
 #include "common.h"
+#include "cipher-mode.h"
+#include "gcm.h"
 
 
 C_BEGIN_EXTERN_C
@@ -38,6 +40,7 @@ C_BEGIN_EXTERN_C
 #define ENC_MODE_ECB 0
 #define ENC_MODE_CBC 1
 #define ENC_MODE_CFB 2
+#define ENC_MODE_CTR 3
 
 enum
 {
@@ -57,8 +60,35 @@ typedef struct AesCtx
     uint8_t                 IV[AES_BLOCK_SIZE];             // initialized value
     uint8_t                 nRound;
     uint8_t                 iMode;
+    uint8_t                 hwAes;                          // 1: 使用 AES-NI 路径
+    uint8_t                 hwEnKey[AES_BLOCK_SIZE*(AES_MAX_ROUNDS+1)];    // AES-NI 加密轮密钥(字节序)
+    uint8_t                 hwDeKey[AES_BLOCK_SIZE*(AES_MAX_ROUNDS+1)];    // AES-NI 解密轮密钥(已做 InvMixColumns)
 } AesContext;
 
+/**
+ * 流式 CTR 上下文: 密钥只读引用, 多个流(或多个线程)可以共用同一个 AesContext
+ */
+typedef struct
+{
+    const AesContext*       aes;
+    CipherCtrContext        ctr;
+} AesCtrContext;
+
+typedef struct
+{
+    const AesContext*       aes;
+    GcmContext              gcm;
+} AesGcmContext;
+
+/**
+ * XTS 需要两个独立的 AES 密钥: 数据密钥与调整值密钥
+ */
+typedef struct
+{
+    AesContext              data;
+    AesContext              tweak;
+} AesXtsContext;
+
 
 #ifdef BIG_ENDIAN
 #define GETU32(pt)          (((uint32_t)(pt)[0] << 24) ^ ((uint32_t)(pt)[1] << 16) ^ ((uint32_t)(pt)[2] <<  8) ^ ((uint32_t)(pt)[3]))
@@ -68,11 +98,72 @@ typedef struct AesCtx
 #define PUTU32(ct, st)      (*(uint32_t*)(ct) = (st))
 #endif
 
+/**
+ * @note 支持 AES-NI 的 CPU 上自动使用硬件实现(运行时检测), 否则使用 T 表实现, 两者结果完全一致
+ */
 void c_aes_setup            (AesContext* ctx, const uint8_t* aesKey, uint32_t keyLen);
 void c_aes_setup_real       (AesContext* ctx, const uint8_t* aesKey, uint32_t keyLen, uint8_t* iv, uint32_t iMode);
 void c_aes_encrypt_block    (AesContext* ctx, uint8_t* input, uint8_t* output);
 void c_aes_decrypt_block    (AesContext* ctx, uint8_t* input, uint8_t* output);
 
+/**
+ * @brief 批量 ECB 加/解密 nBlocks 个互不依赖的分组, 内部多个分组交错执行以隐藏单轮延迟
+ * @note input 与 output 可以相同(原地加解密)
+ */
+void c_aes_encrypt_blocks   (const AesContext* ctx, const uint8_t* input, uint8_t* output, size_t nBlocks);
+void c_aes_decrypt_blocks   (const AesContext* ctx, const uint8_t* input, uint8_t* output, size_t nBlocks);
+
+/**
+ * @brief CTR 模式加/解密(同一操作), 从第 blockOffset 个分组开始, 长度任意
+ * @note 计数器为 128 位大端整数, 第 N 个分组使用 iv + N; 因此可以只解密文件中的某一段,
+ *       也可以把一个缓冲区切成若干段(按分组对齐)交给多个线程并行处理
+ */
+void c_aes_encrypt_ctr      (const AesContext* ctx, const uint8_t iv[AES_BLOCK_SIZE], uint64_t blockOffset, const uint8_t* input, uint8_t* output, size_t length);
+
+/**
+ * @brief 流式 CTR, 每次 update 的长度任意, 不足一个分组的密钥流保留到下次
+ */
+void c_aes_ctr_init         (AesCtrContext* ctx, const AesContext* aes, const uint8_t iv[AES_BLOCK_SIZE], uint64_t blockOffset);
+void c_aes_ctr_seek         (AesCtrContext* ctx, uint64_t byteOffset);
+void c_aes_ctr_update       (AesCtrContext* ctx, const uint8_t* input, uint8_t* output, size_t length);
+
+/**
+ * @brief AES-GCM 认证加密(单遍: 加密与 GHASH 在同一批分组上完成)
+ * @note 流式用法: init -> aad(可多次) -> encrypt_update/decrypt_update(可多次) -> final/verify;
+ *       verify 对标签做常数时间比较(tagLen 须为 12 到 16), 失败时调用方必须丢弃已解密的数据
+ */
+void c_aes_gcm_init             (AesGcmContext* ctx, const AesContext* aes, const uint8_t* iv, size_t ivLen);
+bool c_aes_gcm_aad              (AesGcmContext* ctx, const uint8_t* aad, size_t length);
+bool c_aes_gcm_encrypt_update   (AesGcmContext* ctx, const uint8_t* input, uint8_t* output, size_t length);
+bool c_aes_gcm_decrypt_update   (AesGcmContext* ctx, const uint8_t* input, uint8_t* output, size_t length);
+void c_aes_gcm_final            (AesGcmContext* ctx, uint8_t* tag, size_t tagLen);
+bool c_aes_gcm_verify           (AesGcmContext* ctx, const uint8_t* tag, size_t tagLen);
+
+/**
+ * @brief 一次完成的 AES-GCM
+ * @return 解密时标签不一致返回 false, 并清零 output
+ */
+void c_aes_gcm_encrypt          (const AesContext* aes, const uint8_t* iv, size_t ivLen, const uint8_t* aad, size_t aadLen, const uint8_t* input, uint8_t* output, size_t length, uint8_t* tag, size_t tagLen);
+bool c_aes_gcm_decrypt          (const AesContext* aes, const uint8_t* iv, size_t ivLen, const uint8_t* aad, size_t aadLen, const uint8_t* input, uint8_t* output, size_t length, const uint8_t* tag, size_t tagLen);
+
+/**
+ * @brief AES-XTS 初始化
+ * @param key 数据密钥与调整值密钥拼接而成(与 LUKS aes-xts-plain64 相同)
+ * @param keyLen 32 (AES-128) 或 64 (AES-256)
+ * @return 其它长度返回 false
+ */
+bool c_aes_xts_setup            (AesXtsContext* ctx, const uint8_t* key, uint32_t keyLen);
+
+/**
+ * @brief AES-XTS 按扇区加/解密, 一次可以处理多个连续扇区
+ * @param length 必须是 sectorSize 的整数倍
+ * @param sectorSize 数据单元长度, 如 512 或 4096
+ * @param startSector 第一个扇区的扇区号(plain64)
+ * @return 参数不合法返回 false
+ */
+bool c_aes_xts_encrypt_sectors  (const AesXtsContext* ctx, const uint8_t* input, uint8_t* output, size_t length, size_t sectorSize, uint64_t startSector);
+bool c_aes_xts_decrypt_sectors  (const AesXtsContext* ctx, const uint8_t* input, uint8_t* output, size_t length, size_t sectorSize, uint64_t startSector);
+
 C_END_EXTERN_C
 
 #endif // purec_PUREC_AES_H
\ No newline at end of file
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cipher-mode.h"
+
+
+void c_cipher_mode_xor(uint8_t* out, const uint8_t* a, const uint8_t* b, size_t len)
+{
+    uint64_t x, y;
+
+    for (; len >= sizeof(uint64_t); len -= sizeof(uint64_t)) {
+        memcpy(&x, a, sizeof(x));
+        memcpy(&y, b, sizeof(y));
+        x ^= y;
+        memcpy(out, &x, sizeof(x));
+        out += sizeof(uint64_t);
+        a += sizeof(uint64_t);
+        b += sizeof(uint64_t);
+    }
+    for (; len > 0; len--) {
+        *out++ = *a++ ^ *b++;
+    }
+}
+
+static uint64_t cipher_mode_load_be64(const uint8_t* p)
+{
+    uint64_t v;
+
+    memcpy(&v, p, sizeof(v));
+
+    return be64toh(v);
+}
+
+static void cipher_mode_store_be64(uint8_t* p, uint64_t v)
+{
+    v = htobe64(v);
+    memcpy(p, &v, sizeof(v));
+}
+
+void c_cipher_mode_ctr_add(uint8_t counter[CIPHER_MODE_BLOCK_SIZE], uint64_t n)
+{
+    uint64_t lo = cipher_mode_load_be64(counter + 8);
+
+    lo += n;
+    cipher_mode_store_be64(counter + 8, lo);
+    if (lo < n) {
+        cipher_mode_store_be64(counter, cipher_mode_load_be64(counter) + 1);
+    }
+}
+
+void c_cipher_mode_ctr_init(CipherCtrContext* ctx, const uint8_t iv[CIPHER_MODE_BLOCK_SIZE], uint64_t blockOffset)
+{
+    memcpy(ctx->iv, iv, CIPHER_MODE_BLOCK_SIZE);
+    memcpy(ctx->counter, iv, CIPHER_MODE_BLOCK_SIZE);
+    c_cipher_mode_ctr_add(ctx->counter, blockOffset);
+    memset(ctx->keyStream, 0, CIPHER_MODE_BLOCK_SIZE);
+    ctx->num = CIPHER_MODE_BLOCK_SIZE;
+}
+
+void c_cipher_mode_ctr_seek(CipherCtrContext* ctx, const void* key, CipherBlocksFunc encrypt, uint64_t byteOffset)
+{
+    memcpy(ctx->counter, ctx->iv, CIPHER_MODE_BLOCK_SIZE);
+    c_cipher_mode_ctr_add(ctx->counter, byteOffset / CIPHER_MODE_BLOCK_SIZE);
+    ctx->num = CIPHER_MODE_BLOCK_SIZE;
+
+    if (byteOffset % CIPHER_MODE_BLOCK_SIZE) {
+        encrypt(key, ctx->counter, ctx->keyStream, 1);
+        c_cipher_mode_ctr_add(ctx->counter, 1);
+        ctx->num = (uint32_t) (byteOffset % CIPHER_MODE_BLOCK_SIZE);
+    }
+}
+
+void c_cipher_mode_ctr_update(CipherCtrContext* ctx, const void* key, CipherBlocksFunc encrypt, const uint8_t* input, uint8_t* output, size_t length)
+{
+    size_t i, n, nBlocks;
+    uint64_t hi, lo;
+    uint8_t ks[CIPHER_MODE_BATCH_BLOCKS * CIPHER_MODE_BLOCK_SIZE];
+
+    // 先用完上次剩余的密钥流
+    if (ctx->num < CIPHER_MODE_BLOCK_SIZE && length) {
+        n = C_MIN(length, CIPHER_MODE_BLOCK_SIZE - ctx->num);
+        c_cipher_mode_xor(output, input, ctx->keyStream + ctx->num, n);
+        ctx->num += (uint32_t) n;
+        input += n;
+        output += n;
+        length -= n;
+    }
+
+    // 整分组: 成批生成计数器, 一次交给批量分组函数
+    while (length >= CIPHER_MODE_BLOCK_SIZE) {
+        nBlocks = C_MIN(length / CIPHER_MODE_BLOCK_SIZE, CIPHER_MODE_BATCH_BLOCKS);
+        hi = cipher_mode_load_be64(ctx->counter);
+        lo = cipher_mode_load_be64(ctx->counter + 8);
+        for (i = 0; i < nBlocks; i++) {
+            cipher_mode_store_be64(ks + i * CIPHER_MODE_BLOCK_SIZE, hi);
+            cipher_mode_store_be64(ks + i * CIPHER_MODE_BLOCK_SIZE + 8, lo);
+            if (0 == ++lo) {
+                ++hi;
+            }
+        }
+        cipher_mode_store_be64(ctx->counter, hi);
+        cipher_mode_store_be64(ctx->counter + 8, lo);
+        encrypt(key, ks, ks, nBlocks);
+        n = nBlocks * CIPHER_MODE_BLOCK_SIZE;
+        c_cipher_mode_xor(output, input, ks, n);
+        input += n;
+        output += n;
+        length -= n;
+    }
+
+    // 不足一个分组: 生成一个分组的密钥流, 剩余部分留给下次调用
+    if (length) {
+        encrypt(key, ctx->counter, ctx->keyStream, 1);
+        c_cipher_mode_ctr_add(ctx->counter, 1);
+        c_cipher_mode_xor(output, input, ctx->keyStream, length);
+        ctx->num = (uint32_t) length;
+    }
+
+    memset(ks, 0, sizeof(ks));
+}
+
+static uint64_t cipher_mode_load_le64(const uint8_t* p)
+{
+    uint64_t v;
+
+    memcpy(&v, p, sizeof(v));
+
+    return le64toh(v);
+}
+
+static void cipher_mode_store_le64(uint8_t* p, uint64_t v)
+{
+    v = htole64(v);
+    memcpy(p, &v, sizeof(v));
+}
+
+bool c_cipher_mode_xts_sectors(const void* key, CipherBlocksFunc crypt, const void* tweakKey, CipherBlocksFunc tweakEncrypt, const uint8_t* input, uint8_t* output, size_t length, size_t sectorSize, uint64_t startSector)
+{
+    size_t i, j, n, nSectors, nTweaks, remain;
+    uint64_t lo, hi, carry;
+    uint8_t tweak[CIPHER_MODE_BATCH_BLOCKS * CIPHER_MODE_BLOCK_SIZE];
+    uint8_t tw[CIPHER_MODE_BATCH_BLOCKS * CIPHER_MODE_BLOCK_SIZE];
+    uint8_t buf[CIPHER_MODE_BATCH_BLOCKS * CIPHER_MODE_BLOCK_SIZE];
+
+    if (0 == sectorSize || 0 != sectorSize % CIPHER_MODE_BLOCK_SIZE || 0 != length % sectorSize) {
+        return false;
+    }
+
+    for (nSectors = length / sectorSize; nSectors > 0; nSectors -= nTweaks) {
+        // 一批扇区的初始调整值 T = E(K2, sector)
+        nTweaks = C_MIN(nSectors, CIPHER_MODE_BATCH_BLOCKS);
+        memset(tweak, 0, nTweaks * CIPHER_MODE_BLOCK_SIZE);
+        for (i = 0; i < nTweaks; i++) {
+            cipher_mode_store_le64(tweak + i * CIPHER_MODE_BLOCK_SIZE, startSector + i);
+        }
+        tweakEncrypt(tweakKey, tweak, tweak, nTweaks);
+
+        for (i = 0; i < nTweaks; i++) {
+            lo = cipher_mode_load_le64(tweak + i * CIPHER_MODE_BLOCK_SIZE);
+            hi = cipher_mode_load_le64(tweak + i * CIPHER_MODE_BLOCK_SIZE + 8);
+            for (remain = sectorSize / CIPHER_MODE_BLOCK_SIZE; remain > 0; remain -= n) {
+                n = C_MIN(remain, CIPHER_MODE_BATCH_BLOCKS);
+                for (j = 0; j < n; j++) {
+                    cipher_mode_store_le64(tw + j * CIPHER_MODE_BLOCK_SIZE, lo);
+                    cipher_mode_store_le64(tw + j * CIPHER_MODE_BLOCK_SIZE + 8, hi);
+                    // T = T·α, GF(2^128) 模 x^128 + x^7 + x^2 + x + 1, 小端
+                    carry = hi >> 63;
+                    hi = (hi << 1) | (lo >> 63);
+                    lo = (lo << 1) ^ (carry * 0x87);
+                }
+                c_cipher_mode_xor(buf, input, tw, n * CIPHER_MODE_BLOCK_SIZE);
+                crypt(key, buf, buf, n);
+                c_cipher_mode_xor(output, buf, tw, n * CIPHER_MODE_BLOCK_SIZE);
+                input += n * CIPHER_MODE_BLOCK_SIZE;
+                output += n * CIPHER_MODE_BLOCK_SIZE;
+            }
+        }
+        startSector += nTweaks;
+    }
+
+    memset(tweak, 0, sizeof(tweak));
+    memset(tw, 0, sizeof(tw));
+    memset(buf, 0, sizeof(buf));
+
+    return true;
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef purec_PUREC_CIPHER_MODE_H
+#define purec_PUREC_CIPHER_MODE_H
+#include "common.h"
+
+/**
+ * 与具体分组密码无关的工作模式实现(分组长度 16 字节, 适用于 AES/SM4)
+ * 各算法只需要提供一个批量 ECB 加密函数, 模式代码按批生成输入并调用它
+ */
+
+#define CIPHER_MODE_BLOCK_SIZE              16
+#define CIPHER_MODE_BATCH_BLOCKS            32      // 每批交给批量分组函数处理的分组数
+
+
+C_BEGIN_EXTERN_C
+
+/**
+ * @brief 批量 ECB 分组函数, input 与 output 可以相同
+ * @param key 算法相关的已扩展密钥(如 AesContext), 只读
+ */
+typedef void (*CipherBlocksFunc) (const void* key, const uint8_t* input, uint8_t* output, size_t nBlocks);
+
+/**
+ * CTR 模式状态: 计数器为 128 位大端整数(NIST SP 800-38A), 第 N 个分组使用 IV + N
+ */
+typedef struct
+{
+    uint8_t         iv[CIPHER_MODE_BLOCK_SIZE];         // 第 0 个分组的计数器
+    uint8_t         counter[CIPHER_MODE_BLOCK_SIZE];    // 下一个要使用的计数器
+    uint8_t         keyStream[CIPHER_MODE_BLOCK_SIZE];  // 上次调用剩余的部分分组密钥流
+    uint32_t        num;                                // keyStream 中已使用的字节数, 等于 16 表示没有剩余
+} CipherCtrContext;
+
+/**
+ * @brief out = a ^ b, 三者可以重叠为同一地址
+ */
+void c_cipher_mode_xor          (uint8_t* out, const uint8_t* a, const uint8_t* b, size_t len);
+
+/**
+ * @brief 计数器(128 位大端)加上 n
+ * @param counter
+ * @param n
+ */
+void c_cipher_mode_ctr_add      (uint8_t counter[CIPHER_MODE_BLOCK_SIZE], uint64_t n);
+
+/**
+ * @brief 初始化 CTR 状态, 从第 blockOffset 个分组开始
+ * @param ctx
+ * @param iv
+ * @param blockOffset
+ */
+void c_cipher_mode_ctr_init     (CipherCtrContext* ctx, const uint8_t iv[CIPHER_MODE_BLOCK_SIZE], uint64_t blockOffset);
+
+/**
+ * @brief 定位到数据流的任意字节位置, 之后的 update 从该位置开始加/解密
+ * @param ctx
+ * @param key
+ * @param encrypt
+ * @param byteOffset
+ */
+void c_cipher_mode_ctr_seek     (CipherCtrContext* ctx, const void* key, CipherBlocksFunc encrypt, uint64_t byteOffset);
+
+/**
+ * @brief CTR 加/解密(同一操作), 长度任意, 不足一个分组的密钥流保留到下次调用
+ * @param ctx
+ * @param key
+ * @param encrypt
+ * @param input
+ * @param output 可以与 input 相同
+ * @param length
+ */
+void c_cipher_mode_ctr_update   (CipherCtrContext* ctx, const void* key, CipherBlocksFunc encrypt, const uint8_t* input, uint8_t* output, size_t length);
+
+/**
+ * @brief XTS 模式(IEEE P1619)按扇区加/解密, 扇区号按 plain64 (64 位小端)作为调整值
+ * @param key 数据密钥
+ * @param crypt 数据密钥的批量加密或解密函数
+ * @param tweakKey 调整值密钥
+ * @param tweakEncrypt 调整值密钥的批量加密函数
+ * @param length 必须是 sectorSize 的整数倍
+ * @param sectorSize 数据单元长度(如 512/4096), 必须是 16 的整数倍
+ * @param startSector input 第一个扇区的扇区号
+ * @return 参数不合法返回 false
+ * @note 多个扇区的初始调整值一次批量加密, 扇区内的调整值逐个乘 α 递推
+ */
+bool c_cipher_mode_xts_sectors  (const void* key, CipherBlocksFunc crypt, const void* tweakKey, CipherBlocksFunc tweakEncrypt, const uint8_t* input, uint8_t* output, size_t length, size_t sectorSize, uint64_t startSector);
+
+C_END_EXTERN_C
+
+#endif // purec_PUREC_CIPHER_MODE_H
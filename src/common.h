@@ -149,6 +149,18 @@
 #ifndef C_ALIGN_TO
 #define C_ALIGN_TO(_v, _alignment)                  (((uint64_t)(_v) + ((_alignment)-1)) & ~(((uint64_t)(_alignment))-1))
 #endif
+
+#ifndef C_ALIGNED
+#define C_ALIGNED(_alignment)                       __attribute__((aligned(_alignment)))
+#endif
+
+#ifndef C_HIDDEN
+#define C_HIDDEN                                    __attribute__((visibility("hidden")))     // 库内部跨文件使用的符号, 不从动态库导出
+#endif
+
+#ifndef C_CACHE_LINE_SIZE
+#define C_CACHE_LINE_SIZE                           64
+#endif
 /* 常用宏函数 -- end   */
 
 #ifdef __KERNEL_MODULE__
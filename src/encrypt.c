@@ -21,72 +21,279 @@
  */
 #include "encrypt.h"
 
-#include "aes.h"
-#include "rc4.h"
-#include "sm4.h"
+#define AES_BULK_BLOCKS         32          // CBC 解密每批处理的分组数
+#define ENCRYPT_BLOCK_SIZE      16          // AES/SM4 分组长度
 
 
-void c_encrypt_encode_rc4(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen)
+static void encrypt_tail(uint8_t* buffer, uint64_t len)
 {
-    Rc4Context ctx;
-    c_rc4_setup(&ctx, key, keyLen);
-    c_rc4_crypt(&ctx, buffer, bufLen);
+    uint64_t i;
+
+    for (i = 0; i < len; i++) {
+        *buffer++ ^= (uint8_t) i;
+    }
 }
 
-void c_encrypt_decode_rc4(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen)
+/**
+ * 分组算法的整分组部分(AES-ECB / SM4), 其它算法返回 false
+ */
+static bool encrypt_blocks(const CEncryptContext* ctx, bool decrypt, const uint8_t* input, uint8_t* output, uint64_t nBlocks)
 {
-    Rc4Context ctx;
-    c_rc4_setup(&ctx, key, keyLen);
-    c_rc4_crypt(&ctx, buffer, bufLen);
+    switch (ctx->arith) {
+        case C_ENCRYPT_ARITH_AES_ECB: {
+            if (decrypt) {
+                c_aes_decrypt_blocks(&ctx->u.aes, input, output, nBlocks);
+            }
+            else {
+                c_aes_encrypt_blocks(&ctx->u.aes, input, output, nBlocks);
+            }
+            return true;
+        }
+        case C_ENCRYPT_ARITH_SM4: {
+            if (decrypt) {
+                c_sm4_decrypt_blocks(&ctx->u.sm4, input, output, nBlocks);
+            }
+            else {
+                c_sm4_encrypt_blocks(&ctx->u.sm4, input, output, nBlocks);
+            }
+            return true;
+        }
+        default: {
+            break;
+        }
+    }
+
+    return false;
 }
 
-void c_encrypt_encode_sm4(uint8_t* buffer, uint64_t bufLen, const uint8_t* key)
+bool c_encrypt_context_init(CEncryptContext* ctx, uint32_t arith, const uint8_t* key, uint64_t keyLen)
 {
-    uint64_t i = 0;
-    Sm4Context ctx;
-    c_sm4_setup(&ctx, key);
-    while (bufLen >= SM4_BLOCK_SIZE) {
-        c_sm4_encrypt_block(&ctx, buffer, buffer);
-        buffer += SM4_BLOCK_SIZE;
-        bufLen -= SM4_BLOCK_SIZE;
-    }
+    memset(ctx, 0, sizeof(CEncryptContext));
+    ctx->arith = arith;
 
-    for (i = 0; i < bufLen; i++) {
-        *buffer++ ^= i;
+    switch (arith) {
+        case C_ENCRYPT_ARITH_RC4:
+        case C_ENCRYPT_ARITH_EN_RC4: {
+            c_rc4_setup(&ctx->u.rc4, key, keyLen);
+            break;
+        }
+        case C_ENCRYPT_ARITH_AES_ECB: {
+            c_aes_setup_real(&ctx->u.aes, key, keyLen, NULL, ENC_MODE_ECB);
+            break;
+        }
+        case C_ENCRYPT_ARITH_SM4: {
+            c_sm4_setup(&ctx->u.sm4, key);
+            break;
+        }
+        default: {
+            ctx->arith = C_ENCRYPT_ARITH_NONE;
+            return false;
+        }
     }
+
+    return true;
 }
 
-void c_encrypt_decode_sm4(uint8_t* buffer, uint64_t bufLen, const uint8_t* key)
+static void encrypt_context_crypt(const CEncryptContext* ctx, bool decrypt, uint8_t* buffer, uint64_t bufLen)
 {
-    uint64_t i = 0;
-    Sm4Context ctx;
-    c_sm4_setup(&ctx, key);
-    while (bufLen >= SM4_BLOCK_SIZE) {
-        c_sm4_decrypt_block(&ctx, buffer, buffer);
-        buffer += SM4_BLOCK_SIZE;
-        bufLen -= SM4_BLOCK_SIZE;
+    Rc4Context rc4;
+    uint64_t nBlocks = bufLen / ENCRYPT_BLOCK_SIZE;
+
+    if (encrypt_blocks(ctx, decrypt, buffer, buffer, nBlocks)) {
+        encrypt_tail(buffer + nBlocks * ENCRYPT_BLOCK_SIZE, bufLen % ENCRYPT_BLOCK_SIZE);
+        return;
+    }
+
+    switch (ctx->arith) {
+        case C_ENCRYPT_ARITH_RC4: {
+            rc4 = ctx->u.rc4;
+            c_rc4_crypt(&rc4, buffer, bufLen);
+            break;
+        }
+        case C_ENCRYPT_ARITH_EN_RC4: {
+            rc4 = ctx->u.rc4;
+            if (decrypt) {
+                c_en_rc4_decrypt(&rc4, buffer, bufLen);
+            }
+            else {
+                c_en_rc4_encrypt(&rc4, buffer, bufLen);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
     }
-    for (i = 0; i < bufLen; i++) {
-        *buffer++ ^= i;
+}
+
+void c_encrypt_context_encrypt(const CEncryptContext* ctx, uint8_t* buffer, uint64_t bufLen)
+{
+    encrypt_context_crypt(ctx, false, buffer, bufLen);
+}
+
+void c_encrypt_context_decrypt(const CEncryptContext* ctx, uint8_t* buffer, uint64_t bufLen)
+{
+    encrypt_context_crypt(ctx, true, buffer, bufLen);
+}
+
+void c_encrypt_context_clear(CEncryptContext* ctx)
+{
+    memset(ctx, 0, sizeof(CEncryptContext));
+}
+
+void c_encrypt_stream_init(CEncryptStream* stream, const CEncryptContext* ctx, bool decrypt)
+{
+    memset(stream, 0, sizeof(CEncryptStream));
+    stream->key = ctx;
+    stream->rc4 = ctx->u.rc4;
+    stream->decrypt = decrypt;
+}
+
+uint64_t c_encrypt_stream_update(CEncryptStream* stream, const uint8_t* input, uint64_t inLen, uint8_t* output)
+{
+    uint64_t n, outLen = 0;
+
+    switch (stream->key->arith) {
+        case C_ENCRYPT_ARITH_AES_ECB:
+        case C_ENCRYPT_ARITH_SM4: {
+            // 先凑满上次剩下的分组
+            if (stream->bufLen > 0) {
+                n = C_MIN(inLen, ENCRYPT_BLOCK_SIZE - stream->bufLen);
+                memcpy(stream->buf + stream->bufLen, input, n);
+                stream->bufLen += (uint32_t) n;
+                input += n;
+                inLen -= n;
+                if (ENCRYPT_BLOCK_SIZE == stream->bufLen) {
+                    encrypt_blocks(stream->key, stream->decrypt, stream->buf, output, 1);
+                    stream->bufLen = 0;
+                    output += ENCRYPT_BLOCK_SIZE;
+                    outLen += ENCRYPT_BLOCK_SIZE;
+                }
+            }
+            n = inLen / ENCRYPT_BLOCK_SIZE;
+            encrypt_blocks(stream->key, stream->decrypt, input, output, n);
+            outLen += n * ENCRYPT_BLOCK_SIZE;
+            if (inLen % ENCRYPT_BLOCK_SIZE) {
+                memcpy(stream->buf, input + n * ENCRYPT_BLOCK_SIZE, inLen % ENCRYPT_BLOCK_SIZE);
+                stream->bufLen = (uint32_t) (inLen % ENCRYPT_BLOCK_SIZE);
+            }
+            break;
+        }
+        case C_ENCRYPT_ARITH_RC4: {
+            memcpy(output, input, inLen);
+            c_rc4_crypt(&stream->rc4, output, inLen);
+            outLen = inLen;
+            break;
+        }
+        case C_ENCRYPT_ARITH_EN_RC4: {
+            memcpy(output, input, inLen);
+            if (stream->decrypt) {
+                c_en_rc4_decrypt(&stream->rc4, output, inLen);
+            }
+            else {
+                c_en_rc4_encrypt(&stream->rc4, output, inLen);
+            }
+            outLen = inLen;
+            break;
+        }
+        default: {
+            // 未实现的算法与一次调用一样保持数据不变
+            memcpy(output, input, inLen);
+            outLen = inLen;
+            break;
+        }
     }
+
+    return outLen;
+}
+
+uint64_t c_encrypt_stream_final(CEncryptStream* stream, uint8_t* output)
+{
+    uint64_t outLen = stream->bufLen;
+
+    memcpy(output, stream->buf, outLen);
+    encrypt_tail(output, outLen);
+    memset(stream, 0, sizeof(CEncryptStream));
+
+    return outLen;
+}
+
+void c_encrypt_encode_rc4(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen)
+{
+    c_encrypt_encrypt_buffer(buffer, bufLen, key, keyLen, C_ENCRYPT_ARITH_RC4);
+}
+
+void c_encrypt_decode_rc4(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen)
+{
+    c_encrypt_decrypt_buffer(buffer, bufLen, key, keyLen, C_ENCRYPT_ARITH_RC4);
+}
+
+void c_encrypt_encode_sm4(uint8_t* buffer, uint64_t bufLen, const uint8_t* key)
+{
+    c_encrypt_encrypt_buffer(buffer, bufLen, key, SM4_BLOCK_SIZE, C_ENCRYPT_ARITH_SM4);
+}
+
+void c_encrypt_decode_sm4(uint8_t* buffer, uint64_t bufLen, const uint8_t* key)
+{
+    c_encrypt_decrypt_buffer(buffer, bufLen, key, SM4_BLOCK_SIZE, C_ENCRYPT_ARITH_SM4);
 }
 
 void c_encrypt_encode_aes_ecb(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen)
 {
-    c_encrypt_encode_aes_real(buffer, bufLen, key, keyLen, NULL, ENC_MODE_ECB);
+    c_encrypt_encrypt_buffer(buffer, bufLen, key, keyLen, C_ENCRYPT_ARITH_AES_ECB);
 }
 
 void c_encrypt_decode_aes_ecb(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen)
 {
-    c_encrypt_decode_aes_real(buffer, bufLen, key, keyLen, NULL, ENC_MODE_ECB);
+    c_encrypt_decrypt_buffer(buffer, bufLen, key, keyLen, C_ENCRYPT_ARITH_AES_ECB);
+}
+
+bool c_encrypt_encode_aes_ctr(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, const uint8_t* iv, uint64_t blockOffset)
+{
+    AesContext ctx;
+
+    // 不使用默认 IV: 同一密钥下所有消息会共用一条密钥流
+    if (!iv) {
+        return false;
+    }
+
+    c_aes_setup(&ctx, key, keyLen);
+    c_aes_encrypt_ctr(&ctx, iv, blockOffset, buffer, buffer, bufLen);
+
+    return true;
+}
+
+bool c_encrypt_decode_aes_ctr(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, const uint8_t* iv, uint64_t blockOffset)
+{
+    return c_encrypt_encode_aes_ctr(buffer, bufLen, key, keyLen, iv, blockOffset);
+}
+
+void c_encrypt_encode_aes_gcm(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, const uint8_t* iv, uint64_t ivLen, const uint8_t* aad, uint64_t aadLen, uint8_t* tag)
+{
+    AesContext ctx;
+    c_aes_setup(&ctx, key, keyLen);
+    c_aes_gcm_encrypt(&ctx, iv, ivLen, aad, aadLen, buffer, buffer, bufLen, tag, GCM_TAG_SIZE);
+}
+
+bool c_encrypt_decode_aes_gcm(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, const uint8_t* iv, uint64_t ivLen, const uint8_t* aad, uint64_t aadLen, const uint8_t* tag)
+{
+    AesContext ctx;
+    c_aes_setup(&ctx, key, keyLen);
+    return c_aes_gcm_decrypt(&ctx, iv, ivLen, aad, aadLen, buffer, buffer, bufLen, tag, GCM_TAG_SIZE);
 }
 
-void c_encrypt_encode_aes_real(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, uint8_t* iv, uint32_t mode)
+bool c_encrypt_encode_aes_real(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, uint8_t* iv, uint32_t mode)
 {
     AesContext ctx;
     uint32_t i, j, groups;
     uint32_t IV[AES_BLOCK_UINT_SIZE];
     uint32_t* inout;
+
+    // CTR 不能使用由密钥派生的默认 IV, 交给要求显式 IV 的接口处理
+    if (ENC_MODE_CTR == mode) {
+        return c_encrypt_encode_aes_ctr(buffer, bufLen, key, keyLen, iv, 0);
+    }
+
     c_aes_setup_real(&ctx, key, keyLen, iv, mode);
     groups = bufLen >> AES_BLOCK_SIZE_SHIFT;
     memcpy(IV, ctx.IV,AES_BLOCK_SIZE);
@@ -122,24 +329,28 @@ void c_encrypt_encode_aes_real(uint8_t* buffer, uint64_t bufLen, const uint8_t*
     }
     else {
         //ECB mode, not using the Chain
-        for (i = 0; i< groups; i++) {
-            {
-                c_aes_encrypt_block(&ctx,buffer,buffer);
-            }
-            buffer += AES_BLOCK_SIZE;
-        }
+        c_aes_encrypt_blocks(&ctx, buffer, buffer, groups);
+        buffer += (uint64_t) groups * AES_BLOCK_SIZE;
     }
     for (i = 0; i < (bufLen % AES_BLOCK_SIZE); i++) {
         *buffer++ ^= (uint8_t) i;
     }
+
+    return true;
 }
 
-void c_encrypt_decode_aes_real(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, uint8_t* iv, uint32_t mode)
+bool c_encrypt_decode_aes_real(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, uint8_t* iv, uint32_t mode)
 {
     AesContext ctx;
-    uint32_t i, j, groups;
-    uint32_t IV[AES_BLOCK_UINT_SIZE], block[AES_BLOCK_UINT_SIZE];
+    uint32_t i, j, n, groups;
+    uint32_t IV[AES_BLOCK_UINT_SIZE], block[AES_BULK_BLOCKS * AES_BLOCK_UINT_SIZE];
     uint32_t* inout;
+
+    // CTR 不能使用由密钥派生的默认 IV, 交给要求显式 IV 的接口处理
+    if (ENC_MODE_CTR == mode) {
+        return c_encrypt_decode_aes_ctr(buffer, bufLen, key, keyLen, iv, 0);
+    }
+
     c_aes_setup_real(&ctx, key, keyLen, iv, mode);
     groups = bufLen >> AES_BLOCK_SIZE_SHIFT;
     memcpy(IV, ctx.IV,AES_BLOCK_SIZE);
@@ -147,19 +358,21 @@ void c_encrypt_decode_aes_real(uint8_t* buffer, uint64_t bufLen, const uint8_t*
     inout = (uint32_t*) buffer;
 
     if (ENC_MODE_CBC == mode) {
-        for (i = 0; i < groups; i++) {
-            {
-                c_aes_decrypt_block(&ctx,(uint8_t*) inout,(uint8_t*) block);
-            }
-
+        // CBC 解密的各分组互不依赖: 先批量解密, 再与前一个密文分组异或
+        for (i = 0; i < groups; i += n) {
+            n = C_MIN(groups - i, AES_BULK_BLOCKS);
+            memcpy(block, buffer, n * AES_BLOCK_SIZE);
+            c_aes_decrypt_blocks(&ctx, (uint8_t*) block, buffer, n);
             for (j = 0; j < AES_BLOCK_UINT_SIZE; j++) {
-                block[j] ^=  IV[j];
+                inout[j] ^= IV[j];
             }
-            memcpy(IV, inout, AES_BLOCK_SIZE);
-            memcpy(inout, block, AES_BLOCK_SIZE);
-            inout += AES_BLOCK_UINT_SIZE;
+            for (j = AES_BLOCK_UINT_SIZE; j < n * AES_BLOCK_UINT_SIZE; j++) {
+                inout[j] ^= block[j - AES_BLOCK_UINT_SIZE];
+            }
+            memcpy(IV, block + (n - 1) * AES_BLOCK_UINT_SIZE, AES_BLOCK_SIZE);
+            buffer += n * AES_BLOCK_SIZE;
+            inout = (uint32_t*) buffer;
         }
-        buffer = (uint8_t*) inout;
     }
     else if (ENC_MODE_CFB ==  mode) {
         for (i = 0; i < groups; i++) {
@@ -176,79 +389,42 @@ void c_encrypt_decode_aes_real(uint8_t* buffer, uint64_t bufLen, const uint8_t*
     }
     else {
         //ECB mode, not using the Chain
-        for (i = 0; i< groups; i++) {
-            {
-                c_aes_decrypt_block(&ctx,buffer,buffer);
-            }
-            buffer += AES_BLOCK_SIZE;
-        }
+        c_aes_decrypt_blocks(&ctx, buffer, buffer, groups);
+        buffer += (uint64_t) groups * AES_BLOCK_SIZE;
     }
     for (i = 0; i < (bufLen % AES_BLOCK_SIZE); i++) {
         *buffer++ ^= (uint8_t) i;
     }
+
+    return true;
 }
 
 void c_encrypt_encode_en_rc4(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen)
 {
-    Rc4Context ctx;
-    c_rc4_setup(&ctx, key, keyLen);
-    c_en_rc4_encrypt(&ctx, buffer, bufLen);
+    c_encrypt_encrypt_buffer(buffer, bufLen, key, keyLen, C_ENCRYPT_ARITH_EN_RC4);
 }
 
 void c_encrypt_decode_en_rc4(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen)
 {
-    Rc4Context ctx;
-    c_rc4_setup(&ctx, key, keyLen);
-    c_en_rc4_decrypt(&ctx, buffer, bufLen);
+    c_encrypt_decrypt_buffer(buffer, bufLen, key, keyLen, C_ENCRYPT_ARITH_EN_RC4);
 }
 
 void c_encrypt_encrypt_buffer(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, uint32_t arith)
 {
-    switch(arith) {
-        case C_ENCRYPT_ARITH_RC4: {
-            c_encrypt_encode_rc4(buffer, bufLen, key, keyLen);
-            break;
-        }
-        case C_ENCRYPT_ARITH_EN_RC4: {
-            c_encrypt_encode_en_rc4(buffer, bufLen, key, keyLen);
-            break;
-        }
-        case C_ENCRYPT_ARITH_AES_ECB: {
-            c_encrypt_encode_aes_ecb(buffer, bufLen, key, keyLen);
-            break;
-        }
-        case C_ENCRYPT_ARITH_SM4: {
-            c_encrypt_encode_sm4 (buffer, bufLen, key);
-            break;
-        }
-        default: {
-            break;
-        }
+    CEncryptContext ctx;
+
+    if (c_encrypt_context_init(&ctx, arith, key, keyLen)) {
+        c_encrypt_context_encrypt(&ctx, buffer, bufLen);
+        c_encrypt_context_clear(&ctx);
     }
 }
 
 void c_encrypt_decrypt_buffer(uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, uint32_t arith)
 {
-    switch(arith) {
-        case C_ENCRYPT_ARITH_RC4: {
-            c_encrypt_decode_rc4(buffer, bufLen, key, keyLen);
-            break;
-        }
-        case C_ENCRYPT_ARITH_EN_RC4: {
-            c_encrypt_decode_en_rc4(buffer, bufLen, key, keyLen);
-            break;
-        }
-        case C_ENCRYPT_ARITH_AES_ECB: {
-            c_encrypt_decode_aes_ecb(buffer, bufLen, key, keyLen);
-            break;
-        }
-        case C_ENCRYPT_ARITH_SM4: {
-            c_encrypt_decode_sm4 (buffer, bufLen, key);
-            break;
-        }
-        default: {
-            break;
-        }
+    CEncryptContext ctx;
+
+    if (c_encrypt_context_init(&ctx, arith, key, keyLen)) {
+        c_encrypt_context_decrypt(&ctx, buffer, bufLen);
+        c_encrypt_context_clear(&ctx);
     }
 }
-
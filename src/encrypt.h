@@ -23,6 +23,10 @@
 #define purec_PUREC_ENCRYPT_H
 #include "common.h"
 
+#include "aes.h"
+#include "rc4.h"
+#include "sm4.h"
+
 // FIXME:// AES 算法还不完善
 
 /* 加解密算法 -- start */
@@ -44,6 +48,85 @@
 
 C_BEGIN_EXTERN_C
 
+/**
+ * 可复用的加解密上下文: 按 (算法, 密钥) 创建一次, 之后每次加解密不再做密钥扩展
+ * 初始化之后上下文只读, 多个线程可以同时使用同一个上下文
+ */
+typedef struct
+{
+    uint32_t                arith;
+    union
+    {
+        Rc4Context          rc4;        // KSA 之后的初始状态, 每次调用复制一份再使用
+        Sm4Context          sm4;
+        AesContext          aes;
+    } u;
+} CEncryptContext;
+
+/**
+ * 流式加解密: 数据可以按任意长度分多次送入, 输出与对整个缓冲区一次调用 c_encrypt_context_encrypt 完全相同
+ * 分组算法内部缓存不足一个分组的数据, 最后不足一个分组的尾部在 final 中处理
+ */
+typedef struct
+{
+    const CEncryptContext*  key;
+    Rc4Context              rc4;                // RC4 类算法的当前状态
+    uint8_t                 buf[16];            // 尚未凑满一个分组的数据
+    uint32_t                bufLen;
+    bool                    decrypt;
+} CEncryptStream;
+
+/**
+ * @brief 初始化加解密上下文
+ * @param ctx
+ * @param arith C_ENCRYPT_ARITH_*
+ * @param key
+ * @param keyLen
+ * @return 不支持的算法返回 false
+ */
+bool        c_encrypt_context_init           (CEncryptContext* ctx, uint32_t arith, const uint8_t* key, uint64_t keyLen);
+
+/**
+ * @brief 使用上下文加密/解密缓存区, 结果与 c_encrypt_encrypt_buffer/c_encrypt_decrypt_buffer 相同
+ * @param ctx 只读
+ * @param buffer
+ * @param bufLen
+ */
+void        c_encrypt_context_encrypt        (const CEncryptContext* ctx, uint8_t* buffer, uint64_t bufLen);
+void        c_encrypt_context_decrypt        (const CEncryptContext* ctx, uint8_t* buffer, uint64_t bufLen);
+
+/**
+ * @brief 清除上下文中的密钥材料
+ * @param ctx
+ */
+void        c_encrypt_context_clear          (CEncryptContext* ctx);
+
+/**
+ * @brief 开始一次流式加密或解密
+ * @param stream
+ * @param ctx 已初始化的上下文, 在流结束前必须保持有效
+ * @param decrypt true 表示解密
+ */
+void        c_encrypt_stream_init            (CEncryptStream* stream, const CEncryptContext* ctx, bool decrypt);
+
+/**
+ * @brief 送入任意长度的数据
+ * @param stream
+ * @param input
+ * @param inLen
+ * @param output 至少 inLen + 15 字节, 不能与 input 重叠
+ * @return 写入 output 的字节数
+ */
+uint64_t    c_encrypt_stream_update          (CEncryptStream* stream, const uint8_t* input, uint64_t inLen, uint8_t* output);
+
+/**
+ * @brief 结束流, 输出缓存的尾部数据并清除流状态
+ * @param stream
+ * @param output 至少 15 字节
+ * @return 写入 output 的字节数
+ */
+uint64_t    c_encrypt_stream_final           (CEncryptStream* stream, uint8_t* output);
+
 /**
  * @brief RC4 加密
  * @param buffer
@@ -79,6 +162,25 @@ void        c_encrypt_decode_sm4             (uint8_t* buffer, uint64_t bufLen,
 void        c_encrypt_encode_aes_ecb         (uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen);
 void        c_encrypt_decode_aes_ecb         (uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen);
 
+/**
+ * @brief AES-CTR 加/解密, buffer 是整个数据流中从第 blockOffset 个分组(16 字节)开始的一段
+ * @param iv 16 字节初始计数器, 必须提供且同一密钥下每条消息不同, 否则密钥流重复
+ * @return iv 为 NULL 时返回 false, buffer 不变
+ * @note 解密文件的某一段时只需传入该段对应的分组偏移; 多线程可按分组对齐切分缓冲区并行处理
+ */
+bool        c_encrypt_encode_aes_ctr         (uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, const uint8_t* iv, uint64_t blockOffset);
+bool        c_encrypt_decode_aes_ctr         (uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, const uint8_t* iv, uint64_t blockOffset);
+
+/**
+ * @brief AES-GCM 认证加密, 一遍完成加密与完整性校验(替代 AES + HMAC 两遍处理)
+ * @param iv 推荐 12 字节, 同一密钥下不能重复
+ * @param aad 只认证不加密的附加数据, 可以为 NULL
+ * @param tag 输出/输入 16 字节认证标签
+ * @return 解密时标签不一致返回 false, 此时 buffer 被清零
+ */
+void        c_encrypt_encode_aes_gcm         (uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, const uint8_t* iv, uint64_t ivLen, const uint8_t* aad, uint64_t aadLen, uint8_t* tag);
+bool        c_encrypt_decode_aes_gcm         (uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, const uint8_t* iv, uint64_t ivLen, const uint8_t* aad, uint64_t aadLen, const uint8_t* tag);
+
 /**
  * @brief 增强的 RC4 加密
  * @param buffer
@@ -117,8 +219,13 @@ void        c_encrypt_encrypt_buffer         (uint8_t* buffer, uint64_t bufLen,
  */
 void        c_encrypt_decrypt_buffer         (uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, uint32_t arith);
 
-void        c_encrypt_encode_aes_real        (uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, uint8_t* iv, uint32_t mode);
-void        c_encrypt_decode_aes_real        (uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, uint8_t* iv, uint32_t mode);
+/**
+ * @brief 按 ENC_MODE_* 加/解密
+ * @param iv 为 NULL 时 CBC/CFB 使用由密钥派生的默认 IV; CTR 必须提供 IV
+ * @return CTR 模式 iv 为 NULL 时返回 false, 缓冲区不变
+ */
+bool        c_encrypt_encode_aes_real        (uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, uint8_t* iv, uint32_t mode);
+bool        c_encrypt_decode_aes_real        (uint8_t* buffer, uint64_t bufLen, const uint8_t* key, uint64_t keyLen, uint8_t* iv, uint32_t mode);
 
 
 C_END_EXTERN_C
@@ -0,0 +1,488 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "gcm.h"
+
+#include "utils-sys.h"
+
+#ifdef C_SYS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+
+static uint32_t gcm_load_be32(const uint8_t* p)
+{
+    return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | (uint32_t) p[3];
+}
+
+static void gcm_store_be32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t) (v >> 24);
+    p[1] = (uint8_t) (v >> 16);
+    p[2] = (uint8_t) (v >> 8);
+    p[3] = (uint8_t) v;
+}
+
+static uint64_t gcm_load_be64(const uint8_t* p)
+{
+    uint64_t v;
+
+    memcpy(&v, p, sizeof(v));
+
+    return be64toh(v);
+}
+
+static void gcm_store_be64(uint8_t* p, uint64_t v)
+{
+    v = htobe64(v);
+    memcpy(p, &v, sizeof(v));
+}
+
+/**
+ * 4 位查表 GHASH (Shoup): hl/hh[i] 为 i * H, 每次处理 4 位, last4 为右移 4 位时的约减值
+ */
+static const uint64_t gsLast4[16] = {
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0,
+};
+
+static void gcm_table_init(GcmContext* ctx, const uint8_t h[GCM_BLOCK_SIZE])
+{
+    int i, j;
+    uint32_t t;
+    uint64_t vh, vl;
+
+    vh = gcm_load_be64(h);
+    vl = gcm_load_be64(h + 8);
+
+    ctx->hl[8] = vl;
+    ctx->hh[8] = vh;
+    ctx->hl[0] = 0;
+    ctx->hh[0] = 0;
+
+    for (i = 4; i > 0; i >>= 1) {
+        t = (uint32_t) (vl & 1) * 0xe1000000U;
+        vl = (vh << 63) | (vl >> 1);
+        vh = (vh >> 1) ^ ((uint64_t) t << 32);
+        ctx->hl[i] = vl;
+        ctx->hh[i] = vh;
+    }
+
+    for (i = 2; i <= 8; i *= 2) {
+        vh = ctx->hh[i];
+        vl = ctx->hl[i];
+        for (j = 1; j < i; j++) {
+            ctx->hh[i + j] = vh ^ ctx->hh[j];
+            ctx->hl[i + j] = vl ^ ctx->hl[j];
+        }
+    }
+}
+
+static void gcm_table_mult(const GcmContext* ctx, uint8_t x[GCM_BLOCK_SIZE])
+{
+    int i;
+    uint8_t lo, hi, rem;
+    uint64_t zh, zl;
+
+    lo = x[15] & 0xf;
+    zh = ctx->hh[lo];
+    zl = ctx->hl[lo];
+
+    for (i = 15; i >= 0; i--) {
+        lo = x[i] & 0xf;
+        hi = (x[i] >> 4) & 0xf;
+
+        if (i != 15) {
+            rem = (uint8_t) zl & 0xf;
+            zl = (zh << 60) | (zl >> 4);
+            zh = (zh >> 4) ^ (gsLast4[rem] << 48);
+            zh ^= ctx->hh[lo];
+            zl ^= ctx->hl[lo];
+        }
+
+        rem = (uint8_t) zl & 0xf;
+        zl = (zh << 60) | (zl >> 4);
+        zh = (zh >> 4) ^ (gsLast4[rem] << 48);
+        zh ^= ctx->hh[hi];
+        zl ^= ctx->hl[hi];
+    }
+
+    gcm_store_be64(x, zh);
+    gcm_store_be64(x + 8, zl);
+}
+
+static void gcm_table_ghash(GcmContext* ctx, const uint8_t* data, size_t nBlocks)
+{
+    for (; nBlocks > 0; nBlocks--) {
+        c_cipher_mode_xor(ctx->xi, ctx->xi, data, GCM_BLOCK_SIZE);
+        gcm_table_mult(ctx, ctx->xi);
+        data += GCM_BLOCK_SIZE;
+    }
+}
+
+#ifdef C_SYS_X86_SIMD
+/**
+ * PCLMULQDQ 实现(Intel 白皮书 "Carry-Less Multiplication and Its Usage for Computing the GCM Mode"):
+ * 数据按字节逆序后相乘, 乘积先不约减, 8 个分组
+ *   X = (X ^ C1)·H^8 ^ C2·H^7 ^ ... ^ C8·H
+ * 的 256 位乘积异或在一起后只做一次移位和约减
+ */
+C_SYS_TARGET("pclmul,ssse3")
+static void gcm_clmul_mul(__m128i a, __m128i b, __m128i* lo, __m128i* hi)
+{
+    __m128i t0, t1, t2;
+
+    t0 = _mm_clmulepi64_si128(a, b, 0x00);
+    t1 = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10), _mm_clmulepi64_si128(a, b, 0x01));
+    t2 = _mm_clmulepi64_si128(a, b, 0x11);
+    *lo = _mm_xor_si128(*lo, _mm_xor_si128(t0, _mm_slli_si128(t1, 8)));
+    *hi = _mm_xor_si128(*hi, _mm_xor_si128(t2, _mm_srli_si128(t1, 8)));
+}
+
+C_SYS_TARGET("pclmul,ssse3")
+static __m128i gcm_clmul_reduce(__m128i lo, __m128i hi)
+{
+    __m128i t2, t7, t8, t9;
+
+    // 比特逆序表示下的乘积需要整体左移 1 位
+    t7 = _mm_srli_epi32(lo, 31);
+    t8 = _mm_srli_epi32(hi, 31);
+    lo = _mm_slli_epi32(lo, 1);
+    hi = _mm_slli_epi32(hi, 1);
+    t9 = _mm_srli_si128(t7, 12);
+    t8 = _mm_slli_si128(t8, 4);
+    t7 = _mm_slli_si128(t7, 4);
+    lo = _mm_or_si128(lo, t7);
+    hi = _mm_or_si128(hi, t8);
+    hi = _mm_or_si128(hi, t9);
+
+    // 模 x^128 + x^7 + x^2 + x + 1 约减
+    t7 = _mm_slli_epi32(lo, 31);
+    t8 = _mm_slli_epi32(lo, 30);
+    t9 = _mm_slli_epi32(lo, 25);
+    t7 = _mm_xor_si128(t7, _mm_xor_si128(t8, t9));
+    t8 = _mm_srli_si128(t7, 4);
+    t7 = _mm_slli_si128(t7, 12);
+    lo = _mm_xor_si128(lo, t7);
+
+    t2 = _mm_srli_epi32(lo, 1);
+    t2 = _mm_xor_si128(t2, _mm_srli_epi32(lo, 2));
+    t2 = _mm_xor_si128(t2, _mm_srli_epi32(lo, 7));
+    t2 = _mm_xor_si128(t2, t8);
+    lo = _mm_xor_si128(lo, t2);
+
+    return _mm_xor_si128(hi, lo);
+}
+
+C_SYS_TARGET("pclmul,ssse3")
+static void gcm_clmul_init(GcmContext* ctx, const uint8_t h[GCM_BLOCK_SIZE])
+{
+    int i;
+    __m128i h1, hn, lo, hi;
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    h1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) h), bswap);
+    hn = h1;
+    _mm_storeu_si128((__m128i*) ctx->hPow[0], h1);
+    for (i = 1; i < GCM_H_POWERS; i++) {
+        lo = _mm_setzero_si128();
+        hi = _mm_setzero_si128();
+        gcm_clmul_mul(hn, h1, &lo, &hi);
+        hn = gcm_clmul_reduce(lo, hi);
+        _mm_storeu_si128((__m128i*) ctx->hPow[i], hn);
+    }
+}
+
+C_SYS_TARGET("pclmul,ssse3")
+static void gcm_clmul_ghash(GcmContext* ctx, const uint8_t* data, size_t nBlocks)
+{
+    int i;
+    __m128i x, d, lo, hi;
+    __m128i h[GCM_H_POWERS];
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    for (i = 0; i < GCM_H_POWERS; i++) {
+        h[i] = _mm_loadu_si128((const __m128i*) ctx->hPow[i]);
+    }
+    x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) ctx->xi), bswap);
+
+    for (; nBlocks >= GCM_H_POWERS; nBlocks -= GCM_H_POWERS) {
+        lo = _mm_setzero_si128();
+        hi = _mm_setzero_si128();
+        for (i = 0; i < GCM_H_POWERS; i++) {
+            d = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (data + i * GCM_BLOCK_SIZE)), bswap);
+            if (0 == i) {
+                d = _mm_xor_si128(d, x);
+            }
+            gcm_clmul_mul(d, h[GCM_H_POWERS - 1 - i], &lo, &hi);
+        }
+        x = gcm_clmul_reduce(lo, hi);
+        data += GCM_H_POWERS * GCM_BLOCK_SIZE;
+    }
+
+    for (; nBlocks > 0; nBlocks--) {
+        d = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) data), bswap);
+        lo = _mm_setzero_si128();
+        hi = _mm_setzero_si128();
+        gcm_clmul_mul(_mm_xor_si128(d, x), h[0], &lo, &hi);
+        x = gcm_clmul_reduce(lo, hi);
+        data += GCM_BLOCK_SIZE;
+    }
+
+    _mm_storeu_si128((__m128i*) ctx->xi, _mm_shuffle_epi8(x, bswap));
+}
+#endif
+
+static void gcm_ghash(GcmContext* ctx, const uint8_t* data, size_t nBlocks)
+{
+#ifdef C_SYS_X86_SIMD
+    if (ctx->hwGhash) {
+        gcm_clmul_ghash(ctx, data, nBlocks);
+        return;
+    }
+#endif
+    gcm_table_ghash(ctx, data, nBlocks);
+}
+
+static void gcm_inc32(uint8_t counter[GCM_BLOCK_SIZE])
+{
+    gcm_store_be32(counter + 12, gcm_load_be32(counter + 12) + 1);
+}
+
+/**
+ * AAD 结束: 不足一个分组的 AAD 补零后计入 GHASH
+ */
+static void gcm_start_text(GcmContext* ctx)
+{
+    uint32_t n;
+
+    if (ctx->inText) {
+        return;
+    }
+
+    n = (uint32_t) (ctx->aadLen % GCM_BLOCK_SIZE);
+    if (n) {
+        memset(ctx->buf + n, 0, GCM_BLOCK_SIZE - n);
+        gcm_ghash(ctx, ctx->buf, 1);
+    }
+    ctx->inText = 1;
+}
+
+static void gcm_crypt(GcmContext* ctx, const void* key, CipherBlocksFunc encrypt, const uint8_t* input, uint8_t* output, size_t length, bool decrypt)
+{
+    size_t i, n, nBlocks;
+    uint32_t ctr;
+    uint8_t c, o;
+    uint8_t ks[CIPHER_MODE_BATCH_BLOCKS * GCM_BLOCK_SIZE];
+
+    gcm_start_text(ctx);
+
+    // 上次剩余的部分分组: 密钥流与待 GHASH 的密文都按 textLen 对齐
+    n = (size_t) (ctx->textLen % GCM_BLOCK_SIZE);
+    ctx->textLen += length;
+    if (n) {
+        for (; n < GCM_BLOCK_SIZE && length > 0; n++, length--) {
+            c = *input++;
+            o = c ^ ctx->keyStream[n];
+            ctx->buf[n] = decrypt ? c : o;
+            *output++ = o;
+        }
+        if (GCM_BLOCK_SIZE == n) {
+            gcm_ghash(ctx, ctx->buf, 1);
+        }
+    }
+
+    while (length >= GCM_BLOCK_SIZE) {
+        nBlocks = C_MIN(length / GCM_BLOCK_SIZE, CIPHER_MODE_BATCH_BLOCKS);
+        ctr = gcm_load_be32(ctx->counter + 12);
+        for (i = 0; i < nBlocks; i++) {
+            memcpy(ks + i * GCM_BLOCK_SIZE, ctx->counter, 12);
+            gcm_store_be32(ks + i * GCM_BLOCK_SIZE + 12, ctr + (uint32_t) i);
+        }
+        gcm_store_be32(ctx->counter + 12, ctr + (uint32_t) nBlocks);
+        encrypt(key, ks, ks, nBlocks);
+
+        n = nBlocks * GCM_BLOCK_SIZE;
+        if (decrypt) {
+            gcm_ghash(ctx, input, nBlocks);
+        }
+        c_cipher_mode_xor(output, input, ks, n);
+        if (!decrypt) {
+            gcm_ghash(ctx, output, nBlocks);
+        }
+        input += n;
+        output += n;
+        length -= n;
+    }
+
+    if (length) {
+        encrypt(key, ctx->counter, ctx->keyStream, 1);
+        gcm_inc32(ctx->counter);
+        for (i = 0; i < length; i++) {
+            c = input[i];
+            o = c ^ ctx->keyStream[i];
+            ctx->buf[i] = decrypt ? c : o;
+            output[i] = o;
+        }
+    }
+
+    memset(ks, 0, sizeof(ks));
+}
+
+void c_gcm_init(GcmContext* ctx, const void* key, CipherBlocksFunc encrypt, const uint8_t* iv, size_t ivLen)
+{
+    size_t n;
+    uint8_t block[GCM_BLOCK_SIZE];
+
+    memset(ctx, 0, sizeof(GcmContext));
+
+    memset(block, 0, sizeof(block));
+    encrypt(key, block, block, 1);
+    gcm_table_init(ctx, block);
+#ifdef C_SYS_X86_SIMD
+    if (C_FLAG_ON(c_utils_sys_get_cpu_features(), C_SYS_CPU_PCLMUL) && C_FLAG_ON(c_utils_sys_get_cpu_features(), C_SYS_CPU_SSSE3)) {
+        gcm_clmul_init(ctx, block);
+        ctx->hwGhash = 1;
+    }
+#endif
+
+    // J0 = IV || 0^31 || 1, 或 GHASH(IV || 0 填充 || [len(IV)]64)
+    if (GCM_IV_SIZE == ivLen) {
+        memcpy(ctx->counter, iv, GCM_IV_SIZE);
+        ctx->counter[15] = 1;
+    }
+    else {
+        n = ivLen / GCM_BLOCK_SIZE;
+        gcm_ghash(ctx, iv, n);
+        if (ivLen % GCM_BLOCK_SIZE) {
+            memset(block, 0, sizeof(block));
+            memcpy(block, iv + n * GCM_BLOCK_SIZE, ivLen % GCM_BLOCK_SIZE);
+            gcm_ghash(ctx, block, 1);
+        }
+        memset(block, 0, sizeof(block));
+        gcm_store_be64(block + 8, (uint64_t) ivLen * 8);
+        gcm_ghash(ctx, block, 1);
+        memcpy(ctx->counter, ctx->xi, GCM_BLOCK_SIZE);
+        memset(ctx->xi, 0, GCM_BLOCK_SIZE);
+    }
+
+    encrypt(key, ctx->counter, ctx->ekj0, 1);
+    gcm_inc32(ctx->counter);
+    memset(block, 0, sizeof(block));
+}
+
+bool c_gcm_aad(GcmContext* ctx, const uint8_t* aad, size_t length)
+{
+    size_t n;
+
+    if (ctx->inText) {
+        return false;
+    }
+
+    n = (size_t) (ctx->aadLen % GCM_BLOCK_SIZE);
+    ctx->aadLen += length;
+    if (n) {
+        for (; n < GCM_BLOCK_SIZE && length > 0; n++, length--) {
+            ctx->buf[n] = *aad++;
+        }
+        if (GCM_BLOCK_SIZE == n) {
+            gcm_ghash(ctx, ctx->buf, 1);
+        }
+    }
+
+    n = length / GCM_BLOCK_SIZE;
+    gcm_ghash(ctx, aad, n);
+    aad += n * GCM_BLOCK_SIZE;
+    length -= n * GCM_BLOCK_SIZE;
+
+    memcpy(ctx->buf, aad, length);
+
+    return true;
+}
+
+bool c_gcm_encrypt_update(GcmContext* ctx, const void* key, CipherBlocksFunc encrypt, const uint8_t* input, uint8_t* output, size_t length)
+{
+    // 标签已经输出, 之后的数据不会被认证
+    if (ctx->finished) {
+        return false;
+    }
+    gcm_crypt(ctx, key, encrypt, input, output, length, false);
+
+    return true;
+}
+
+bool c_gcm_decrypt_update(GcmContext* ctx, const void* key, CipherBlocksFunc encrypt, const uint8_t* input, uint8_t* output, size_t length)
+{
+    if (ctx->finished) {
+        return false;
+    }
+    gcm_crypt(ctx, key, encrypt, input, output, length, true);
+
+    return true;
+}
+
+void c_gcm_final(GcmContext* ctx, uint8_t* tag, size_t tagLen)
+{
+    uint32_t n;
+    uint8_t block[GCM_BLOCK_SIZE];
+
+    // 长度分组只能计入 GHASH 一次, 再次调用(包括 final 之后的 verify)直接使用保存的标签
+    if (ctx->finished) {
+        memcpy(tag, ctx->tag, C_MIN(tagLen, GCM_TAG_SIZE));
+        return;
+    }
+
+    gcm_start_text(ctx);
+
+    n = (uint32_t) (ctx->textLen % GCM_BLOCK_SIZE);
+    if (n) {
+        memset(ctx->buf + n, 0, GCM_BLOCK_SIZE - n);
+        gcm_ghash(ctx, ctx->buf, 1);
+    }
+
+    gcm_store_be64(block, ctx->aadLen * 8);
+    gcm_store_be64(block + 8, ctx->textLen * 8);
+    gcm_ghash(ctx, block, 1);
+
+    c_cipher_mode_xor(ctx->tag, ctx->xi, ctx->ekj0, GCM_BLOCK_SIZE);
+    ctx->finished = 1;
+    memcpy(tag, ctx->tag, C_MIN(tagLen, GCM_TAG_SIZE));
+    memset(block, 0, sizeof(block));
+}
+
+bool c_gcm_verify(GcmContext* ctx, const uint8_t* tag, size_t tagLen)
+{
+    size_t i;
+    uint8_t diff = 0;
+    uint8_t expect[GCM_TAG_SIZE];
+
+    if (tagLen < GCM_TAG_MIN_SIZE || tagLen > GCM_TAG_SIZE) {
+        return false;
+    }
+
+    c_gcm_final(ctx, expect, GCM_TAG_SIZE);
+    for (i = 0; i < tagLen; i++) {
+        diff |= expect[i] ^ tag[i];
+    }
+    memset(expect, 0, sizeof(expect));
+
+    return 0 == diff;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef purec_PUREC_GCM_H
+#define purec_PUREC_GCM_H
+#include "common.h"
+#include "cipher-mode.h"
+
+/**
+ * GCM 认证加密(NIST SP 800-38D), 与具体分组密码无关, 分组长度 16 字节
+ * GHASH 在支持 PCLMULQDQ 的 CPU 上使用无进位乘法(8 个分组合并一次约减), 否则使用 4 位查表实现
+ */
+
+#define GCM_BLOCK_SIZE                      16
+#define GCM_TAG_SIZE                        16
+#define GCM_TAG_MIN_SIZE                    12      // 校验时接受的最短标签
+#define GCM_IV_SIZE                         12      // 推荐的 IV 长度
+#define GCM_H_POWERS                        8
+
+
+C_BEGIN_EXTERN_C
+
+typedef struct
+{
+    uint64_t                hl[16];                                 // 4 位查表: H 的倍数(低 64 位)
+    uint64_t                hh[16];                                 // 4 位查表: H 的倍数(高 64 位)
+    uint8_t                 hPow[GCM_H_POWERS][GCM_BLOCK_SIZE];     // PCLMULQDQ: H^1 .. H^8 (字节逆序)
+    uint8_t                 xi[GCM_BLOCK_SIZE];                     // GHASH 累加值
+    uint8_t                 ekj0[GCM_BLOCK_SIZE];                   // E(K, J0), 用于计算标签
+    uint8_t                 counter[GCM_BLOCK_SIZE];                // 下一个计数器(inc32)
+    uint8_t                 keyStream[GCM_BLOCK_SIZE];              // 不足一个分组的密钥流
+    uint8_t                 buf[GCM_BLOCK_SIZE];                    // 不足一个分组的 AAD/密文, 等待 GHASH
+    uint64_t                aadLen;
+    uint64_t                textLen;
+    uint8_t                 hwGhash;                                // 1: 使用 PCLMULQDQ
+    uint8_t                 tag[GCM_TAG_SIZE];                      // final 计算出的完整标签
+    uint8_t                 inText;                                 // 1: AAD 已结束
+    uint8_t                 finished;                               // 1: 已计算标签
+} GcmContext;
+
+/**
+ * @brief 初始化, 计算 H = E(K, 0) 和 J0
+ * @param ctx
+ * @param key 算法相关的已扩展密钥, 只读
+ * @param encrypt 批量 ECB 加密函数
+ * @param iv 推荐 12 字节, 其它长度按 SP 800-38D 用 GHASH 派生 J0
+ * @param ivLen
+ */
+void c_gcm_init             (GcmContext* ctx, const void* key, CipherBlocksFunc encrypt, const uint8_t* iv, size_t ivLen);
+
+/**
+ * @brief 附加认证数据, 必须在第一次 update 之前提供, 可多次调用
+ * @return 加/解密已经开始时返回 false, 这部分数据不会被认证
+ */
+bool c_gcm_aad              (GcmContext* ctx, const uint8_t* aad, size_t length);
+
+/**
+ * @brief 加/解密并同时计算 GHASH, 长度任意, output 可以与 input 相同
+ * @return final 之后调用返回 false, output 不被写入
+ */
+bool c_gcm_encrypt_update   (GcmContext* ctx, const void* key, CipherBlocksFunc encrypt, const uint8_t* input, uint8_t* output, size_t length);
+bool c_gcm_decrypt_update   (GcmContext* ctx, const void* key, CipherBlocksFunc encrypt, const uint8_t* input, uint8_t* output, size_t length);
+
+/**
+ * @brief 输出认证标签(tagLen <= 16), 重复调用返回同一标签; 之后不能再 update
+ */
+void c_gcm_final            (GcmContext* ctx, uint8_t* tag, size_t tagLen);
+
+/**
+ * @brief 计算标签并与 tag 做常数时间比较
+ * @param tagLen 12 到 16 字节, 更短的截断标签容易被穷举伪造, 一律拒绝
+ * @return 标签一致返回 true
+ */
+bool c_gcm_verify           (GcmContext* ctx, const uint8_t* tag, size_t tagLen);
+
+C_END_EXTERN_C
+
+#endif // purec_PUREC_GCM_H
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "hash-mb.h"
+
+#include "utils-sys.h"
+
+
+static void hash_mb_put32(uint8_t* p, uint32_t v, bool bigEndian)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        p[bigEndian ? 3 - i : i] = (uint8_t) (v >> (8 * i));
+    }
+}
+
+/**
+ * 通道的完整分组处理完后转到填充分组, 填充分组也处理完则任务完成
+ */
+static void hash_mb_lane_next(HashMbManager* mgr, uint32_t lane)
+{
+    uint32_t i;
+    HashMbJob* job = mgr->jobs[lane];
+
+    if (mgr->tailBlocks[lane] > 0) {
+        mgr->ptr[lane] = mgr->tail[lane];
+        mgr->blocks[lane] = mgr->tailBlocks[lane];
+        mgr->tailBlocks[lane] = 0;
+        return;
+    }
+
+    for (i = 0; i < mgr->algo->stateWords; i++) {
+        hash_mb_put32(job->dgst + i * 4, mgr->state[i][lane], mgr->algo->bigEndian);
+    }
+    mgr->done[mgr->nDone++] = job;
+    mgr->jobs[lane] = NULL;
+    mgr->nActive--;
+}
+
+/**
+ * 所有活动通道同时压缩到最短的一个处理完, 空闲通道重复计算某个活动通道的数据, 结果丢弃
+ */
+static void hash_mb_run(HashMbManager* mgr)
+{
+    uint32_t i, first = 0;
+    size_t n = SIZE_MAX;
+    const uint8_t* p[HASH_MB_MAX_LANES];
+
+    for (i = 0; i < mgr->lanes; i++) {
+        if (mgr->jobs[i]) {
+            n = C_MIN(n, mgr->blocks[i]);
+            first = i;
+        }
+    }
+    for (i = 0; i < mgr->lanes; i++) {
+        p[i] = mgr->jobs[i] ? mgr->ptr[i] : mgr->ptr[first];
+    }
+
+    mgr->algo->compress(mgr->state, mgr->lanes, p, n);
+
+    for (i = 0; i < mgr->lanes; i++) {
+        if (mgr->jobs[i]) {
+            mgr->ptr[i] += n * HASH_MB_BLOCK_SIZE;
+            mgr->blocks[i] -= n;
+            if (0 == mgr->blocks[i]) {
+                hash_mb_lane_next(mgr, i);
+            }
+        }
+    }
+}
+
+uint32_t c_hash_mb_lanes(void)
+{
+#ifdef C_SYS_X86_SIMD
+    uint32_t f = c_utils_sys_get_cpu_features();
+
+    if (C_FLAG_ON(f, C_SYS_CPU_AVX512F)) {
+        return 16;
+    }
+    if (C_FLAG_ON(f, C_SYS_CPU_AVX2)) {
+        return 8;
+    }
+    if (C_FLAG_ON(f, C_SYS_CPU_SSE2)) {
+        return 4;
+    }
+#endif
+
+    return 1;
+}
+
+void c_hash_mb_init(HashMbManager* mgr, const HashMbAlgo* algo)
+{
+    memset(mgr, 0, sizeof(*mgr));
+    mgr->algo = algo;
+    mgr->lanes = c_hash_mb_lanes();
+}
+
+HashMbJob* c_hash_mb_submit(HashMbManager* mgr, HashMbJob* job, const uint8_t* data, size_t dataLen, const uint32_t* iv, uint64_t prefixLen)
+{
+    uint32_t i, lane = 0;
+    size_t rem = dataLen % HASH_MB_BLOCK_SIZE;
+    size_t full = dataLen / HASH_MB_BLOCK_SIZE;
+    uint64_t bits = ((uint64_t) dataLen + prefixLen) << 3;
+    bool be = mgr->algo->bigEndian;
+    uint8_t* tail = NULL;
+
+    while (mgr->jobs[lane]) {
+        lane++;
+    }
+
+    for (i = 0; i < mgr->algo->stateWords; i++) {
+        mgr->state[i][lane] = iv[i];
+    }
+
+    // MD5 与 SM3 相同的填充, 剩余数据不足 56 字节时填充一个分组, 否则两个; 长度按算法的字节序写入
+    tail = mgr->tail[lane];
+    mgr->tailBlocks[lane] = (rem < HASH_MB_BLOCK_SIZE - 8) ? 1 : 2;
+    if (rem) {
+        memcpy(tail, data + full * HASH_MB_BLOCK_SIZE, rem);
+    }
+    tail[rem] = 0x80;
+    memset(tail + rem + 1, 0, mgr->tailBlocks[lane] * HASH_MB_BLOCK_SIZE - rem - 9);
+    tail += mgr->tailBlocks[lane] * HASH_MB_BLOCK_SIZE - 8;
+    hash_mb_put32(tail + (be ? 0 : 4), (uint32_t) (bits >> 32), be);
+    hash_mb_put32(tail + (be ? 4 : 0), (uint32_t) bits, be);
+
+    mgr->jobs[lane] = job;
+    mgr->ptr[lane] = data;
+    mgr->blocks[lane] = full;
+    mgr->nActive++;
+    if (0 == full) {
+        hash_mb_lane_next(mgr, lane);
+    }
+
+    // 保证下次提交时有空闲通道
+    while (mgr->nActive == mgr->lanes) {
+        hash_mb_run(mgr);
+    }
+
+    return mgr->nDone ? mgr->done[--mgr->nDone] : NULL;
+}
+
+HashMbJob* c_hash_mb_flush(HashMbManager* mgr)
+{
+    while (0 == mgr->nDone && mgr->nActive > 0) {
+        hash_mb_run(mgr);
+    }
+
+    return mgr->nDone ? mgr->done[--mgr->nDone] : NULL;
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef purec_PUREC_HASH_MB_H
+#define purec_PUREC_HASH_MB_H
+#include "common.h"
+
+/**
+ * 与具体摘要算法无关的多缓冲区调度(分组长度 64 字节, 64 位长度填充, 适用于 MD5/SM3)
+ * 各算法只需要提供一个按通道数分派的多路压缩函数, 通道分配、填充和任务完成都在这里处理
+ */
+
+#define HASH_MB_BLOCK_SIZE                  64
+#define HASH_MB_MAX_LANES                   16
+#define HASH_MB_MAX_STATE_WORDS             8
+
+
+C_BEGIN_EXTERN_C
+
+/**
+ * 多缓冲区计算的一个任务: 计算 data 的摘要写入 dgst
+ */
+typedef struct
+{
+    const uint8_t*  data;
+    size_t          dataLen;
+    uint8_t*        dgst;           // 算法的摘要长度
+    void*           userData;       // 调用者自用, 不会被修改
+} HashMbJob;
+
+/**
+ * @brief 多路压缩函数: 第 l 个通道从 p[l] 开始压缩 blocks 个分组
+ * @param state 按字交错存放各通道的链接值(state[字][通道])
+ * @param lanes 通道数, 为 1 时只处理第 0 个通道
+ */
+typedef void (*HashMbCompressFunc) (uint32_t state[][HASH_MB_MAX_LANES], uint32_t lanes, const uint8_t* const p[], size_t blocks);
+
+/**
+ * 算法描述: 压缩函数, 链接值的字数, 以及摘要和填充中的长度是否为大端
+ */
+typedef struct
+{
+    HashMbCompressFunc  compress;
+    uint32_t            stateWords;
+    bool                bigEndian;
+} HashMbAlgo;
+
+/**
+ * 多缓冲区管理器: 把互不相关的消息分配到 SIMD 通道(SSE2 4 路, AVX2 8 路, AVX-512 16 路)同时压缩
+ */
+typedef struct
+{
+    uint32_t            state[HASH_MB_MAX_STATE_WORDS][HASH_MB_MAX_LANES] C_ALIGNED(64);
+    HashMbJob*          jobs[HASH_MB_MAX_LANES];
+    const uint8_t*      ptr[HASH_MB_MAX_LANES];
+    size_t              blocks[HASH_MB_MAX_LANES];
+    size_t              tailBlocks[HASH_MB_MAX_LANES];
+    uint8_t             tail[HASH_MB_MAX_LANES][2 * HASH_MB_BLOCK_SIZE];      // 最后不足一个分组的数据及填充
+    HashMbJob*          done[HASH_MB_MAX_LANES];
+    uint32_t            nDone;
+    uint32_t            nActive;
+    uint32_t            lanes;
+    const HashMbAlgo*   algo;
+} HashMbManager;
+
+/**
+ * @brief 当前 CPU 上多缓冲区实现的通道数(16/8/4, 没有 SIMD 时为 1)
+ */
+uint32_t    c_hash_mb_lanes     (void);
+
+/**
+ * @brief 初始化管理器, 通道数由 c_hash_mb_lanes 决定
+ */
+void        c_hash_mb_init      (HashMbManager* mgr, const HashMbAlgo* algo);
+
+/**
+ * @brief 从链接值 iv 开始计算 data 的摘要, 写入 job->dgst
+ * @param prefixLen iv 之前已经压缩的字节数(如 HMAC 的 ipad/opad 分组), 计入填充中的总长度
+ * @return 已完成的任务(不一定是刚提交的), 没有则返回 NULL
+ * @note data 中不足一个分组的部分在提交时就复制到通道的填充缓冲区
+ */
+HashMbJob*  c_hash_mb_submit    (HashMbManager* mgr, HashMbJob* job, const uint8_t* data, size_t dataLen, const uint32_t* iv, uint64_t prefixLen);
+
+/**
+ * @brief 不再提交新任务时调用, 压缩剩余通道直到有任务完成
+ * @return 已完成的任务, 所有任务都已返回时为 NULL
+ */
+HashMbJob*  c_hash_mb_flush     (HashMbManager* mgr);
+
+C_END_EXTERN_C
+
+#endif // purec_PUREC_HASH_MB_H
@@ -21,6 +21,23 @@
  */
 #include "md5.h"
 
+#include "utils-str.h"
+#include "utils-sys.h"
+
+#ifdef C_SYS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#ifndef __KERNEL_MODULE__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// c_md5_file 每次映射的窗口大小, 是页大小和分组长度的整数倍
+#define MD5_FILE_WINDOW         (64 << 20)
+
 
 
 #define GET_UINT32(n,b,i)                       \
@@ -173,8 +190,7 @@ void c_md5_process(Md5Context* ctx, const uint8_t data[64])
 
 void c_md5_starts(Md5Context* ctx)
 {
-    ctx->total[0] = 0;
-    ctx->total[1] = 0;
+    ctx->total = 0;
 
     ctx->state[0] = 0x67452301;
     ctx->state[1] = 0xEFCDAB89;
@@ -182,7 +198,7 @@ void c_md5_starts(Md5Context* ctx)
     ctx->state[3] = 0x10325476;
 }
 
-void c_md5_update(Md5Context* ctx, const uint8_t* input, uint32_t len)
+void c_md5_update(Md5Context* ctx, const uint8_t* input, uint64_t len)
 {
     uint32_t left, fill;
 
@@ -190,15 +206,10 @@ void c_md5_update(Md5Context* ctx, const uint8_t* input, uint32_t len)
         return;
     }
 
-    left = ctx->total[0] & 0x3F;
+    left = (uint32_t) (ctx->total & 0x3F);
     fill = 64 - left;
 
-    ctx->total[0] += len;
-    ctx->total[0] &= 0xFFFFFFFF;
-
-    if (ctx->total[0] < len) {
-        ctx->total[1]++;
-    }
+    ctx->total += len;
 
     if (left && len >= fill) {
         memcpy((ctx->buffer + left), input, fill);
@@ -208,6 +219,7 @@ void c_md5_update(Md5Context* ctx, const uint8_t* input, uint32_t len)
         left = 0;
     }
 
+    // 完整的分组直接从输入处理
     while (len >= 64) {
         c_md5_process(ctx, input);
         len -= 64;
@@ -215,7 +227,7 @@ void c_md5_update(Md5Context* ctx, const uint8_t* input, uint32_t len)
     }
 
     if (len) {
-        memcpy((ctx->buffer + left), input, len);
+        memcpy((ctx->buffer + left), input, (size_t) len);
     }
 }
 
@@ -225,13 +237,13 @@ void c_md5_finish(Md5Context* ctx, uint8_t digest[16])
     uint32_t high, low;
     uint8_t msgLen[8] = {0};
 
-    high = (ctx->total[0] >> 29) | (ctx->total[1] << 3);
-    low  = (ctx->total[0] <<  3);
+    high = (uint32_t) (ctx->total >> 29);
+    low  = (uint32_t) (ctx->total <<  3);
 
     PUT_UINT32(low,  msgLen, 0);
     PUT_UINT32(high, msgLen, 4);
 
-    last = ctx->total[0] & 0x3F;
+    last = (uint32_t) (ctx->total & 0x3F);
     padN = (last < 56) ? (56 - last) : (120 - last);
 
     c_md5_update(ctx, gsMd5Padding, padN);
@@ -243,18 +255,244 @@ void c_md5_finish(Md5Context* ctx, uint8_t digest[16])
     PUT_UINT32(ctx->state[3], digest, 12);
 }
 
-void c_md5_result_to_str(const uint8_t val[16], uint8_t str[32])
+#ifdef C_SYS_X86_SIMD
+/**
+ * 多缓冲区 MD5: 每个通道处理一条独立的消息, 链接值按字交错存放(state[字][通道]),
+ * 消息分组先转置为 M[字][通道] 再载入向量; 轮函数与 c_md5_process 相同
+ */
+#define MD5_MB_STEP(F, a, b, c, d, k, s, t) \
+    a = MD5_MB_ADD(b, MD5_MB_ROL(MD5_MB_ADD(MD5_MB_ADD(a, F(b, c, d)), MD5_MB_ADD(X[k], MD5_MB_SET1(t))), s))
+
+#define MD5_MB_ROUNDS() \
+    MD5_MB_STEP(MD5_MB_F1, A, B, C, D,  0,  7, 0xD76AA478); \
+    MD5_MB_STEP(MD5_MB_F1, D, A, B, C,  1, 12, 0xE8C7B756); \
+    MD5_MB_STEP(MD5_MB_F1, C, D, A, B,  2, 17, 0x242070DB); \
+    MD5_MB_STEP(MD5_MB_F1, B, C, D, A,  3, 22, 0xC1BDCEEE); \
+    MD5_MB_STEP(MD5_MB_F1, A, B, C, D,  4,  7, 0xF57C0FAF); \
+    MD5_MB_STEP(MD5_MB_F1, D, A, B, C,  5, 12, 0x4787C62A); \
+    MD5_MB_STEP(MD5_MB_F1, C, D, A, B,  6, 17, 0xA8304613); \
+    MD5_MB_STEP(MD5_MB_F1, B, C, D, A,  7, 22, 0xFD469501); \
+    MD5_MB_STEP(MD5_MB_F1, A, B, C, D,  8,  7, 0x698098D8); \
+    MD5_MB_STEP(MD5_MB_F1, D, A, B, C,  9, 12, 0x8B44F7AF); \
+    MD5_MB_STEP(MD5_MB_F1, C, D, A, B, 10, 17, 0xFFFF5BB1); \
+    MD5_MB_STEP(MD5_MB_F1, B, C, D, A, 11, 22, 0x895CD7BE); \
+    MD5_MB_STEP(MD5_MB_F1, A, B, C, D, 12,  7, 0x6B901122); \
+    MD5_MB_STEP(MD5_MB_F1, D, A, B, C, 13, 12, 0xFD987193); \
+    MD5_MB_STEP(MD5_MB_F1, C, D, A, B, 14, 17, 0xA679438E); \
+    MD5_MB_STEP(MD5_MB_F1, B, C, D, A, 15, 22, 0x49B40821); \
+    MD5_MB_STEP(MD5_MB_F2, A, B, C, D,  1,  5, 0xF61E2562); \
+    MD5_MB_STEP(MD5_MB_F2, D, A, B, C,  6,  9, 0xC040B340); \
+    MD5_MB_STEP(MD5_MB_F2, C, D, A, B, 11, 14, 0x265E5A51); \
+    MD5_MB_STEP(MD5_MB_F2, B, C, D, A,  0, 20, 0xE9B6C7AA); \
+    MD5_MB_STEP(MD5_MB_F2, A, B, C, D,  5,  5, 0xD62F105D); \
+    MD5_MB_STEP(MD5_MB_F2, D, A, B, C, 10,  9, 0x02441453); \
+    MD5_MB_STEP(MD5_MB_F2, C, D, A, B, 15, 14, 0xD8A1E681); \
+    MD5_MB_STEP(MD5_MB_F2, B, C, D, A,  4, 20, 0xE7D3FBC8); \
+    MD5_MB_STEP(MD5_MB_F2, A, B, C, D,  9,  5, 0x21E1CDE6); \
+    MD5_MB_STEP(MD5_MB_F2, D, A, B, C, 14,  9, 0xC33707D6); \
+    MD5_MB_STEP(MD5_MB_F2, C, D, A, B,  3, 14, 0xF4D50D87); \
+    MD5_MB_STEP(MD5_MB_F2, B, C, D, A,  8, 20, 0x455A14ED); \
+    MD5_MB_STEP(MD5_MB_F2, A, B, C, D, 13,  5, 0xA9E3E905); \
+    MD5_MB_STEP(MD5_MB_F2, D, A, B, C,  2,  9, 0xFCEFA3F8); \
+    MD5_MB_STEP(MD5_MB_F2, C, D, A, B,  7, 14, 0x676F02D9); \
+    MD5_MB_STEP(MD5_MB_F2, B, C, D, A, 12, 20, 0x8D2A4C8A); \
+    MD5_MB_STEP(MD5_MB_F3, A, B, C, D,  5,  4, 0xFFFA3942); \
+    MD5_MB_STEP(MD5_MB_F3, D, A, B, C,  8, 11, 0x8771F681); \
+    MD5_MB_STEP(MD5_MB_F3, C, D, A, B, 11, 16, 0x6D9D6122); \
+    MD5_MB_STEP(MD5_MB_F3, B, C, D, A, 14, 23, 0xFDE5380C); \
+    MD5_MB_STEP(MD5_MB_F3, A, B, C, D,  1,  4, 0xA4BEEA44); \
+    MD5_MB_STEP(MD5_MB_F3, D, A, B, C,  4, 11, 0x4BDECFA9); \
+    MD5_MB_STEP(MD5_MB_F3, C, D, A, B,  7, 16, 0xF6BB4B60); \
+    MD5_MB_STEP(MD5_MB_F3, B, C, D, A, 10, 23, 0xBEBFBC70); \
+    MD5_MB_STEP(MD5_MB_F3, A, B, C, D, 13,  4, 0x289B7EC6); \
+    MD5_MB_STEP(MD5_MB_F3, D, A, B, C,  0, 11, 0xEAA127FA); \
+    MD5_MB_STEP(MD5_MB_F3, C, D, A, B,  3, 16, 0xD4EF3085); \
+    MD5_MB_STEP(MD5_MB_F3, B, C, D, A,  6, 23, 0x04881D05); \
+    MD5_MB_STEP(MD5_MB_F3, A, B, C, D,  9,  4, 0xD9D4D039); \
+    MD5_MB_STEP(MD5_MB_F3, D, A, B, C, 12, 11, 0xE6DB99E5); \
+    MD5_MB_STEP(MD5_MB_F3, C, D, A, B, 15, 16, 0x1FA27CF8); \
+    MD5_MB_STEP(MD5_MB_F3, B, C, D, A,  2, 23, 0xC4AC5665); \
+    MD5_MB_STEP(MD5_MB_F4, A, B, C, D,  0,  6, 0xF4292244); \
+    MD5_MB_STEP(MD5_MB_F4, D, A, B, C,  7, 10, 0x432AFF97); \
+    MD5_MB_STEP(MD5_MB_F4, C, D, A, B, 14, 15, 0xAB9423A7); \
+    MD5_MB_STEP(MD5_MB_F4, B, C, D, A,  5, 21, 0xFC93A039); \
+    MD5_MB_STEP(MD5_MB_F4, A, B, C, D, 12,  6, 0x655B59C3); \
+    MD5_MB_STEP(MD5_MB_F4, D, A, B, C,  3, 10, 0x8F0CCC92); \
+    MD5_MB_STEP(MD5_MB_F4, C, D, A, B, 10, 15, 0xFFEFF47D); \
+    MD5_MB_STEP(MD5_MB_F4, B, C, D, A,  1, 21, 0x85845DD1); \
+    MD5_MB_STEP(MD5_MB_F4, A, B, C, D,  8,  6, 0x6FA87E4F); \
+    MD5_MB_STEP(MD5_MB_F4, D, A, B, C, 15, 10, 0xFE2CE6E0); \
+    MD5_MB_STEP(MD5_MB_F4, C, D, A, B,  6, 15, 0xA3014314); \
+    MD5_MB_STEP(MD5_MB_F4, B, C, D, A, 13, 21, 0x4E0811A1); \
+    MD5_MB_STEP(MD5_MB_F4, A, B, C, D,  4,  6, 0xF7537E82); \
+    MD5_MB_STEP(MD5_MB_F4, D, A, B, C, 11, 10, 0xBD3AF235); \
+    MD5_MB_STEP(MD5_MB_F4, C, D, A, B,  2, 15, 0x2AD7D2BB); \
+    MD5_MB_STEP(MD5_MB_F4, B, C, D, A,  9, 21, 0xEB86D391)
+
+#define MD5_MB_DEFINE(name, isa, V, LANES) \
+C_SYS_TARGET(isa) \
+static void name(uint32_t st[4][C_MD5_MB_MAX_LANES], const uint8_t* const p[], size_t blocks) \
+{ \
+    int i, l; \
+    size_t n; \
+    V A, B, C, D; \
+    V X[16]; \
+    uint32_t M[16][C_MD5_MB_MAX_LANES] C_ALIGNED(64); \
+    for (n = 0; n < blocks; n++) { \
+        for (i = 0; i < 16; i++) { \
+            for (l = 0; l < (LANES); l++) { \
+                GET_UINT32(M[i][l], p[l] + n * 64, 4 * i); \
+            } \
+            X[i] = MD5_MB_LOAD(M[i]); \
+        } \
+        A = MD5_MB_LOAD(st[0]); B = MD5_MB_LOAD(st[1]); C = MD5_MB_LOAD(st[2]); D = MD5_MB_LOAD(st[3]); \
+        MD5_MB_ROUNDS(); \
+        MD5_MB_STORE(st[0], MD5_MB_ADD(A, MD5_MB_LOAD(st[0]))); \
+        MD5_MB_STORE(st[1], MD5_MB_ADD(B, MD5_MB_LOAD(st[1]))); \
+        MD5_MB_STORE(st[2], MD5_MB_ADD(C, MD5_MB_LOAD(st[2]))); \
+        MD5_MB_STORE(st[3], MD5_MB_ADD(D, MD5_MB_LOAD(st[3]))); \
+    } \
+}
+
+// SSE2: 4 路
+#define MD5_MB_LOAD(m)          _mm_load_si128((const __m128i*) (m))
+#define MD5_MB_STORE(m, x)      _mm_store_si128((__m128i*) (m), x)
+#define MD5_MB_SET1(k)          _mm_set1_epi32((int) (k))
+#define MD5_MB_ADD(a, b)        _mm_add_epi32(a, b)
+#define MD5_MB_ROL(x, n)        _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - (n)))
+#define MD5_MB_F1(x, y, z)      _mm_xor_si128(z, _mm_and_si128(x, _mm_xor_si128(y, z)))
+#define MD5_MB_F2(x, y, z)      _mm_xor_si128(y, _mm_and_si128(z, _mm_xor_si128(x, y)))
+#define MD5_MB_F3(x, y, z)      _mm_xor_si128(_mm_xor_si128(x, y), z)
+#define MD5_MB_F4(x, y, z)      _mm_xor_si128(y, _mm_or_si128(x, _mm_xor_si128(z, _mm_set1_epi32(-1))))
+MD5_MB_DEFINE(md5_mb_compress_sse2, "sse2", __m128i, 4)
+#undef MD5_MB_LOAD
+#undef MD5_MB_STORE
+#undef MD5_MB_SET1
+#undef MD5_MB_ADD
+#undef MD5_MB_ROL
+#undef MD5_MB_F1
+#undef MD5_MB_F2
+#undef MD5_MB_F3
+#undef MD5_MB_F4
+
+// AVX2: 8 路
+#define MD5_MB_LOAD(m)          _mm256_load_si256((const __m256i*) (m))
+#define MD5_MB_STORE(m, x)      _mm256_store_si256((__m256i*) (m), x)
+#define MD5_MB_SET1(k)          _mm256_set1_epi32((int) (k))
+#define MD5_MB_ADD(a, b)        _mm256_add_epi32(a, b)
+#define MD5_MB_ROL(x, n)        _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - (n)))
+#define MD5_MB_F1(x, y, z)      _mm256_xor_si256(z, _mm256_and_si256(x, _mm256_xor_si256(y, z)))
+#define MD5_MB_F2(x, y, z)      _mm256_xor_si256(y, _mm256_and_si256(z, _mm256_xor_si256(x, y)))
+#define MD5_MB_F3(x, y, z)      _mm256_xor_si256(_mm256_xor_si256(x, y), z)
+#define MD5_MB_F4(x, y, z)      _mm256_xor_si256(y, _mm256_or_si256(x, _mm256_xor_si256(z, _mm256_set1_epi32(-1))))
+MD5_MB_DEFINE(md5_mb_compress_avx2, "avx2", __m256i, 8)
+#undef MD5_MB_LOAD
+#undef MD5_MB_STORE
+#undef MD5_MB_SET1
+#undef MD5_MB_ADD
+#undef MD5_MB_ROL
+#undef MD5_MB_F1
+#undef MD5_MB_F2
+#undef MD5_MB_F3
+#undef MD5_MB_F4
+
+// AVX-512: 16 路, 轮函数用 vpternlogd
+#define MD5_MB_LOAD(m)          _mm512_load_si512((const void*) (m))
+#define MD5_MB_STORE(m, x)      _mm512_store_si512((void*) (m), x)
+#define MD5_MB_SET1(k)          _mm512_set1_epi32((int) (k))
+#define MD5_MB_ADD(a, b)        _mm512_add_epi32(a, b)
+#define MD5_MB_ROL(x, n)        _mm512_rol_epi32(x, n)
+#define MD5_MB_F1(x, y, z)      _mm512_ternarylogic_epi32(x, y, z, 0xca)
+#define MD5_MB_F2(x, y, z)      _mm512_ternarylogic_epi32(x, y, z, 0xe4)
+#define MD5_MB_F3(x, y, z)      _mm512_ternarylogic_epi32(x, y, z, 0x96)
+#define MD5_MB_F4(x, y, z)      _mm512_ternarylogic_epi32(x, y, z, 0x39)
+MD5_MB_DEFINE(md5_mb_compress_avx512, "avx512f", __m512i, 16)
+#undef MD5_MB_LOAD
+#undef MD5_MB_STORE
+#undef MD5_MB_SET1
+#undef MD5_MB_ADD
+#undef MD5_MB_ROL
+#undef MD5_MB_F1
+#undef MD5_MB_F2
+#undef MD5_MB_F3
+#undef MD5_MB_F4
+#endif
+
+static void md5_mb_compress(uint32_t state[][HASH_MB_MAX_LANES], uint32_t lanes, const uint8_t* const p[], size_t blocks)
+{
+    int i;
+    size_t n;
+    Md5Context ctx;
+
+#ifdef C_SYS_X86_SIMD
+    switch (lanes) {
+        case 16: {
+            md5_mb_compress_avx512(state, p, blocks);
+            return;
+        }
+        case 8: {
+            md5_mb_compress_avx2(state, p, blocks);
+            return;
+        }
+        case 4: {
+            md5_mb_compress_sse2(state, p, blocks);
+            return;
+        }
+        default: {
+            break;
+        }
+    }
+#endif
+
+    // 单通道
+    for (i = 0; i < 4; i++) {
+        ctx.state[i] = state[i][0];
+    }
+    for (n = 0; n < blocks; n++) {
+        c_md5_process(&ctx, p[0] + n * 64);
+    }
+    for (i = 0; i < 4; i++) {
+        state[i][0] = ctx.state[i];
+    }
+}
+
+static const HashMbAlgo gsMd5MbAlgo = { md5_mb_compress, 4, false };
+static const uint32_t gsMd5IV[4] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476 };
+
+void c_md5_mb_init(Md5MbManager* mgr)
+{
+    c_hash_mb_init(mgr, &gsMd5MbAlgo);
+}
+
+Md5Job* c_md5_mb_submit(Md5MbManager* mgr, Md5Job* job)
+{
+    return c_hash_mb_submit(mgr, job, job->data, job->dataLen, gsMd5IV, 0);
+}
+
+Md5Job* c_md5_mb_flush(Md5MbManager* mgr)
+{
+    return c_hash_mb_flush(mgr);
+}
+
+void c_md5_digest_batch(Md5Job* jobs, size_t count)
 {
-    int i = 0;
-    char name[64] = {0};
-    for (i = 0; i < 16; i++) {
-        sprintf(name + 2 * i, (char*)"%02x", val[i]);
+    size_t i;
+    Md5MbManager mgr;
+
+    c_md5_mb_init(&mgr);
+    for (i = 0; i < count; i++) {
+        c_md5_mb_submit(&mgr, &jobs[i]);
+    }
+    while (c_md5_mb_flush(&mgr)) {
     }
+}
 
-    memcpy(str, name, 32);
+void c_md5_result_to_str(const uint8_t val[16], uint8_t str[32])
+{
+    c_utils_str_hex_encode((char*) str, val, 16);
 }
 
-void c_md5_get_result(const uint8_t* buffer, uint32_t length, uint8_t md5Val[16])
+void c_md5_get_result(const uint8_t* buffer, uint64_t length, uint8_t md5Val[16])
 {
     Md5Context ctx;
     c_md5_starts(&ctx);
@@ -262,9 +500,72 @@ void c_md5_get_result(const uint8_t* buffer, uint32_t length, uint8_t md5Val[16]
     c_md5_finish(&ctx, md5Val);
 }
 
-void c_md5_get_str_result(const uint8_t* buffer, uint32_t length, uint8_t md5Val[32])
+void c_md5_get_str_result(const uint8_t* buffer, uint64_t length, uint8_t md5Val[32])
 {
     uint8_t val[32] = {0};
     c_md5_get_result(buffer, length, val);
     c_md5_result_to_str(val, md5Val);
 }
+
+void c_md5_get_results(const uint8_t* const buffers[], const uint64_t lengths[], uint8_t md5Vals[][16], size_t count)
+{
+    size_t i, n;
+    Md5Job jobs[C_MD5_MB_MAX_LANES * 4];
+
+    // 分批提交, 避免为任务数组分配内存
+    while (count > 0) {
+        n = C_MIN(count, sizeof(jobs) / sizeof(jobs[0]));
+        for (i = 0; i < n; i++) {
+            jobs[i].data = buffers[i];
+            jobs[i].dataLen = (size_t) lengths[i];
+            jobs[i].dgst = md5Vals[i];
+            jobs[i].userData = NULL;
+        }
+        c_md5_digest_batch(jobs, n);
+        buffers += n;
+        lengths += n;
+        md5Vals += n;
+        count -= n;
+    }
+}
+
+#ifndef __KERNEL_MODULE__
+bool c_md5_file(const char* path, uint8_t md5Val[16])
+{
+    int fd;
+    size_t len;
+    uint64_t off, size;
+    void* addr = NULL;
+    struct stat st;
+    Md5Context ctx;
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    if (0 != fstat(fd, &st) || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return false;
+    }
+
+    // 分窗口映射以限制占用的地址空间; 除最后一个窗口外都是整分组, 数据不会进入 ctx->buffer
+    c_md5_starts(&ctx);
+    size = (uint64_t) st.st_size;
+    for (off = 0; off < size; off += len) {
+        len = (size_t) C_MIN((uint64_t) MD5_FILE_WINDOW, size - off);
+        addr = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, (off_t) off);
+        if (MAP_FAILED == addr) {
+            close(fd);
+            return false;
+        }
+        madvise(addr, len, MADV_SEQUENTIAL);
+        c_md5_update(&ctx, (const uint8_t*) addr, len);
+        munmap(addr, len);
+    }
+    close(fd);
+
+    c_md5_finish(&ctx, md5Val);
+
+    return true;
+}
+#endif
@@ -22,24 +22,55 @@
 #ifndef purec_PUREC_MD_5_H
 #define purec_PUREC_MD_5_H
 #include "common.h"
+#include "hash-mb.h"
 
 
 C_BEGIN_EXTERN_C
 
-typedef struct _PACKED
+typedef struct
 {
-    uint32_t total[2];
     uint32_t state[4];
+    uint64_t total;             // 已输入的字节数
     uint8_t buffer[64];
 } Md5Context;
 
+#define C_MD5_MB_MAX_LANES          (HASH_MB_MAX_LANES)
+
+/**
+ * 多缓冲区计算的一个任务(dgst 为 16 字节)和管理器, 通道调度见 hash-mb.h
+ */
+typedef HashMbJob       Md5Job;
+typedef HashMbManager   Md5MbManager;
+
 void c_md5_starts (Md5Context* ctx);
-void c_md5_update (Md5Context* ctx, const uint8_t* input, uint32_t len);
+void c_md5_update (Md5Context* ctx, const uint8_t* input, uint64_t len);
 void c_md5_finish (Md5Context* ctx, uint8_t digest[16]);
 
 void c_md5_result_to_str  (C_IN const uint8_t val[16], C_OUT uint8_t str[32]);
-void c_md5_get_result     (C_IN const uint8_t* buffer, C_IN uint32_t length, C_OUT uint8_t md5Val[16]);
-void c_md5_get_str_result (C_IN const uint8_t* buffer, C_IN uint32_t length, C_OUT uint8_t md5Val[32]);
+void c_md5_get_result     (C_IN const uint8_t* buffer, C_IN uint64_t length, C_OUT uint8_t md5Val[16]);
+void c_md5_get_str_result (C_IN const uint8_t* buffer, C_IN uint64_t length, C_OUT uint8_t md5Val[32]);
+
+/**
+ * @brief 同时计算多块数据的 MD5, 结果与逐个调用 c_md5_get_result 相同
+ */
+void c_md5_get_results    (C_IN const uint8_t* const buffers[], C_IN const uint64_t lengths[], C_OUT uint8_t md5Vals[][16], C_IN size_t count);
+
+/**
+ * @brief 多缓冲区接口, 用法与 c_sm3_mb_* 相同: submit 返回已完成的任务(可能为 NULL), 不再提交时反复 flush 直到返回 NULL
+ * @note 任务完成前 job 及其 data 必须保持有效
+ */
+void    c_md5_mb_init       (Md5MbManager* mgr);
+Md5Job* c_md5_mb_submit     (Md5MbManager* mgr, Md5Job* job);
+Md5Job* c_md5_mb_flush      (Md5MbManager* mgr);
+void    c_md5_digest_batch  (Md5Job* jobs, size_t count);
+
+#ifndef __KERNEL_MODULE__
+/**
+ * @brief 计算文件的 MD5, 按窗口只读映射文件并直接把映射的页交给分组函数, 不经过 ctx->buffer 复制
+ * @return 文件无法打开或映射时返回 false
+ */
+bool c_md5_file (C_IN const char* path, C_OUT uint8_t md5Val[16]);
+#endif
 
 C_END_EXTERN_C
 
@@ -21,6 +21,67 @@
  */
 #include "rc4.h"
 
+#define RC4_MULTI_LANES         4
+
+#define RC4_MODE_PLAIN          0
+#define RC4_MODE_EN_ENCRYPT     1
+#define RC4_MODE_EN_DECRYPT     2
+
+#define RC4_WORD_MIN            64          // 短于此长度时展开 S 盒不划算, 仍逐字节处理
+
+#define RC4_SWAR_LO             0x7f7f7f7f7f7f7f7fULL
+#define RC4_SWAR_HI             0x8080808080808080ULL
+
+// 8 个字节分别相加/相减(模 256), 字节之间不进位/借位
+#define RC4_SWAR_ADD(a, b)      ((((a) & RC4_SWAR_LO) + ((b) & RC4_SWAR_LO)) ^ (((a) ^ (b)) & RC4_SWAR_HI))
+#define RC4_SWAR_SUB(a, b)      ((((a) | RC4_SWAR_HI) - ((b) & RC4_SWAR_LO)) ^ (((a) ^ ~(b)) & RC4_SWAR_HI))
+
+/**
+ * 生成一个密钥流字节放入 k1 的第 sh 位处 (增强型另把 S[b] 放入 k2)
+ */
+#define RC4_WORD_STEP(sh, en) \
+{ \
+    uint32_t a_, b_; \
+    x = (x + 1) & 0xff; a_ = s[x]; \
+    y = (y + a_) & 0xff; b_ = s[y]; \
+    s[x] = b_; s[y] = a_; \
+    k1 |= (uint64_t) s[(a_ + b_) & 0xff] << (sh); \
+    if (en) { \
+        k2 |= (uint64_t) s[b_] << (sh); \
+    } \
+}
+
+#define RC4_WORD_GEN(en) \
+    RC4_WORD_STEP( 0, en) RC4_WORD_STEP( 8, en) RC4_WORD_STEP(16, en) RC4_WORD_STEP(24, en) \
+    RC4_WORD_STEP(32, en) RC4_WORD_STEP(40, en) RC4_WORD_STEP(48, en) RC4_WORD_STEP(56, en)
+
+#define RC4_MULTI_CHUNK         64          // 每条流每次先生成的密钥流字节数
+#define RC4_MULTI_LONG          512         // 不短于此长度的流不参与交错
+
+/**
+ * 一条流生成一个密钥流字节 k1 = S[a + b] (增强型另需 k2 = S[b]), 直接在各自的上下文中置换 S 盒:
+ * 交错面向短记录, 展开 S 盒的开销不划算; 密钥流先写入局部缓冲区, 不占用数据指针寄存器
+ */
+#define RC4_MULTI_STEP(k, j, en) \
+{ \
+    uint32_t a_, b_; \
+    x##k = (x##k + 1) & 0xff; a_ = m##k[x##k]; \
+    y##k = (y##k + a_) & 0xff; b_ = m##k[y##k]; \
+    m##k[x##k] = (uint8_t) b_; m##k[y##k] = (uint8_t) a_; \
+    k1[k][j] = m##k[(a_ + b_) & 0xff]; \
+    if (en) { \
+        k2[k][j] = m##k[b_]; \
+    } \
+}
+
+#define RC4_MULTI_GEN(en) \
+    for (j = 0; j < n; j++) { \
+        RC4_MULTI_STEP(0, j, en) \
+        RC4_MULTI_STEP(1, j, en) \
+        RC4_MULTI_STEP(2, j, en) \
+        RC4_MULTI_STEP(3, j, en) \
+    }
+
 void c_rc4_setup(Rc4Context * ctx, const uint8_t * Key, uint32_t keyLen)
 {
     uint32_t i, j, k;
@@ -43,10 +104,100 @@ void c_rc4_setup(Rc4Context * ctx, const uint8_t * Key, uint32_t keyLen)
     }
 }
 
-void c_rc4_crypt(Rc4Context * ctx, uint8_t * data, uint32_t length)
+static void rc4_state_load(const Rc4Context* ctx, uint32_t s[256])
+{
+    int i;
+
+    for (i = 0; i < 256; i++) {
+        s[i] = ctx->m[i];
+    }
+}
+
+static void rc4_state_store(Rc4Context* ctx, const uint32_t s[256], uint32_t x, uint32_t y)
+{
+    int i;
+
+    for (i = 0; i < 256; i++) {
+        ctx->m[i] = (uint8_t) s[i];
+    }
+    ctx->x = x;
+    ctx->y = y;
+}
+
+/**
+ * 先把 8 字节密钥流攒在寄存器里, 再与数据按 64 位整字运算; S 盒展开为 uint32_t 局部数组
+ */
+static void rc4_crypt_words(Rc4Context* ctx, uint8_t* data, uint64_t length, int mode)
+{
+    int i;
+    uint64_t k1, k2, v;
+    uint32_t x = ctx->x, y = ctx->y;
+    uint32_t s[256];
+
+    rc4_state_load(ctx, s);
+
+    if (RC4_MODE_PLAIN == mode) {
+        for (; length >= sizeof(uint64_t); length -= sizeof(uint64_t), data += sizeof(uint64_t)) {
+            k1 = 0;
+            RC4_WORD_GEN(0)
+            memcpy(&v, data, sizeof(v));
+            v ^= k1;
+            memcpy(data, &v, sizeof(v));
+        }
+    }
+    else if (RC4_MODE_EN_ENCRYPT == mode) {
+        for (; length >= sizeof(uint64_t); length -= sizeof(uint64_t), data += sizeof(uint64_t)) {
+            k1 = k2 = 0;
+            RC4_WORD_GEN(1)
+            memcpy(&v, data, sizeof(v));
+            v = RC4_SWAR_ADD(v ^ k1, k2);
+            memcpy(data, &v, sizeof(v));
+        }
+    }
+    else {
+        for (; length >= sizeof(uint64_t); length -= sizeof(uint64_t), data += sizeof(uint64_t)) {
+            k1 = k2 = 0;
+            RC4_WORD_GEN(1)
+            memcpy(&v, data, sizeof(v));
+            v = RC4_SWAR_SUB(v, k2) ^ k1;
+            memcpy(data, &v, sizeof(v));
+        }
+    }
+
+    // 不足 8 字节的尾部
+    k1 = k2 = 0;
+    for (i = 0; i < (int) length; i++) {
+        RC4_WORD_STEP(8 * i, RC4_MODE_PLAIN != mode)
+    }
+    for (i = 0; i < (int) length; i++) {
+        uint8_t a = (uint8_t) (k1 >> (8 * i));
+        uint8_t b = (uint8_t) (k2 >> (8 * i));
+        if (RC4_MODE_PLAIN == mode) {
+            data[i] ^= a;
+        }
+        else if (RC4_MODE_EN_ENCRYPT == mode) {
+            data[i] = (uint8_t) ((data[i] ^ a) + b);
+        }
+        else {
+            data[i] = (uint8_t) ((data[i] - b) ^ a);
+        }
+    }
+
+    rc4_state_store(ctx, s, x, y);
+    memset(s, 0, sizeof(s));
+}
+
+void c_rc4_crypt(Rc4Context * ctx, uint8_t * data, uint64_t length)
 {
-    uint32_t i, x, y;
+    uint64_t i;
+    uint32_t x, y;
     uint8_t *m, a, b;
+
+    if (length >= RC4_WORD_MIN) {
+        rc4_crypt_words(ctx, data, length, RC4_MODE_PLAIN);
+        return;
+    }
+
     x = ctx->x;
     y = ctx->y;
     m = ctx->m;
@@ -63,11 +214,17 @@ void c_rc4_crypt(Rc4Context * ctx, uint8_t * data, uint32_t length)
     ctx->y = y;
 }
 
-void c_en_rc4_encrypt(Rc4Context * ctx, uint8_t * data, uint32_t length)
+void c_en_rc4_encrypt(Rc4Context * ctx, uint8_t * data, uint64_t length)
 {
-    uint32_t i, x, y;
+    uint64_t i;
+    uint32_t x, y;
     uint8_t *m, a, b;
 
+    if (length >= RC4_WORD_MIN) {
+        rc4_crypt_words(ctx, data, length, RC4_MODE_EN_ENCRYPT);
+        return;
+    }
+
     x = ctx->x;
     y = ctx->y;
     m = ctx->m;
@@ -86,11 +243,17 @@ void c_en_rc4_encrypt(Rc4Context * ctx, uint8_t * data, uint32_t length)
     ctx->y = y;
 }
 
-void c_en_rc4_decrypt(Rc4Context * ctx, uint8_t * data, uint32_t length)
+void c_en_rc4_decrypt(Rc4Context * ctx, uint8_t * data, uint64_t length)
 {
-    uint32_t i, x, y;
+    uint64_t i;
+    uint32_t x, y;
     uint8_t *m, a, b;
 
+    if (length >= RC4_WORD_MIN) {
+        rc4_crypt_words(ctx, data, length, RC4_MODE_EN_DECRYPT);
+        return;
+    }
+
     x = ctx->x;
     y = ctx->y;
     m = ctx->m;
@@ -109,3 +272,149 @@ void c_en_rc4_decrypt(Rc4Context * ctx, uint8_t * data, uint32_t length)
     ctx->y = y;
 }
 
+
+static void rc4_xor(uint8_t* data, const uint8_t* ks, size_t n)
+{
+    uint64_t a, b;
+
+    for (; n >= sizeof(uint64_t); n -= sizeof(uint64_t), data += sizeof(uint64_t), ks += sizeof(uint64_t)) {
+        memcpy(&a, data, sizeof(a));
+        memcpy(&b, ks, sizeof(b));
+        a ^= b;
+        memcpy(data, &a, sizeof(a));
+    }
+    for (; n > 0; n--) {
+        *data++ ^= *ks++;
+    }
+}
+
+static void rc4_crypt_serial(Rc4Context* ctx, uint8_t* data, size_t length, int mode)
+{
+    if (RC4_MODE_PLAIN == mode) {
+        c_rc4_crypt(ctx, data, length);
+    }
+    else if (RC4_MODE_EN_ENCRYPT == mode) {
+        c_en_rc4_encrypt(ctx, data, length);
+    }
+    else {
+        c_en_rc4_decrypt(ctx, data, length);
+    }
+}
+
+static void rc4_multi_apply(uint8_t* data, const uint8_t* k1, const uint8_t* k2, size_t n, int mode)
+{
+    size_t i;
+
+    if (RC4_MODE_PLAIN == mode) {
+        rc4_xor(data, k1, n);
+    }
+    else if (RC4_MODE_EN_ENCRYPT == mode) {
+        for (i = 0; i < n; i++) {
+            data[i] = (uint8_t) ((data[i] ^ k1[i]) + k2[i]);
+        }
+    }
+    else {
+        for (i = 0; i < n; i++) {
+            data[i] = (uint8_t) ((data[i] - k2[i]) ^ k1[i]);
+        }
+    }
+}
+
+/**
+ * 4 条流交错生成密钥流, 再与数据异或
+ */
+static void rc4_crypt_multi(Rc4Buffer* buffers, size_t count, int mode)
+{
+    int k, active;
+    size_t j, n, next = 0;
+    size_t rem[RC4_MULTI_LANES];
+    uint32_t x0 = 0, x1 = 0, x2 = 0, x3 = 0;
+    uint32_t y0 = 0, y1 = 0, y2 = 0, y3 = 0;
+    uint8_t *m0 = NULL, *m1 = NULL, *m2 = NULL, *m3 = NULL;
+    uint8_t k1[RC4_MULTI_LANES][RC4_MULTI_CHUNK];
+    uint8_t k2[RC4_MULTI_LANES][RC4_MULTI_CHUNK];
+    uint8_t* d[RC4_MULTI_LANES];
+    Rc4Buffer* lane[RC4_MULTI_LANES] = { NULL, NULL, NULL, NULL };
+
+    while (true) {
+        // 空闲的通道取下一条非空的流
+        for (active = 0, k = 0; k < RC4_MULTI_LANES; k++) {
+            while (NULL == lane[k] && next < count) {
+                if (buffers[next].length >= RC4_MULTI_LONG) {
+                    // 长数据直接走单流的整字实现, 展开 S 盒的开销已被摊薄, 不比交错慢
+                    rc4_crypt_serial(buffers[next].ctx, buffers[next].data, buffers[next].length, mode);
+                }
+                else if (buffers[next].length > 0) {
+                    lane[k] = &buffers[next];
+                    d[k] = lane[k]->data;
+                    rem[k] = lane[k]->length;
+                    switch (k) {
+                        case 0: x0 = lane[k]->ctx->x; y0 = lane[k]->ctx->y; m0 = lane[k]->ctx->m; break;
+                        case 1: x1 = lane[k]->ctx->x; y1 = lane[k]->ctx->y; m1 = lane[k]->ctx->m; break;
+                        case 2: x2 = lane[k]->ctx->x; y2 = lane[k]->ctx->y; m2 = lane[k]->ctx->m; break;
+                        default: x3 = lane[k]->ctx->x; y3 = lane[k]->ctx->y; m3 = lane[k]->ctx->m; break;
+                    }
+                }
+                next++;
+            }
+            active += (NULL != lane[k]);
+        }
+        if (active < RC4_MULTI_LANES) {
+            break;
+        }
+
+        n = C_MIN(C_MIN(rem[0], rem[1]), C_MIN(rem[2], rem[3]));
+        n = C_MIN(n, RC4_MULTI_CHUNK);
+        if (RC4_MODE_PLAIN == mode) {
+            RC4_MULTI_GEN(0)
+        }
+        else {
+            RC4_MULTI_GEN(1)
+        }
+
+        for (k = 0; k < RC4_MULTI_LANES; k++) {
+            rc4_multi_apply(d[k], k1[k], k2[k], n, mode);
+            d[k] += n;
+            rem[k] -= n;
+            if (0 == rem[k]) {
+                switch (k) {
+                    case 0: lane[k]->ctx->x = x0; lane[k]->ctx->y = y0; break;
+                    case 1: lane[k]->ctx->x = x1; lane[k]->ctx->y = y1; break;
+                    case 2: lane[k]->ctx->x = x2; lane[k]->ctx->y = y2; break;
+                    default: lane[k]->ctx->x = x3; lane[k]->ctx->y = y3; break;
+                }
+                lane[k] = NULL;
+            }
+        }
+    }
+
+    // 不足 4 条时逐条处理剩余部分
+    for (k = 0; k < RC4_MULTI_LANES; k++) {
+        if (NULL != lane[k]) {
+            switch (k) {
+                case 0: lane[k]->ctx->x = x0; lane[k]->ctx->y = y0; break;
+                case 1: lane[k]->ctx->x = x1; lane[k]->ctx->y = y1; break;
+                case 2: lane[k]->ctx->x = x2; lane[k]->ctx->y = y2; break;
+                default: lane[k]->ctx->x = x3; lane[k]->ctx->y = y3; break;
+            }
+            rc4_crypt_serial(lane[k]->ctx, d[k], rem[k], mode);
+        }
+    }
+    memset(k1, 0, sizeof(k1));
+    memset(k2, 0, sizeof(k2));
+}
+
+void c_rc4_crypt_multi(Rc4Buffer* buffers, size_t count)
+{
+    rc4_crypt_multi(buffers, count, RC4_MODE_PLAIN);
+}
+
+void c_en_rc4_encrypt_multi(Rc4Buffer* buffers, size_t count)
+{
+    rc4_crypt_multi(buffers, count, RC4_MODE_EN_ENCRYPT);
+}
+
+void c_en_rc4_decrypt_multi(Rc4Buffer* buffers, size_t count)
+{
+    rc4_crypt_multi(buffers, count, RC4_MODE_EN_DECRYPT);
+}
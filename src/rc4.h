@@ -35,14 +35,37 @@ struct _Rc4Context
     uint8_t                 m[256];
 };
 
+/**
+ * 批量接口中的一条独立密钥流: 一个 RC4 状态 + 要原地加/解密的数据
+ */
+typedef struct
+{
+    Rc4Context*             ctx;
+    uint8_t*                data;
+    size_t                  length;
+} Rc4Buffer;
+
 void c_rc4_setup         (Rc4Context* ctx, const uint8_t* Key, uint32_t keyLen);
-void c_rc4_crypt         (Rc4Context* ctx, uint8_t* data, uint32_t length);
+
+/**
+ * @note 64 字节以上的数据每次生成 8 字节密钥流后按 64 位整字与数据运算
+ */
+void c_rc4_crypt         (Rc4Context* ctx, uint8_t* data, uint64_t length);
 
 // 增强型加密算法
-void c_en_rc4_encrypt    (Rc4Context* ctx, uint8_t* data, uint32_t length);
+void c_en_rc4_encrypt    (Rc4Context* ctx, uint8_t* data, uint64_t length);
 
 // 增强型解密算法
-void c_en_rc4_decrypt    (Rc4Context* ctx, uint8_t* data, uint32_t length);
+void c_en_rc4_decrypt    (Rc4Context* ctx, uint8_t* data, uint64_t length);
+
+/**
+ * @brief 批量处理多条互不相关的密钥流, 结果与对每一项分别调用 c_rc4_crypt/c_en_rc4_* 相同
+ * @note 单条 RC4 流只能逐字节串行, 这里每次交错推进 4 条短流, 用其它流的计算掩盖 S 盒读写的延迟;
+ *       各项的 ctx 必须互不相同, 处理完后 ctx 中保存各自的新状态
+ */
+void c_rc4_crypt_multi       (Rc4Buffer* buffers, size_t count);
+void c_en_rc4_encrypt_multi  (Rc4Buffer* buffers, size_t count);
+void c_en_rc4_decrypt_multi  (Rc4Buffer* buffers, size_t count);
 
 C_END_EXTERN_C
 
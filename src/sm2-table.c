@@ -0,0 +1,3461 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "sm2-table.h"
+
+/**
+ * SM2 基点 G 的固定基预计算表, 供 c_sm2_jacobian_point_mul_generator 使用, 布局见 sm2-table.h
+ * 表体由 tests/test-sm2 --g-table 生成, test-sm2 会逐项重新计算并比较
+ */
+const uint64_t c_sm2_z256_g_table[SM2_Z256_G_WINDOWS][SM2_Z256_G_WINDOW_SIZE][8] = {
+    {
+        {
+            0x61328990f418029e, 0x3e7981eddca6c050, 0xd6a1ed99ac24c3c3, 0x91167a5ee1c13b05,
+            0xc1354e593c2d0ddd, 0xc1f5e5788d3295fa, 0x8d4cfb066e2a48f8, 0x63cd65d481d735bd,
+        },
+        {
+            0x0af037bfbc3be46a, 0x83bdc9ba2d8fa938, 0x5349d94b5788cd24, 0x0d7e9c18caa5736a,
+            0x6a7e1a1d69db9ac1, 0xccbd8d37c4a8e82b, 0xc7b145169b7157ac, 0x947e74656c21bdf5,
+        },
+        {
+            0x1cda54fdab589e4a, 0x26765289db4f0a0d, 0x0a265a308ceb4a0a, 0x3019fd6bfe887c64,
+            0x0a10fbe94b2fc190, 0xf40aa52b87cbce60, 0xcc496bfa6dc13c97, 0x28ad34785bb3fbb4,
+        },
+        {
+            0x393f7c5a98615060, 0x487ea27fe9016209, 0x8a86bcb4a09f9020, 0x50dc8e3ac899dbe1,
+            0xfc099043fd619998, 0x1de135ea7c7383bd, 0x4d0bd55632cf70ed, 0x6ffc31c525bce9e3,
+        },
+        {
+            0x9a5756336a9c8162, 0x15aa58f221dfcc53, 0x7ad354bf1ef5f4c5, 0x0f443ef363f875b9,
+            0x2e81d68fd3450133, 0xb30f4bbde3607d18, 0xb1826a4c362258ef, 0x7b415276142a6768,
+        },
+        {
+            0x136a9c4c0acd72ba, 0xb1274a255e7ec73c, 0xf15a876e5de34db6, 0x85e74ca08cba8047,
+            0x08454cddb469eb37, 0x8fbf6d1fc99754f8, 0x1060e7f8ec30e984, 0xb568bc974b8c598a,
+        },
+        {
+            0xaa3531c781f06784, 0x0b89419307132520, 0x84ee5b69acfe18c5, 0xbbf492e0d9fbec28,
+            0x313a35c1e5f6186d, 0x0e449a2e757a01b8, 0x96c9b9922bd99baf, 0x2ba05a8f3b84d777,
+        },
+        {
+            0xde523a1c09122670, 0x90be6f2a22cc810c, 0x086e63414387df9e, 0x115c2fc0d9c44134,
+            0x9334430d8799302a, 0x693b3500e27b7ea4, 0xcbe1136f9a8f3382, 0xe77fd5f2b5778247,
+        },
+        {
+            0x98e795c330fbde86, 0x8e5e0495ab21af8f, 0x3925bf83b48669b4, 0x77d88740469522c8,
+            0x8fbf8b5b987b04ce, 0x63c563a83aff4428, 0x5dc1116553a6e969, 0x822a6c2432697f4c,
+        },
+        {
+            0x6774298a642cb143, 0xecdb60d82d110e71, 0xe810b11b1388728e, 0x2e8237d8d8603a8a,
+            0x673968fc50aeeae1, 0x08c65d196746a3f4, 0x7a61a6b5d7dd7165, 0xe31bbfd9a9b6df3a,
+        },
+        {
+            0x2b252ad03421e115, 0x7557c8c7c6affc01, 0xd90c19fd8a509267, 0x483da168e0d871c8,
+            0x72d6f9b3c10729bf, 0x5dd8402115b7061e, 0x9bfea2db9f2c587d, 0x528398a798641ec2,
+        },
+        {
+            0x18a65d8df3afdd62, 0x89f38500d6d7e4e4, 0x65708c6a9d8d4f07, 0xb90ea13cd0bdc7f4,
+            0x589858558c3e2b32, 0xfa48d5c5bcfad3a1, 0x5c3544e762385ffa, 0xb6bd39ed7e72aeb7,
+        },
+        {
+            0x34e51c6a8000fe4e, 0x7da2bdfd89c46941, 0x667ba91de1bc2b2e, 0x3c80c9d010a73e5c,
+            0x4fadebbec7f5c64d, 0xaef09eb43ea35052, 0x167ee11b26ec55f9, 0x45fa508a85189260,
+        },
+        {
+            0xa0e9a43922542fc3, 0x3f194a6cddac78dc, 0xa75ae72d6f74d053, 0x0f8babeb097c6617,
+            0x1d12bc5c4303c247, 0xfe0c027abd1e246c, 0xe9ca1a99b69b55ad, 0xff6cd2b0117cd63a,
+        },
+        {
+            0xf3489343dde97d4d, 0x9c14e38abbb2ce1f, 0x25866911cfddf221, 0x0df89411460efef1,
+            0xf713f30e73ae8326, 0xd9be66a8cdd274a1, 0xdf915ae236885947, 0x2c5c1e9e7878b781,
+        },
+        {
+            0xf71560c939e8a120, 0x7121d6b87273b59a, 0x649535ce8ef4639d, 0xcd01076e14cc6d58,
+            0x2705729a96e74f8a, 0xb07e32305533037e, 0x0846dcc1663c5c62, 0x6a4759c110fc3ac1,
+        },
+    },
+    {
+        {
+            0xa6c11369adbb3c8b, 0xd78af40b4c8ec378, 0xffb3a80d03f0a982, 0x550e3e71a83be50a,
+            0x845c0fb2418ee45b, 0x5297cf430791b964, 0x676b638ccc47e33b, 0xb1c52facfecf85b2,
+        },
+        {
+            0x80ffa5ae0d038ad4, 0xf44d3df336256c8f, 0x0a3077c8bc978dce, 0xf3d9b4b0745b8317,
+            0x8bbf4484b6b1852c, 0x0cd02ed40e78ff07, 0x91cb827e49c24238, 0x58adaee5daa3cb55,
+        },
+        {
+            0xeb7a91da5f6fbf64, 0xad5bf46314de051b, 0x13e4455d485a1ac8, 0x5d09b6e014f3a2fa,
+            0x87c3ffc804bf1416, 0x4b5bedabce88e447, 0x1fc4f3fd983777ca, 0x55e4509eb6d4b118,
+        },
+        {
+            0x07e6ce4d033fc12a, 0xba4f98a14886f316, 0xb24b38f3e66f3f11, 0xe3f6205a5ea4bde3,
+            0x00705387a77b998f, 0x2c9b44579549f3b1, 0xdef6625b533a61d6, 0x4eda7e2a7e4f781a,
+        },
+        {
+            0x9e442522628c422a, 0xcf12ca756d00f896, 0xefbf20b5176621dc, 0xc6b933265de8dda1,
+            0x160718251827361b, 0xf6d51e744e98c880, 0x2824ffe99291dc69, 0xf9d1926fa0cef585,
+        },
+        {
+            0x483a080d9e82eba8, 0xce1971bbbf5145e8, 0xafb346e3a014c2e6, 0xc38daaa32414afeb,
+            0x70cb2c723f42b286, 0x0014500e25625080, 0xd9f0ef435b518c82, 0x87c753e1813f39b3,
+        },
+        {
+            0x9e47fa9b9c462e97, 0xb822edc84ccbd5d2, 0x4cbb0ec42578602a, 0x2ef3dab5a2546a84,
+            0x9027f06b40c3e1d2, 0xc8c02faff7e61ea6, 0x342a06c4e7fe05bd, 0xbb8060149347f0a2,
+        },
+        {
+            0xe9730aaafd120134, 0xb22b9089c057309c, 0x98e7956584726ce7, 0x0e1431a0d635a584,
+            0xbd387023e834ffa6, 0x64198ddf036ab1ae, 0x46e5ebb19124b684, 0xa316fa44233b3c6d,
+        },
+        {
+            0x38a68f9e423eb38e, 0xdb7f51adf447e0d7, 0xf62db21b19609640, 0x9c5c39c1a92bc7a4,
+            0x1386a325ae71428b, 0xf89b85412d92d60a, 0x9f39e845143855a1, 0x52b877c038d69315,
+        },
+        {
+            0xcb2f94161d0195d9, 0xaf18fea52d23ea78, 0x9af21137a65de11e, 0xf9bb3d00b328c4c4,
+            0x37dd2b79dedb9cd1, 0x6c8c9047f4dc56b7, 0x0edcb8ef03d88e77, 0xc23784a3ace70471,
+        },
+        {
+            0x0831b35b8019d806, 0x3b4e52ce29749f78, 0xff86af41bda46936, 0x96ccfb83609f3faf,
+            0xa68dbdc47b464fa4, 0x77f3430ab12f6c69, 0x7a69d3173503e846, 0xb24da7114763a7c5,
+        },
+        {
+            0xec2a932584782513, 0xd67c8ab72903d20b, 0x6b65b262157f9aee, 0x547be60c69f964a2,
+            0x001bf327ee0419db, 0x92fa0800f20c7005, 0x1e11e745cdc1ccda, 0xa785ec10e471f822,
+        },
+        {
+            0xb0952012c8c3907a, 0xe2b9a066df811254, 0x102fd035d4c9b32e, 0x8919f9cde3a77624,
+            0x9ba9e3f15ea5d261, 0x1377917837c8bddf, 0x9930bccade74c6c0, 0xd8c802ad62263dc3,
+        },
+        {
+            0xfc25ee5d2e694eee, 0x679dd524fa668d58, 0x3a0b07f03c02d6b1, 0xb80f3dcf869c0ff6,
+            0x60d2951eab28cdcd, 0x6a47780d079b7e3d, 0x0b824635cabab337, 0xf6279a015fbd140d,
+        },
+        {
+            0xfaea050765cb8e2a, 0x3ee8e165a3327b68, 0xb772d0db16e637c2, 0x714287ed49b04e1f,
+            0x905963076efc1e6c, 0x926869975cb7ce6a, 0x298abb610678599b, 0xf5ee0ef1430e27c3,
+        },
+        {
+            0xbc970210a1371aa4, 0xaff481a054b5424e, 0xbcdf91fd0e64269b, 0x18bb37bbb02fc7cf,
+            0xd99edd796f69d439, 0x4e27a58f169514b2, 0x80eca1ca66e19ae4, 0x0470e9650788696d,
+        },
+    },
+    {
+        {
+            0x528a9e2f5876d6e8, 0x93c48f85d2b622d7, 0x88d9eac83e5411d7, 0xb7e4a6ba00a70e91,
+            0xaf18e5baf1c43b2e, 0x46578c7ea2f347de, 0x19ca736df009638f, 0xa6563f1ebd1acd29,
+        },
+        {
+            0x870b12dd12ee579d, 0x2a9a12ab06dd62d6, 0xbcd52599071d7582, 0x7a36193aa869c457,
+            0xd29e6592e976ae5b, 0xe82c8712adfecd58, 0xbc83a440f714686d, 0xfe19344a0c21e3ba,
+        },
+        {
+            0xf44eeb994620e739, 0x7663a596f4159a9a, 0x79c54f42b4b745b1, 0xa8d3493759db9482,
+            0x35fad92a579501df, 0x1d81bbe3289d7c2b, 0x1d60a274ddf3d371, 0xf08e23e546df1233,
+        },
+        {
+            0x1f41010b2c439171, 0x3ff85ee6e8139388, 0x4ada4c7d8f077633, 0x9976011a824e6023,
+            0xa2501197eaf49f63, 0xdff2122fd60b0c4c, 0x1a6a3abbbab3df90, 0x854bbcc6b66ffd5f,
+        },
+        {
+            0xe3808e725472d67b, 0x73450378ce74546e, 0xc1b1b66eea1d58f7, 0x2b576e4fe34c2a7d,
+            0xc2b1bdf72f732803, 0x37aea3909f8e48c3, 0x8bbbb61e944f1cf3, 0x5cc7ccaa86c59643,
+        },
+        {
+            0x26234b2e56730245, 0x9a04c15de1b54be4, 0x153fb6cfee89282b, 0x5901ca12d79d81ad,
+            0xbe6853d87c3c5ffd, 0x16d3efb535e1942a, 0x3491f2073b56bece, 0x0d75e0c15b818cfd,
+        },
+        {
+            0x83af640e1f913210, 0x529a29fd8d505edc, 0xdf3d3090d6b0c85a, 0x46e238866897ea43,
+            0x97cca980416577ae, 0x1f5a96a89aa08fc3, 0xcb014b3356c05c30, 0x1944765a05ec9be4,
+        },
+        {
+            0xbb45c28718d13bd3, 0xbbf3a89423c6dd1a, 0xc8171c5e13b9cf87, 0x2dfc779234f5348d,
+            0x9b9a662d985cabd4, 0x588a6ebc4d971de0, 0xda9fd894574cba64, 0x7e0f0cca651e6e67,
+        },
+        {
+            0xc3a4eb7c3ac5bf84, 0x0c045f4016dc8599, 0x13f4702577fff42c, 0x082c7904c19a093a,
+            0x50255ad22da2ded1, 0x755cf8a013ea4382, 0xe124c89ed2710e41, 0xa316d9df9bd6e22c,
+        },
+        {
+            0x66c5dc725e1e27ff, 0xd24aaef00a5c8db3, 0x68fa0797cc00220a, 0xd7525d688ee44c4e,
+            0x299bde567b0dd801, 0xf43e711657dc1e6a, 0x7928a5a37ec35ece, 0x35939e73663a518d,
+        },
+        {
+            0xd71ca70602c22347, 0x422c77a9dd8dd5c1, 0xeb2541ea4718f89f, 0x44ee1682b913247b,
+            0x72b7c50b70c3d9f4, 0x896b369fea21319d, 0x8eea2edc63c00dc0, 0xedcf6bee0d8b0dee,
+        },
+        {
+            0x274c572f9f177d65, 0xc39e9e152c2394c4, 0xc9e7b18c1e307ad6, 0x33da596c4c22d9c8,
+            0x5c300e12b74b9c00, 0x5f434a9d59f5d134, 0x5b872943719e8442, 0xc0164ba48acd11c3,
+        },
+        {
+            0x5a2994aae99d6a84, 0xdccaf1281a932b4c, 0xae8dd6205e6fab26, 0xb0e63793382030a4,
+            0x76421c28e61d33a4, 0x7683bea1684e865d, 0xb21bcd702c4f22b9, 0xa3e86bbb170bf781,
+        },
+        {
+            0xa65dce2e0397acd5, 0x3108a070d349b0ce, 0xbcdb752b8cb6aa0a, 0x9aa2b9d341dbdda0,
+            0xffe4bb762597aac6, 0xadadda2b6f3cb8d8, 0x8388defba23acd05, 0xbcc2a06a0e26bd2e,
+        },
+        {
+            0x7588776f7f2950e7, 0xb0b3025fd7856e89, 0xac4b5aa66055d399, 0x498dd61c017b0a85,
+            0x587dc089eecc98d6, 0x2484be03382219be, 0x8251730b52acb991, 0x6a8d2390843a2696,
+        },
+        {
+            0x88ca276c4b8bceb8, 0x6d4ec101752d1106, 0x2ad98063f834dcbf, 0x4da81d19dfff19d0,
+            0x4ccc7cd23a9828ff, 0xf1e389b02e64b332, 0xe2fb6a6c7308b81c, 0xc6df66b25bcc0ac6,
+        },
+    },
+    {
+        {
+            0x5ccb8c75e1c58c80, 0x2ba9de0483fcc95a, 0xccdeb0eedfccbcf9, 0x1d667d4f70f3d3ad,
+            0xc6aa14a536269820, 0x329a308b0fe87940, 0x39869970ede5cfb2, 0xc33c3068f601bb2c,
+        },
+        {
+            0xec25045511c09289, 0x83042ba7164079c9, 0x4881640c6e3879a2, 0x77c5babc802452ee,
+            0x7a7759a67088f360, 0x02da352cb74be7e9, 0x15800cdbe0338289, 0xad69f7c9501688c6,
+        },
+        {
+            0xe9130a63103b5fa2, 0xe97f71208eee983b, 0x54b7f85be8749cba, 0x69976910bb1bca55,
+            0x9ec4034ff4e621d3, 0xaad567ed695e17da, 0x7647f054cedb2ea8, 0xf85f944c09fc7433,
+        },
+        {
+            0x164ac67faee03999, 0x4de174d379ff7f91, 0x063e4943548da6ea, 0x5264880bdb7ccdf7,
+            0x4a18f34b49b992cc, 0xe16b6f4d14065870, 0xd32479ac4cdb0e21, 0xce8151f6162bc9f8,
+        },
+        {
+            0x947ceaffed059f1d, 0xf5754d037460a186, 0x37698fa60164ff7b, 0x630900d235805339,
+            0xe467a6beeddd6bbc, 0xc53bffec5e36b12e, 0x06dfd3f9f831fc7d, 0xd995fcc4daef86ac,
+        },
+        {
+            0x8ae82a1cc216cf37, 0xac437f45773828bf, 0x8c12ff189d51a85b, 0xfeb563be34c16578,
+            0x9d9353b6c6706966, 0xcdc6eb5a0cda8733, 0x033c186e3e4953db, 0x2ba46a66b2e37f7c,
+        },
+        {
+            0xb7c18083fccf76eb, 0xc693bdbbf93113a3, 0x215ff05d66e03205, 0x4424aaeaf76d2a12,
+            0xb23f2782e7f30891, 0xad814d5e062db479, 0x347ec1d04aea78c3, 0x3d0f0a7e6a2332f2,
+        },
+        {
+            0x7eb7f516da0abf3e, 0x3c92ac9461b3381f, 0xbad7320ed3418870, 0xbab7a12607dbe066,
+            0xe7ce59be2def303f, 0x0bf1f2372d1e0c9f, 0x12c18d1e38f418dc, 0x7fcc5e3eb85bb676,
+        },
+        {
+            0x997aa2a424f2c6b1, 0xde87114f9e536a91, 0x01938bd20f819ec8, 0x012e9031ef772a43,
+            0x1578eb4c77aa9256, 0x052b408861a0c8ed, 0x1153a3306ab5a380, 0xa3e7f085132f5675,
+        },
+        {
+            0x9efee7047e1754b8, 0x54085471b1c0027b, 0xc5e7a6fa45af4e6d, 0xb4d3cd5830048569,
+            0xd2c20014f3ae8e79, 0xd0b6af13849f3f23, 0x3a1db91517982a8c, 0xea3c8099f9ffcf90,
+        },
+        {
+            0xd1ef53cb68caff21, 0x3cff018c5074160a, 0x609a468898f982fc, 0xee5caaac562a099e,
+            0xf650365bf8c6cfd7, 0x2652aa239cbc10ee, 0x904fd66e6ab86f4e, 0x6a25bbc32d82f3d8,
+        },
+        {
+            0x18eac9530fa12b5b, 0x45ccf07377d159b5, 0xa74804446e844a0d, 0x4404e6c6d77d1c18,
+            0x003e43a6ce1af18f, 0x8a82808117fdffcc, 0x91b63c11cabf3d17, 0xa4dedc21ad26f286,
+        },
+        {
+            0x43f51810fbaffded, 0x3886ccb40f6fd7c3, 0xb939247b13c31946, 0xbc1ee613aa1fd72a,
+            0x6d40140a631fd790, 0x9382e3bad26b3fd9, 0xff414370b3af96c3, 0x38c813cfe0ea9ad6,
+        },
+        {
+            0xd202853b60aa5c14, 0x1dc35d343850cc05, 0x8014357e0cabccfd, 0x1aa44ce9c5a5225a,
+            0xa3cef9203a8444b4, 0xcf3f91b3c95384b1, 0x1d625ba1c9e5da54, 0xbf1fba37b1d0f46a,
+        },
+        {
+            0x0a89e741edf71900, 0xd679b841d514d93f, 0x8878577fb0a03702, 0xc9607b7885a209ae,
+            0xb7bd061659432a28, 0x0da060a2ed567145, 0x44e35a7a1a449f52, 0x9c9a2c82bbaccc0f,
+        },
+        {
+            0x2cda5caee30ae90b, 0x2cc34290caabea0d, 0x564afcd941e67856, 0x210c7a09cf6ef8b7,
+            0xc316d352f82a591d, 0x5fe8cc4dab43d2a1, 0xd8ebce978b4e9470, 0x26c78f44ba321a07,
+        },
+    },
+    {
+        {
+            0x681a38c765604726, 0x4f8c6ae3247a421e, 0x1a51eaa01294956e, 0x0984b1ef47c9b324,
+            0x3749bd0d597b7696, 0x9d432b7808e57ee7, 0x3092afe12ba112d2, 0x89ccee4916c5a7f5,
+        },
+        {
+            0x355e9d7b54089685, 0x9f0ec68f40818349, 0x4cf4d8cd3861b80f, 0xcce669fdc1f5fa14,
+            0xea2125091788f9da, 0x32953613f3ccf239, 0x1048d09250027f3b, 0xe807b39d4270fbcb,
+        },
+        {
+            0x5660c73cdf18eddf, 0x77edb4b9e2465ee9, 0xaf24eff83af950c8, 0xb822c6b26f6cb68b,
+            0x250352f6149d2bb2, 0x926809daf4a66ae7, 0x9964c2803f7e1c68, 0xd253298ab668129b,
+        },
+        {
+            0x5099dc5595e388c3, 0xd0670ff5ea44e3ea, 0xd212c99361b41f7b, 0x4f594af9faf13305,
+            0xbc508bf205c01232, 0x7683353639ff08a5, 0xa1cf70bdb837741a, 0xba8e6616aaf7bd2a,
+        },
+        {
+            0xab7b68da909bf8c6, 0xb5bd7c8b8f4bad4a, 0xa0ebb027fae39585, 0x68932a36c676d2d9,
+            0x562f954b730901cb, 0x108194a724fa3192, 0xe32829e6a547b351, 0x5ca08b2e5b343765,
+        },
+        {
+            0xde04c343def27938, 0x3f15ca9148cee32a, 0xcb61573b9dd142da, 0xc094eefd126dd9bc,
+            0x5d42f1a5136bb4da, 0x75693952db2f3449, 0x98017cd65c16795e, 0x9e4015302afb67db,
+        },
+        {
+            0x90cd608550643d18, 0x821f27f37902eb91, 0x766f7c645d7964ba, 0xf56feaa48c7bdad5,
+            0xf6aa29281bfda5ec, 0x5c09581dc624a7de, 0x33d1a64a6ff7f3b1, 0xa19a86e56c36de4b,
+        },
+        {
+            0x6376749f9b7c6c75, 0x680eacdcacbca35d, 0xe87fd5b55e145b32, 0xeb20d1ba36b886af,
+            0xca499055779b12bb, 0x6f290ff20be39fb7, 0x33ad6fe0f4a128ce, 0xf09e2a409b31da81,
+        },
+        {
+            0x4203575da2d26b49, 0x862784e16223b029, 0xf556c9ba4c74ed0b, 0x40b5c72fb31d980e,
+            0x15e3bedf8bf5480f, 0xde40e7a99ae4ab0f, 0xbe081c28f26fa3d3, 0x1308bf512e8d3bf8,
+        },
+        {
+            0xb2ed3d7012039372, 0xb87e02c42ff46c13, 0x164246c6fb27dce2, 0xe34ee8f6e6d95811,
+            0x66cc601c3ec1fde9, 0x056b319480ffdd56, 0xff0098689626aa21, 0xc3e4982c2d931092,
+        },
+        {
+            0xa5668e00e36b4ba2, 0xde48c2d8603e5fe6, 0x1e3fbdd95a6ac65b, 0xbf2303a376211c91,
+            0xf5789fce47b8f122, 0xa6ad5faa81d632d8, 0xa68743b24eb8b361, 0x3f8e966f89be1fee,
+        },
+        {
+            0xbc0da9c1c3d42729, 0x4905da24720df0a0, 0x0e5e1fa045f6eadf, 0xc02033f32aab7523,
+            0x45ba916fedde75e1, 0xf43919bd75c68e52, 0x00e7c07684892e6a, 0x259f848870dfeb08,
+        },
+        {
+            0xf6a7088a00d10b91, 0x849d89409eb7a079, 0x93d2e7c540d28a04, 0x43c1dd348cac6817,
+            0xde906fbbf5ab94d2, 0x394ddba94a7c6600, 0x08f12cca70105a86, 0xe4415fa489ea04ac,
+        },
+        {
+            0x3bfd5f2cd8a869a0, 0x1df48669574e7d67, 0x16d6ed5ae14cfd3b, 0x583aac2cfcf78465,
+            0x67210e6b67da2ae9, 0x0b024e70cfee511d, 0xf27e122c13839a4f, 0xfa5356c9b79dfa97,
+        },
+        {
+            0x9bdb333d66db5ade, 0x6fbf459076dcd6bb, 0x61f03ed4832acccc, 0x54d7181ac4a22a7d,
+            0x00d7786453a15cbc, 0x4d4cdc88d6347056, 0x80600341dbbaf9f2, 0xc98acb4214498019,
+        },
+        {
+            0xf0c24783f357999b, 0x2c21474c26bfacb3, 0xe3abed6ad3ddb945, 0xbb21b7646031a5ea,
+            0x6db3b68b8afc2a09, 0x1aac2f0881306b71, 0x882c3371852eb6f5, 0xadfe0c1ad98e9b6f,
+        },
+    },
+    {
+        {
+            0x1e0bf0633fd5a1de, 0x5d05e901a75b5b8c, 0xbbbdb1abcb3c617a, 0x44954a8c1aef4706,
+            0xbc3ceea3ff6a6e47, 0x6140f4210ded1275, 0xbb4b4c044dabe95f, 0xc55e87da7135e813,
+        },
+        {
+            0xffa1de9738f4194d, 0x33d2726a3b996b63, 0x787c0ec30d2053a7, 0x9447e9cbeecd5c0c,
+            0x077f121c284773c0, 0x496427e4815829a1, 0x4b11978694def08b, 0x9e7b29e69c15a778,
+        },
+        {
+            0xf1b318af2988abcd, 0xf887558f8e7da518, 0xb8b9939c97836b57, 0xf793e3b5c0a74cf3,
+            0xe191008a37684170, 0x7708823b05cb453c, 0xec221d40361beb2c, 0x0e5a6cceeb1b68f4,
+        },
+        {
+            0xe85f995e2a8ed3d7, 0x9dc712e82f319e47, 0xc4402eff536d98a2, 0xca61e31037521e35,
+            0xfed39621c3196672, 0x29e7743fff17e8a7, 0x47eca488412a7c49, 0xf011451333a2a6da,
+        },
+        {
+            0x062ded9277df3899, 0xf569331d60d4bc4c, 0x7fd95223b8091def, 0x7b63bb33c26fc5a3,
+            0x4c4ad2fe1492b4f7, 0xf7387774ce232301, 0x1bb8f757d23e8ff9, 0x27e4ede532d3d3e1,
+        },
+        {
+            0x225ae64936e63b10, 0x02f3c242c196a507, 0x77dadf55698f757a, 0x6593e5d2b1a7abd1,
+            0xe44f3b25a8ef53dd, 0x1633197abf4ac533, 0x5ef0df96a4480cb3, 0xaa6d10b3cfc2d2f5,
+        },
+        {
+            0x763ed31629092264, 0x5796c2b96d8820cb, 0xf51e060ee6b69df7, 0x0db96136c5460a8c,
+            0x5b2b0288fb71d943, 0xe27c6ef0e64d278c, 0xa2c4ba06649b8e94, 0x024a7f4d5afd34c2,
+        },
+        {
+            0x5675a12ae6880b5f, 0x9ba1e92ce2606d25, 0xb012facbeb3b2125, 0x3c50fdfbc37b0099,
+            0xc9ce461c9ce223e9, 0xcb90bdd6eefbd8ac, 0xf657e5a4c631ea8e, 0x6584520b38a83ff6,
+        },
+        {
+            0x24bea2fcd50e8d96, 0x1e5420b92b83a1f6, 0x6fdac8ff4fe195c6, 0x8071e9fd54e0eaa5,
+            0x802f980ab489d9df, 0x5cda958011d8693f, 0xb01aa560cc8ab303, 0xfda36425fc891da4,
+        },
+        {
+            0xc8e75363f2a7d1f6, 0x31ab0e6918b83086, 0x5c021eb701358791, 0x911f64246f1d32f1,
+            0xe585a982d14294f3, 0x75ea28a0e8410ff6, 0x1a0812acc62a08f0, 0x679b79cd07d8ac72,
+        },
+        {
+            0xed3bdc2dffaecdbc, 0x9d619006b8974474, 0x72c8f73d7f02162e, 0x9877c3ec7286396e,
+            0x428b42d6e9c5882f, 0x7941bee01f45303a, 0x85666f6e0d0a5128, 0xb460784d2ba467ad,
+        },
+        {
+            0xa5b99f4881071fdb, 0x8e2dfc2ac59a2c1c, 0x2a9828a8e4aaa74f, 0xa4d203e324b57b54,
+            0xe67369539c3cf562, 0x0ad8ed4dc0244ff9, 0x2e5d1a604e71e5a1, 0xd4e11acd108381ee,
+        },
+        {
+            0x42feea6bc5d4cb3a, 0xe715aeba1efdefc3, 0x4f62d3e7d5a3afd8, 0x07ec255b98399602,
+            0xe1716d5d60b5af04, 0xf06580d28f259d34, 0x069387ce0c6a6a02, 0x500dc2b8d601ef5e,
+        },
+        {
+            0x2d86ae2d512ecb5c, 0x81d73c4d7643ada6, 0x8702f33a41da8811, 0xeb02d514853d74bb,
+            0x5bdc0fbf529ef701, 0xaf5e7f91925b2178, 0x00eebf945efd585e, 0x1a827d7bcba1d151,
+        },
+        {
+            0xc431d39bed935d2a, 0x58325d58adf96171, 0x51a33b1a95bbe4ab, 0x1df5c824c9cdfcd8,
+            0xfa8158c3fb02548e, 0x877d2977dfa1055a, 0xba1e4fef9c14daf3, 0xbee9ab9209b71f19,
+        },
+        {
+            0xd959f317635abcf0, 0xa516a43f99e17618, 0xed90ccf2ce3bd99b, 0x2fc6d460a9fb3290,
+            0xb61ebe090cde4302, 0x5a3b061ff908003b, 0xf51bb736f60f5787, 0x1717f6e9057efc2f,
+        },
+    },
+    {
+        {
+            0xa8bf21726ddc3d83, 0xf68deb6ed88207bb, 0xa8eae2ebcd03bd7e, 0x64c7f57e951f59a4,
+            0x8badb223a1786d57, 0x2e7fda6071182790, 0x9dc90e369a5a9457, 0x6eca838bf4b07e07,
+        },
+        {
+            0x9a4b9b92167cdd1f, 0xa9118fc0f879b894, 0xf6e73387c55479f5, 0xfadf82edc626d292,
+            0xa03bb76156e80e6a, 0x59a783f9f27555d1, 0x027d63b63d087e43, 0x29f9ff3202fdeded,
+        },
+        {
+            0x865e07611b8c82e2, 0xcf11bcb9a659f2ab, 0x1804bbeb7c868143, 0x2fa89a0e453e36eb,
+            0x42d69d8f2e17bad1, 0xe7fcea6fdc2ec741, 0xe7f19b45379ceb37, 0x84f0bd8949bb35a0,
+        },
+        {
+            0xecb8f92d0cf4efe5, 0x88c47214960e2d22, 0xca9549ef6059f079, 0xd0a3774a7016da7c,
+            0xd51c95f61d001cab, 0x2d744defa3feeec1, 0xb7c20cc20afedf2b, 0xbf16c5f171d144a5,
+        },
+        {
+            0x20bfbd77642c467a, 0x3452bb12259d50c8, 0x0d3ba9c7ec7ffab2, 0xbbdb54543560e541,
+            0xab1d6e22d63ba04b, 0xdf6f11d37d24f015, 0x7c4d61d2f3df15fa, 0xd5269f7940b3288c,
+        },
+        {
+            0xa8ca0be24c4b12c5, 0x633292b628762d5d, 0xc04983f2827c0d5e, 0xcb6b867dc707ef03,
+            0xa7fc0d5bb9ac1124, 0xa5ce085baab7dcaf, 0xb85e8f1c1cfda998, 0x8208df4227822503,
+        },
+        {
+            0xc480938fc83f86c4, 0x6479b8efe43bfcc6, 0x8e6f2e2238cabad7, 0x48e57fdd31f8c6aa,
+            0x66dd6a77cfbbdcac, 0xc7d9950b50ece329, 0x2e31f2050747a937, 0xc0f8a7e2a07acb8a,
+        },
+        {
+            0x81125450677b7a8f, 0xba889fcee69273d2, 0x4a40a859582c5990, 0x836638b3f48934c3,
+            0xe964e189f3596ba6, 0x2f417c0ede8b0754, 0xd883169fd5f93f1b, 0x0318fe4ed45bb389,
+        },
+        {
+            0x55b77ef4418acd7b, 0x64ba62d347a77d32, 0xaec1aa932d1f562e, 0x3468725b10dc5999,
+            0x422851b16ff0d478, 0x15da84298e7dddcc, 0x38567920b8ac5238, 0xfd29eb4a2e3344d8,
+        },
+        {
+            0xb0a31a1c855512cf, 0x293a819ed71d4c4e, 0xc1ebc896cd6a900f, 0xc727a6469b9e0a4b,
+            0x06124fc00018f29f, 0x67bd8fed41b7730c, 0xeeebf0f0c77be72e, 0x427fe6fe474d747a,
+        },
+        {
+            0xde4873646fecb64c, 0xa8fda1fdd15fb62f, 0x97e2febe088de028, 0x4a769019ecdce095,
+            0x4cb6a33850a58ddb, 0x08df59d817028d36, 0xfe3a80ffb51722b7, 0xa3cc2fe2963c2383,
+        },
+        {
+            0xb559e34d674d10cf, 0x6955bb699f962ec5, 0x8bf1ab6c542af42d, 0x3f2f33fadfa61256,
+            0x3214019573d1049e, 0xf5089278dfd7f39b, 0xb42eb51cb4237be0, 0xdf747f44874d0e57,
+        },
+        {
+            0x0851631f7fd52a3d, 0x9881db71949ad4be, 0x4b2337dd88caf772, 0x02da59de33ec7979,
+            0x2473c620afe840df, 0x2965ebffa92ef1d0, 0x2452854f6fcd9651, 0x97092935bac2ed99,
+        },
+        {
+            0x91973d4d4aa359d7, 0x249f510cc8dd0582, 0xef11ac877608be27, 0xce116714d940b1c7,
+            0xf34881f3fef20037, 0x2622247298203f4e, 0x4c9e98ede9363154, 0xa806b3a603a8158d,
+        },
+        {
+            0xdd4a1a18cec38056, 0xe6ef179375544998, 0xf58f69cf30583fb6, 0x12197860aa76bf2b,
+            0x717813e53bb686fc, 0x9beeb1ae0f06c403, 0xd83416ee2782dc86, 0x5fc89c01b5500ccc,
+        },
+        {
+            0x26bc537af0c1bb4f, 0x37f376ffd06b90f5, 0x4d48d994be7c89cf, 0x511c21588d572003,
+            0xc26fbac1088dda1e, 0xc3d551897ad4934c, 0x5233c17685dcaf7c, 0xec3a8a29a88b473d,
+        },
+    },
+    {
+        {
+            0xfd96667ab1f0c175, 0xa256a6112ab99e7d, 0xff07c1ea05e43f9d, 0x305700bc7e1c9cd6,
+            0x3f1e25462b2887a3, 0xdd782f49c772fd14, 0x9125f99638584057, 0x19fd039616a02cf9,
+        },
+        {
+            0xa8d62bd34c58174d, 0x872251d3a900551f, 0x06f5862df12802c3, 0x5d93c48add925555,
+            0xc39b67d5bd6006f8, 0xea6f756bf96ccc67, 0x140e853e543014db, 0x2bdc5674e9de42c0,
+        },
+        {
+            0x01dfda7be01c073d, 0x07a6bb65ff9e1234, 0x2a4f7f18622cee4e, 0xdf4cead850f0a3a7,
+            0x152b3c8e1b8c2903, 0x9e82e9995f2a89b3, 0x0e6cfa7e68ce7a3c, 0xebb34d900ca0464c,
+        },
+        {
+            0xfa1a58faeda49f74, 0xddb899570e4545a3, 0xd3576489c74c07e4, 0x64e4b39eb59b1008,
+            0x3b090340f66b546c, 0x0e0f4013cdeb912f, 0xbb00b46c01e55cca, 0x55b61b3499ad0768,
+        },
+        {
+            0xb06b71fce8bbda5b, 0x8de64d84a24b0a63, 0xb73dc262b5d4603f, 0x5d5fa9641965a916,
+            0xb48a40533bc98966, 0xaa8718636f564743, 0x88b00822e76a6a3e, 0x58c9e92eb38d9e0d,
+        },
+        {
+            0xc0d22337e989963e, 0x2c4831ced3778d5a, 0xd775c6a5ee8c4178, 0xe23916549d0c2894,
+            0xf7d4fe865d0eb314, 0x42801b8f8b2290d3, 0x73e9b332cdcefa78, 0xc0d169d93e877fea,
+        },
+        {
+            0x29c8138bffee23fa, 0xbff98230fb92e3b8, 0x14077ad58fa75007, 0x4d3a6e1088e61b81,
+            0x218a867d3bcf733d, 0x20ff6566665e37fc, 0xe39c0581da5cbf67, 0x4a6e1d7c8add8c4c,
+        },
+        {
+            0xcab02370734a1327, 0xa1df7afc1951afa8, 0x581cfbaf42638b8a, 0x39db6d2b2130eaa6,
+            0x4bbc805bda2f91a5, 0x3dcb0a7ee569add8, 0x724ab65ad721fa7d, 0xa5152b95f88f8008,
+        },
+        {
+            0x7fe7f1b9281615ba, 0x419d1a5341d5aa0c, 0xafc556dc9fb0917e, 0xab2a69f3616ce893,
+            0xfb9a6eb1c0861e05, 0x0b74ae115eb02b8f, 0xccff0ad53b1e44fe, 0x86dfe0e688824f53,
+        },
+        {
+            0xedf38dc441177a46, 0xd9a955bb7f039a7b, 0x4f1525814d8ae7c2, 0x063c9f834f848819,
+            0x54ea4526841e8783, 0xe86a4119aa5f2b32, 0xb7529a3b19846dcf, 0x91356a0735689d70,
+        },
+        {
+            0xbe66f5db8f049ef8, 0x0f5fd99ec38dd5ed, 0x1896d52b1b4ae7a7, 0xf27c45c6480b1ebb,
+            0xd88cff4c3fede5c1, 0x57d902c9da27560b, 0x84aa7f0752d57deb, 0x8da4c7c808bb6028,
+        },
+        {
+            0x658f4dea8910763e, 0x6e5fcb48076a0f80, 0x6a5447a4ab65f9b9, 0xd7d863d4a75bb0c5,
+            0x806c34a7e87e7916, 0x05391559cd961e88, 0x5def2d8874fe6aeb, 0x8ac350b2f9226ca1,
+        },
+        {
+            0xffa8a64912401813, 0xd61827625337c55d, 0xfce9d7ff3be902e3, 0xb3b275d1ea0dd7a5,
+            0x342620f42cb48ac9, 0xc0369384a8b38a74, 0x04b0ee6ac0695d3a, 0x4d02558594c5394d,
+        },
+        {
+            0xff9635d081443d16, 0x2342cbfaa6cc364b, 0x63b0a03225bf8438, 0x6ccd3ce5a078d298,
+            0xf93bd10891292fd3, 0xc887a31b14073286, 0xeb1275bf9f62cd16, 0x0335bae361578b46,
+        },
+        {
+            0x810d5efd53348e4e, 0xf9cd822a63c74225, 0x93d2e810a426bf44, 0x95a47a97019d36b3,
+            0x1da421b9d5d1f840, 0xe5b8a55fd6c46e3c, 0x2dd3a5e7c9244881, 0xd50f9cde70c1fd2f,
+        },
+        {
+            0xbee2aca7614d9ff3, 0xd1f13b2c358f245a, 0x9e92d83fc46f62ab, 0xc1dd32dd827d7374,
+            0x1636d593c3e566e7, 0x81c2f4e704ccb02b, 0xb57782c6cd35b652, 0xad88787e88210d42,
+        },
+    },
+    {
+        {
+            0xb5b383c6150b0fcd, 0xf948da80ed9b0f4c, 0xcf075225ccd05413, 0x3f31b12c4f62be64,
+            0x23b21fc8368c17f6, 0x423d5369400bc690, 0x5335dd1edeac140e, 0xe631c2499493ad61,
+        },
+        {
+            0xb23d262021afa86f, 0xea757f0386b11457, 0x0bc4d2d1b0148d30, 0x119b553588ce4170,
+            0xaab5bb670aa9c8f6, 0xdfc9693c88e05de2, 0x6cae7e57e3f1e9c3, 0x2b1ceb546f6c3b9c,
+        },
+        {
+            0x67539fcb03cdcc63, 0x72fdb551cfc3afa9, 0x573534e10299aa97, 0xaffe71792664d651,
+            0xe660fa10f5ecccf0, 0x8df4394f403d6c62, 0x1bec4f0f317f5786, 0xc019916cba461d74,
+        },
+        {
+            0x12e335ca87636183, 0x1461a65a719d1ca3, 0x8150080ab14161d8, 0x08da4ebfc612e112,
+            0xc95dfb6ba8498a9a, 0x099cf91dba0f8dba, 0x12d2ae144fb4f497, 0xfa3a28b033cb7306,
+        },
+        {
+            0x5e38577b9ec7f1ff, 0x9deaab67036c29a0, 0x624127222cf0939b, 0x98c2a3489b5105c0,
+            0x3069a08656706b8d, 0xa2296ffb714add6b, 0x537a875bded85a98, 0x6705fef2003debd6,
+        },
+        {
+            0x9cd779bdc3141d13, 0xe4acdef291873685, 0xe804c2cc4e4305b9, 0x03c2e8392d86bd6d,
+            0x95d53c44aee7c9a3, 0xb303ea1a9f8d49b0, 0x5c3579b5c2c57bc9, 0x09ac7359ad03f6a6,
+        },
+        {
+            0xe9b3cfc3afb8cec5, 0x533076ae3630ab58, 0xd50dcfb8f0322634, 0x853af6f47b737a3d,
+            0x270362cefa4582dc, 0x3019bfda74554a48, 0x61487a210f4c8a66, 0xa5b5f3612130610e,
+        },
+        {
+            0xc89fc5d00f01c7ce, 0x6fc45ffd7283bdf0, 0x71dece8181151923, 0xed1cb14cc433fcc9,
+            0x4279612bd3959bcf, 0xe163880b35b5732f, 0x35414ca771d0a1ca, 0xe8b9e6512c1e47f3,
+        },
+        {
+            0x08e790f47f234b60, 0x85982d79c3146a9e, 0x24b625a2e20695f0, 0x592a0f387c0fefaf,
+            0xd6c6dfb2f18f3e5e, 0x8b3b0965ff75ec27, 0x52c98729c5d5b683, 0x4ccb3afb0aa06eef,
+        },
+        {
+            0x8f4114449b18237b, 0x9de69013f5378be1, 0x6b6fbe348ce09b7e, 0xfb0a47275db89266,
+            0xed6d130bbeeb954d, 0x456f7f09fedacd73, 0xf213193a0b93bfd8, 0xb1d4668e5b914ffb,
+        },
+        {
+            0xfc76e4cb83805fee, 0x22906c594f7d948d, 0xc102605061cc2c63, 0x489fa9b75df3d6ff,
+            0x49ed589b7eaad014, 0xc614723489db1407, 0x8b2f9aad1ff0944e, 0x3a27e3951c6f06d5,
+        },
+        {
+            0x4ff11b0cc8df0a74, 0x346ba520e095ea9a, 0x81dd2268cc2bc6c0, 0x2fb2e99fc2701468,
+            0x0d21336198053f0e, 0xe0b8280df7ae879a, 0xd92b7a75952560f7, 0x8d17dfad9723b62e,
+        },
+        {
+            0x3061b859dd128e16, 0x5d51b3191c630198, 0xefea057bd32866d0, 0x1dd7f941f60023e9,
+            0x203b4844f64f3818, 0x464da56070bc61f2, 0x7384ab1146d9978f, 0x05ef7bf567d188ed,
+        },
+        {
+            0xec4b773ac0b58988, 0x9226f4b0d5e9b7c0, 0x0071b882ae04dfb1, 0x37fae7b8bdc9325a,
+            0x29541bcef3d41ec8, 0xf7335bfb19df5dfe, 0xaebff477a02618a8, 0x121669d8c1c3b324,
+        },
+        {
+            0x82cc6cf0df20bf2c, 0x1f0e3c8a447fe0b9, 0x5145192310c6a9b8, 0x6bedf8760be84538,
+            0xf7c21a91ee294c18, 0xe90608f1a7a40802, 0x19483c377149cd72, 0x654fb630ded73b3c,
+        },
+        {
+            0x5ce8a78a08b21362, 0xf37f5e7fd9fe0b36, 0xdca66c7f2c87837c, 0x92524b940bf2e993,
+            0xfc0f020c71745788, 0x6018de463cbfbf4c, 0xa8446691ac3de1c8, 0xb194d4195de5ae41,
+        },
+    },
+    {
+        {
+            0x29aaa4a89ce76a94, 0x847cd081c0725c97, 0x0c099e9097e16665, 0xe409ffc98f7b1fc4,
+            0xc0575b80690941ed, 0x8e25100a92c0ee9d, 0x71662d279b75837d, 0x6eeb9e97e56bb22b,
+        },
+        {
+            0xb3e76e66528960b1, 0x445dc393d84aecb3, 0x136184361612ad64, 0x3ccbeccc8c831e37,
+            0x0fb0bd416121383c, 0x316164a380d895a3, 0xc3d34153233f2f1e, 0x2905906fe0d92225,
+        },
+        {
+            0x967dafb7b790881c, 0x2002b8e43663e76c, 0x3bd28edef8e82490, 0x44dd2e814bb2a47a,
+            0xde750dfedbc3f2f8, 0xd9b6e9126e2eec70, 0xe8400e2f1e4c4d2f, 0xd332569723217be2,
+        },
+        {
+            0x963d87934d217a2e, 0x099e8c561fa4702d, 0x6d91bc47e6431f1b, 0x3fd21287a5f61399,
+            0x2fc90bae682fa08b, 0x51699c85c1ca371c, 0x16f29d74831c428f, 0x0ecefb669fa2b504,
+        },
+        {
+            0x884be61c460ed764, 0x388df47bb6041177, 0x2708976360b29b0b, 0xd66d7d53e502ba08,
+            0xadec85ca5acbfaf4, 0xfbacf9b7470c9519, 0x5d18b7f6dbcda5b2, 0x7615c0360f228ed5,
+        },
+        {
+            0x4d725c1d67a95e56, 0xc36d6e8b8e17af44, 0x38ffb699313454c1, 0x22c3da8c991e4eaa,
+            0xfa36ee150bb72dc0, 0x356bbf744fd01d32, 0x9ff71a303c7939a3, 0xa0ad2fb5691786e9,
+        },
+        {
+            0x53eaaa1fc192bc29, 0x09504e7a4123a9f2, 0xe897397f90671997, 0xc56185d24294fda2,
+            0xb531f2789819b185, 0x390155ffe9dda4cc, 0x1258a5d914d26bf9, 0x47d8f5ae7e5f13a1,
+        },
+        {
+            0x8487eb9068755cf3, 0x1887394e7fe12541, 0x2e4c65d446af8ca8, 0x72aae645b9e119dc,
+            0x958e00941ec6ad73, 0x84a7eec48ce4573e, 0x3d6d00d4f9254b96, 0x4ef44f588e421732,
+        },
+        {
+            0x17f8574421eb9f54, 0x1ed814049330f148, 0x491e4d1d0b3a3240, 0xe141296df6ce32c7,
+            0x0895db722609408d, 0xd3fe5407346826c0, 0x74a8973d8c5f1c5f, 0xa728c5a828e087b3,
+        },
+        {
+            0xab71a6e69a2fdb8d, 0x9e1181b81f428911, 0x2c9a56b77885eba4, 0xa7f656b21edc1720,
+            0x7b223f05fe00bf3a, 0x9fd519326156275b, 0xc5436d0a8e1df730, 0x490edca38063f707,
+        },
+        {
+            0xa60f7a9ae389cd6d, 0xc138748120dae225, 0x9a9f9fe20f204c7d, 0xa826472be312045d,
+            0x63b3970344addfbe, 0x33ad9b39b1935e58, 0xb9377174bb0c05e4, 0x4daca644e472b935,
+        },
+        {
+            0x7ab48542ce258ad8, 0x2e9957374a8cd524, 0xfd6df637d7493acd, 0x599ab42c675ef715,
+            0xc52e7332b0a83e9d, 0x00602b6e6bf49d4c, 0x0456fd12ee0eee42, 0xad28a4d79611f2ca,
+        },
+        {
+            0x22ac46e236f23fd4, 0x4f9cc9c9f3456331, 0x4024bd3cc7cad27c, 0x63139a722a2f4f7f,
+            0xa103695c765d6c22, 0xd12c5cc947f8e744, 0x22bdd8474d319339, 0x0989c1b7816c07fe,
+        },
+        {
+            0xfd6fd4603cbf6434, 0xcb698309363a33b7, 0x52b9aed38976370f, 0x3992cba7ad3d65df,
+            0x423cc05b7769bf7b, 0x19ea1d7bd0afb59f, 0xf3a58b5dbf10a748, 0x2fcd3390ad491638,
+        },
+        {
+            0x4fda789adcd572a1, 0x58776624b0862e78, 0x2782603aaf5ac7ec, 0xc0a427ceceb4638f,
+            0x70c274d9a5323b62, 0xa9916df177c76d89, 0x4333867b64a01b88, 0xf0984024e8c6153e,
+        },
+        {
+            0xf59de0f87d3ad2ac, 0xd2670cb1c0f92c5c, 0x8f05944ac900b6a5, 0x11aeed238d9668eb,
+            0x21b038e47c488ea6, 0x406ea3f778083d75, 0xd22197b43bd31fe2, 0xdc8f8ccb28a6ef9a,
+        },
+    },
+    {
+        {
+            0x679a648302887281, 0x13f3d39b7f9de66f, 0x289c3c50f1a7dee2, 0xa510a53c40b698b8,
+            0xc566c3fb06f799ad, 0xcc95a879b5374650, 0xbd7343c061c947b2, 0xbbbff69d9543e51b,
+        },
+        {
+            0x0398381d11476dde, 0x4959204d1ea0923f, 0xd67427ad017745bd, 0xef022a746935e467,
+            0x57e799f524e0380a, 0x6ee2b64fb5f1a730, 0x9aeaac48521771d8, 0x02c8521c0992a13c,
+        },
+        {
+            0xcdca4b1e55c1759b, 0x3d46ee3ba6819d39, 0xf7497adeb4b0fce9, 0x54aef506dcb613c3,
+            0xbc11d721522ff464, 0xf53f16f237bd3c51, 0x88f29955485695b9, 0x428ce742dac00fe3,
+        },
+        {
+            0xbfe5c43b153adbf7, 0x07a66edf80351fec, 0x3d8042353b109e60, 0x4dc97176a832c162,
+            0x03fec75fb1db1e5c, 0x6aa02da6a15b9900, 0x5f9e808f4faa1cff, 0x90aa28bda6412a26,
+        },
+        {
+            0x522a6925876db0fd, 0xc5401ca17a9a4211, 0x89163b576789e755, 0xd2b2c99a0fd6f1b8,
+            0x427eea22a7b452dc, 0xce8e6682ef9db65c, 0xfd835810da9c80f7, 0xdb91bfbbea916411,
+        },
+        {
+            0xb19de6f12983bd4d, 0xb990931e1e3a28b3, 0x43b71b8b00cbc4f9, 0x35d1ddd0f4d75a0e,
+            0xc211951dc653f111, 0xbbc4682488750928, 0x0cf6e752174803e3, 0x81f5e0ac8960d80c,
+        },
+        {
+            0xe5effb4e5b11d6c0, 0xba30f74701c8374c, 0x8733511b0c275aec, 0xf140b74097354e36,
+            0xb01ded690341268e, 0x17bc317627eac17b, 0x880977038984992c, 0x37bfafab3e05061c,
+        },
+        {
+            0x0dbaf1c99ce0fcd6, 0x732ea65e3232a847, 0xdb2ce2186a75d822, 0x88ffd4793d2273ca,
+            0x89092ad2f2f26b61, 0xfb7041bd686706ab, 0xe3d5fa755e23597c, 0xa2035bf85995fc84,
+        },
+        {
+            0xc8ded766cedd2cc1, 0xa3e48e9d6447b925, 0xc73282a369efa728, 0x8cb72c308d408bec,
+            0xfb4f279741cf92eb, 0xef3f42a026f2412e, 0xdbc0f972a941ab5a, 0xc7bd62dd98337613,
+        },
+        {
+            0x22b639f9124eb248, 0xed097f74125f8c22, 0xdbc025175f8bed34, 0xb93f5b4251aa29c3,
+            0x6fedd599c7368c44, 0x99a5a7952c772a9a, 0x30b35ba77a5f156e, 0x9dc50978191c45af,
+        },
+        {
+            0xab3a4b0d0ca6cec0, 0xcb23537467246ec3, 0xdf9b0e891ec2538f, 0x3ec2ea1380c7b53d,
+            0x920c55f2d0ae3146, 0xd3ac4e1e43946090, 0xeba7258397ebe7a4, 0x5031644a393d401f,
+        },
+        {
+            0xdb456c1ab9ac4754, 0xf497e6e94d3f305a, 0x84d27e3a3fa62dc0, 0xc18c35692524b94f,
+            0x92198954e380f5cb, 0x81d8221c272ea458, 0x6fa082f65f328491, 0x810ca5af8e304ccf,
+        },
+        {
+            0xaaebde75c910b521, 0xc803ded4a7d5dd9c, 0xc8b713b062764be2, 0x5ea9ea2b92540cf3,
+            0xbaa999c66930bd0e, 0x57052e531f4b254c, 0xfb9fd6992b0b27ee, 0x86b709324cc83793,
+        },
+        {
+            0x5d3ece2e493d76c2, 0xa425f3aed804954a, 0x49100271eac95eb8, 0x94e4dfa038b4be56,
+            0xa855893f650f9930, 0x1fa0a07d50264765, 0x37a3c1690d1d40be, 0xfedb51e42eed2a0d,
+        },
+        {
+            0x384f37f4f71e84d4, 0x57de947359d6481a, 0xa9a81f99f5e6fa70, 0x26f0a64f6cb57bf3,
+            0xc07e1c13061d38fe, 0x6fae70e94a475732, 0x6cfb6b1d840e595c, 0xb23cf1f262848351,
+        },
+        {
+            0xb5deb892313de667, 0x75c872d766a478a8, 0xb67b5513c4992428, 0xf97e010ef70fde09,
+            0x49b0f05360ee268c, 0x981b5141f67cd321, 0xb5a1ac8d4fbc187c, 0x162417e2c12e6da8,
+        },
+    },
+    {
+        {
+            0xd44550f8849e6d32, 0xe7bc29d4fe16485e, 0x29bbfec62f343924, 0xeeb802f240f2b5ce,
+            0x2b337542bbb64f33, 0x4c1d3a369f9bdb3c, 0x1067cf3bc7a1cb88, 0x3f12a31d4601fb6e,
+        },
+        {
+            0xb720a78f1f8a4a91, 0x59e22211753dbe73, 0x9f5ad99cadd0991a, 0x3a0db8027380726f,
+            0x37f0761c7dfb4f1c, 0x68e7098a5ac819cd, 0x9683d61037ffe348, 0x5bf205e52b7b5140,
+        },
+        {
+            0x32a7189573e92186, 0xbd16cfe9c6279363, 0xe3e4199cebe054d6, 0xab0ce65f01902295,
+            0x72c932d0f8f9734e, 0x853cb323f5fb04af, 0xa3950df5054a2611, 0xc1a3afaf285703bc,
+        },
+        {
+            0x9846b5f661a97262, 0xedf2cacb974a82f7, 0x3dfab85faf439654, 0x43fb0ef9c724ee09,
+            0xd0d5016f53b0119a, 0x684453635bc8fc81, 0x6d10b6491f65d298, 0x0f3c88c621a4e64f,
+        },
+        {
+            0x18682b0864588bf1, 0x7bd229bb4c38616c, 0x57a7b29c2f655d93, 0x34993505e888ef2d,
+            0xd3e4ef880983dd2a, 0x1d895d8f76b0f1c0, 0x9982e2ab09f2d5e2, 0x6b63dd3e7afc1d29,
+        },
+        {
+            0x320372a17f34c517, 0x5602bd162378bc27, 0x666a592d91aae024, 0x716886ab317bbdaa,
+            0xce55fe68e3045103, 0xf2c4b0b27de1d701, 0x8da358857d724cb6, 0x9aac623c9ec47314,
+        },
+        {
+            0xab8a97218bcb77a3, 0x437bdc8f2d8f79dc, 0x7dd76986d2a560fb, 0x5cf29d50f2064cc2,
+            0xb946d54dd571813c, 0x0adf6ee2b0bcc97f, 0x4424255d498cc8f1, 0x562a6c66bd067832,
+        },
+        {
+            0x824cff46b8529a01, 0x6e4d82a24856b95c, 0x58c6b833c65af7f7, 0x8a6c4125ae110e53,
+            0x38207c304f083340, 0x71aa384b176cdb31, 0x1ada294142882de1, 0x38b1ad2ec16a2e4a,
+        },
+        {
+            0x0556b74fa0738fcd, 0x6dc0f08a1bd795d8, 0x601b55aceaf039f9, 0x8cab0d33e5623b97,
+            0x30b2e6550f7a398f, 0x83859b76a94efaa6, 0x9324f2676dd07b3e, 0xe6ebc4d73b75ff7a,
+        },
+        {
+            0xbdda2720142bcb30, 0x56175263faf604d1, 0x086189c1e6796314, 0xdab01c685b04dd19,
+            0xce54e4b0ba8ed3c1, 0xf616513be281acfb, 0xaf1796295e0a6319, 0x85e79ac9328b587b,
+        },
+        {
+            0xd8af013c122359a7, 0x9202869ff0147aa5, 0x2880977a7b7b2bf7, 0xc2f0e68ca2286cba,
+            0x1f70239db1b03e79, 0x7418b9f16b5fc301, 0x3131f26e2af9c326, 0x346a460c076e47f4,
+        },
+        {
+            0x11d84588c9fd7da0, 0xa78682d01238d0c4, 0x333ddde0829d6475, 0x80c8844069de9e18,
+            0x5d15f21ac6d8176f, 0xdaff9434a509d470, 0x0191bb0a8bbbfcd5, 0xff7732b808fc2688,
+        },
+        {
+            0x04629a59e0e83ed1, 0x177971c0059a7ea5, 0xfd79fe74bcd1a2f4, 0xfe9f0af34fded695,
+            0x437d272ce14a791e, 0x450381fbb596eebc, 0xafc9c15882f3a78f, 0xee8910e5ff2d711e,
+        },
+        {
+            0x02fe772d5ab3d89e, 0xf1580ec99a786c91, 0x8fd834175a323866, 0x93711d49badec96f,
+            0x2020c34a6b9b4a30, 0xbf10e000b8b0de24, 0x2a5f298d28de3ce5, 0x807a398efe1a1c63,
+        },
+        {
+            0x2a529afb63c60793, 0x370d3a5ee69b13b7, 0x5e8e1e881a94059c, 0x038401da1232474b,
+            0x450b9304fba5da30, 0x8c22409c4a3142f0, 0x3c77747840a98d19, 0xe026b7e7d6928ad6,
+        },
+        {
+            0x9fb640cd73f7c45c, 0xeb1f87ad0afe059c, 0xa3c3979a52b168d4, 0x6eef460c7b1e403f,
+            0x6d943e502724bb3f, 0x53f3f1bbf9d922d1, 0x547e7a03cd538b4a, 0x37631e20d2c4145f,
+        },
+    },
+    {
+        {
+            0xb7c9bf06970e164d, 0xc27a88d8bd3d3087, 0x8a37c9cdf4e7c899, 0x18494d5aab411371,
+            0x06532375d9d8b29c, 0xb92dd45c915a2f74, 0x8a23f6bf515acb02, 0x0e69248c435bfa89,
+        },
+        {
+            0x561454fd6113a9f8, 0x78ebe733e70e67e6, 0x8764360b903f2feb, 0x2ba3b3d897902f36,
+            0x28808cef87490b8a, 0xb1175954f05f31b3, 0xbd5d60056c9b4f4d, 0x12b13fcadd254e60,
+        },
+        {
+            0xbf8474449a7a4ede, 0xb26b1f15f5cfd20f, 0xf380ed7d83b33b64, 0xa21f95643d1998c9,
+            0xd985c7d3a720e347, 0x980789748bdf09d5, 0xa1f34ce2ce947692, 0xf69e6144f419c385,
+        },
+        {
+            0x7fc071ef16f55d40, 0x701954389bb45ea5, 0x83cf09f2a35543ca, 0x07e91a8420554c19,
+            0x51ecd70162a9d06e, 0x00e14c622044a663, 0xb1317c1300423dd9, 0xf49431bca46eab4c,
+        },
+        {
+            0x2ed5548a60bffa60, 0x903708bb6e0c4e34, 0xcbc42d78a1db5bad, 0x152ad7376be148a5,
+            0x8b3fcda3ef8265d6, 0xcfcb34f3790c675d, 0x0c2954b5d333d235, 0xd4a7d1694a3203cb,
+        },
+        {
+            0x575bdffbcdc0e5cf, 0xeeb8cc135f611433, 0xe3b489f974c16d43, 0xb5c174dfc22ed997,
+            0x68cea9b6afb9c1d8, 0xda546da265cb574a, 0x688d2edc0e15c4a8, 0x3ffc898fbf45b307,
+        },
+        {
+            0x2e355f1be45b69cf, 0x570bb7976a5a8c53, 0xa0a43c059f7d0264, 0x1cd74a04220e4a61,
+            0x2c352e876cf3ac0a, 0xb7672e628212cb78, 0x045a0ba3fc6c032d, 0x33e7bc4403ad9bc2,
+        },
+        {
+            0x35118434d0614aa1, 0x8bae9779d1418434, 0xf5641d82b8c15b89, 0x2383af56416432eb,
+            0xa552d3f02c73f990, 0x8df82e9ea6bbdc7d, 0x0f336aa8d75ec634, 0xc42e3b2d1603e53f,
+        },
+        {
+            0xd91049cd9ecdf09a, 0xf02fd6837df9e948, 0x29ea2cbc75999b7f, 0xada6da88deb478cb,
+            0x1ed02e2f159d0642, 0xfd90aec58d6e28c5, 0x1795082ed2fe2b50, 0xd16d33cdcced0c3f,
+        },
+        {
+            0x700e4ed20f51d7a9, 0xb29a71b431ea3e87, 0x33c7ad4a1717ee5c, 0xe093577874793310,
+            0xe066ceb1c198206c, 0x560e71bdfbc80797, 0xee3e56feaec5d6d2, 0xf8608a5a6ae9c6ca,
+        },
+        {
+            0xe7ffde102308a01d, 0xc14fcf7baf0a8194, 0x2f3a852bc67b1b1c, 0x67487f0130f0468e,
+            0x12ab50a11a969483, 0xde6d6e48a91366b1, 0x82d74ee9176e1047, 0xe1a933e77950f1e1,
+        },
+        {
+            0xd3b730bac3c32c0f, 0xd40b1514e2a7ffeb, 0x9fe2f2ca691aaceb, 0x1d402e6a5804b98c,
+            0x286df9c2b8c225bb, 0xa920c30e897f3131, 0xa53cf00b18df5c0f, 0xdf2af8fb941a9454,
+        },
+        {
+            0xd87d4ca55e81a678, 0x133f46665a9d66a0, 0xc25210b67a16cdf7, 0xe05a81fbe229205e,
+            0x9390321da1e5e3e2, 0x557c497f4335d268, 0x5fa1638d27a5c554, 0x90a6add34c7488aa,
+        },
+        {
+            0x21a82697fc5d6ecc, 0xab09603e93075997, 0xa258cf8423c1860a, 0xe7c7afdcde5b40bb,
+            0xb5f56b9ebb4a2cac, 0x486d13f06390f712, 0xfb806e2303c27c38, 0x174d4c22c423af8b,
+        },
+        {
+            0x2a242883bcf966e3, 0xba0a3f06296ff65f, 0x58f644c40974a2d6, 0x1b6757e16f868b99,
+            0x0cf03daa89ca9083, 0x395df427d73bfb60, 0x8337909148f793ac, 0xc20a1c45028cd306,
+        },
+        {
+            0x4b33e020bad830d2, 0x5c101f9e590dffb3, 0xcd0e0498bc80ecb0, 0x302787f852aa293e,
+            0xbfd64ced220f8fc8, 0xcf5cebe0be0ee377, 0xdc03a0388913b128, 0x4b096971fde23279,
+        },
+    },
+    {
+        {
+            0x6c5389aff727ef3a, 0x95ffeb9533db88fb, 0x27cb70429dae0777, 0xd20afe81616dbf02,
+            0x0fab8e18914bf706, 0x3b1e66f30517cd09, 0x24b46dce12e40644, 0x0ff1016808f2d8fa,
+        },
+        {
+            0xb13caaddca9a9526, 0x701c63fa69a303e9, 0xb97d667ab0a50f3c, 0x27c03d7c68e6557f,
+            0xab24e712eb105607, 0x4936aedd8dd86ccb, 0x32196f8a0a986d68, 0x0307b826248f5a65,
+        },
+        {
+            0xd64bab7799458b24, 0x6fe19e252eba3064, 0x9aabd83d74068f03, 0xaef812186fdf8655,
+            0xf506d27b65593fef, 0x0a1ad85dfaa457b2, 0x266d0f06a303dff4, 0xe8114f4eabb416e3,
+        },
+        {
+            0x605f581a88a45b65, 0xcb78920068e58c1c, 0x14cbed65bc5bfe1c, 0xd1af7dc7f02b11d7,
+            0xb8341bc0cd3a7cc8, 0x8e9aefe8a01a77b7, 0x8eeafe875ae2a402, 0x27a0698fc11f3859,
+        },
+        {
+            0xc28c1f81e5dcd066, 0x64d1268dff9e3493, 0xab0db38ebdf8992c, 0xe3790c26320cce30,
+            0x59b408a026e3e4b0, 0xe9e5fe296ab8504e, 0x45c827bd83c9eaf3, 0xc298e23689518edb,
+        },
+        {
+            0x3f06c14699775c4e, 0xb10a4ed3f66e7d05, 0x9300e3ca3a3ab903, 0x0a5610e0de3c3e1f,
+            0xe28273121af56fb7, 0x7e2a2365d75d9a9c, 0x9c3bb05af11f8963, 0xdf94cac730c80488,
+        },
+        {
+            0x4a0b581d84d1c5b2, 0xfc825a4a0dfa90cb, 0x2df2ec9811c72996, 0x82077a6e7dde922e,
+            0x89acda109f28b584, 0x54578eb8e49fe66f, 0x90a5f7004a1c29d7, 0x2de4719cb3b44748,
+        },
+        {
+            0x9b805759c8544885, 0xbe9b99ca7bfcad78, 0xd1db36e12b8fe78e, 0x37255a2dd5387bcf,
+            0x044b3a3ea150ad32, 0xc65bc2a36671ae59, 0x41ce078e1d52384b, 0x3115f1b19e72c300,
+        },
+        {
+            0xd4288fb51c704922, 0xaadd19688c1363c5, 0x9b5c42d752f2cc4e, 0xf9e4bc96c298e794,
+            0xd604f076af0804ac, 0xa441140ab3bb2628, 0x761eabcad37bf6bd, 0x7d192922be1cf79c,
+        },
+        {
+            0x51383e614f4c9c8b, 0x78d171829182fc81, 0xbed6f0d490d72cb4, 0x987612917bea62f0,
+            0x27594570ef3cd3fc, 0xf475953491a8c364, 0xf5c607c52744eb2d, 0x0d6264ebd8d8f337,
+        },
+        {
+            0x4bd00db0b8dbf031, 0x866e0bbe7d2cb92d, 0xad36406e1dd3db2c, 0x969dc881e4e3f194,
+            0xcb3ac9e42a115bc8, 0xb45efd5de0a5ab75, 0x1709c29355377d5c, 0x06d11ba4de6bc25d,
+        },
+        {
+            0x7835e4e9876f8f38, 0xcd421d77090ca6b6, 0x71a1d12dad0604f7, 0x51c2d1581a22e872,
+            0xfe7dfcc8429e45e9, 0x20028f5c48224b6f, 0xf7afed3750abf907, 0x92183692c4ce1a69,
+        },
+        {
+            0xcb89b484170dd677, 0x36b1d3d16b3ee110, 0xe50ada4f0d7b51b4, 0xa2f4fb57fd9afdbc,
+            0xb1b9b81daa6dd8e8, 0x616056a00be328aa, 0x8f6dd943e12b07c8, 0x4bb551c6325abaf6,
+        },
+        {
+            0x1c1bf593c60f1799, 0x388d695064ef800f, 0xf78ef00fce927a87, 0x2a0104196abfff9f,
+            0x13a7b08eb0b7ffe2, 0x4619da3e6da4cc8f, 0x8ac191907937e0bd, 0xf97d3fcb1af4f84c,
+        },
+        {
+            0xb9837258d430488c, 0xf9fc178b7abc184b, 0x035d30790c5e6a11, 0x20cbe540fbc2182b,
+            0x849994e29d76812f, 0x166a9279f7a85553, 0x15ff064319d70aff, 0x3c58e0b04bc6a829,
+        },
+        {
+            0x14a4517480eed542, 0xadd645613362ef7f, 0x39228bfcc5dd0396, 0xe9fdf903ea0c538b,
+            0x6bfd91ec74d235de, 0x96ec237824aa0a47, 0xf5699241af8d6168, 0x0a7b9be3c548a60b,
+        },
+    },
+    {
+        {
+            0xe5255c302ade9556, 0xe328af1b75ba2e9b, 0x9d3391ef41ce9e47, 0xb74cd668fb0ffcc9,
+            0xc67103e4e3226acf, 0xa65ad22cd2959e42, 0x3aaa840699d490fc, 0x3e26a1c29ecc6356,
+        },
+        {
+            0x71c975de4e92defc, 0x81aeb173d0089883, 0x8a30ce4a2ec09190, 0x426e783869a36d64,
+            0x5899a0b6309bd2d7, 0x3b1c24af3cc1a4af, 0xb2aa8142345163b3, 0xd2ad9a692c78c86d,
+        },
+        {
+            0xde59fe5d8e7a4174, 0xaedff2d2ab3b0f3d, 0x4688e9e01f053470, 0x29ff3fb197c95c7c,
+            0xffb930cc85e6a8df, 0xaa4d3175623b6068, 0x682101ddf9716623, 0xa3bc9f5f402db696,
+        },
+        {
+            0xf67233c6ba4e4651, 0x8cf956600714d4ac, 0xd70decc371f1f8da, 0xb674732a7078370e,
+            0x4270416d4ccc773b, 0xc848ff35de87951e, 0xa61506a8493dfb56, 0xd8371ea9767eb110,
+        },
+        {
+            0xb468c3829e6b1d70, 0x1a9019784cd025fb, 0x4bf50c7e5e6879e8, 0x6b862c0f71cf7119,
+            0x6a53ce8906240e95, 0x3ddfaa0a04107ff4, 0x317093cc65532b51, 0xf1e0f8590e27b5fc,
+        },
+        {
+            0x96a97a12fe4674b4, 0x2a132ae6f7c97b12, 0x5afcd087a5f5ae91, 0xfd1d3a32d4805ddb,
+            0x0a989dc0d7b5c8bd, 0x35d186e44429af19, 0x65623ad242935fba, 0x4e274314e79b867d,
+        },
+        {
+            0x47d9201608aaba2a, 0x12b62343f3f4c812, 0xb35bf043464f4b4c, 0xdc9391c0d8e8ba16,
+            0xcc0f8c4a5d460c0d, 0x04ce64bfe20fc6ad, 0xd0289df5aa4b7db5, 0xe0ea15c5e5299815,
+        },
+        {
+            0xc066ee2fda3adfe0, 0xce6a9bdc0c964e7d, 0x04a0115b0c859476, 0xb5e02dc99c95699c,
+            0xf8301f6211377eb9, 0x57b245a2172bca2e, 0xa7d9b4707b47cf1f, 0x1b469bab1774b1c1,
+        },
+        {
+            0xbb9ec3e9da2dce70, 0x02d5353ed29bcdda, 0xc193244ab215233c, 0xb8d5727fd27a4e2a,
+            0x79e56194b6c5b114, 0xe2c20e715ce727f0, 0xc92f34a5236cbfea, 0xcc47dfd156a02b8f,
+        },
+        {
+            0x5cdbda39e983ba13, 0x20f3de576e96c8b2, 0x2ff05aa766b76faa, 0xa876bc62d7f84b47,
+            0x962ef8a90d677d1f, 0xabc7bb1e801d3001, 0xdb5f0b1a7d13a23f, 0x2664f3ab20b819e4,
+        },
+        {
+            0x96be66c5dc45375a, 0x780ee0624a6c24e8, 0xc6fbfd1a013a13ee, 0x6ce1496c21fc4f9c,
+            0x03130c0981f272c5, 0x06e59457a26609cd, 0xf4c5e564ee5363b4, 0x1cd19a117df0775d,
+        },
+        {
+            0xcdfcfa67dfd6586e, 0x358953e51ba23faa, 0x0f467275aeec5d6f, 0xb815967a5b0e6b2a,
+            0xb01bf133012b89b4, 0xdd924bbc6839cc04, 0xa5cd2180120dfd73, 0x1abb11ef19bf8098,
+        },
+        {
+            0xd56c11ce6a281d1d, 0xfb01f45570daeb19, 0xbb442a0d8f29fcc1, 0x9aa60157e9b2f829,
+            0x1f3f6e6190ae8113, 0xc701a1856c946c0d, 0xb4b8926852ba7caa, 0xd657c679b0a5c77f,
+        },
+        {
+            0x0f14eb110dd26330, 0xff6222969b036325, 0xaf833fb8186e735a, 0x7801b02fc7e710f5,
+            0xa0bf821f5c948f43, 0x3be31aea86225c71, 0xe98f4f7be60b1c88, 0x6306588d73c5281b,
+        },
+        {
+            0xd617827783c9f829, 0x67b20e6cc06675f1, 0x8a63fb89cb2d5b9d, 0xcb28128c038c00fe,
+            0x070a51418c7c6c6e, 0xc05e18c38789c3b7, 0x09fd03c2d5c67731, 0xc59e2abbf54010ec,
+        },
+        {
+            0x03977889f1ef2232, 0xbe2c82f19c7409a5, 0x35ac44f932004e03, 0x048bb359856823a3,
+            0x2e108d6cec1cf253, 0xe98e74d7703eb1d2, 0xcaf64f60570ac34d, 0xff814e7d4d7797fa,
+        },
+    },
+    {
+        {
+            0xf7cd1bcc89e35108, 0x924efa4393f1cbaf, 0xe3716559f35b13ac, 0xa0a88e8760370a1d,
+            0x1203be0a8c286ea3, 0x97fc5ab66ebd50c7, 0x2b5b360274284d08, 0x3055716f694a20e0,
+        },
+        {
+            0x7d67a63d5b99708d, 0xfb29bef74b80189a, 0x3cb7eeaa241c402e, 0x328cb6de2c5c2767,
+            0x0d24a7b49cec231d, 0x725955fc0e2e6a7f, 0xa2040cfab7f17b13, 0x215eff8da25c71cf,
+        },
+        {
+            0x2912176326d2b704, 0x90985c21dafaabb9, 0x07a109419a549f1b, 0xbfe6175b5b920bef,
+            0xdc228e114005f56f, 0x24a97a4cc031f91f, 0x2b23e3d1f745dc19, 0x256e1495b4128814,
+        },
+        {
+            0xe4d9cab1c0d41a94, 0xc38b202a9e60f7d4, 0x2bbf6b179336116c, 0x2f9aa8772e068f13,
+            0xf8820627a4bac9fd, 0x2209cb9e8a593cb4, 0xaa78ec63c7417931, 0x42d212517cfccfbf,
+        },
+        {
+            0x088f3ee32a533311, 0x7ebbc18a543f5a41, 0x6bbebdccdbad1aa7, 0x7bb0be7ecabcfd07,
+            0xd15996d8ae817a07, 0x7c0cf17b054b9e64, 0xba206ae993aab3f9, 0x18692884c63eb21c,
+        },
+        {
+            0x1233fb305334d7b5, 0x41b57555411f7074, 0x099a53713c97794e, 0x656ead5a3a5f00dd,
+            0x9ece696f1e3511dc, 0x1828a6469e5e30fd, 0xe007b8ff604ace65, 0x73da66389b89261c,
+        },
+        {
+            0xa63d89eba23fd957, 0x2363c3c4afdfe830, 0x73b0dfb09eb14363, 0x04ee702753f9afc0,
+            0x3f650bead067957e, 0x92eebee421b1995c, 0xeb74e4fede770914, 0xe95166d7f3e6684c,
+        },
+        {
+            0x40cee5ae3e611940, 0x4e2d9ea90aa090ec, 0x73d167ef1b926e42, 0x7fff36df5d5112a3,
+            0x25587745caffa3fb, 0x224f7f4ec5a83504, 0x5ceff0183b47bf2a, 0xed9bfa73ecfab5c6,
+        },
+        {
+            0x81ae45cd4a21cffc, 0x50bf2f8eb586b73d, 0x62975c5b4ab1cbd8, 0x575cf242001cd985,
+            0xa2b16db2649701e1, 0xc4e4a75688ba821f, 0x680db01b89cd7804, 0x8058604732c1ae63,
+        },
+        {
+            0x7581c13c73f076b3, 0xf225af7e8a3baf1a, 0x6fa0d82d4e86b1cc, 0x209f4168034645b3,
+            0x6613cfcb2fbe643e, 0x806abcd0f3c46a74, 0xd04bc1028a19477d, 0x768888caf68bec02,
+        },
+        {
+            0x442ba0174b44a271, 0xbfd5c7f14259e54a, 0x0afafc3207f8277f, 0x6855dc3aaabe5802,
+            0x6325bfb75a78323e, 0x798aa2b420a04b31, 0x36623a3fe8b1f618, 0x76becd6e53aa02b1,
+        },
+        {
+            0xf3d570b8d9b429c9, 0x69460116c5ad81cb, 0x30833a082f6825bd, 0xa297122a7c99f36a,
+            0x6fc9b84805c3abdf, 0xefe952985f2e24b2, 0xf045275a8915d922, 0x79146aab298a9726,
+        },
+        {
+            0xa9752cc2ec8df6e1, 0x0897b4647c634b64, 0xbaba321ae8339435, 0x0363bb5f9a300258,
+            0x40b599e447af0319, 0x55efa7f78ba38333, 0x4030dd9be8ca605b, 0xd551e50d405ef69c,
+        },
+        {
+            0xb08751d89cdbd4b3, 0xae8de7a0b1195d20, 0xdb08e2fc12c6618e, 0x397fc24f0fc4acfb,
+            0x98692071844eeaa7, 0x2b3e1e6b2c004c25, 0xa1211da1e835fcca, 0x0c881208c73ffbe4,
+        },
+        {
+            0x0d769fe562073df3, 0x7ecad0fc476980c2, 0x60ec0a9e5aa1dab4, 0x21451eb2b01201b3,
+            0x0da4d7af3012ce0a, 0x8a563dbbf8eb8df7, 0x1e30dfb4131dcc4c, 0x8ba6133e17b82f41,
+        },
+        {
+            0x0c7d59054f831d0b, 0xfaaaa26c2d47d4fe, 0x5ac2859985042e12, 0x7eda370b7796977d,
+            0x9f0bd71d95c0be63, 0x7c4601bc8e821005, 0xf1ecbc604c2ffae9, 0x7e3efc579b688173,
+        },
+    },
+    {
+        {
+            0x8348ca15587feffa, 0x585d07407d69e4ad, 0x6fbe5619885a0745, 0x04ee9ebab10b24dd,
+            0x5c27075c0f4c12d7, 0xacf4acdc3c51c605, 0x782fa52bfce336d0, 0x6e1d078f483621d2,
+        },
+        {
+            0x74387a1bb2b806a8, 0x14efa300bad5d0f4, 0xee7e442123a0e9e4, 0x504ae4283b6abdec,
+            0xb8c06fcb927b1aac, 0x55e1c85c323b71d3, 0xf47e180f48d6dae1, 0x6d80dd63a84cb0b8,
+        },
+        {
+            0xa0dbc3819ec64698, 0x770e4d111ef36dd2, 0x01d179158d56bdfd, 0xb48153cd75eb9947,
+            0xc1d17a54fde98390, 0x0817eaf70fe2d6fc, 0x44a63591a6a704f1, 0x9423465f7f554182,
+        },
+        {
+            0x88a686430d7fff59, 0x82b9219367bfe743, 0x1a8b86cfc2ce06f9, 0xa38414a0f9ad6134,
+            0x7f10261028e2c39f, 0x34805c20480856a0, 0x1b3f930218c3034d, 0x1713f457574c0c9d,
+        },
+        {
+            0x19cfc8821b96672b, 0x2759c76b379d1f57, 0xa6cc7a982269a514, 0x1bc2015b683b1413,
+            0xc43b11781bf4be62, 0xd29419757bf2b0be, 0x1eac3587c4591cfd, 0x283169e60e66d495,
+        },
+        {
+            0xd8594800da0723bc, 0x524452dff3c8381d, 0x846dfa02138ca980, 0xaa77a80ce2d32e56,
+            0x27573fbc419c86b5, 0xe7486807b70216c3, 0x8b7a685ac72036e6, 0xa176462715fae3d8,
+        },
+        {
+            0xaea8d0556b1fb104, 0x2ff339a431fe146f, 0x3d7ef85bcf63c413, 0x1f0f57c5289a097b,
+            0x82f2f83b5bda1160, 0x433eea4d6fea66e8, 0x1f3fff4fcae11651, 0xfa71c3fd6b1c243b,
+        },
+        {
+            0xcb52edc2023cb0df, 0x08773a4dd5a24591, 0x0d9a6aaae12a9072, 0x4261f56f5bf5586e,
+            0x184b040260a08106, 0x1b398053b09cfa61, 0xdf7f55b1d5dae483, 0x9554210e86ef2cde,
+        },
+        {
+            0x9a2c1a63107e57be, 0x54fbef467a9b93ea, 0x46942ab3d5d41ade, 0xb5c68550b0cab532,
+            0x5d6172d8c29d0e9f, 0x3378e22b7c6fc5ea, 0x3b4eec752fb94074, 0xb9cea67e7036b26c,
+        },
+        {
+            0x813bf6bf6ab6590c, 0xdda4fe2f7ca3b328, 0x916f9301ee5e00ed, 0x15c888993813e78b,
+            0x7005728b6c8f9da9, 0xeafbeb1b98add606, 0xae2c851859acb98b, 0x8584747f5aad1053,
+        },
+        {
+            0x4dad570d3aa01003, 0x662f8c56896ba11c, 0x378430c638f32d77, 0x96cab2b348ff8a9c,
+            0x89a5280292b7d1af, 0x1589ab7b23382991, 0x23f3907e747dda93, 0x1bbd6616a06b3da4,
+        },
+        {
+            0xa68c441cdaa064d8, 0xc8f9317afc83b414, 0xedbb1bb6d717e525, 0xa8f067866180687c,
+            0x6ba6b909734545f8, 0xa31f6826c57f1e87, 0x675dbe2f2e93fca1, 0x2e5ca85b18d3ebb9,
+        },
+        {
+            0x775c2de065b50583, 0x33053bedaaaa9894, 0xf2fd6d23cd7b68c2, 0xde1c29482ac14af0,
+            0x267cd49d116f7a45, 0x5c4386ba165a04a6, 0xf167d7fada1abeb6, 0x26418d0a72989596,
+        },
+        {
+            0xb047804a1841816e, 0xd46875d9b65316ed, 0x206ef868889b8124, 0x16a1901cba80df52,
+            0x93fa7fd90b7943b2, 0xbb8076b6da6c5400, 0x7b21e52b13ee5005, 0x3ea2c195242a3d08,
+        },
+        {
+            0x4b7e4539ab1cd00e, 0xdc2c733c49cc22b3, 0x3df3d1af7b432214, 0xadcdbfae1ad4e2bd,
+            0xfbb3ad4eb3df677c, 0x5e0dd378ee20b1ba, 0x2cb5b3b96d3c8326, 0x2e90ea1f0fbadfa8,
+        },
+        {
+            0x564d6e859204db30, 0x139bb9282aa84cdf, 0x9413d7ea88476456, 0x5c5544835a1ffa66,
+            0x7b8630892ed18080, 0x589aaf20d14e5daf, 0xeee4f96f7b5f81ca, 0x88d470071bb0b415,
+        },
+    },
+    {
+        {
+            0x1bb400d355c9bd11, 0x8402465c06fc2851, 0xa81ba22d65063b3e, 0xbab2dcbc6e1aa0c6,
+            0xe5f43f1abe645e25, 0x623205334df84be1, 0x14ac708021a2eaf4, 0x3f94646458beb26f,
+        },
+        {
+            0x7e2c5852126506cc, 0xba94aac708b3567d, 0x6905cdf4c05a3f24, 0xbf5f559b3547f8b3,
+            0x9e4b4e62aade7a1d, 0x56b8b9d61fda3088, 0xea3eb4c64c43d89f, 0xfb7e537c9c69e047,
+        },
+        {
+            0xdada9bb90f88095a, 0x7155c28f919ce305, 0x32a01e476d78b266, 0x6da94459b652c4f8,
+            0xa31783a6827ea8ef, 0x4d69b7c6bdb1af2b, 0x2874eb38af31dab9, 0xa0ed9910afd9bace,
+        },
+        {
+            0x4ade066daafd6cef, 0xce59c8def8c1decc, 0x3e12a24a77b96ece, 0xee7c32fc44cc710c,
+            0x70700e4f240e9bb7, 0x837ada546a63b06e, 0xa58ce980d19644ee, 0xcaa5d14d27e7451c,
+        },
+        {
+            0x76f54954a2e23074, 0x9039326417526081, 0x0d095055f3b78a50, 0x1f3a377669d8b26d,
+            0x0575e3bbf5e7c8fb, 0xee7dd406ee40b0c5, 0xe6522e5d55dab556, 0x2d1b5709b61cd918,
+        },
+        {
+            0xa7cc8bbfdc8db00e, 0x1c51f5e43aa7fc1f, 0xb85b782eb4ac2d0c, 0x32fde94b0468e5ea,
+            0x8ad5b9a27f7ff0a9, 0xcd26f4188fdbb3f9, 0x853bc95d6ebf89db, 0x1da0a323a066b849,
+        },
+        {
+            0x66d46ad3ddfd45ed, 0xf0325189e50a2f01, 0xe19b95003ec5683d, 0xc46ab0a291dd97e9,
+            0x74c971d7ed682c4a, 0xafedac2da14da289, 0xd17838fee39ba740, 0xeb497bca053536bc,
+        },
+        {
+            0xca0ed50cf1edd62f, 0xc3c7ae6fd29f48d9, 0xff47bf288a72ae88, 0x584ddfe5348c6666,
+            0x271137e936731fdf, 0x714bc7db88d98bc8, 0xcea912c10da6be30, 0x91cb844dbe62d6a5,
+        },
+        {
+            0xe1ccb6c1eebdbcf9, 0x89ca4552e873842e, 0x4837f1373c2fcdd5, 0x805874e8108a8c0a,
+            0xe7e524f43d442fa7, 0x580d82bef8131f8a, 0x6dcb7d2793d3d50f, 0x51207d3eb5b39168,
+        },
+        {
+            0x19879e780a3e3684, 0xec553912ee249180, 0x8eb73faef8f4c1ee, 0xdee59877b81fd20d,
+            0x2452e63f20b5ece3, 0x17be9422b632dddb, 0x01f8922094311e6d, 0x8f0fe052a332f84f,
+        },
+        {
+            0x8fa225557fe2ffec, 0xc6dc3d32a778448f, 0x4886fedb85f45aad, 0x5bdef90e51704d0c,
+            0x46ad596de2d1fdaf, 0x914e009004126f0d, 0x71aaeb18aef960a6, 0x8f4601e5ac77472c,
+        },
+        {
+            0x58234c89659604c5, 0xa6a421adce4b0872, 0x5dc8848acc19578f, 0xfcb418d04f28bdfc,
+            0xf2e748208d6442f5, 0x0c481d854dcf6378, 0x4987d1a64556438b, 0x763593633157c6be,
+        },
+        {
+            0x1fc3f7a259c437e3, 0x737de2e324235e5e, 0x589a56e37a5eaabd, 0x5a79da8ecca140f3,
+            0x3d8b0d82a12463fa, 0x63fc83d80875daf5, 0x42a30803bd9211f7, 0x62f6167f32d3935f,
+        },
+        {
+            0x78c80f73f37cc6b7, 0x41d286266ab88fc2, 0x2126981c58ca26fc, 0x7a956c64be3dbf87,
+            0x2f41e27dce0ce9f3, 0x0cb49ae0f4c98e5b, 0xba6224a6cace473e, 0x25dddbc0393e092f,
+        },
+        {
+            0x0094e7c6c6f80fb4, 0x16e99ebc351bebd3, 0xc555ed44aae16a6f, 0xe9d2846f2f6367eb,
+            0xb34c93d083d46d0f, 0xc0cb137a894fadc6, 0x21e289f8ab31f937, 0xac5e05161bc72a35,
+        },
+        {
+            0x496c93634626e343, 0xf6999578f4e4c8fa, 0xce7306f6b8648a06, 0xe2775c8cae7996e5,
+            0x7b47e678bf09d221, 0xf5251e1e515c2ace, 0x087f912177b48b41, 0xc40e7725eb38d74b,
+        },
+    },
+    {
+        {
+            0x4b7fab3cc064f530, 0x731153aede175892, 0x335e65033d4c4e60, 0xb0876a8a776ce13a,
+            0xa8a566ee22241ecd, 0xb7456b3e011e861c, 0xa9aff4eb177dd490, 0x189b1ed9c8f77c40,
+        },
+        {
+            0x624de6872857a1fc, 0xbd0a0d9c2ff8f505, 0xeecb4fadc381bc9a, 0x72386292fa94e41b,
+            0x354d3f83e75fc753, 0x06afc753a7a5a6bf, 0x1ce792eeb2f568dc, 0xc5faaee3bd2f9647,
+        },
+        {
+            0x41cab3091b957580, 0x2f50e07bf1d67866, 0x00804dbb9457dbe1, 0xccf64dec97296123,
+            0xcbe4187b89d74171, 0x9b2fd202210ec594, 0x15b6a51fbfdf2029, 0xc10b095b6732bdb4,
+        },
+        {
+            0x175fbeb0f912b74f, 0x45fbe8e16e0ceedd, 0xf0e1aa68d9233ee7, 0xe55fc1ce406a626e,
+            0x20efa1b9e08712e7, 0x5fd108b5bcfd6360, 0xea431df6eec1edac, 0xae1c0521940803f1,
+        },
+        {
+            0x6a165ee044ac89e1, 0x124bfca66a7923c0, 0x384cd031a30e1249, 0xde22a21fbc8c254d,
+            0xa78701b123a54910, 0xf0c384bab3f35bf7, 0x5522821568075bb1, 0xf4edbd9c07d89e10,
+        },
+        {
+            0x584a16d015407ffe, 0xa977f70208a82a69, 0x52eefecf67f8a198, 0xec21373819f7a7e0,
+            0x6795cfef35987b9a, 0xb243403b97028480, 0xac24b12b9c1b9124, 0x1f379501a90f8aeb,
+        },
+        {
+            0x7493df74cf87bdba, 0x178f158b155861e9, 0x1f8b625f45bf1171, 0x83ac4d1b9653b6c8,
+            0x3cda34f0abd687c7, 0xf935facf87d2f0e4, 0x64e1a01b475ede40, 0xed0f8e602ee963d9,
+        },
+        {
+            0xa8e97fb664bc0f09, 0x0b913991c953cd08, 0x8385a1b37fc3bf00, 0xb6e74decb09ccd8f,
+            0x6e1df026ec473ea7, 0xf2f7fbbe530766bd, 0xf18cb47a3292052b, 0x7f8d45929114866a,
+        },
+        {
+            0x82f5ad936870b614, 0x9016f839e165c07f, 0xbf8a97a48ae5ef3a, 0x411dff109f9d7e68,
+            0x548a249c35c0dca6, 0xdc79c65d5ed30b54, 0x06225f1bc2b82ecf, 0x2351222a8bbd0aa7,
+        },
+        {
+            0xf0a1c5658bfa2c22, 0xc28518c32b326c0e, 0xabafc6f0ec107d66, 0xbc7a6abf8478907a,
+            0x8c1c8f6aa2920288, 0x6c87579d930c043e, 0x25ee808db309696d, 0x433bbbdab7a71041,
+        },
+        {
+            0xc4a833632e3d2a17, 0x8d94399291c9950d, 0xd360561685b1e1b0, 0x71995a518cd36b85,
+            0x2bdfde5243c5e42a, 0x0bb7438326f43f3a, 0xcd566dfc620619a7, 0xfbbfc0dcfff87333,
+        },
+        {
+            0x48d6d957b3086691, 0x9946a29b26640916, 0x932ca93c43db59a9, 0xaa61a0c5e4fe91ba,
+            0x9e22e112815bf003, 0xa9ed1b18c86ba8d3, 0x1b5d3c141069f434, 0x3cd2ebd01cc01754,
+        },
+        {
+            0x3fdf1bc39b461ae0, 0x63d64792670ecc8f, 0x1387fe336e3cdfef, 0x34a1a84678ac488b,
+            0x270304424b8246e2, 0x1e64b28578a013b3, 0xb13c87775cb49f38, 0x10dcc0d90758703c,
+        },
+        {
+            0x5c06b2443350f670, 0x7557dc9df6f9c751, 0xa7ebd3b8de66fd97, 0xc126dbaa2befe6fe,
+            0x312f4897396f434a, 0xe05cfcd661a4124d, 0xc83b86881525c05e, 0x4646dbf211899f64,
+        },
+        {
+            0xef9b9458b8aa54a1, 0x0d8becf2751e1f47, 0x69620c61780523d4, 0x5b9742f7d89c8fe1,
+            0x183128b0d9c93958, 0x0f7b642ea47ac9cd, 0xfd4cc6d06878bd48, 0x9a1b73d0d957c0b2,
+        },
+        {
+            0x2b7507cb8e419e08, 0x785328d7af855eec, 0x875db0c77b8683a5, 0x3d1bc96890a597e9,
+            0x7d4afa1047eeeab4, 0x2668dd43d680ca71, 0xc3210d1f17365023, 0xd5bb2ee417fb31cc,
+        },
+    },
+    {
+        {
+            0xa24cf6acf96ec2b8, 0xd06747c3a961cc16, 0x57c7001cbd17f0a2, 0x5f298db034afe2d6,
+            0x51b01ef2df12f671, 0xc01c50665ce712fe, 0xac0f403492a74776, 0xa3e9934f08d696bd,
+        },
+        {
+            0x4599b8941abd31f0, 0xdb34198d9a1da7d3, 0xa8b89523a0f0217d, 0x2014cc43e56b884e,
+            0x6fb94f8849efd4ee, 0xf1b81710287f4ae0, 0x89d38a9a99fd2deb, 0x8179277a72b67a53,
+        },
+        {
+            0xfffc5482cf69c747, 0x7748a0f4a83549fd, 0xba1c8a0de7ccf4a6, 0x6cd1399aa2ede6b7,
+            0x8fb634e687bb90d9, 0xfa8e659bc59a5304, 0xcd6bfc75a9122d95, 0xdb107defdfa6d75a,
+        },
+        {
+            0xdd5fee9e2d3a6e28, 0x8eed56d4686d8ca3, 0x36889a2778083491, 0xea1a6555bef20457,
+            0xe7e6b609a501e2a3, 0x1ea0ae29fb23de2f, 0x5f537d07632c9a6b, 0x61770d1f9a3db961,
+        },
+        {
+            0xa277202bac5e9a4f, 0xa2024d66942ec9c1, 0x04c4eb4adf87fffa, 0xd34fb4f9823bd369,
+            0x7cdbd77386f92b4a, 0x43cdda264793f0cf, 0x6d2f9ebc462b3ca9, 0x1fcf6a1a289edf7f,
+        },
+        {
+            0xce21d1fa9047d3c6, 0x847d15739e2d51ce, 0x80167a634eb10c9c, 0x8896686878c07623,
+            0xee878f2cdc401ce6, 0x7f46062a697d1c83, 0x04a047da6862b7c2, 0x68a2caccfafd636e,
+        },
+        {
+            0xe9cb1e3450b70a9b, 0x7b4eb0ce7d3fe31a, 0x57ba61e4c94f95ff, 0xe32b2f826946a604,
+            0xa1d0b6b77313f5fc, 0xbedeb07f54f4036e, 0x938cce399d921b80, 0xa352a0c7a357f9fc,
+        },
+        {
+            0x325c60db7497e8a5, 0x05d8eab88c6949a9, 0x3169e466c7bd5898, 0xadc06264192d8e3f,
+            0x1ff468f4d55959fe, 0x97b33ee0202dba19, 0xaa0c3fe221cf84bb, 0x48cdc0af04a8d176,
+        },
+        {
+            0xc04eb5878938d987, 0xd61368341ebb25d0, 0x39d48574591879db, 0x61ac68bc10c20cf2,
+            0xcf088b038bf43015, 0xd630c185ff80b752, 0x5b4ede64a52f1021, 0x60e8a1a512ccc76e,
+        },
+        {
+            0xe4f3730ec599b822, 0x821b583dc1db1fe7, 0xa5b97c09f68091cd, 0xbeb36d94a7afbcff,
+            0x2e71e9729ef451b2, 0xc20a694be72474cf, 0xd30f6220dd75c396, 0xe0b129df9fa41fa4,
+        },
+        {
+            0xc215cbfdd5ffea9c, 0x106d35ce68f9d4f9, 0xcecfcb3b5348fac1, 0x581706a89ac89988,
+            0xd6f066f179ed0a4b, 0x60fea2e8c41cbe8c, 0x6e2b187948494bdc, 0x97528c49e9973afb,
+        },
+        {
+            0xfa9f7a8b81ba9b34, 0xe32ba9453196b512, 0x93a571c82476f535, 0xafdf29231810863f,
+            0x53bc9a3c16169f60, 0x2a0397f29b5c7c35, 0xf1059d5016d93e03, 0x5e6e9109388f5ef4,
+        },
+        {
+            0x903a4ae67ce02c01, 0x4173b5ab8c08bf44, 0xebe8af9dc03aa4d0, 0x7b771ec7f5447a78,
+            0x3885833292b87c79, 0xd9b60cc9e90ea9ae, 0x849c958dff36926d, 0x30a8dbacb464178c,
+        },
+        {
+            0x40cea9ddaaa05d08, 0xd0caffaaa51b5a25, 0xd63010c8585d54b4, 0xc852d033be35b009,
+            0xd508e50ef3df425c, 0x9e459701ff86f10c, 0xe36cccc2081059ff, 0x48d3f14fe3989ff4,
+        },
+        {
+            0x8d1809e32bb5468c, 0xb5a5f918391d6e61, 0x12301068052aea4c, 0x16f098aaf67ec59d,
+            0x0149a82d6a7864c8, 0xa72ac3e2589f4c0c, 0x078c8a01d4d8614d, 0x360d4a1d0071cc60,
+        },
+        {
+            0x53d8c4489c0d4009, 0xd37146172e24dbaa, 0xdd92e7309b62e5f1, 0x97b344d79922cc8a,
+            0x416b009b0bfe3e8f, 0x56873834f3c82269, 0xf82a980fe6623555, 0xb027ecaa5ce68e54,
+        },
+    },
+    {
+        {
+            0xe6982c86fbd613c3, 0xf4af69d5c366f17a, 0x8683eed6b85c2343, 0xf5bb244a24bc2116,
+            0x997a74bcc9fc77d4, 0xe202eb916f44b54b, 0x77886412a6997e76, 0x6996c8fb02c8837e,
+        },
+        {
+            0xb2e9371c902c343d, 0xf57b2de8da4fdba1, 0x43f9afa4b67703a1, 0xeafafb41f79fe203,
+            0xfec99dc9f649a494, 0x14799ef9fe378232, 0xba3f81147184e31e, 0x0abbb815dc0e987f,
+        },
+        {
+            0xd2589ad6e069de1c, 0x3fe8e67a7ee09300, 0x5b8818602f8ae49b, 0x186a1482263a6a90,
+            0xc6079b399b35b33a, 0x6c38d78953d3411d, 0x743c4462720b2f99, 0x4d903dd729e14d08,
+        },
+        {
+            0xd4085efcb4e31aa4, 0xc760aec018b26adf, 0x14c1f78e76a7400d, 0x87b8aced317fe128,
+            0x4433582ecbd85bb4, 0x58f0142686adc041, 0x3596dd508f0d5781, 0x2e7f3b801a31a82f,
+        },
+        {
+            0x95c9bd80d6d7878c, 0xe1ef20ee34ff7c75, 0x3fab197ad2ccd599, 0x9e480593952ef4f9,
+            0x69777fd206ea3410, 0xb028045474fa7dd5, 0x641b6860c43bb5fc, 0x9f359d5becd7b8a8,
+        },
+        {
+            0x7ff12c379ce08452, 0x3dd8dd09a3a87024, 0x61ff0d39b849dcb6, 0x3f5eab86fefad6de,
+            0xb6146886251523f9, 0x45ac1d525be2135b, 0x6350799541d2c5d4, 0x7f19f799b3064e72,
+        },
+        {
+            0x7335044ae1118539, 0xed6d43fc5192a007, 0x1a8bf622a43a2bd4, 0xefec3fb6efa9f3a5,
+            0x6d224bbc6d834bde, 0xaaebfcb8b0fbc744, 0x383b2bfcc4ea1652, 0x9cd26d90751ae816,
+        },
+        {
+            0x2d832a29161f6475, 0x435b8d78fc8797eb, 0x66bc156dd71b609c, 0xb3dca798fe0c2004,
+            0x445d47bf02fd92d7, 0x1d1c9798c8b03083, 0xca46d98d079a7c51, 0xb93f286c1afeb89a,
+        },
+        {
+            0x68b84dfd0ee9f78b, 0xff42fc9bf2ee390e, 0xaca71e10531e1dcf, 0x391620e27feaedfa,
+            0x7b2d6a02acf3e5da, 0x261823d2d20a16d3, 0xf9afa5d6bb00cd30, 0xba151f4a1084580d,
+        },
+        {
+            0xf8d8c55d0a3ebbfc, 0xdcd838d5ed48f61a, 0x032f91ead4cba7ab, 0xeb0ed88d2f70235e,
+            0xd4498170000ef325, 0xfd34e07f4b923c4a, 0xf71c07a9b19b84cb, 0x000a669ced9690a3,
+        },
+        {
+            0xf0d4146cb572407c, 0x829cfb383f84cc39, 0xd7c9fed4e31f007e, 0x93b2a5bc09e68ce9,
+            0x073fb24ad01482b9, 0xfe494244b8d44e62, 0xe59a16493dc49858, 0x071776f7f005b31f,
+        },
+        {
+            0xb853465a3a4a0217, 0x74a2534f66f3a4d5, 0xae1a7ff3eff0423b, 0xd2a01a09bb126028,
+            0xff84c6f04963e855, 0x63db264c6bc18d50, 0x39792dcacc6a5e25, 0xf20cdf3eedb37a25,
+        },
+        {
+            0x9ea95bc9adb45b3e, 0xb5a28feced06ec67, 0xd678df4662a3c143, 0x80f0bc9d6793284a,
+            0xeb7865a907d4afc7, 0x0fc5eafec1301d87, 0x50a8e7f54823349b, 0x97800fa22d019e96,
+        },
+        {
+            0xb7be75d8a6b3f6e4, 0xf64bb3fd2c0d2e1d, 0xad17a039935ae640, 0x7304ad638f243748,
+            0x04316bb4d278caa9, 0x19b89c621e84f91d, 0xdf4a47e96e7a2511, 0xdef32df9998b6bc0,
+        },
+        {
+            0xba976a58da99fcf5, 0x3881ef1ec3536b7c, 0xec65a069fbc931b1, 0xab7f57b4fc929a0e,
+            0xc7c63491bc61f452, 0x5c1aa935c1750dbc, 0x35b8789b9ff0465c, 0x8ff8589b727647b7,
+        },
+        {
+            0x40372d2d4919affe, 0x2d4a2ea3a009bd16, 0x48f1e7f8c1a62eb1, 0xce083725587a1124,
+            0xe874261be7ebadd3, 0x7ca5c156057b93e9, 0xe8b381e5fe39e6ff, 0x2d16b32fd30815c3,
+        },
+    },
+    {
+        {
+            0xdfd30b28ad2e996a, 0x64d4eeec9df0fc37, 0x8e049e3dddc39763, 0x9f55e0ce37ea2e8e,
+            0xf3fcba4e4bf01984, 0x764d5c3d9d55bc4b, 0x98cb92a1cfda895f, 0x27dfe7955c7bca69,
+        },
+        {
+            0x86dfdecf23a86e2c, 0x02ac466b3387f712, 0xc30a1ac2d63509d1, 0xd391342263aebbd1,
+            0xdc7b789f068ae34f, 0x499f2d01487dcd10, 0x68e2a3bca3e8a4b4, 0xdf87ba7114d2a26c,
+        },
+        {
+            0x9e3ab99934479e7b, 0x9d5f2dc3b026e780, 0x131374fd4f1bd429, 0x92e2e7389be1379a,
+            0x6cc32f80d13bc111, 0x6fbfc35086f81c92, 0x12ca1b309263913a, 0x6f7da1ffe06ab75c,
+        },
+        {
+            0x4780f12a19301b16, 0x233bc231bc368a20, 0xd9650892cbadb344, 0x38a0d964ad9425a1,
+            0x277abcf24a8d4d7e, 0x4ccd16b1b806ce9e, 0x82ff40f07570d473, 0x57491414df130780,
+        },
+        {
+            0x9f1f39f2a96ef42b, 0x1fd967ed107f1321, 0x9383249729d4767e, 0x7761a38b3fa9e796,
+            0x3e408c5966318df2, 0x9283ca4441745f03, 0xfedf8fa32cce1a86, 0x8363860db44600b4,
+        },
+        {
+            0x3dbfde5545f45a89, 0x8800c86026ce399c, 0xfb25e8dac25e9479, 0x6ff0d6cbf7d367a2,
+            0x70b0ba36a93f9890, 0xc07ca40349bd5a80, 0x5f4feda6ed54d1aa, 0xfa1e2efd671ad0b4,
+        },
+        {
+            0xda4654678c56e7aa, 0x39d04cdc25e45bc0, 0x26661bd6af21c637, 0xf757ff5cb55ddfa5,
+            0x07318fd14394eb20, 0xe010b19d2bcf3ad1, 0x71e2031c8e5c7e7f, 0xee35f346edbfda69,
+        },
+        {
+            0x8d8d41205d8f6fab, 0x5e420839abed09c8, 0x5120e0794aacbb1e, 0xf7e840f8ec1bc996,
+            0xd921d63b9707c3bb, 0x3ab4b8b8ae891a71, 0xbe46575673bb2278, 0x776ce040553ee91c,
+        },
+        {
+            0x86f07c2e88222e0a, 0x3f3688f1df97816e, 0x20d2d944a6df9d3a, 0xff399057b2cb925a,
+            0x010c747e27f1de19, 0xbe9406697fc1fbc3, 0x3ab94600877ef709, 0x9af40a6b8f4c8a8e,
+        },
+        {
+            0xf7c0f202713f023a, 0xbe0bf3dbd0a8dc63, 0x0978992664a41337, 0xbb4a89642c2823cf,
+            0x9279cb27b90e45c6, 0x80283fd3382564ac, 0x3a746b01fa5f0bcd, 0x28667a8e0afaf10a,
+        },
+        {
+            0xeccfd0ee015d5295, 0xbd6678a573ce8e21, 0x132a87f2336ecb65, 0x09de4efcbe7dc659,
+            0xbedadd106f69b3bd, 0x357c61e2e8303650, 0x6b3c613aa45777e6, 0x51dd30ad08d41179,
+        },
+        {
+            0xa7b53f3ff98feac3, 0xe8e00328f9497319, 0x1f3b080d0ca20b40, 0x06dc5456e19b088e,
+            0x1f3f18d70dce02cb, 0x2d2155446fd1ade9, 0x4c6de38c055550d0, 0x5d535e6ff33f4973,
+        },
+        {
+            0xdcfd4163744c033d, 0x0706a49076fc420a, 0xdc9db55c394f5b6d, 0x1a050a62e040a093,
+            0x60367ebbd0ab26f3, 0xb9c07239c3d91820, 0x14a8bed5a3e32db2, 0x23b19cd3d49f37dd,
+        },
+        {
+            0xd048c64fea6c85ce, 0x8aefff19d5716cfe, 0x199fddb1ab85bdcf, 0x3f592e7ebaea49d0,
+            0x8c8decb6f1d58ff6, 0x02598a997fe8f425, 0xe4c73ae264a93fd6, 0x208a0f61878db06b,
+        },
+        {
+            0xff0272fe27c4a266, 0xccfc96ae69e7c6a2, 0xbd7e715f8e78d74a, 0xd04ae9a432ed35bc,
+            0x302af41305614c5f, 0x9817663733943b5a, 0xa4d1c9b28a58cfd8, 0xf0ebd5f4ac2f3f79,
+        },
+        {
+            0xebadb010fdc7945f, 0x62c9cff003750a4b, 0x75192383a0c85b9d, 0x2aba7b5316eb0bf9,
+            0x93d4adaaa4c06f9a, 0x573a86a25f8e482c, 0x109c6fdce791a79f, 0xd9ed02ceb37eeec2,
+        },
+    },
+    {
+        {
+            0x86f18c448b63b669, 0x53c6eba66972d2d1, 0x2a522d8c8cff59bc, 0xbc181d156ed25ce5,
+            0x913f173d5feb0eca, 0x34273f8da207bd71, 0x41b7572efa1715ae, 0x8a8ffea27f16f4ae,
+        },
+        {
+            0xf356917a2f8ebcf5, 0x6f2c400b953f056c, 0x09d9ac41dd84bb48, 0x50dc7a8ea61e98e3,
+            0x1179a9d33d3a6776, 0xdda312e716de8b3e, 0x62a8b7c3ce6e2bea, 0x2b00036c645e4ca0,
+        },
+        {
+            0xda4a4c577847ce81, 0x0b0a684e1fa3f8d6, 0xcc96115adb4dcb7a, 0x96e75435024de3f6,
+            0x98c439d1fa7aaa89, 0x674817482b15aea7, 0x9d46df705045921e, 0x9f98e0586867b5d1,
+        },
+        {
+            0x9ad2cbd7ab6cf0b4, 0x7a1e67f4f13d1ddf, 0xa58f0c73746003ba, 0x8263e888a64a8fcc,
+            0x535cbe37be2452f7, 0x931257666ae81a76, 0x7d2ed0ab3a553701, 0x93d7e7dfb0717d78,
+        },
+        {
+            0x9a6bccd97e734552, 0x979a109c4952a6f6, 0xd9ae4b6b53249d48, 0xb2d1c3d0ff657e2b,
+            0x4c2b9a8be02a1637, 0x3bc8d284f300cf14, 0x7bcced03a5ca5b49, 0x37700806bdee3388,
+        },
+        {
+            0xd3d1eede06d18b28, 0x0bc90fd8a0333c57, 0x848b66a55e9cfcd4, 0x3fe3ae3d39c11934,
+            0xb44a66a976fbbb4e, 0x6de50d3a9f1a9953, 0x18c3e3237b649f7a, 0x0a3c10eaff3dbbc8,
+        },
+        {
+            0x4b88edb92717bc37, 0x3d6452d3b405430d, 0x6d3058dce7ea8c5d, 0x27b34eec5f55254e,
+            0x4eee18f1f9681f2d, 0x4a759a8da27e2d9c, 0x01a1dc5241526e89, 0xdde2d31715f7a360,
+        },
+        {
+            0x61bc013cf9cf03ba, 0x36223b88feee3a78, 0x86efc9233d7e4c95, 0xaf3801be965625e4,
+            0xa7bba1413f32fd9d, 0x70724dec4e564acb, 0x52587f32b7edcac1, 0x0b1cd94cb3969985,
+        },
+        {
+            0xbb92c79f2d607008, 0x6f4d5335a493663a, 0x17517b5a763407d9, 0x83b2a48f5bd3c41c,
+            0xdd67a8e7ba5c78f7, 0x057d1bd3a3b384b7, 0x614bc724c5711c41, 0x461c3e43a83c0a9a,
+        },
+        {
+            0x130ce9f0600fa6c6, 0x0736b35a032dae6e, 0xa52c52a1caf655f9, 0xb192772121381db3,
+            0x2a622d883480704b, 0x4410f315e8f9b89a, 0xa73c33be77fd15a0, 0x489e94caf3bdf03d,
+        },
+        {
+            0x8659b3f34cb21273, 0xa04b7d5a6aae99cb, 0xe662db45e714a5fe, 0x72eaf6550f82964d,
+            0xbaedc6d20dfeb0be, 0xab81e109d91b740d, 0xfb86055103a376eb, 0xd62d18ab89d4ccb3,
+        },
+        {
+            0x9f08407a661fbdab, 0xc4d7c53658e52151, 0xa3765bce63dfe954, 0xc6829bfbac2dddd1,
+            0x97393f65dc6e4487, 0x9ba29422bf04c930, 0x493c691418838c0a, 0x41b137ff4b2f35cd,
+        },
+        {
+            0x07ac1ba9641c379c, 0x72fff3d7db310d3d, 0x502e52c9b785be5b, 0xa451b1f12db3b805,
+            0xaf36dc5ed92f9f86, 0xb71f692157a48cac, 0xda6a3b5bfa99e4de, 0x6ef4ad06ec022d58,
+        },
+        {
+            0x7d384e65c417dd0a, 0xd9c953b184ee6dc3, 0x4e2013d15e5a669d, 0x9a04d2fd812782ea,
+            0x4ae104626ff4bc4a, 0x6e5ae66ef7b8f840, 0x1f93c69f567f4966, 0x1c88d309361b422f,
+        },
+        {
+            0xef2da7c1dad6dfed, 0x0e185b6e403a43b7, 0xde9a974a626e4af1, 0x232e7b42cd0bc29b,
+            0x50f612d2993fe128, 0x93284b11ef32e1f0, 0x35df093399966a65, 0xf72d610cbc03da90,
+        },
+        {
+            0xc9e4aa244e1c5e60, 0x54bb528913253d51, 0xf4a86ab39bbabe53, 0xd561feae6ac0aa64,
+            0x27a896ab1911bad7, 0x9cb22b9864337303, 0xf14262fb161f6928, 0x1661885c59ba6c9f,
+        },
+    },
+    {
+        {
+            0x27e19335f576cb3c, 0xe16e4573dfb3b78f, 0xaf96d78563da0001, 0xb38deafdf7444c5e,
+            0xaca6b38cc0eb0e28, 0xa6ca35417fe41b98, 0xfeb37b4718965b31, 0x739cc322597d5bc6,
+        },
+        {
+            0xe19fac99a211ffd3, 0x408f94243f1f6bca, 0x1f5b76d1a5648244, 0xef3942e895b2bd67,
+            0x1b9dee7fb538f1d7, 0x1cb78620444b8f85, 0x9f8ecd63cb8ea6a3, 0xca111b2eb9d3b71f,
+        },
+        {
+            0xd397edcd833396ea, 0x78a75693ed5e6747, 0xf2c844ba1a5f8260, 0xbcafe59d5fb9fec5,
+            0xa2413d5fd3147e7e, 0x130dd9e3afdf26cd, 0x44be87ec9ad1abde, 0xe925c4956e77fbe8,
+        },
+        {
+            0x3cc00e21091e1c4c, 0xd500db44867ccc75, 0xa8e2e84bf5ebbbe4, 0xc3266881c4279ac0,
+            0x2e8fb4de7a170658, 0x219c5ec151da4a2e, 0xda69a3fdeeacee19, 0x9d4c6fbd30462243,
+        },
+        {
+            0x35ecb4e20a6dc5b9, 0x8b3fc2c851c54ed2, 0x059f86eb9eede13d, 0xa796c750791dd5eb,
+            0xb2f33680ea88555b, 0x927309501245348c, 0x1a5545f8d1e63bfb, 0xfebc9a14bebb7858,
+        },
+        {
+            0xd9621d166087c5e5, 0xae49c2cec53a8bc5, 0xd7868882cad314cd, 0xfde10dc7aa57af18,
+            0x3fa8a60d3800f397, 0xcec8ae7b388b333c, 0xefd8d69285fa8129, 0x33d5685b90776c32,
+        },
+        {
+            0xab65c8f6aed5be73, 0x838c3958174bf00b, 0x27c57199f1c7e594, 0x62643d810d02fae6,
+            0xc1e70c125f4431fa, 0xfac86124b2b41f7e, 0x062ac35af0108e3c, 0xd7d34dfca43d3a28,
+        },
+        {
+            0xf0acf768680dcbf9, 0x5072b8254f0a51df, 0x3a74751cd88df9c5, 0x9d20f9891cc1a332,
+            0x4e90042b6926c34a, 0x5c728b1e00766880, 0xf2e3bfe8f76e9dcb, 0xd9822f0a15a125ae,
+        },
+        {
+            0xe43384ebd73aa034, 0xaa8121d826c773a0, 0xfc2af3478b20e0ea, 0xe26fb634114c8c97,
+            0x28db7dc4093c2193, 0x935e816422da82e3, 0x0195d6ddf4d7670a, 0xe1e1fca77b2a9370,
+        },
+        {
+            0x641aeafec58b6d02, 0x750cd60353443629, 0xa68af789e4823652, 0x284d1e24c8d6ad5e,
+            0xa3f93ee3c4d56ddf, 0x8365004fac18e362, 0x0e409c5b85a2fe79, 0x6127bfe025cfddf9,
+        },
+        {
+            0xe465bbb77323f574, 0xd0a1229fb539a2a2, 0x9ee038e8c1905a62, 0x75ecdb48f419ba98,
+            0x8b470521aa0412d5, 0x822dd6f6c1303f4e, 0x6f97151646f65a9a, 0x27c6c7b230b27486,
+        },
+        {
+            0xdc56ff1d35689ad9, 0xe0f21142a32addf2, 0x4d52297877fdde42, 0xf402832cdd838f5f,
+            0x2a13267d915ac881, 0xcf224e200c9963a6, 0x0d44419ac52a42bd, 0x3ed2898d1cc0ac50,
+        },
+        {
+            0x02803fa55a993ccf, 0x538c595f4d4b991a, 0x855db705badf6f9f, 0xb42ef6a8ddf2b874,
+            0x3412471ddc6dd526, 0x3a10c35f47ad62cf, 0x5e0b3312d9616d1d, 0x249d80d2d0cb7e76,
+        },
+        {
+            0x3e7305799f67b96b, 0xc6d265ea5f509e96, 0xe985dceed416dc34, 0xe308207f48803493,
+            0x9fcb4271dc7a39d4, 0x839afda23b9f5dc4, 0x1c08ba2fc7d33ea6, 0xf3ae1c278c59165a,
+        },
+        {
+            0x536358206b9cdb63, 0xc5951d3bebcf5bd1, 0x1e3f01a8676a2a8f, 0x52dd8ccc08a66079,
+            0x805337592a64c9a6, 0xd9f6ff24fa78f975, 0x48801e99b76bccf0, 0xea8632e365fbd3dd,
+        },
+        {
+            0xbf84db58f51b14b0, 0xdf73ccf5a39a79f0, 0x0ce1e5842b5a1f11, 0x841fa6a3185fc400,
+            0x94b09c682455c32a, 0x383c9bdebfa71cc3, 0xb63814861e797929, 0x33036faf623d0a5d,
+        },
+    },
+    {
+        {
+            0x41b6cf7c90f17cba, 0x5d655ff430c7c5f4, 0xc64f29d54ccc7f38, 0xf28e85316124a79e,
+            0x1efa8d5167bf1e98, 0x8610027f5d7a33b0, 0x35fe2bb2cb9a40a4, 0xc5cc1bf143d50a0b,
+        },
+        {
+            0x60ae2bbfa32106c2, 0xef155b2a3e917750, 0x5567c3c713853a30, 0xa6be8290eddb305b,
+            0x2db58c21ade26eec, 0xfa3c895c003c17ed, 0x96ab0de16293f8a2, 0xbd2365ecac3710c6,
+        },
+        {
+            0x9ab03e73e194c642, 0x607b7106789e3c85, 0x952aab024bdacd55, 0x31ca3ee221cc6084,
+            0xd3149b2b1c6b93f9, 0xcbc5ef3bead930f8, 0xed04984f22872630, 0xef5d052d6c4b6fe2,
+        },
+        {
+            0xd2028d0557028677, 0x90eebeebce9aabdf, 0xab977aee06d4e5d0, 0x7a98c527f9361873,
+            0xe49b1251b7c2474d, 0xcdaf2a365f3e7b02, 0x638bcaf46fe54af1, 0xfec426241dac06b7,
+        },
+        {
+            0xda738cf51eafe37b, 0x503eac2430dd7c2b, 0xf9b7b7a511dd77af, 0x0ade03afe9dcfe7c,
+            0x489bd34af479e3b5, 0x993ab403030a33f3, 0xaef322bf9fb64068, 0xa47cc71b0e27f110,
+        },
+        {
+            0xe19ff8f8c63b9e75, 0x43f6b4fc0d7d130a, 0xdba3385d7c8490b7, 0x97889df70252c14a,
+            0xfccfca86b2f18b9f, 0xf092ff9ec3a87422, 0xf96dd67567474838, 0x039e82875bad2e9f,
+        },
+        {
+            0x46a609112da32c0a, 0xb2e1ac32b2676ca3, 0xfb74093f17614dc6, 0xf44939e43f27f965,
+            0x4656a402c922422b, 0xd60a55ba3ff5c56f, 0x0d061b41ab9aa62e, 0xc9ceacfeaca3acd2,
+        },
+        {
+            0x4f581d47515f954c, 0x145f925b7f470a40, 0xfee6b6b0736feaaf, 0xf90744af2ea5743b,
+            0x4d8e8ceaa2f36f56, 0x4239a6cee3ed4007, 0x0906b5bdd515e6db, 0x536229908ac973d1,
+        },
+        {
+            0x48f93fc3f4f966da, 0xf92691a0ed5b6487, 0xc5a93e5dada2c1fc, 0x4a7aca524b7d9243,
+            0x810aba93d7c5598b, 0x98f9ead225109638, 0xe8c6e893a388481a, 0x56e96b9be91ce74b,
+        },
+        {
+            0x8d13b665fc1f9449, 0x6e9932a9dd4bba75, 0xa90ce8e5564083da, 0x8a7cf362bbf7989d,
+            0x652eccb71b07ee2f, 0x0c0dcf1a6857a141, 0xa87ec410b7bfb43e, 0xaebdb7e782b8d179,
+        },
+        {
+            0xd3a243100c62c041, 0x4d27344a6c03c747, 0x0b19e4a67d3ee9d1, 0x9cf2eccdcd90de33,
+            0x673a9d1ffda636a9, 0xb7349981a86ee501, 0x11ca1e49e43766ed, 0x0806af6fe3ff3b08,
+        },
+        {
+            0x32551d31579d8a41, 0x754c7c2460a5ee33, 0x2c53fbff6a88f85f, 0x6ad0bda72c7a36a0,
+            0x8b3674f815724d6c, 0x614727ceb9b7b34a, 0x384fba9882ca9cd7, 0x8ef4343c0c566025,
+        },
+        {
+            0xc68450cb4bc7dccb, 0xb5f11b269e5f2400, 0x2af58e9e9c3a833b, 0xb60e2672a058abaa,
+            0xe891bf8c75b080c0, 0x5b09b2762434bf38, 0x0d90a040700b8739, 0x995cb042e69f4a0b,
+        },
+        {
+            0x6bb34768240c7897, 0x80ff54ea7b45473e, 0x16acd40f82fe5aac, 0xa3e76f524350449f,
+            0xf7a3579eacacbeb9, 0x9791e0e07bc40732, 0xb26da7b5bc58cb9d, 0x11d9fc80987e18f4,
+        },
+        {
+            0xee5f526d12ac8df5, 0xf1dd23f73bf94c65, 0x594ceaac81a3cb0e, 0x07d41d3b9757cc8b,
+            0x9eb0081dfc5603d5, 0xfb5d329857bd230c, 0xf2c0402ecde3f845, 0xa2defd6741e8aba6,
+        },
+        {
+            0x648d667432efbbce, 0x64a6c2b3e9639719, 0x38c0465730662e7d, 0x15d1d7ca352c9184,
+            0x70e8630ccc3020cc, 0xe4b56c9cb09f038f, 0xdb9cb5edfe76a744, 0x4c85f0206947b988,
+        },
+    },
+    {
+        {
+            0x349e4873ec83c953, 0xb4f59fb33a21ef0a, 0x3872d31440f7d93e, 0x479e1d02c2568c82,
+            0xd7e4dc9a65d43d22, 0xcc068e81e775efa8, 0xb78ccae9326defa6, 0x8f92b2962da64956,
+        },
+        {
+            0xb721f8d5dea227ee, 0xf48c766c3dda8ba0, 0x0583d94be43e3520, 0xebda36c9e1d898b6,
+            0x1808286a6627adaa, 0x19c4c6209938368e, 0xe0dbd707f750949f, 0xcadf4bea0cf356d9,
+        },
+        {
+            0x75c053eeb5763ed7, 0x4a553fb754585425, 0x3b2736a46ccd718c, 0x1c4f9cdec64894bb,
+            0x2df001a0f71211b7, 0x2c5325f372974259, 0xe8e172f449ff2591, 0x82e960caa1a3720b,
+        },
+        {
+            0xf5de21262dc890a7, 0x76b7b67595aa75a3, 0x475fc1432a070b32, 0x7429a6468e31d68f,
+            0xec3a9aaa09be3dca, 0x07e119a9af780ed7, 0x6212562564fd96c4, 0xb571494fe8e80577,
+        },
+        {
+            0xa7608c5676f9da70, 0x677ed2f383f6babf, 0x312fb23e52aa2b9b, 0xe5ff108d2dd31d6d,
+            0xd88036fb5932b2e3, 0x80ec5d92a3914d7f, 0xc9a925bd4dc7dc3f, 0x9ebeec9f33fc4e14,
+        },
+        {
+            0x955ee3495228d735, 0xa04ef2bb8fc5d4b6, 0x0c5328913600814f, 0x41f1f63759f85bd4,
+            0x72f1d731e3dcdfb4, 0x28a4ddb93aa5edb3, 0x116a68e1f702dcdb, 0x1975bc423bde657e,
+        },
+        {
+            0x81bec09db5b3ca35, 0x6ceb37022a82dc3b, 0xf8bc5f551537b615, 0x0d9a85088d1a3dd9,
+            0x2c9c79ae23afdd5f, 0x20ff3dcd527f33e5, 0x0ec163984854e88c, 0xef1edf7ce99eeefb,
+        },
+        {
+            0x7b9f561a8a914b50, 0x2bf7130e9154d377, 0x6800f696519b4c35, 0xc9e65040568b4c56,
+            0x30706e006d98a331, 0x781a12f6e211ce1e, 0x1fff9e3d40562e5f, 0x6356cf468c166747,
+        },
+        {
+            0xdb746d59b8ccdbd6, 0x10e3389a78d573b8, 0x10d15e760cee812c, 0xf618678e866925f0,
+            0x34206d8da71ceb4f, 0x05fe45ec4dec54db, 0x5e7bba833b305f28, 0x64d100f9cc41bfe0,
+        },
+        {
+            0x80e87329429945a7, 0xc619fe17b7ab06ad, 0x9116bc2e6fd86b17, 0x64a41877b9116aac,
+            0xe3ed867e32ba4f3b, 0x013e263b68b4ebe6, 0x305ebfe7e779e4ec, 0x5536d45d50178251,
+        },
+        {
+            0x6628d22b4af84049, 0xd36c22f2e3c6f378, 0xb202ec2eec29e14b, 0x242634c371269ebe,
+            0x3dcc02d46598ba41, 0x59da5bc8f44fb353, 0xa26a202ff0d1a52a, 0xb96de941cf48ab9e,
+        },
+        {
+            0x5abb939f8873a93d, 0x0263ba488c4c9cb1, 0x36764b8d6b78a4b5, 0x205bb45d28bebc1e,
+            0x16df4bb0ae89dcd5, 0x85994670316fadb7, 0x71f756643af3c724, 0x43e30313e8520c9c,
+        },
+        {
+            0x90c5f1a46997345d, 0x40d1239cf2512bb2, 0xa845574b0215b692, 0x0402f4be4bfbff01,
+            0x35043b3879bb8b68, 0xa35aaef28719b9d7, 0x7a5b4d578b3a5ac7, 0x15a7927bc0ce0a8a,
+        },
+        {
+            0x3ab9ec5429e91921, 0xd931436ee3299f47, 0xb56da7bfb89cd49f, 0x90623412cff7f637,
+            0x751e7944714022de, 0x86bcc3422c338262, 0x85f6a9bc314c23bb, 0xedbe8e741f0a3991,
+        },
+        {
+            0x305cc62683dddb46, 0x755ab331b3b68f64, 0xb2b9da5fb6ace37e, 0x05a5af6a66ca9424,
+            0x824e30ec2c0183a5, 0x56514eaa3a91c0ee, 0x387df3b27e66c861, 0x0b1a14806cc75902,
+        },
+        {
+            0x7a748d63003b40dd, 0x8a6824023951b7ae, 0x41e92dd9704a91b0, 0x2dfb3eb9858cd3ea,
+            0xc3c2af35f5094667, 0xffa287dc7435aa2d, 0xd03f39797462714f, 0xdb550f67203e5b0e,
+        },
+    },
+    {
+        {
+            0xb9dae1b8207eecd9, 0xd3f50d63ec07b47c, 0x02b4d909364292da, 0x919a6df3fc35975b,
+            0xb41ed4aab616452e, 0xe58689cd5cfc6abb, 0xeac325d9f389b025, 0x45ceb1e68f255de5,
+        },
+        {
+            0x74e7b7fc506f7dcd, 0x985e85465d037d69, 0xff00a4da1ec8d374, 0x8c339ae3505b4180,
+            0x78bcd4f23a5f71c4, 0x2fb4d99f67ac3e9f, 0x7dd25aa6ee65dad1, 0x2fd63fc2b62c34dc,
+        },
+        {
+            0x39bfa2a8b9ab0a36, 0x560f80a618f71ac7, 0xca9b265a45e24412, 0x6796bece8e2ddac3,
+            0x87f1eee517bfcabb, 0x624db4d9195c9bb2, 0xf7110fcf2b4db6d2, 0x41d3fb0db432d19d,
+        },
+        {
+            0x43e0671fe43332ef, 0x71c5dd5b441c2218, 0x4c1d2c1fe922ba18, 0x558e9c2fd619cb67,
+            0xd04acde01ec51255, 0x824b3740af824507, 0x62d1b9de744c6afe, 0xb99616dbab0d52e3,
+        },
+        {
+            0x5622dd2522fddb8c, 0xbaf6799b8f32f3bd, 0x7da0615b603eb139, 0x910879c9a5ec7c81,
+            0xffdcf3075ed9193b, 0xf1387c44397e42f9, 0x9717ac97bee3099b, 0xadb09e902330afcc,
+        },
+        {
+            0x30c26a68571784c2, 0x690b0f5b5cb98f3a, 0x62e1ae95b5e465ba, 0x300971c1c465de93,
+            0xb6de78f852bf69f8, 0x8b409d3059a5c4b4, 0x75554b111d08373c, 0x2d7ce620c75ac137,
+        },
+        {
+            0x0f693f0952534249, 0x9e24ccc2f84aca18, 0xe0bdb7f22aac9b0d, 0xa77748ed9861da99,
+            0xcf74ffa6d23c91aa, 0x89bb39c1476bd99f, 0x5379457d0e897317, 0x61423ba74c0902d0,
+        },
+        {
+            0x5ec9c0847f6a1cda, 0x68839c14823d6350, 0xcbbb678b03bad007, 0x6a7272554788854e,
+            0xc747fea2ef5c7294, 0x748527784875e775, 0xad7b8e8baa61a893, 0x18ff333540da98b1,
+        },
+        {
+            0xdc6ab5364a7d283a, 0xff2b6a7ebb6cf7a2, 0xf852929047b47cd5, 0xf2412c3adc5e13d4,
+            0x8058a70c2dd24191, 0x87cdda318f1c250c, 0x41b239bd24502ab7, 0xe8a334a4f90624e6,
+        },
+        {
+            0x9ace6eedfb92e165, 0xe0245e7722ec3e32, 0x8cc99f9f538049be, 0x987aad76a70c41bd,
+            0x8b6fe448fb2b5b81, 0x46143d8e6f1426ba, 0xddc3669f811bcedc, 0xd61675beabee380c,
+        },
+        {
+            0xe9c50f36a5ed0a62, 0x8ee9b0f4e85f700e, 0x72dda477032763d8, 0x7b449f17237e1a3f,
+            0x5724959edf2922df, 0x35a3a9c68a818f25, 0xd85b9d2b0971d66e, 0x2aae15fbef8eacfd,
+        },
+        {
+            0xf4396ca48d15f612, 0xdc27609571a8a910, 0xb388a29a0de4801e, 0xf1786468f2330765,
+            0xe63e153bbefdde3b, 0xecffc16c46b8ce1a, 0xab70c46999313e17, 0x263b28a2da50ffc5,
+        },
+        {
+            0x7dde67a6359c45e1, 0xcedd3532f60b838c, 0x94baf7094bda349d, 0x5aafad3677d5f497,
+            0x0c0900ed5da72cea, 0x759e2cd2d1f67d07, 0xb11ae4fb8f73d331, 0x5cd83e428469fd1e,
+        },
+        {
+            0x9d8ac94af2a37404, 0x80812e2c9e6c8841, 0x8e4c90699d0d82d2, 0xebb83d8515a0cd32,
+            0xfc18cfc003083998, 0xee70a9014be0aa1b, 0xaa2caf49b9f4e181, 0x495e5fafac4a1969,
+        },
+        {
+            0x8aebe9d65f2c6855, 0x056de3c287f1ea48, 0xce8262863c66999a, 0x0c139c204f15e0e3,
+            0x85d6c9c552d1182e, 0xcbe2064980740ff8, 0x2bd86bd39c98364d, 0x18e58349300bd055,
+        },
+        {
+            0xa51e9f4f5529ec80, 0x0420274a6fd146d1, 0xbbf1ab668e300c2c, 0x2d0b3a9d41653fea,
+            0x2be2180f23a495b9, 0x6ef3c3745415d73b, 0x1d3e1ec8c67ae4fc, 0xa5839e9c98d31f5f,
+        },
+    },
+    {
+        {
+            0xf25d4777d0d42887, 0x4b4892182b7a2707, 0x1b4dbf9b2d3966fe, 0x4bac5f4841ae2bec,
+            0x68db27331733964e, 0xa10c5dff6a814a69, 0x84ebdaf0a9898348, 0x60e46823a74da3f4,
+        },
+        {
+            0xe0642d18f9066d73, 0xbe1d2ec3a098b3bf, 0xefee860c21b4954c, 0x4d7c4e6d27b629bb,
+            0xcd8f1e038e8b81b0, 0x4a80168e7fe77eb0, 0x4d977591ce247c73, 0x9b30c9f2857e0356,
+        },
+        {
+            0xc7eaf2c5f037d15f, 0x410b627ec7afbf8b, 0x243cdb79d7bedf50, 0x04813b51be6512d0,
+            0x2fb77cab26beca2f, 0xbb6019757baa3099, 0x8c327e5940bda4d0, 0x85b9c76413c23444,
+        },
+        {
+            0x673aead488c06b1c, 0xea8af42049d9d4e8, 0xa7b4409acb9e86bf, 0x49f76f715414aa56,
+            0x6603c8018c13857a, 0x7c26f1c2ce742384, 0x042fb2242a665719, 0x2619f254e175b0c6,
+        },
+        {
+            0x75f97753b01a91e5, 0xd374dfa2cd0d8cac, 0xe5dbffef8eb72ba0, 0x61049807d7b8a624,
+            0x9c8b5e93a39277d3, 0x6e5ba5933b1cc635, 0x8bd0a69e21cde059, 0xd0a19b53071ec0c8,
+        },
+        {
+            0x012c699444bb5a79, 0xf5928e0c9bd1fdc0, 0xd30b8a973ce49191, 0x52792b85e3a05dd3,
+            0x0da089161d3d69c3, 0x931759e8ed59a28d, 0x412148d96ca05485, 0xb1517aa03d6e9964,
+        },
+        {
+            0x50b43efa78845d09, 0x3899e1becb3acdd9, 0xa93a28e318d4ec31, 0x18a4eeed0a66fe47,
+            0xd7a7bf4687333831, 0xbbf5c1a8dbe14699, 0xf2a3da7380b9c9d0, 0x133c138a82bceb4e,
+        },
+        {
+            0x8d6fbcc7d9b45206, 0x00ab735deabc4640, 0x428c7017810e37d1, 0xa436587227af5718,
+            0x8f1958230a910146, 0xc13ccdd70ff76704, 0x59d34ad644d6f1c8, 0xd3dfa6b2795b61b4,
+        },
+        {
+            0xaf063553b16679d5, 0xa509f4494316ed7e, 0xe3d6ec43b53cc0e2, 0x9e957ce016ba34cd,
+            0x2b0c7fbc7857d80d, 0xc2c671fe3daffbf3, 0xebcbf0120d251d41, 0xedcfe7f7ffef45f5,
+        },
+        {
+            0x00e15d0a1685e460, 0x6fae8b37155d00b6, 0x277126d8dc561456, 0x331c02e56bf70c63,
+            0xc9b7da4e515f39b7, 0xb7e0d135966c2060, 0x9a801457c401f926, 0xcc560825ffb0137e,
+        },
+        {
+            0xfb8e903ec8239fe7, 0x5805c2ef524f213c, 0xdf056e4570645f7f, 0xfe10ecfb454c4577,
+            0x422126da990dc567, 0x95a5d753bf55cd81, 0x2705a00c8c2688ed, 0xd079ecb42f8f91af,
+        },
+        {
+            0x8874ffb56487a5d4, 0xc02a12b52f53e25f, 0x38654a57416ba8fc, 0x226356f20c0b25d6,
+            0x34f2eaa66030f2ac, 0xb788baa19cea9176, 0x66fbe9f74e912104, 0x982ef71d39a69e3d,
+        },
+        {
+            0xc80c83a4fe771ef7, 0xe212050f1c1c1b92, 0x0f12bb88f09c666f, 0x8ec5f39610a2eca2,
+            0xdaf9699690a22eb7, 0xeb77eee5450de941, 0x13823c5858fb0165, 0x2157ba6e31272111,
+        },
+        {
+            0x765390f62369ce91, 0x2dc376395754d219, 0xbc5523697c018afb, 0xca83507735bf6b66,
+            0x61b83e4361d4b0a6, 0x8f87f59727cf66c5, 0xace578409357cbf2, 0x24834481abe47fb7,
+        },
+        {
+            0x906fb7486a10a9ea, 0x46cda42e0a3b0e89, 0x10b9096d7ae4ad43, 0xe1f239963bf2afea,
+            0xcb50b9410dd82d19, 0x008e593c832d93a0, 0x0b1fb0e6d86a71e0, 0x75f2aa6bb1730860,
+        },
+        {
+            0x698ec2c96fd8b309, 0x512ea17aa055809f, 0x28cb44e78822943c, 0x434dc709deb7d3e6,
+            0xb8b324d11be76434, 0x7cf24ed3382ff0b1, 0xda8265fe2905e726, 0xd57b3915ee6c3abc,
+        },
+    },
+    {
+        {
+            0xf9010095d2a819b5, 0x5291aaf948f2f653, 0xfa533907f0afe366, 0x88a58ecf8e279e27,
+            0x0f077127fae130bc, 0xee9ccf1af8a54c75, 0x38a6783ebed82b6a, 0x9a1acb3ded414524,
+        },
+        {
+            0xe4e53ceed9c12e2a, 0x11983fc17fc1308f, 0x3eb4d84d892c2d0f, 0xa0bfc1ca74499723,
+            0x708344d90145176b, 0xbb2988e06f12e75b, 0xdf73ceadada67545, 0xf37069d12bb8f989,
+        },
+        {
+            0xa24a35e69cc17f65, 0xc49b3e9a89d9abe0, 0x82f403032fc09ae3, 0xbffe7d4d002cc587,
+            0x5511f4e6424ef713, 0xb86bf654a658f660, 0x623388d91c8baea2, 0x60664a7133656759,
+        },
+        {
+            0x18996198d8447e16, 0x17195d76662171dd, 0x28cfe6a1f448b8e6, 0x8a3c28230658c923,
+            0x0c548d899c35e852, 0xadf1cd2f2b378157, 0x999e41aff30113b6, 0xf87515a59cf4696f,
+        },
+        {
+            0x6c332c559778aa8e, 0x290ae3ead1b8d8b2, 0x3e2bfa0bbf533883, 0xe48e37471a523ee2,
+            0x4d40f1d550fde3ed, 0xb57e695b48710433, 0xa41012581b241f3f, 0xa0cabf7b3042cabc,
+        },
+        {
+            0x68eb19c7edfea522, 0x68e028b8a400db7b, 0x6cd97bf7a8f03a08, 0x09f4d266f442fe36,
+            0x1ac77f915d713a1f, 0x356e3a352f58ccb5, 0x31d657f1f8ddc47d, 0xfea7aede90092115,
+        },
+        {
+            0x2aeba1d24ad49f66, 0x16ff2bad9d40861b, 0x25464f377da225f5, 0xa2fe66cc1ffc3f0b,
+            0x74074d7fac757f41, 0x5c85d3d1cd0a2c20, 0xccda2a05c974b266, 0x5c2e2511cc10a04f,
+        },
+        {
+            0x01ea2535510d515f, 0xc861c54c489e7856, 0x9bc8485b680d17bc, 0x71472c11819ccc86,
+            0xa7ef94850e9b5d8b, 0x698c9fe8d029720d, 0x6ce987d161f50161, 0x035f6f329d240bf6,
+        },
+        {
+            0xe7c03c9d44ec2bed, 0x0bc4f4a276cf95c5, 0x0722d57c88f014ee, 0xae40634876fa941b,
+            0x046424df23ee068d, 0xd30b6530e8c130c5, 0x17b69098554f149d, 0x887e04f792f95b71,
+        },
+        {
+            0x414e7371941c1244, 0x1d48fe5394f1da50, 0xc18bcd896519802a, 0xfae7c2d848925019,
+            0x0f311ddff2ece2af, 0x7e8e0e080a779f79, 0x47daa5f9b6207944, 0xf29dc331efd08d6e,
+        },
+        {
+            0x9c096e1923e48f60, 0xbcc6fe538dd36f0c, 0x452e60f9bb86a9ca, 0xad35f732ed16cf06,
+            0xcbdd01a22bf445f7, 0xb7848e94f60ce893, 0x5e65e8ca2939a977, 0x304ebedc63cfa5e4,
+        },
+        {
+            0x79bae721252cc655, 0xa3b9a4e5c4743792, 0xf32dcfeb36fdba1c, 0xadbd0c1f7ac19885,
+            0xefb4fb68dc42a2cd, 0x78b1ca372289a71f, 0x7e1f70fe87fc6df4, 0x8d02430190a9faec,
+        },
+        {
+            0x37c0867246cd4141, 0x3c0fed171a60d8e5, 0xab18bf060f56fea1, 0x879ee748372e757b,
+            0x84b19b801d280206, 0xa40d7ce3d96ac240, 0x5d493fb1fea42ebc, 0x9a5fdafd40d79bbd,
+        },
+        {
+            0x790c0b30383b371c, 0x6dae5df9676f8168, 0x101bb4fe4c584948, 0xe3d7e99f55faafeb,
+            0xd2c9aefa134c2e3b, 0x0aa2a71f79e27788, 0x4082f7a67ed0a606, 0x843c12bb6a1be308,
+        },
+        {
+            0xae72ee7456e9e473, 0xcecde6c1743e16ee, 0x9a06f1057c48ca04, 0x79179cd25f822a31,
+            0x570d3eebe3530605, 0xbacb30c34c7b03b0, 0x0a8fe2540eea0cb4, 0xa052a5552cdf203a,
+        },
+        {
+            0xee0315879c34971b, 0x5829eb07e76545cf, 0xb7a3a6ae33a81bb9, 0xff42daff49c9f710,
+            0x894eae85bffb951b, 0x815fe3e2ce70f324, 0x636564cb428b1f12, 0x722e0050a029b0bd,
+        },
+    },
+    {
+        {
+            0xdfc9578b41aeb39f, 0xeeda86fe7dd55c1f, 0xd4b8fc54fb814075, 0x12e32a7833a1317c,
+            0xeb79cd2b2fd217d1, 0x5f5f20c0dbd07638, 0xfc57643a53dc7d8b, 0x65126014f08350e2,
+        },
+        {
+            0xd63e91e139bb481a, 0xdcdc072a99984155, 0x9fce6e38d2d8e622, 0xbf6978b68e8c8034,
+            0xaa1ae8748c37990a, 0xd1f0e0680e749b86, 0x5aa303b1cbdc7c12, 0x9a78baafc9130211,
+        },
+        {
+            0x3b270b8acc130e8b, 0x17f5f78fdc6f0872, 0x9683bd22e50d3f34, 0x6d5852af62699031,
+            0x83d554cd8f15058a, 0x24038deab4cfe9dd, 0xb19336ecc89479d6, 0xcaa9ed54f03eb59b,
+        },
+        {
+            0x5eeba910b3e2087b, 0xbd016dd344a61a33, 0xffd1f08148cd5c0f, 0x041c6aa02e6a8e94,
+            0xe09c35c5c4ac3d91, 0x58298105634767a4, 0x6120e7cb1040c2b5, 0x32a661efa713589f,
+        },
+        {
+            0x654e5b3e5ca9cad0, 0x1c377e65294aa685, 0x94dd8d571cb6dafb, 0x52a5366c307555c9,
+            0x0279f681dedc3d1d, 0xc7c15ac6a38b3f52, 0x97d7ebddd59ebd9b, 0x4ea646a4e161ef42,
+        },
+        {
+            0xf6210d3e146ae490, 0xb6938803dccbfc53, 0xd5fd88f90da92436, 0x8bd018d5aa4bca68,
+            0x7544976bbd7106ee, 0xcfc7ab32da20c622, 0x739aa7c858adb4fb, 0x01d951a9d5f643b4,
+        },
+        {
+            0x899319537b61e72c, 0x826b913587437617, 0x22aa37b6e729ce3b, 0xb97ee729a273013e,
+            0xd6dad8bfd617c0c4, 0x5214a04ff17f44c5, 0x89bb23b509462793, 0x1880d7742d03b48e,
+        },
+        {
+            0x5a056a90bd74c70e, 0x44f7d00d8af672f3, 0xdc25ab68ef4e9a48, 0xadd15cc3fdfb1069,
+            0xb1f4fd289f3033bf, 0x088a49bbebb8b8a7, 0xea485869a8d2861c, 0x46dbfdaf6b977fb5,
+        },
+        {
+            0x0f95912ca6509834, 0xe00f5c0800d061fe, 0x87fd6a8297e4abac, 0xf312dc3d3a04d876,
+            0xa11aa9f9e0db26a7, 0x8994f335539cd8b3, 0x5fa6ab2fc9f8ef51, 0x7d9f0b5eb42e59b8,
+        },
+        {
+            0x7c2227d242f5b260, 0x44ccd23e990bd5b4, 0x6c3ded963753229f, 0xbc01508a316214b8,
+            0x5bdc9d8a0479c1da, 0x236e0ab669881007, 0x5b348f6e2ada75a6, 0x45da17ac148e90e5,
+        },
+        {
+            0xdbbc2fa143c0b238, 0x7f32f2e5fe130ebb, 0xefbd73b7bf5d7a18, 0x713bc55ee3b4688d,
+            0x7e01fbab9e68a55f, 0x1743ee998e6a1130, 0x08fd5e2c2fafd59c, 0xea6bbc44f3dbfe59,
+        },
+        {
+            0x04e6461ed88ae888, 0x112d204a9be2d7ad, 0x952dc813db558427, 0x39b0165227e35200,
+            0x8b89bfceff02cdbb, 0x1381a99b3e854e4c, 0x68185218999efd2b, 0xeb41e1bb86dc62e1,
+        },
+        {
+            0x1195bbcb46d5d1d6, 0x583fcb4fa25755b6, 0x8ec3c3614a8a11ff, 0xc0d9886057cec2f3,
+            0xf64b3ffd0dad2aad, 0x30b548ca5f34f78f, 0x6aba9873338441ed, 0x98dd0efd1fe23f45,
+        },
+        {
+            0xe2f4302363257c29, 0xcd309787c030b2f4, 0x40a8892ec32fd8c2, 0x9a26bc89f6b05bdc,
+            0x37408cc211208b8d, 0x6e59678da8ea9d82, 0xe53f1837d915d485, 0xe0b615fed070e65d,
+        },
+        {
+            0x212fa1295f64ee8e, 0x946a391eba08042a, 0xa1260a2a1cdcb929, 0xfd45b902aa2b0b01,
+            0x015cf9e20961108e, 0x3910393bd5317a2b, 0x00d3ce83bc11cd3b, 0xfd62048495ea5031,
+        },
+        {
+            0xa264ef4002d0aaff, 0xa678c07d6e679fe2, 0xcff13be7fd88bdce, 0x9a8efe8d617badb8,
+            0x1388a815ad5a22f4, 0x8f821400fec398b3, 0x85a6a565ff4fc2da, 0x681f0181858dd4f3,
+        },
+    },
+    {
+        {
+            0x44168fbc4e933b19, 0xaf2db74ce54ea969, 0x36fade13aeacbb56, 0x2970866584e6cd1d,
+            0x6f7ff1e1b692df97, 0x5a68c1a26ae66307, 0x85bc544ce7685f20, 0xb3f42e6d0f65eeec,
+        },
+        {
+            0xfbf7033a675b47a0, 0xcb3669c46542378f, 0x96abb0f7125ec248, 0x6d5d2047795fc346,
+            0xa6c6c9e88f5cffb6, 0xb968f2c7bea5ee09, 0x2f2ce735844ffd6f, 0x7931b87727e40ac8,
+        },
+        {
+            0x113f094b89b781c2, 0x996bf893013833a5, 0x26bc6210c0b9cf6d, 0x18e2d3ac6a88f1cf,
+            0xc0ff2b3ca21a2d35, 0x409c2598a79e918e, 0xffcf65a0b6917e22, 0x8036897fbb4f8f3c,
+        },
+        {
+            0x98bb15ecfe73e699, 0x7533abdc47526489, 0x4b269607491dcc6d, 0x325ec2a077187363,
+            0x766faa197e9ab865, 0x1c105b4ac25a9448, 0x0b6b89630531b5ba, 0x32691f112db1a579,
+        },
+        {
+            0x05de3e119224c152, 0x2fa9a474ea8fda4e, 0xf5c8df05f48055ec, 0x48bbf43a9e23a599,
+            0xf593f034148086db, 0x0173a87aef0a2b62, 0x90ef01323fbabb6f, 0x56ced09a21ade107,
+        },
+        {
+            0x041e0aff9f102fb3, 0x91b3a87c106ae748, 0xfd969804c426fa5d, 0xe624f1cd28f95b76,
+            0x6fe28cce34f2ea56, 0xdea55947d230f37c, 0xd5e336f2f92f2742, 0x86852e3c1899c751,
+        },
+        {
+            0xe70af958bf881f9e, 0xd4cd35adc4e58ec4, 0x3889d3d95a531924, 0xac657424b4ce15ec,
+            0xdbe384caf41e1344, 0x9a1aed235ab8bb08, 0x375a041f8561df1d, 0x19f7a238b7685c1c,
+        },
+        {
+            0xabdf5f7341690d1c, 0x0e857a78f0edac8c, 0x59f40fcf8238cfb0, 0xdcb54f67511d41d2,
+            0x3f036ac80e645117, 0xdc4e833e7af5fdcc, 0x67d859b23d7bab2c, 0x92489b235f8b32bd,
+        },
+        {
+            0xa65f8abbf775b3cd, 0x0e4f2d7a5a359eff, 0x0d49b5fcc9d544d4, 0xa19d250041090016,
+            0xcda20aebd606e6f2, 0x293e2834fe0ad0a3, 0x2a2ff9d2ecb50ff0, 0x50c3beab87cb135c,
+        },
+        {
+            0x8fde5c070a6e6b06, 0x8f32f546b194cefd, 0xda91c27ca9b9aa2b, 0xcb3560e2e1031aac,
+            0x17f61cd273ddc8eb, 0x721fe021ee97864e, 0xa1dba31448cf5810, 0xe4ec77a1fe4d140d,
+        },
+        {
+            0x04da8af788fe3e8c, 0xc01d91758d81b777, 0x357a956d37cdd45e, 0xe08c989ec603bad3,
+            0x668a0f3542462a38, 0x52e98b0e327a2913, 0x896231942b97f9c6, 0x2d4d5cf6bf6976d0,
+        },
+        {
+            0x59ef34b4c22eb7ff, 0xfc26171add66596b, 0x6ce57d2c0eb3f3e1, 0xde4177dc0587bde0,
+            0x22f0f7eb6ebf95ff, 0xefde86941f55b874, 0xb699bdb3080cbc46, 0xe32804f350cd4190,
+        },
+        {
+            0x736c7133189147cb, 0x684da8e244e93b86, 0x6702ff68e1d90d17, 0x77f227884858bfe2,
+            0x33ba22ea0fd2a199, 0x33b3a0c297091a37, 0x3929122f7370454e, 0x85cb71be2bfab714,
+        },
+        {
+            0xb14d742d27bb142b, 0x1166be60214efeae, 0xbae30e9a2bd18cab, 0x3ea2b819fcb7eeac,
+            0xec8fd89cdd468b5f, 0x7654d5438ef32c9b, 0x66464f754e4935c5, 0xc7c9ae1d1636e13c,
+        },
+        {
+            0x90826ca9526915a8, 0x13901028d77c7cc8, 0xd490d2e1574dc7fa, 0x7bf5b001773c8cfa,
+            0xa986424647f383d4, 0x8b017944a282b62d, 0x9a53246db972469d, 0x0b009b4e1a2a4675,
+        },
+        {
+            0xe412aaf7b9e2f9f8, 0x0484c1aa0ff419ac, 0x9d944989417bcb90, 0x2b73dbe3fe7318ca,
+            0xb91b71e552dd7b0a, 0xd61f8eea3954afeb, 0xaaeab13ca07e3958, 0xde44203202a1ff49,
+        },
+    },
+    {
+        {
+            0x8292d96d0b054a0f, 0xa978af8874b9077a, 0x70bd185bfff1d49f, 0xbe6d08440279eab1,
+            0xa8fffe45b8ed07e9, 0x714824a1cb920e55, 0xcd5c628aaf1bb143, 0xd151afcd7637dbb7,
+        },
+        {
+            0xa433bd2e5a26a1d4, 0x1148bb1dd1c2d78c, 0x4aae419e64102515, 0xd03b993966489384,
+            0xe21d58b1d61a9919, 0x17618c364a0ef3d4, 0x2519020d6fe8c0dd, 0x48d837d600b87a75,
+        },
+        {
+            0xbe51975703fcd3bf, 0x3f9dbd8dc8c7b62f, 0xce91fce6fc476e0e, 0x2f140c732715393a,
+            0x8a149a94f11da35b, 0xf6a2be5e5367030d, 0xb68c0d820269def3, 0x32d588198eecb775,
+        },
+        {
+            0x5cfd3a693f11fc00, 0x1f2b5d018bc8eade, 0x5160359ba6b9f7ae, 0x1e2601dcfa696463,
+            0x7f5ac6d2915f6084, 0x6e387789679176d5, 0x7fb99f4bae26abee, 0x4798a2fcaa409d22,
+        },
+        {
+            0xc9536d6bffb3df08, 0xc95169ce6dde9e09, 0xcb050de7cc085766, 0x92fce77e0df088dc,
+            0x10c124ca88781592, 0x6429d30bc81030f3, 0x2e37721d09e20c50, 0x43e7f9caf3e3d604,
+        },
+        {
+            0xc192342d86b383b5, 0xe85f303f706b01d5, 0x19e1921388cdcb89, 0xe88f19432ce0de2a,
+            0xf6fcf8cfe453aecc, 0x0dcd10b89a67b49f, 0xb93d5b4dafece961, 0xe232f34ac39d0b53,
+        },
+        {
+            0xc08c85e50e6c8579, 0x29d04ad48d991759, 0xbae8f1633a8ccd69, 0xade665391790a49c,
+            0xf9f5bc8c45915cc1, 0x63461cf04f2b18c3, 0xceb75a9cd236e848, 0xac653e3b847ce6c2,
+        },
+        {
+            0x799acd7c64ca2efc, 0x3397a15b4e0bcb6c, 0xb9b10ced0358a26c, 0x0a30dbbe4b8ddfaa,
+            0xa70e9712e20f6fac, 0x87c7f732d11451b0, 0xf0c967b1d5eece8f, 0xbc62882aab370e2d,
+        },
+        {
+            0x8740af505628ad08, 0x30a233db8b1284e8, 0xb3982d7357acc8cd, 0x211d53d337c5ff03,
+            0xb6371f1bf6578d40, 0x7f749beaa80dec53, 0xe6b3f730a9816ec0, 0xd26832fdf5423ec6,
+        },
+        {
+            0xe9c0ba8516a010bc, 0x2fd90fbaea4f3e8e, 0x8af183714570a1e5, 0xe869e8f77cca9004,
+            0xe2c8afb72dd83019, 0xb877995dfd99b386, 0x1e3efc16f5adab87, 0x93105fe4aa3b191a,
+        },
+        {
+            0x8140768796067f64, 0xab2c270677a62d7d, 0xbe9c1edfae19786b, 0xa313f2b2887814eb,
+            0xe2bc4c1f08fd3c04, 0x25387129e5a9d032, 0x7b3ced228fbc5030, 0xc22bea3badbf1bdc,
+        },
+        {
+            0x305165d10a020be7, 0x48560411f66eaf8b, 0x5ff898ddffd2380e, 0x7da35f08784b4b11,
+            0x50f53e2c38fd05c7, 0x64b3ee8247ada3a5, 0x672ae316678995de, 0x74707460dfe96605,
+        },
+        {
+            0x4c6408f9a2ae339c, 0xf9ea4cb25a70ba33, 0x3eaa93645cac2af4, 0x62686d4695eaea09,
+            0x5196e88f3e771722, 0x749518e87108b198, 0x394107c429b25254, 0xf9945ac13a315aad,
+        },
+        {
+            0x70cbce8b62a0b0ed, 0x92f5dc330abbc9be, 0xbb92b7d3f369c2d6, 0x70dd90c879ef83e1,
+            0xe0b331537937ab45, 0x3a8d1f74c054af6d, 0x35cf7380b05ebfc4, 0xefb8dac258c2cd0c,
+        },
+        {
+            0xe79a4f63ecb1ad25, 0x1857cec76948504d, 0x03b7b3ada497922f, 0x9df2f2e438930f36,
+            0x355e4a7a4bb5927c, 0x5ad3fd47636ec349, 0x5400730dc41b19ca, 0xbfeabac1555afa93,
+        },
+        {
+            0x7722cb400c11e65a, 0xc94a7f5268ff2be5, 0x420085cc8d9f9352, 0x4addb986ca4b2544,
+            0x3c6ceac006264a47, 0xebc01a03e2b48ccc, 0xc430e7abea94fef2, 0x973bb6f0bd94aa8a,
+        },
+    },
+    {
+        {
+            0x11cf4c2e24424a48, 0x843c73ee37d4471c, 0xb3047fc5617a488b, 0xf2a91709e3cf861c,
+            0x844444211c3a60f7, 0x74787a3626679148, 0x115fbd0653d9404b, 0x70fd33656244cef0,
+        },
+        {
+            0x76695c9b2b574b7f, 0xcca80405c369b6be, 0x1f4bae99e3108ded, 0x9e715ce2ea133fce,
+            0x60d5205554c2ee1c, 0x56bab3011680742e, 0xa409b5f63fe438b9, 0xe3a8e4d08036f7ce,
+        },
+        {
+            0x6d25fbfea62e0842, 0xf07a613360d426c0, 0xb28fe4774c3a816c, 0x07987198b8d1259d,
+            0x048c21b150044888, 0xd0b1f74141a2ad58, 0x85be8dae4dba884a, 0xd96bc03009802a03,
+        },
+        {
+            0xe1d7ec0f247fdfdf, 0xfb9d90e74a23d1dc, 0x7012eb2c190fdc41, 0x5c2bbff6ddced48c,
+            0x8a93426a68cd7feb, 0xb59639626b4854e1, 0x8ac72b8ee772bbd8, 0xc10d24d2a6b3040a,
+        },
+        {
+            0x66ab4b14e735cafe, 0xb27539944e80373d, 0xbc5bba23f595617f, 0x0802dcbf70cceda6,
+            0x3bf5ba1cc6040160, 0x7e181374db552473, 0xabdeb3cad1b1a590, 0x14f0c025217503b1,
+        },
+        {
+            0x8fdfef1694d5f347, 0xf31894902b04af0a, 0x30e3da7a6d2ca633, 0x8d002aea4803814a,
+            0xc15e311f95a0bfe9, 0x2891ec7e4b4cc50c, 0x0936fed88834df25, 0x7e5d7dbf78e00289,
+        },
+        {
+            0x3a49b4ae1863c1b5, 0x84af9fbba96f565a, 0xb45c071dedc2f3cb, 0x8db1c01da76f7bbd,
+            0x2f3e9a9ea84ee50f, 0x508e794a49145b55, 0x6acff4f7e9692134, 0xc7c5a5c8555cdadc,
+        },
+        {
+            0xb9a92d78fbfcf1b5, 0x17ce4fabe8427d74, 0xbae98ffdac66e74e, 0x6d548304145bb5e5,
+            0xbf3dc6030992abe1, 0x318cfbdabefdc5c5, 0xbb5fa37d59f8efb8, 0x347874a04ef5bef8,
+        },
+        {
+            0x504e5bce43138908, 0x604dc5d007c418f3, 0x87dd590c858dfdea, 0xcd321471ba72a002,
+            0x69187392f4ce3adf, 0x66be5a8af28197ac, 0xd1a75f0fa5ed8d90, 0xb4ee7c751efc09fc,
+        },
+        {
+            0xdf552b01bf68688b, 0x2fc542cb8f96a57a, 0x5a731b614edb340e, 0x5143d103181cf578,
+            0x749ab5112cc936b6, 0xbc94c0530dd355c2, 0xa825eff5a3900fa2, 0x60a909a3c1dc2b31,
+        },
+        {
+            0x2cd1e3357be5e8da, 0x2d4cd170c3e59ed0, 0xcce9a9ac79a8a4ec, 0x82bd14e1f245dd64,
+            0x5cb2b972bde37243, 0xc2444ff4ddede4be, 0x1a5017bbe6400bc7, 0x26d64323ed3c065b,
+        },
+        {
+            0x59b33c78af5bcab5, 0x0053d789496fbcdf, 0x5a5afe02d7883bc1, 0xec9afe78fa66951d,
+            0x38f28b83728e56a6, 0x21d0b6ac78cafb9d, 0xd43996bc7042e327, 0x606866377c31c145,
+        },
+        {
+            0x518be48d8ab866cc, 0x35e78b411deab029, 0xb02b7341f8b326cd, 0x4aba37e1a8390920,
+            0x466d7cabb81ac63e, 0x389b7241b4565fb9, 0x93a99af4d5340f8a, 0xc847f9322c1330e9,
+        },
+        {
+            0xe1f8d2e63d919304, 0x09cf437c456be82a, 0x6a01dae8f0c21973, 0x8bffcda8246d9ef8,
+            0x7e03a0d45d853975, 0xc3800ca832533ba3, 0xd77152ccf02ce43c, 0xb8bc17a66392089a,
+        },
+        {
+            0xe757c1846f1160cf, 0xcdc10e2cfe9b81f1, 0x14f1061ef44559a6, 0xf9c5519753518684,
+            0x1181e26118f5ae97, 0x656707b03ef9c5cc, 0xb59fe0bffe066ded, 0xc7e5fb4538c1bb4e,
+        },
+        {
+            0x6f5fcb614b4558fb, 0x9602597b1f2545aa, 0xfd89ab3fabe5e469, 0xf1daeea2fb2e16bc,
+            0xe699acd73a12940f, 0x24980f6c4d7c7311, 0x4a5cf975336c8ec6, 0x8e180e328c27d3dc,
+        },
+    },
+    {
+        {
+            0x4f02ece400e25a95, 0xef9474027ac1732e, 0xecdb65ac51149260, 0x6043aa29a9180d51,
+            0x07fc92bd852deca0, 0xf333829715237c8d, 0xecfb0e76e84b3f38, 0x21f2f5c56b89af17,
+        },
+        {
+            0x88abaa5c7fd181e7, 0x136a0c9fca3ad1eb, 0xe6e5e6c2f394aab5, 0x84d697d49349e4a5,
+            0x8215578bf76f4b3b, 0x81a1cec612feeb5f, 0x5d336eb73e876bc3, 0xe8afdcb5071892ca,
+        },
+        {
+            0x791b2085894f7f16, 0x42eb80f2b5c353fb, 0x377777f7df8db0d4, 0x023c096334c42ef2,
+            0xba05eb5ea34cb6d0, 0xffb8b01e55cd1242, 0xeab6ff7d87cd9f24, 0x175e94c9ab3c09fc,
+        },
+        {
+            0x95792f06978f92cc, 0xb11574d323196752, 0xc3249711b8cfcac1, 0x2061c767cf93af67,
+            0xeff09a1b2f63dbe7, 0x527776b648091edd, 0xf0fa985e19bba5a9, 0xc54f89f366ae3221,
+        },
+        {
+            0x67963bc4f3ec2a3f, 0x43a8e88ec54f288c, 0x2e5bbcc72136bc1d, 0x7fb34fb4fa3fd3fd,
+            0xf14fe3ac213234ce, 0x24e4b43f025877fc, 0x4104be478ecd8441, 0xd943bee72f2d8f80,
+        },
+        {
+            0x0c6197d83c5fad2e, 0x68190b5dd38dcb67, 0x3a7120ebbf8dc4fa, 0x98b53d041595607d,
+            0x1b3aed6d23aae25e, 0xdc8327425002e30c, 0x50e82cae1b8fb3a5, 0x003a7b2a6f57d49a,
+        },
+        {
+            0x0fc4a1161c89a233, 0x6bdce39d98a5b97a, 0xd4ae715bfc1a09f5, 0x4fde13e740018159,
+            0xaea5a30b0c04b764, 0x6e0cfc2612b3e370, 0x36eb8081893b1ec7, 0x8f95f5852278b7fc,
+        },
+        {
+            0xbc5a62846a436476, 0x6fcc231335dbb9cb, 0xa77d2d9f5012ffbf, 0xcc25e9f44ae4bd14,
+            0xd17fcfc41a5e40c6, 0x7d716a5fff085322, 0x9dcbc50bee3077c4, 0xebfe953cdb4a6e61,
+        },
+        {
+            0xc54537e0c9b59114, 0x6eb32d349808147b, 0xadd9e6793d0430e1, 0x54439a45ce069e88,
+            0xcbd50ba53da36bef, 0xbbdc00ba02574b83, 0xe6b184c5379713d9, 0xad5bab4e08c4fcba,
+        },
+        {
+            0xb3c421d5caca3343, 0x7f7b1731e3f44f9e, 0xd7370524fb35faa7, 0x57aa8870d8296470,
+            0xde63924be69ac5ee, 0x8d9f91110c5f1b68, 0x03d367602389d6e4, 0x4afc5aafdd313547,
+        },
+        {
+            0x00582d90ae111be6, 0xb66efd1920ef4a55, 0xb424ebdf4a5790ec, 0x3af05d477838e19e,
+            0x2304c533b09c7e48, 0x393edbfcc0a2b7bc, 0xec0efe11e330320c, 0xbb423dd81b47cd4f,
+        },
+        {
+            0x7b4c47fdc5287caf, 0xa20f888bbccb4a9d, 0xe0f2fdb4763a9e2f, 0x572ee73786d9b59c,
+            0xa3e3066ba634c3c8, 0xb396bb69f8ae6745, 0x42271cc43accf25f, 0x8fae7970527585e4,
+        },
+        {
+            0x7f09bfd2cffbe367, 0x4d0ca0c8e0ed2ee0, 0x351281e8bb58e0a4, 0xf6a7ceb116168e3e,
+            0x7e2aaf0a1e0a09c8, 0x88c972eb672ff068, 0x6f182145b2eef857, 0xf1ccf9c7b9751df7,
+        },
+        {
+            0xc7a838d81c1c6259, 0x41d0d72ff2caf86b, 0xd438305d2a2df41d, 0x915d7a34fb8d7063,
+            0x993eef9e3c7a5c48, 0xe5ed584e0e76d849, 0xb2b1e583e2810562, 0x7ab7af0fbbfde8fc,
+        },
+        {
+            0xf26e13543473b0d9, 0x84a1dad338eb4c91, 0xb8a0343a75a5aca3, 0x655f208d718b1dc4,
+            0x9d51b7347b7e6824, 0x7a583af23886626c, 0x66034a3fcfbf7eb1, 0xe25f23299610c6bb,
+        },
+        {
+            0xe7e66f2fd3d777d7, 0x3519dc64cf1a6b09, 0x0df07bebdbf88dcf, 0x17b09654acd4e105,
+            0xcbd7acd04e70c783, 0xda66e74796b9d577, 0x6d0488a1e3e52f8a, 0x3ec0fd116ff71c1b,
+        },
+    },
+    {
+        {
+            0x33207f69573ec6f5, 0x7ecc4bbe67bd2e8b, 0xa07acd348ffe2420, 0x0a957eb8a13f9cdd,
+            0x0bc7f95b9ec9c0c5, 0xd82147cc6a8578cd, 0x07a2e7c59e61923c, 0x591eb06632e83f25,
+        },
+        {
+            0x1736296d1ea4a056, 0x6f74702cd77811ba, 0x5c927548432dd74b, 0x9cc73271e7a194ab,
+            0x0f035eded6328dca, 0x5292aa3928db755e, 0xb5488385a0192a4a, 0x6e7d2fa8dfc6895c,
+        },
+        {
+            0x8e245a192f96144d, 0xc740d3483b61e5ab, 0x8703710e293ddb25, 0xf4bb6ac02bbf8f63,
+            0x86396457de3b5805, 0x607022db65d29e63, 0xad0a0cdccc930fe3, 0xd9997ebb1626abf6,
+        },
+        {
+            0x271b2e2a0133903b, 0x5b3686f2e495ee32, 0x89bcc9740c991f28, 0xadd20cce34f93b8a,
+            0x5f5a1768680b65b6, 0x0c453ab8aad41c40, 0xd479630fa7fb4269, 0x60039d0152c4e929,
+        },
+        {
+            0x67b66ad862f132b5, 0x70318d2bbeb47184, 0x46c429eaf50a0e98, 0xd7e32ebae2b3542c,
+            0x625c1ce9e096b4b7, 0x09221351389fd4dd, 0x08dc02d2fb0ee85a, 0x98c0ba7d853cd901,
+        },
+        {
+            0x13cffce916fcb889, 0xed7e6683ac7e709a, 0xb655d0985896e541, 0x07124356b92a6204,
+            0xa2ae43c8a8f50043, 0xeb39255c68731891, 0xe07be0ad3d9c408b, 0x0db7904f0b4f5c3a,
+        },
+        {
+            0x07b6aeb8fd2e8214, 0x813e718e4cbc297a, 0xfac0dfab81fd6931, 0xa1fe88213c48ffd7,
+            0xd2715c1885e03c08, 0xb6e4418a977c57f0, 0xfaa79ea473418cde, 0x6ab8c25b171e2a89,
+        },
+        {
+            0xee6e8134bce59c0f, 0x3d068b4cd59f7f86, 0xafa2753c96283457, 0x453fe33c1aedcbf0,
+            0x781294c8483c0b1a, 0x9e6f51335c2ad1ee, 0x2a77b6ce69383e0b, 0xcb5a83abfa9f0142,
+        },
+        {
+            0x63acd70e8344224b, 0x966efefcc3145159, 0x406619ecf5e0f955, 0xedd0efc9ec6de618,
+            0x6fe3e34eb2580ed4, 0x9d8875b54139b95e, 0x85baf0c18e5be187, 0x549cefca09553886,
+        },
+        {
+            0xd256dd83dd77d731, 0x2faa6a0e7414d0c0, 0xa2e0f9283b90f004, 0x019bb3ef8719bfd4,
+            0x3f4f6109e2d515c2, 0xb50a9907bf88d7a6, 0x8e5fbc2d015ac4de, 0x96992421e78a2117,
+        },
+        {
+            0xb05981303c63d73f, 0x55e59f610431550e, 0x6f2e109d6693eb8c, 0x3602ba82470b10fe,
+            0x3acd0af45ec7f357, 0xfa7479f4b071c758, 0xbf47caa0e13652c9, 0x6fa139bbf5f5eca9,
+        },
+        {
+            0xa3283a2c72aa1c89, 0x1969613e2a4d513e, 0x0d4c0347ddd5ea18, 0xbbad9ce443cee5fe,
+            0xe8c050a857313b49, 0x3b91c3ccff09bf31, 0xe6e5ab6d610395cb, 0xfc36cde0deb31bef,
+        },
+        {
+            0x442bb39a0be95497, 0xce5d2c600f33c9de, 0x1ce0d08c283dc751, 0x106ed58879b3c1a8,
+            0x4b2e29c67f8ee4d7, 0x7d61e3bb08bbd660, 0x11504dc51e964a3e, 0x31544a52c77a957a,
+        },
+        {
+            0x53c4c95657a10070, 0x7d1be72eae6e4872, 0xb704009cd427eda4, 0x3e0aa93f5f39b7d8,
+            0xdea1ab483153a757, 0x10a070e79ee60ead, 0xd6a6e92de6c916bf, 0x02b1e0e6bd7bb216,
+        },
+        {
+            0x47f6144cc6f3bd8d, 0xdf7b1ee471c19265, 0xa7ea37f13fd5c30f, 0xdc2d890b79fa08cf,
+            0x9813bced2fd40236, 0xa8a1055f432dde17, 0x70011f477772c727, 0x965c130a2e2e802f,
+        },
+        {
+            0x19915b26c3d8ed98, 0xf451e57a9a66a6e5, 0x2984360730dab6a3, 0x1710267c3d1a1ebb,
+            0xce4ecfd4e11d88c0, 0x12fc278711ce026a, 0x9801cecd691227de, 0x517a92f376ce6dae,
+        },
+    },
+    {
+        {
+            0x821b0fdf648c48e5, 0x689e6d569f45a433, 0xa5a9dca82e572855, 0xb0f07eb78adfb547,
+            0x48ecb166552c8d55, 0xfe3fc268ce854171, 0x323af5ebeeee9bc0, 0x0666a2a341ae1c80,
+        },
+        {
+            0xa06d20bc9ff262fb, 0xcba032fdd075868b, 0x70376026943fd973, 0x81c57cbae35c5e02,
+            0x1964e700ba871f1b, 0xf03a8c046b265f57, 0xc8ebc9120b950259, 0xd2b0ee30ad32ca8b,
+        },
+        {
+            0xe01bf0c289c8e719, 0xbce1e20fb2f4cdb0, 0x8c38eeafa1053ca5, 0x8c2d85ef7cd633a5,
+            0x756953649b53cdb1, 0x5e999741447eb1a5, 0x6d6b2d88dbd88626, 0x87eaf04521876357,
+        },
+        {
+            0x2c88f1ffdeec441e, 0xab52096bd01b2157, 0x37eee2756c45cf5c, 0xa070d24e0520ecaa,
+            0x61d15bd1546b9fd3, 0x3276fb742c96db1c, 0xc5c1b041b95b29b7, 0xe18008dbbd7d3254,
+        },
+        {
+            0xd56ae44f98dfb69a, 0xd5f66b0b609d941c, 0xca6b6d35b91b5245, 0x98e3a4e37b3f98a6,
+            0x0715dfa6f358c56a, 0x3b02ff2136a66c64, 0x737b1401cb22cbd3, 0x9dd15f5b6b8e9624,
+        },
+        {
+            0x25f5a71dd360d017, 0x4c0779b529b0ed73, 0xc662fedc9825a018, 0xeee8912561d4add0,
+            0x1543814d92163d14, 0x79f2376f27370d3c, 0xf80c6963cbe1af7a, 0xf2d521bceb9e41f7,
+        },
+        {
+            0xe241619fc1805864, 0x6f1d6166b2de204a, 0x13c3f91250e68d0b, 0x32eb021dc4a24f5a,
+            0x3f1452f50e78c588, 0xa267bf19c9971e98, 0x77a231a7e801c021, 0xf363c9b3c2666e80,
+        },
+        {
+            0xb8eb0bf0ae309a0a, 0xa9f52f58375b8fbc, 0xb8e4f9481a4993b7, 0x50ce578e8f73c292,
+            0x2437a4a602e503d6, 0x20cdfc50e4c68ea3, 0xfec5993b3616f348, 0x5d96b4c5c0c420df,
+        },
+        {
+            0x6b71cdf0cca0c48a, 0x00e71b54c1aea033, 0x247f5baa69f6d107, 0x4e3ec504050c3704,
+            0xf2b2be8a7a438e93, 0x240b632da331e01e, 0x61e6655791150675, 0x3236413495a99a28,
+        },
+        {
+            0x5e5de136d3399e1e, 0xe38bab00fe2f8b75, 0x736126de3a77db29, 0x7b0d1865f2aa121e,
+            0x5545e45edecf9cde, 0x9608ebce2318be70, 0xe6596006fa55b0e5, 0x0c8c2f41bc4b6ca0,
+        },
+        {
+            0xda1c5c7a92025945, 0xb114ba225d3b0775, 0x11cc6888cedb69a0, 0x4365bea80f83c772,
+            0x006fe80bbda8dbe3, 0x334adcb6c2d3d266, 0x8c92c0841521de1c, 0x57873ef978d8f72c,
+        },
+        {
+            0xcfb0a7d03b64dcd7, 0xf4c2f1fc558c9d55, 0x110c2db2a0fbc656, 0x3cad85caef5b6bea,
+            0x7099dd0e4e0b1230, 0xc769b937098a2fcd, 0x9209f5501e1e7407, 0x1b47255d1ba7cb47,
+        },
+        {
+            0xd8aed0cd2c01b596, 0x1a1a2e1130efcda3, 0xf771f93b36b1a5b5, 0x2ea34e3d14fcd251,
+            0x6895cb31fd893979, 0x10b1d2c914f556b4, 0x835fdf7e6430bfa8, 0x1f4bbef524bf4ba5,
+        },
+        {
+            0xbc805aa5d562b5f1, 0x7101b9da35dac658, 0x5b7f211dddc28e5a, 0xea89f24cd3d1cd0a,
+            0xbaaa9ef57567c80d, 0xe0d1f26d9a60c5ee, 0xc88a044cab36cd64, 0xb8e03d021b125de6,
+        },
+        {
+            0xda0c10473a707a66, 0x76ddb98f0c692d44, 0xeccae586b15b7254, 0xeadc1b51e7e82423,
+            0xd6779ff27c3cb698, 0x0e271cb4df6e7da6, 0xeacf34c345900023, 0xafd017ad03da2ba5,
+        },
+        {
+            0x4926699827c7e6eb, 0x84ffa3726625bc7f, 0xedec924705c9cb15, 0xcfad0b908075b84e,
+            0x94bed316bc0898d3, 0x02481eec11f92525, 0x19896e1b0d7e59d7, 0xa06adb6cf2bb3129,
+        },
+    },
+    {
+        {
+            0xc35f6950fe94629d, 0x1cbaa9359f860b15, 0x29b4bcd3f24f8f15, 0x0ae5b06ad29c8458,
+            0xa645c31d1b6c2df1, 0x640b0990d804facc, 0x7a4a7f59122b33e6, 0x94bb0b2b7479b828,
+        },
+        {
+            0xf460aed34397ee7c, 0xf249e4cc36fbc7fe, 0xc42d9da8aab03dfe, 0xa3d73ce3435ab9f3,
+            0x86dddbc33813a3f3, 0x86d5779ab79c32a3, 0x7c3d9aff028a2c3f, 0xc687e71bb1add2bf,
+        },
+        {
+            0x0a23b3d6ce2a7da5, 0x7efbfc9bc6d3650a, 0xdddc5f43e49d79cd, 0xc642b12041334529,
+            0xb73d52b60eb07da3, 0xe0c9a6e79623cceb, 0x65e4f274a8ccb9c3, 0xbc6dacb9d214d40e,
+        },
+        {
+            0x4612a56209b3fed3, 0xf296c17a3579966a, 0xa124a36f07960971, 0x6d03b214380c4a05,
+            0xcb0746e270f1f268, 0xcc9b47ff9341aea4, 0x1b3662d56d2f59cc, 0xa6c65b2dd4b1a15d,
+        },
+        {
+            0x9ce66d5faba617ca, 0xf5bb17dab788f1e7, 0x03ea09fdffbd2024, 0x553dd7092abd4aae,
+            0x02c1458bc19c4561, 0x4ecc53bd0b2676dd, 0x161461025274f7de, 0xcf5fa73809ebc51b,
+        },
+        {
+            0x92df0f5608a104d4, 0xfa16cf8eb317079a, 0x0425bed53031eaa8, 0x7f7c45cb344f3c54,
+            0x51574e5f9db182a9, 0xcae923fe59f23a6e, 0x4b19b78d03b6efa6, 0xffa74d2fbf8c3517,
+        },
+        {
+            0xbafb0568ac0e00ce, 0xff4bc59801c05e34, 0xa94e0be1f6a524f0, 0x2995e87828303539,
+            0xa6cbf99cde02dc40, 0xbe180692de00fcad, 0x7a71994d9130a510, 0xa72b500709e07732,
+        },
+        {
+            0xf96c113acccb0a4b, 0x24c26bba3615f016, 0x52fe115aeead2f5b, 0x85623d260d7aaabb,
+            0x50791fd031a2564f, 0x3659974dcd0d59a4, 0x2cffdb747a8b7466, 0xcf6b36e5514787b0,
+        },
+        {
+            0xf547010211df43e5, 0x8409364062ab34b6, 0x5bbca2318c917f44, 0xe72de1f63bad0a3e,
+            0x7f9f020a03e1109c, 0x1763a1ebea389820, 0x28793a51ffc618b4, 0x753910dc9858e06f,
+        },
+        {
+            0xee3e34ef8fe0a7b9, 0x04a824a82a579b94, 0x09fbfe3c0a67a2a9, 0xe0ea14c9bb11fe8e,
+            0x0dc9dc426b28c8ad, 0x945e5c6517efdebb, 0xc71ac5d3d0ee475a, 0xf1a9b180287af442,
+        },
+        {
+            0x4b1b0fe2c03f687e, 0xcd876515a08809e2, 0x1c9e24dbec77db73, 0x60cc28b77f6e8d3e,
+            0x85fc30fa59e4912a, 0x720e01188324abc5, 0x23dfd0bc7948537e, 0x1b7da98ca6b12acd,
+        },
+        {
+            0x8afccd364ab1ccd2, 0x673146351c03ab29, 0x458f36bfd7ff3a32, 0x70e9e789fcf71648,
+            0xf3764534a6e904cf, 0x2d6130b1f4bdd378, 0xc61c98fb1ca5ce34, 0xda11f502a4a684f5,
+        },
+        {
+            0x5db08a6f979e22b8, 0xc7258fb6073e0d78, 0x92c4165b63c5cc94, 0x822e0c784a612c2f,
+            0x54008a05131fdeec, 0x569cc746b15d6480, 0x215621de0b213871, 0xe6d2f669513f5bd9,
+        },
+        {
+            0x92d61591badf6b6e, 0xca647a3f5bdcedd4, 0x1d44f1d747de4395, 0xff4740840f733e8f,
+            0x4fa28a1265c87b34, 0xe2d042bf1c1adc8c, 0x0e75ad92bc5c965f, 0x79c1467f7bda6470,
+        },
+        {
+            0x23a5da551ac55d35, 0xc3296c776a32fe3c, 0x411677aa9a08cae6, 0x2cc047c5c8f8e821,
+            0xeb36b1fb34b29765, 0x5762c902def02a34, 0xb4129ce736b49960, 0x524f43ba3fa40915,
+        },
+        {
+            0x8d9daa41b6223f04, 0x803c9c0e841c3fab, 0x60eee3f9c50b42cf, 0xaf4a7a5a77298193,
+            0xd379c2e1bf809ad6, 0x903ab4b1f67c0ff2, 0xc779d7ed90f8e637, 0x968b0cc02cf3d363,
+        },
+    },
+    {
+        {
+            0x64ca871cb79f82af, 0x31304b022dab52f6, 0x1825ab54928239a7, 0x740413b28e4ad736,
+            0xc5c5d3fa44071d19, 0x83e438f13f0b2da8, 0xfd759448c70a1981, 0x13e0c7ee565ebae3,
+        },
+        {
+            0x034dd314ef7750f0, 0x2ceaa70522da84d7, 0x4561a254fc0d647b, 0x81cf0915bbe01157,
+            0x547a3d4e34b798eb, 0xbb5dd6258b1c7544, 0x94fee01bc8194168, 0xdb4c25fffaeb010b,
+        },
+        {
+            0x1f09b22514fb9624, 0x2eba4ff8ca4229d7, 0x5b159dd121dc8c19, 0x1e1f968fb1aa553e,
+            0x6ea25976c7674d52, 0x98e73adc7b283501, 0x7cfce0e1d39468c2, 0x7aad0af908438a62,
+        },
+        {
+            0x1fee0f771e33b2a3, 0xd4bed81f9f789870, 0x6396feea6ef05b7e, 0x9c5d6a012640b62a,
+            0x170cfec96834bea4, 0x68d16728e131feca, 0x4be9c5d600affb4d, 0xe34a423c99a6f256,
+        },
+        {
+            0xb795ea0078401c3b, 0x86776990a85ab971, 0xdd81393b185739da, 0x76d0031f58136c97,
+            0x6aceaa56641d39d1, 0x918844c739be7ca8, 0xa63993f7e18efc54, 0xb53691504af0f30a,
+        },
+        {
+            0x4929e89fe0aff809, 0x19755ec21769a00a, 0x3b6a207bc242f335, 0xeca054ef090edab0,
+            0x217e9c8bcd9e1c26, 0x917c2ecd35d4ac57, 0xdc869d5dad33911d, 0x22d9d8602e828bd7,
+        },
+        {
+            0xa1331e951be7ef41, 0xd1f0c3c39fa1be62, 0xb1d8295e4383e451, 0x658d8a849f08bc14,
+            0xb0587aef3ba4b85b, 0xb519c587481cbb27, 0x2b975db6040d8f06, 0x399f64171691d809,
+        },
+        {
+            0x5dfc2874d8247f13, 0xc211a7a1e3c11f56, 0x7512563fa2503b97, 0x124cd9845c007c82,
+            0x4f6eb682491cd249, 0xaf4f70a3a683359d, 0x2f1dfe71cc302b62, 0x83c474bbe57fbf56,
+        },
+        {
+            0xaab4e2af4911d8fe, 0x594de60029b958a8, 0x772877d93b95c879, 0xe1a294df88d74850,
+            0x0b285cb7b8e2c6a6, 0x5f2863acd04c83b9, 0xa6644a2c05348693, 0xc992007a7639de95,
+        },
+        {
+            0xd5fcfb9f9c501ab7, 0xc8a0adee21b09b61, 0xfadc14a10fc2099e, 0xd77b9e00a0bb08b8,
+            0xb3822ff8fa83031e, 0x5ce27aa99cb73c1e, 0xac1b14cb8b467f6d, 0xbf205949f926c940,
+        },
+        {
+            0xc66c7fcc7948fa09, 0x8b807e7e33934673, 0xf8f39a7d210f17b2, 0x68903a96ea49517a,
+            0x7725c3985f6784ba, 0x4e27ee2b7898bbe3, 0x4cbe3d15c1c7e31d, 0xbf6509419a75bfd6,
+        },
+        {
+            0xdb68abb770b4b128, 0x3d41473bc77e34e4, 0xb5a244e62ce86953, 0x8b05ea05b4c2620c,
+            0x880b4c89ab8f5de0, 0xe76da1bac1bc6de4, 0x442a15e547cf32a3, 0xe6dbe4600b1cdbef,
+        },
+        {
+            0xffeada3a36387e68, 0x580534629321ed94, 0xc336c084cc0f3ccf, 0xb962ad34dff14db5,
+            0x03d31a7914636584, 0xa84b166542860aff, 0x1fef31e9c6015632, 0x234ae4284eedf6c1,
+        },
+        {
+            0xc3af09714a3dbbb7, 0xf283557b1b03a8e2, 0x24cf2d30e230bdbf, 0xb8bdfd76ae06c865,
+            0x3bfd169aab4e479c, 0xf5d7ff46c01bc388, 0xf3c9bcbbb1b2dd5a, 0x77cd5f187b4a8694,
+        },
+        {
+            0x2b6b92e3fafc3663, 0x7243e5856a65fbc4, 0xffccb2227f456fd3, 0xd6b00d284fdfa415,
+            0xbe484f9101e07e14, 0xe83849366f096f37, 0x21d512ea67507c97, 0xd56dba5a9e5071b9,
+        },
+        {
+            0x43af7ab7916a8016, 0xf93d487f532bfb9c, 0xa5f9af3ce2174971, 0xd1b9cf1f2d59b4d4,
+            0x4a77941844f4eb91, 0x6a131facc226edc5, 0x472ab89780d4bb33, 0xb69687a52f6ca1fe,
+        },
+    },
+    {
+        {
+            0xffa73ca2fabd066a, 0x494e03a8f9c78bfd, 0xe585a878ff55cfef, 0x00770b1fd7053784,
+            0xdec4da4a056fe70b, 0xe37395d857bd444f, 0x666250d4685df668, 0x0549569ebe6cc583,
+        },
+        {
+            0xf48cdca6db4bdb35, 0x6bc23aec74d913a7, 0x8f0ccd9d12ed94d5, 0xe4aabd1286db09e7,
+            0x0cbff31a1e948326, 0xcf68c47c17a479a2, 0x3cced8e2ca7686f1, 0x15ed1e994eb62669,
+        },
+        {
+            0x903374994ad8bba6, 0xdb71e1fbe3ecb618, 0x6955e8743cf2a8ad, 0x594501f5ed691fee,
+            0x7e2baef3d29bd364, 0x5cbd91ac6f766759, 0xaba54aaab2201a96, 0x2cfea457cfa392ab,
+        },
+        {
+            0xfb3992a4202bde39, 0x2549f5643d6bab98, 0x0b56464287712512, 0xd52442b47fde7e50,
+            0xa6cefd08a3d3e16e, 0x5b194f0ac83b29bd, 0x6db0edd8906dec8c, 0x7a09095902570c1e,
+        },
+        {
+            0x78bb12ea7f3d83ab, 0xca22c31c573f9b99, 0x4283c1732aed4c39, 0xda054c1d39f32bdb,
+            0x2ead717e1da2cbd7, 0x747d67cd62390b41, 0x43739d9c6b9666a6, 0xb84e2f228c827b12,
+        },
+        {
+            0xdbadab5d7e952317, 0xab849ed4c2a5bcaa, 0xe3acbb741e72dbb1, 0xbf42c3d35d4b7cb7,
+            0xebe967b53d748639, 0x1fe93db5c03af7a1, 0x2ab14596a944ea06, 0xfb05a75976655c09,
+        },
+        {
+            0x25ca1891753008e6, 0x4338ec985f0ff93a, 0xd2ba8557ddd30a7c, 0xb4b6536109c51794,
+            0xfbb51399d1cbc66e, 0x28853781e53bca50, 0x5b797232fd5a9aaa, 0x6249afd75b88c4f3,
+        },
+        {
+            0x310695d0eb10175e, 0x79aaa6eacd236aa1, 0xf78539ff3edfff40, 0x2369c51702cd6063,
+            0x81e43ae55c8631ff, 0x065e8212216a60bd, 0x225cb473e761a5f9, 0x695ef860ab6de6fa,
+        },
+        {
+            0x1fa9654715ac27ff, 0xcb0dc17bf49b6c9a, 0xa3e44853709dd202, 0xd3905c5fcfe2bbea,
+            0xb01e57996c35ce9c, 0x0063e7ac900ef600, 0x8c70b87efffa5cc0, 0xebd76d3474230b0c,
+        },
+        {
+            0x8c4b500983c3da54, 0x086a7ec54c8a87c8, 0x9ba0b368aa166c4c, 0xa279670fa658ac1c,
+            0xc49f49bd5d0544da, 0x28c2232315cb0b41, 0x86293dfaa4834d71, 0x283e191dd1e1d63b,
+        },
+        {
+            0xb60b31f32e6d116b, 0xd49e9d11ecab5aa9, 0x3e95f8446787f23d, 0x2ab8834fa12f4846,
+            0xe70e2ab15b6359cc, 0x7a6349e99322a047, 0xc01e424c6c1e483a, 0x424b202792bd5d1b,
+        },
+        {
+            0xa6b9e6c9f60ee3e5, 0xb397af7fa236377f, 0xb7a318ac7da4af71, 0xae64b6130a9d39fb,
+            0x66ce6c74902b3411, 0xea256a705a199e53, 0x8dcddd89550fb76f, 0x9443b47703e70f9c,
+        },
+        {
+            0x5e2dddf833ca1226, 0x18e624b9588cb1e3, 0xf3ba597a21809265, 0x902477025d575728,
+            0x48a5bf7bc1f918db, 0x17d1efafd6840541, 0x13dfe6fe3e2e754d, 0xc471e16a707a531f,
+        },
+        {
+            0xc5a86d3cdebd5116, 0xd547fe08a2ddef2a, 0xbabb617f6a149f12, 0x14f69a1b8a766128,
+            0xb83a147748236f77, 0xd0d81be135711279, 0x706f90675eab1c3a, 0x8c4823f116a1ffaf,
+        },
+        {
+            0x703cbf6dd7422804, 0xe5df61f383349bdd, 0x0fa3d8cd77d285ad, 0xe990f9e52e88e15e,
+            0x40ec61f78561d8a6, 0x7fc498a616650305, 0xa3bf5cb48e5beabf, 0xfaa5200876ae0350,
+        },
+        {
+            0x396cfe2d95298003, 0xcaa66550ad8412fc, 0xf41d021583997dd3, 0x7066e35645534587,
+            0x0d5b5c3e5b6de0d7, 0x8ead45d0cecd5f26, 0xe2f24e2cd252ae50, 0xf71e5d4f815150bf,
+        },
+    },
+    {
+        {
+            0x79d0585b36a1f3a8, 0xa3d8f17f913ba5f2, 0x1eaee5d6225acf11, 0xd4dfd0a20d32de79,
+            0x0cec324b6b3ceff3, 0x3acc6decab447870, 0xabbf7e6db9c759ac, 0x0d5c1f47a5196938,
+        },
+        {
+            0x781a215745e7ea91, 0x4da3f86dacadfc40, 0xc81d6c7d162cd393, 0x2c38a2a1ad6e60fc,
+            0x575b25d6f753479d, 0xc914e08ebdec6025, 0xf81cea34492d5547, 0x6bbb8bb1fb1b6969,
+        },
+        {
+            0xad2ac5e7f7fd374d, 0xac8bf5ed4a86ccee, 0x8632ca40d0a23522, 0xed0a13f8e9eff7f9,
+            0xaaa2267921ff44d9, 0x1ffc20b8091258fb, 0xbc71460e06d470a4, 0xb83c85b6a1f910db,
+        },
+        {
+            0x1ee8082c1279504c, 0xa466abb22c92ffb7, 0x4118b26a3e81c7e2, 0x1a76cc50fc60e33a,
+            0x34998bc25736d7ae, 0x20b39558bd1ef993, 0xd669e2ae5fbf2525, 0xbf956ec601cc7626,
+        },
+        {
+            0x44d3e7b6d6f913e7, 0xe208908cbae5c431, 0xda620d7a30098139, 0xd84f6319b6529c48,
+            0xf10313f37da765ca, 0x714fee58f69dd994, 0x0ad78b5ecb5c25cb, 0x280bd9e66a11ae8b,
+        },
+        {
+            0xce817029b0ccbaa5, 0x57ef5bd2279b78a6, 0xc92837474df45d89, 0xe86b91a82ec4bfd3,
+            0xe5ab4c6dfe565915, 0xe65747167c58a042, 0xe141deda6301c4bc, 0x2f95d5618084513a,
+        },
+        {
+            0xe2ba06db1cc4cd86, 0x6f15ba9cb02457ad, 0xde89667b828a063b, 0x1e640d6a5ec3227b,
+            0x88b1faa3bd695d93, 0x07ae24ff981f5325, 0x20d6172ee4b1dc4f, 0x36ba187129fb5514,
+        },
+        {
+            0xdc424508eecede3d, 0x11889b35386440d0, 0x7b229f9398de0d77, 0x73fced8a300a7447,
+            0xf75e1c79e31c8f88, 0x8db20bddbb277e4f, 0x8ded0a702b87c02c, 0x166281b54d164c1a,
+        },
+        {
+            0x9822e0067df5a48e, 0x620399ca0be16ee7, 0x3c90904d996bbdf0, 0x4f3a65aef3e84f9f,
+            0x6379ea9b22912892, 0xabdcf9a7dff5a70b, 0x38f3442458af6c69, 0x7fcbd13638a9a77c,
+        },
+        {
+            0x887356cfeedd8e0c, 0x8afab37fe44c012b, 0x0795935fe4aa3eb6, 0x9b9efc0cda6dfa57,
+            0x0ff0f8aaa8ab0840, 0x0f3a4b63c8561605, 0x2ca911efd5db9315, 0xef70e5bac8ded9f8,
+        },
+        {
+            0x7389fdd0487cabe7, 0xaec9975a8252e1c2, 0xa304929ff6dd3e2f, 0x5415a210f275a894,
+            0xf55b8c62cbbd6299, 0x7b0aedc908c4bc5e, 0x2cc2bb9f975419c8, 0x0d3859d427c9651b,
+        },
+        {
+            0x443d9209a6aae58b, 0x3d0798e8274edda3, 0x5c2d462cc2be3c9a, 0xb5488239439882dc,
+            0x6391bb41977d4de4, 0x7fd910401e8245c4, 0x1a6d3c713b093dc2, 0x423a4e3a7b22fe12,
+        },
+        {
+            0x9a62644392ed366a, 0xf36c29b9ab05898d, 0xcd88f6eb9242dfcb, 0x485c84f5111e3e84,
+            0x74b799f3686f9cac, 0x8665c1f49bc91b42, 0x763ad313162d46f0, 0xe628a082a1851b73,
+        },
+        {
+            0xe3156f403a9a04a3, 0x9b32c4e5297d9aff, 0x7e0b401e62a89850, 0xffbf542ea84ef082,
+            0x377cc0e0f990caf5, 0x02704343ec88ea9b, 0x846fd46c63f96a51, 0x37f5cebfe9855c47,
+        },
+        {
+            0xe06c624085869d9a, 0xa26768aacd0019b5, 0x048ed699418e7e88, 0xf5f4a0566dc2c838,
+            0xca29056219666b37, 0xa101bab347a73b6e, 0x2e3d56cee5737212, 0xe7c12aa50347ba73,
+        },
+        {
+            0xbd140bd8e6ad29dc, 0x7dca4b106a04da28, 0xa84feafcade05b33, 0x44d031f87630aacf,
+            0x18af2fa6cdee269c, 0x1e40571b8697a40b, 0xf71d44adf0e5f826, 0x2a47ddf9a434cfe6,
+        },
+    },
+    {
+        {
+            0x3b3892d346410cb1, 0x72097f2203a5a136, 0xdb3a1b8098de068d, 0xfb7438e44b1a3890,
+            0x8a10d5ea3839d3d9, 0xd9ad034df4bd8126, 0x07d108efd4800261, 0x978d98ba9c5d6c52,
+        },
+        {
+            0x4f942d017375f2de, 0x968a76088aa1523a, 0x55dc7da6377e5c4c, 0xb75fff53282b540e,
+            0xfee35c15fd4b6951, 0x6d1d64f6f04ddfae, 0x320f1769af7c8714, 0x2b5f86a4482ba6fd,
+        },
+        {
+            0xc01e1f3bdd857b31, 0x92c2263ac9513734, 0x562652d5589327b8, 0xa8edd06596a1c164,
+            0x2cbf8f9879f8df8d, 0x3d5cf77140847dde, 0x69b08ee4597c0622, 0xfff18c4d8a868f2a,
+        },
+        {
+            0x1c6fd7a99107901b, 0x5dc4a41ea211d116, 0x597e94e7af1b78a8, 0xe72da34d53afcb6a,
+            0xbc364db774512c24, 0xc26a8fb9b2811e91, 0xfdd39d7f290469b1, 0x8451539220612535,
+        },
+        {
+            0x57ef606a4a98f93d, 0x41b9190df3475d72, 0x7ec792db91e3f8cf, 0xca37ec1022396a4f,
+            0xf0b9c219d0879e17, 0x61303af3eac57d3f, 0x13293c3be1037ea7, 0x61557e04a058f1ec,
+        },
+        {
+            0xab997cd15c5d384f, 0x36884aeff74de833, 0x6be21274d8fb7ce3, 0xe0bb298ea6608ef7,
+            0xe27c1a0cd53bd426, 0x78035a206eb3293b, 0x0d7689eb2a6fc1ac, 0x9a38274a4f2c4fed,
+        },
+        {
+            0xce7f1c4eccf60d0b, 0xc7918e140cab95d8, 0x7af4761e1425a060, 0xbfa0bf6ef8e80f35,
+            0x88e7629801e11b3e, 0x4b7ca488d92d8a4f, 0x247db98bcf4a9e6f, 0x08745cd1c9705b1f,
+        },
+        {
+            0x7fe996a01539cf31, 0x4a3f729a0ded7c6e, 0x86f1f2993016f614, 0xc3d44e1886cb9163,
+            0x96984531558fa36c, 0x58e8bf05369c89d6, 0x287da114f9ee923f, 0x2032e984ec271fbc,
+        },
+        {
+            0x8190e97970b36333, 0x949c4f06c96cf175, 0x2955e62a046d73a8, 0xc5b6af78eac9726b,
+            0x99748ebd80aea11a, 0xb624291838a07c1e, 0x4b95ccf697097edd, 0xe090de69a26afc2e,
+        },
+        {
+            0x1b13fe2b9cd4cf1a, 0x95b0c5e27891253b, 0x2cda3b94edc67a81, 0x16c30b7ccbab43fc,
+            0x82d64e507af473e8, 0xdf9c38684f2f1b73, 0x03dac07edae5d3c1, 0xe1c383db5ed45178,
+        },
+        {
+            0x247f71f7a16e1274, 0xd712c179251867bb, 0x6ad813e65935fcf3, 0x496cd11445b4af5b,
+            0x3ebccbdb42691330, 0xad44bce743131de7, 0xaa1eeaa8a32f4725, 0x5eaf2ae4ded0e8e3,
+        },
+        {
+            0x5c18d932278d3bfc, 0x2eaeb9eb0375da43, 0x7b715e74c43c6688, 0x5af6a76fd2e3a068,
+            0x831f32cb1f02410f, 0x4dd51a54c1221efd, 0x2214861504d51258, 0x72c80d2a8290e516,
+        },
+        {
+            0x2d27faa8869e901c, 0xf37a9692679676d0, 0xe0e19ca0412a954a, 0xa12d0874e79dee88,
+            0x179cbf3fdac0b847, 0x7adbcfae441185d3, 0xd5287351c539e70d, 0xda9b21d3578a303e,
+        },
+        {
+            0xccb7fc6e318ec5ce, 0x06c0e7d33e38a981, 0xd3df287aa602c68f, 0x1a6d7e33397f3fd2,
+            0x44a3c47344afc21d, 0x6ff5fefffb2b5c04, 0x9aa6c37a4037ba0b, 0x0bbfa6b6ed662f06,
+        },
+        {
+            0x03c6b95f2fe74e0d, 0xe6d9b4d07ac21d4a, 0x46490a89bc8ad37c, 0xe70914cb0ee1d8c0,
+            0x7efc919726b2ea5f, 0xb39ccb701d952073, 0x53c10b03330fba2a, 0x8aa682b62a8a41dd,
+        },
+        {
+            0x91b8579dd39207ad, 0x6f62c7250b1fe916, 0x0f1599acd89e01bf, 0x8d9bb86d4d1e5843,
+            0x348b90d4726e38d1, 0xb824a1ca52a8c6b9, 0x984d9309b1d2f6f4, 0xefa485b7431ec12e,
+        },
+    },
+    {
+        {
+            0x9972560776ac1925, 0x086449db3442fc58, 0x8dbab9202e311e74, 0x29dee69b7ea25561,
+            0x5a62b6ee19a7cd6c, 0xba38cc4c0d0dd5a0, 0x779279e5166d0ff1, 0x0eef53ccf48b3dae,
+        },
+        {
+            0x39b4393579f34a8a, 0x61acf55f30046435, 0xf0a23fe63f05fdb1, 0x7d6baee10c4fa7ff,
+            0x253f62b6e2daf735, 0xe370ead82948637b, 0xda57c16ad84e6206, 0xf19ffe090dd22ad3,
+        },
+        {
+            0xae65a5c739620daa, 0x8ef6f93f6f7c078f, 0xb06d52bcb0177db8, 0x915cdd0868fdf535,
+            0x0070d150c5183222, 0x2b6495cd7817a2ae, 0x3ce476140b194f0b, 0x2eec6acf513bfdfb,
+        },
+        {
+            0xd80f45a51d63aa7f, 0x8d5eba75b3b32da2, 0x0ef233dfa4708858, 0x74c3f4f752161c61,
+            0xfa9bfe6be6420de4, 0x96c0c50197dd86d5, 0x28e6827bcfce233b, 0x035cc9a958e74d63,
+        },
+        {
+            0xbd3360d88b884857, 0x0419041331b7c579, 0x40dd9229142cc145, 0xb5faab94dad0b2df,
+            0x3e7d792152df4831, 0xcf5bd1ed228bf67d, 0xd8669635c4980085, 0x094b89731c71903d,
+        },
+        {
+            0xf7ec89e335607bc4, 0x17ca00ca9946bf52, 0xee46be5b180c8bd8, 0xd29d5eb0b2873893,
+            0x348ac93997487b3c, 0xc18f0cebfeef78ce, 0xfc648dcaf797cce5, 0xe2467e0c442148d7,
+        },
+        {
+            0x4bf367597cfb37cd, 0x94b0c7f0db7af2ed, 0x2f1bebf6ebf8b461, 0x90ebc9c7073e5c18,
+            0xe431c7933774e905, 0xb8a4bc2fe03265bb, 0x0bee0825fabb629e, 0xbd1481dc84557170,
+        },
+        {
+            0x22de997917a86e18, 0xe2ac2321be029111, 0xbfd3439735cc5a17, 0x7a93461f525e13cf,
+            0xd433542c5122d6f1, 0x41d2d9de833982c7, 0xe9f1f29a8ec24d27, 0x4ae251f3f3b99d58,
+        },
+        {
+            0x3b47563c175b4039, 0x53521dfd116b2025, 0xe4f3aa891a9f1cca, 0xcc73485ce7cb1d2b,
+            0xa6ca61efbf58fe30, 0x5d50e15d531a2b6a, 0x71cfdb4122611c31, 0x0dc1553361e3d46a,
+        },
+        {
+            0x74c2696b7d8a042a, 0xcf4908c354230ded, 0x98a870d8db32943b, 0x181cbe5c52f33e07,
+            0x4d9d117293709d8b, 0xb800c2922b2b7939, 0xd5a1fb7aa8920f60, 0x8d0a7725bf7df622,
+        },
+        {
+            0x1016908024108055, 0xfe0d9cb038961403, 0xf88e6a48ceb87d29, 0x0365ca2f69618944,
+            0x1504647e9fb59ec9, 0xb6486b3ba4aadbb7, 0xfe8701af22ef3214, 0x4c895bc15f56d985,
+        },
+        {
+            0x3553633abfb6a2fd, 0x06533515a0c9ce9a, 0x6decd9e804c71728, 0xcbc0df55980b29bd,
+            0x17b1b55931826d15, 0xc96ed7d71c5cae17, 0x24f5874088cda83e, 0x9e2ee1bc0c69f40f,
+        },
+        {
+            0x06b9341388d601e5, 0x0e996e8776c4483c, 0xe2ff3a6d00eb0c21, 0x86ec3a73f4690674,
+            0x673d123ee9f82ca7, 0x952c2765bf611d0c, 0x26ed9a683676497d, 0x2c9c00499d29cefc,
+        },
+        {
+            0x4adec20ab616aa15, 0x99f77e49ea085548, 0x9108c205c01b9a33, 0x298fbeb16ef3bcef,
+            0xdf1a8d2eefd8ba0e, 0xf0ec9492e9756e7b, 0x4fd333897ff5fbc3, 0x122a6bfb03ac8371,
+        },
+        {
+            0xc9e6ca97483baf0f, 0x09b063bff9bf5055, 0x8c4c6b2afc5a407f, 0xe29cb48799a6f540,
+            0x18b72239cb9a2758, 0xa0ae9f108a5ed308, 0x2a2cb6036e402657, 0x9c7f52cfaf6f4d14,
+        },
+        {
+            0x402da46047920742, 0xb142d6efb45f94cc, 0xc2d613e876608dd4, 0xa2c06cdd5d75d4b5,
+            0xa1951bc53c564ff4, 0xe60f126bad1d5ecd, 0xa634e765702135ad, 0xa5a56a6e8df44695,
+        },
+    },
+    {
+        {
+            0x234b8c7a9e2207b4, 0x1f724f30f7ee9f62, 0xfa908ca2c58e21b6, 0x55587744a74296ae,
+            0x7dbe913002911ae1, 0xc20754339d3af02e, 0x505b724b0f3955a1, 0x480e1a92caeced66,
+        },
+        {
+            0xb20f6128446d9f66, 0xd6e06b14c354b5a1, 0xa72d287d63558aac, 0x4819be29ae68a8fd,
+            0xb024c324205fbdf2, 0x2fca94e7210927f9, 0x74798be7be658f80, 0x618e07f1ef07c046,
+        },
+        {
+            0xfba715fcb35a8c3d, 0xc2548193ed1beba8, 0xb956c6dd2ceb663c, 0x13d4ddbeaacafe85,
+            0x2f8275b530a29cc3, 0x10432e15f51b39ef, 0xd6c9277c2509b2d0, 0x4ee0d4c3849b946c,
+        },
+        {
+            0x547ba94654b01bbc, 0x7c56c36d055d4821, 0x8e93362005575f20, 0xaec65be93a621cf4,
+            0x820b96df46287937, 0x35cea883733c67e7, 0x30366a3a58cf3e05, 0x2580d5652da39773,
+        },
+        {
+            0x7717c42fba4417ed, 0xb2d66fc7654c1086, 0x07fe918e57503cd8, 0xf93851593cacf74f,
+            0x157d908163063029, 0x79c84c08659034cf, 0x02976610a8048cb9, 0xef82200603e81417,
+        },
+        {
+            0x5fb5dd4d22e489c6, 0x9a06d9c281e167e9, 0x83fc248f6b974c90, 0xb78cab727110dca6,
+            0x73f8f311370ff66a, 0x8c5049eb3b61d20f, 0xaac47edbc8516e05, 0x2ceba50d53f0201b,
+        },
+        {
+            0x6679dc5e0b93fbc7, 0xf4457919a560bd27, 0x2561bfcab1acadc9, 0x338fbb6d46708164,
+            0x9f4076218b9cfd27, 0xe806c1e6d3123732, 0xaa1eafc47f24a161, 0xbee3f4a168e6650b,
+        },
+        {
+            0x453b61815832cd6c, 0xc002e337985e90ba, 0x4b33afde6414f686, 0xf9ab29e98511fd45,
+            0x067f09726fb9a688, 0x7db6e14c7202a1b3, 0x0c15b6e973a881ab, 0xc8c324e0fad10660,
+        },
+        {
+            0xa997a6d287d9f927, 0x62307f24acd2f107, 0xed7b48a59c80a742, 0xecd33ae5a7c81e7e,
+            0xcf05c763efa00a94, 0x38844b0dd9ee5aa7, 0x02e0b05d214b293f, 0x732e776b8a8a510e,
+        },
+        {
+            0x784cd9096c929e53, 0xe436e29456a33da2, 0x68eeb727ce9e06d2, 0x637890b3fce7e2f0,
+            0xc0681a1cc3fde38c, 0x9cb729d976dda134, 0xaa69eb975c333ece, 0xe138a68048eed8a6,
+        },
+        {
+            0xd53cbd01505dc701, 0x413de3466a64c3d1, 0x91f6cde93170a5bf, 0x58ffdfd98489b5fa,
+            0xcc0b89d75c584a48, 0x74f8ceed167f28de, 0x250fa9f78c878c91, 0xeb960a79630adfdb,
+        },
+        {
+            0xe43ed412c9489dcb, 0xcec053a5112d084b, 0x0fd4fe42664c7cd2, 0x48ee06f482a917f7,
+            0xc5de197083cd65f5, 0x3a1765785569c42f, 0xf24508f34f876110, 0xf350374b0a415bc4,
+        },
+        {
+            0x9c2b11c2c63aa8ad, 0x6ac1ae127a51c0cc, 0x75acd0d7e1db428f, 0x9e39122719800684,
+            0x4f89e9c6b1050426, 0x099d97ccdaf99eee, 0x27a19ad01ffce97f, 0x05fad0573c038d77,
+        },
+        {
+            0x96d6c6788597d09c, 0x38f6336c1e1d8b57, 0x1f945bef6330ace7, 0x9d627bbb613f9faf,
+            0xc0e7f21b19176cb7, 0xf0e09be3bb9db710, 0x16b06011c650133c, 0x8629b975f3673d7c,
+        },
+        {
+            0x8c8230b267115575, 0x9bfc55b19c9f30c0, 0x132d0e07ce93fd71, 0x08e4736e511c5947,
+            0xd54a098efe881630, 0x8ec67a8598efa501, 0x72975dc72267db00, 0x3d6fc706a338290d,
+        },
+        {
+            0x0c89108255ade88b, 0x0525b5014b212e85, 0x9ede010bb61362fa, 0x52f3d088881eecac,
+            0x49957b6ebc6f0ae4, 0x25fe72631659701d, 0x41e9b7f507b76f45, 0x5f2ad664bda77d42,
+        },
+    },
+    {
+        {
+            0x0366065a848bdc53, 0xba2af074078554dd, 0x3c755fba19ff3b4d, 0x5ea9337235a22cbb,
+            0x0e55fe021eb3e23b, 0x2626ecca765dede4, 0x187bf09481f445da, 0xba0110179df30578,
+        },
+        {
+            0x1ae4ee9a1baea574, 0x0d922f2803ae5168, 0x07df28fdca691124, 0x5aad2f318dd457c4,
+            0xe0d4f443137384ca, 0xd93d424a6620ea8c, 0x21d544d35067797a, 0xc8a8cc999d8a15bc,
+        },
+        {
+            0xa389705aa4a7efd7, 0x249f9b3c489a373f, 0xdcb473677d9a494e, 0x0731c290a9dc7ba0,
+            0x1c79221241cd472b, 0xffd8a65220009dd8, 0x9f3c9343eb999a80, 0xa0c75763cc8d2ea8,
+        },
+        {
+            0x610f0e26941d80a3, 0x30927879ad36514e, 0xaa2dfd4898f22601, 0xbc5b31b788c8b0f6,
+            0xb1281f376c841cc8, 0xdae167195a412b84, 0x9ec1f6c8828f210d, 0x1935d576e8d92901,
+        },
+        {
+            0x078ea26ebb286618, 0xb88f7f6900202a88, 0xdbd8736c455819eb, 0xe5d5cb0e02ec344d,
+            0x8936dc3c16d7043d, 0x849ecda775d32feb, 0xa9fceb1a9ef263c3, 0xa61936e202b6af9b,
+        },
+        {
+            0x72c89be8f731e66e, 0x5c65a3bfc7c9ac67, 0x621746f622778847, 0x3e389821294495a7,
+            0xdb0c4aab948c9496, 0xdfdec518041e7947, 0x91420e3a605283ab, 0x799ec46f34c7dbc0,
+        },
+        {
+            0x3a1f17d461d3c3a9, 0xc365df5a604e9382, 0x5f58ad4bedd54dc9, 0x3c6eb57256c6db35,
+            0x79cf77740fe7ff82, 0xfd4e6633a2f865b6, 0x4f63e6d45b2b48b0, 0xa4a7bbcbc26dc082,
+        },
+        {
+            0x47247921af3840f2, 0x348325d2df3fcdfc, 0xef578508c43961bd, 0x7d5e8ccd1bd98c29,
+            0x59cdba10f8a30164, 0x0757408f7cb8c653, 0xcd7ed73fc3056ef4, 0xd28e7cc1fb99cd1b,
+        },
+        {
+            0xe47a79a86584ddc8, 0xf7b6a672f6148f6d, 0x7f286ef0000b6011, 0x92ada0d1e52e6757,
+            0x1a1fe5438080bf50, 0xd43335c92cb1340b, 0xb400c9650f5aff1e, 0xe360abaa4f9a0b60,
+        },
+        {
+            0xf1b7c0f95182958d, 0xee0c40775749c24b, 0x32f35fcff3638c77, 0x0a46c52952773cee,
+            0x7ae3d4f7e2fb9042, 0x9855249952ce916e, 0xe48a640b04bf7ae8, 0xe3eb60409c9cb2b7,
+        },
+        {
+            0xd850af5fd967adc9, 0xe068dfb4c2fc15c8, 0x74ca12fd250ed6be, 0x9cdbdca857dbaf1a,
+            0xb2200e6bce28a615, 0x557bbab5a98030e3, 0xd91a466e9bd3d528, 0xfb9a53cadfae156f,
+        },
+        {
+            0xa8a674946bb62286, 0x8d6ef816e7d87467, 0x3529f938f673b6d5, 0xf5c0ee768bbf101b,
+            0x3768ed6149fdc949, 0x53b6999ecf405ee0, 0xbf0108a01718e51a, 0x38e609ec5181ebd7,
+        },
+        {
+            0xc7d85d9d3a25cbd1, 0xe8c0061cd1f01582, 0xd4ad3b05661eb708, 0x5e3fcdb68c268c43,
+            0x0068c50135fc49ee, 0x1d9643d4dac949be, 0x27299c30c2345313, 0xc17bb2065461e958,
+        },
+        {
+            0x228879083a6a2a00, 0x82df7fb78e549a6e, 0x8f1d62b44e5facfa, 0x65566a01000cade3,
+            0x8672bcf5b7620135, 0xcf00849d6b75df8e, 0x8f5d3e0fe12fd615, 0x7fb3f788df727a8a,
+        },
+        {
+            0xfe0531f1b19ad003, 0x0651b5fdd806e348, 0xdd2cfb6bc6c998ee, 0x29f13ac098b5a4de,
+            0xa85bb94fb19f5de6, 0xc19f0677170eacc6, 0x6d87d4dfaf4e27f5, 0x2757489d820a789f,
+        },
+        {
+            0x82051640d8595159, 0x30e1c706579a3876, 0x091154c60298a67c, 0x76d9a9c951132d27,
+            0xe41de8b75c661a4d, 0xf24b5e962a6dcbaf, 0x1ed4cb0cd714e045, 0x605926a40c187c70,
+        },
+    },
+    {
+        {
+            0x1558e0f2aa1ff4af, 0x61f43487390503a4, 0x661647323c4f76f1, 0x50d0706e9e13432e,
+            0x5f1a87caf5eba0fb, 0x28a95c0f80bda2c5, 0x10d693e012ae6462, 0x79871340f45e6ba6,
+        },
+        {
+            0xadc4b01264b49667, 0xa4bdafa71e05f760, 0x171b28b3f185d27a, 0x987e516333425747,
+            0x7c42ac4ec3864a65, 0x2dae1bb8bf449c12, 0x680d974306965832, 0x6ac1ef017e31d9f4,
+        },
+        {
+            0xf78068563958e055, 0xac35ee405df44aee, 0x2b47891397c18b8d, 0x5396824efa2586cd,
+            0x22b37b251b23f8c4, 0xf9ced36ecdecdefa, 0x28c3bee5c2fc39c0, 0xa1731fae6d9db32b,
+        },
+        {
+            0x745d4f74ea3d4446, 0xa439f17840ad1c7f, 0xc95d951051374e92, 0x75870e9f90229008,
+            0x3fec98c2c54e7e81, 0xef537ee994b3860b, 0x139dd83440bfc8f6, 0x20b513640f114403,
+        },
+        {
+            0x332f6ab6dd13b3c9, 0x70e052f6e371f873, 0x05740742125712ab, 0x4239152db3512100,
+            0x98355eaa80b22915, 0xd0e263ecb896f6fa, 0x9378a8a6442b4c8f, 0x40c2b546f65795bb,
+        },
+        {
+            0x9f80fe8c28474530, 0x5649a173db7fec00, 0xdeed5bf4d9cb05ca, 0x14b1a3a9d7077c41,
+            0x4c2ed239096883ec, 0xd550edfe44ae671d, 0xb233e5dcf7b7362a, 0x32c158204fd464f2,
+        },
+        {
+            0x252e6a81c61ae967, 0xaf11042c72a2e1e6, 0xb353902a1a211ef8, 0x644d16e0c99a25fc,
+            0x637fd6065b67e48a, 0xfa57096351a0b665, 0xaa661c737ee072b8, 0xde1eb4fef2e0a727,
+        },
+        {
+            0x0dd9bc2afda6a4a9, 0xdba0178a0106ae0e, 0x3820c9f54969a4bb, 0x5031e9fd99fbc715,
+            0x642a030ac193d942, 0xdc3d6ab7454cbb39, 0x507c17b91c8fa77c, 0x8465bcc8e3642a95,
+        },
+        {
+            0x582d610a75d7397e, 0xc768d0d62f8d773a, 0x27977cf01b5a65c5, 0xec59f7fd839c552f,
+            0x0c9f73835c091c57, 0x17a5daca465d6b71, 0x5d35deb36b532837, 0xcb24c95f498eaf96,
+        },
+        {
+            0x893cc2b3497b06f5, 0x48ab2de93ce7238d, 0x7d83d4b26486d148, 0x0c8bc562b7d4848c,
+            0x9274bfc8f9d79ee6, 0x311ced3bb09c6502, 0xafaace7bb63a9e2f, 0xdd2ab177c046f7db,
+        },
+        {
+            0xfd176880fc2e3306, 0xa25292e1d69b1381, 0x32e5961a9a2f2a4a, 0x7cefdb1cd54dc184,
+            0x094fff4ae09495c3, 0xa92469ee6a9c0e9f, 0x7a62b396c88c1706, 0xe7cef1902dba4de1,
+        },
+        {
+            0x7dcf4a08ee35e59c, 0xc7eeb5078a5b1e31, 0x635b0eb6f9be2fc5, 0x24924cab9ba556be,
+            0x62e57b325a8381c1, 0x692ac4c0cb82d174, 0x36da208bfa134f9e, 0x139b39847805318a,
+        },
+        {
+            0xf3fd70a292496d4e, 0xa576e07294e34385, 0x295b55487a0023bb, 0x8e8e576c79862545,
+            0xb1a3eb35fe6a700b, 0x25e5cc349064670b, 0xb73a09a20068f0cb, 0x6acdf4c65367e62a,
+        },
+        {
+            0xc86a7a40318938b5, 0xdfdba7d59132a1d0, 0x529feb94d5d73a7d, 0x342e344baa793807,
+            0x021f8f54240a3d90, 0x0c1a507d13f67d91, 0xe698d48b0c68fa1f, 0xd9b3d9d1c76da062,
+        },
+        {
+            0x8296b8d137ca56c7, 0x6fdb146cb25bdc8f, 0xe2fa5972749b71c7, 0xc359295c610abb1f,
+            0x362a5b49b19ba9e0, 0xda77804c0479b0fc, 0x4628d19fb1773a90, 0xc1c7ff7a9c025afe,
+        },
+        {
+            0xe74e265bc25dfad3, 0xd03630b9493f44b6, 0xb3270892bfd6d473, 0x5b2d95431c5ee992,
+            0xeeb94537a36f7c5f, 0x9befc01d8ab0b81d, 0x483cdb08188b45e5, 0x44c753b701e4648b,
+        },
+    },
+    {
+        {
+            0xee43bc87b2411618, 0x08754bd2f07924c4, 0xef2050334ac92557, 0x6e7e4fe6ee0387f4,
+            0x51f3e2e276961d0e, 0x2b69d41737eac10f, 0x36d0f45f73757a88, 0x38b967e52b0c7d35,
+        },
+        {
+            0x0aef84c16b8a6a97, 0xd2e7f3de0b2bca36, 0x721c6c095b174d43, 0x5719cf31d52ccc5b,
+            0x6c7361f03adf9517, 0x1e264169abe20ff5, 0x01f9d99769eacc0e, 0x721eba63c2e635d2,
+        },
+        {
+            0xca899c4f278291f1, 0x69a90324f4e64c1d, 0x46cc5d428d62916e, 0x3c802e65ec1007cc,
+            0xdadcf2aa6219cfbb, 0x942870dcd10258b2, 0x77264e68a5e142af, 0xf25675e2089cc7a3,
+        },
+        {
+            0x759331335d21d261, 0xa336289acabb1fbd, 0x797db2f3631b3b61, 0xc2cedb25d7e6a511,
+            0xb8806f3410355332, 0xe5f1fb4a5d0ae37f, 0x57cf26a55d17c5c7, 0x82e8df4768c43ec3,
+        },
+        {
+            0x12537433886209b8, 0xb7875fa8c5a11b32, 0xfa63cb99bd61176d, 0xebb204ea33378ebb,
+            0xf29a29a070c135f6, 0xf53941e9fa29d69f, 0xab97b39a9917da42, 0x4677cfea45947ae4,
+        },
+        {
+            0x34d8ed875d279f42, 0x4dd5344c1cd68904, 0xb558b71d24abd550, 0x3728e85040df135e,
+            0x9329e2b2cfe86519, 0x48ad17fbac74cde2, 0x2ad61b2230b388b5, 0xebcbc1adfaea71e1,
+        },
+        {
+            0x67ac89d5e4b68140, 0x34afd23bc9b092af, 0xad65cae9fe1ad661, 0x4f402947e02d884c,
+            0xd0a48fcc6b1c40c1, 0xf950c9f78961487b, 0xdb1cd811206d1752, 0x863b0dede99fd891,
+        },
+        {
+            0x60d41128ffb5e7ce, 0xdbd8b542aecb96c2, 0x029ab3dd0b5ca788, 0x8b1148a2190eb38c,
+            0x59048db869fb1924, 0xcd2149f0b18391a8, 0x6bece5b6fed311b9, 0x5edbe9b99ffd29b9,
+        },
+        {
+            0xe26e690dd67d9902, 0x1a6061f4b58e7e78, 0x960ef741480dd4d1, 0x7fd0973675589610,
+            0x5a20a1a2855a8b2b, 0x3ed68662355b4e0f, 0xd3786f45e76595b4, 0x72a6999d0bdedcfb,
+        },
+        {
+            0x308098a014c5a2cc, 0xeda5a59dba40c0bc, 0x0b10f7e0b718a5ae, 0xdaf7da8c5b8ad9ba,
+            0xddc7128587394cde, 0x9bdb27cde43458d3, 0xc698d9724bd7c11c, 0x2ee97fbc3540be14,
+        },
+        {
+            0x09e743877be60b03, 0x2277ebc3ec8750db, 0xf1e9d5947aeaa545, 0x4156456244c03394,
+            0x57943adc4de9f7ec, 0x09dd58f92a220cd5, 0xdf848ec806973808, 0xf1d5def1d3950024,
+        },
+        {
+            0x3e9f284fee18ffec, 0x702d97f51d1b4e80, 0x2005ee57214c4da1, 0x1c2104132f5ea2f4,
+            0xd24a486ca4149949, 0x3869a33923c8e201, 0x00f6e4100149992e, 0x54e97b46f0a367dd,
+        },
+        {
+            0x0bcac95818e75428, 0xd2f1554a9a95900a, 0xc63c2afb03846833, 0x703d02206d1e8753,
+            0x47f5fe5704a357a2, 0xaafba53ecdc17255, 0x8f94c8eb821af8d5, 0x4d9918bc35e37920,
+        },
+        {
+            0x77b6d3d665e75ed6, 0xbe59c8da53053b45, 0x054d089f54fe92cc, 0x2f2327e06fa4758f,
+            0x948cf03f5d2b5a01, 0x47544c4c9c23b83e, 0x338590fa6c128d69, 0x5724008d76842160,
+        },
+        {
+            0xd3a4636784af55d9, 0x0e709a00d7626b67, 0x135725fa4c6dfc8e, 0xbf6328d9133a6e20,
+            0xa4b743b4a87031f2, 0x62e90e6713825d07, 0x7004028eb85f3c45, 0x0465c50211751be0,
+        },
+        {
+            0xeb5593e7532e8d6a, 0x94092904f02a1ee4, 0x379b32e8200496c0, 0x46fb6e9e360a27c8,
+            0x8a3377ba62005158, 0x1a3266c10de3f191, 0xe60fad96c94d2127, 0x41553dd1646302f3,
+        },
+    },
+    {
+        {
+            0x3b0cd36fe12a94ab, 0xf364b3b9b5ad7c48, 0x96a7a2a78e768469, 0xccc31c7e1bbc7cc5,
+            0xe70ad5d0080dbb92, 0xfb201e9256fb0f1f, 0xdfce7a1e29d99f57, 0xc12a02b006457da5,
+        },
+        {
+            0xdea72ba62a80f39c, 0xcb2174b168cbe088, 0x9c73ec69d6bd1cc1, 0x6a2dbe20f20dcce6,
+            0x20a5150beeaae9da, 0xc935e85d9df630da, 0x2147144fa1634cd8, 0x5eccb56c44f3af02,
+        },
+        {
+            0xb72e04b7f28d4c1f, 0xb2576c49fce0002f, 0xb5058b9addc1fbd0, 0xbb2f37c2e120fa27,
+            0x9c46bfe2e0c972ee, 0xf0fc801b16ba8942, 0x4c3e0393ba84d20a, 0x4f74f456b26a009a,
+        },
+        {
+            0xf77a79cfc0e2b70a, 0x2569c8bcee8cbae7, 0x392a5dbefadb18fc, 0x59bc96b43ce6a0ff,
+            0x287f04f48b551005, 0x7efe3aa5a44b2bd8, 0x0e9cb8ed6ac447d7, 0x9b4eb10a7783bdd0,
+        },
+        {
+            0x8daae193112f44be, 0xd8fc9f4160cfdc75, 0x16d35f0c5de8a247, 0x272a6eb345d8977d,
+            0x18ffd96e30bf0d59, 0x3fac65233bb1098c, 0x58ed64c6d6751ccb, 0x43bd6a2d435d2311,
+        },
+        {
+            0x793c4880b981d96f, 0xf719d828d56fb2a6, 0x9fcc236f8149057e, 0x318c63ecb4d65c2b,
+            0x5269c1d75f95c5de, 0x33b3745fd0efd6bc, 0xace344d54ae87c64, 0x238809d6dd30ba2c,
+        },
+        {
+            0xf3c17c36ce7b203d, 0x5958dcdb1deebe78, 0xa9569dc51a37559a, 0x5b1d94e6cc2e1e6d,
+            0x2429c79674bc06b8, 0x98f65fb878cfbf44, 0x6bc2cbbadc143faa, 0x406c92ba6d8cf80d,
+        },
+        {
+            0x3cc32acc71192348, 0x545401bf3f17ef60, 0xe209a493cde25b0e, 0x5c11886b663abab9,
+            0xe61a81b128ec7c90, 0x18b125a675b57f5c, 0x86d1b45afad91696, 0xb31a786da4c3f7ff,
+        },
+        {
+            0x8a3d64e3fd2ddde4, 0x6abe558c0ff7c638, 0x028911575a60e30e, 0xc3255131b30a1299,
+            0xdb5b35d0dc2e3512, 0xc4a34ed52df24b9f, 0xe589edadd27e4d55, 0x9109ece7b5da7097,
+        },
+        {
+            0x2fd4cd72f45831d8, 0x85978fa68be40d9f, 0x38106329a9301111, 0x1527e4629e5979ee,
+            0x97f71c7e76c5fc8a, 0x205fa473f1f33056, 0x7bb9d24ea6546a05, 0x0e282a5cf84c4d35,
+        },
+        {
+            0xf799309b9986ba36, 0x4aed4260a9e3a7c0, 0xbd16be453945e4e6, 0xb8f4ea48d585f910,
+            0x92d0110013fcccab, 0xef4485bce82c43b5, 0xfcd8e7d437beca0e, 0xbb0255855532e218,
+        },
+        {
+            0x59d2189659471f1f, 0x2e613decf6303573, 0xa799579478bf5a4b, 0x20adf6b5bf19fbe5,
+            0x3a48c95f1574d34d, 0x95488f0909323ceb, 0x450aee7f552df9cf, 0xdf016f7a53557500,
+        },
+        {
+            0xf4d81ed9c0b4e104, 0x5cf77618391260b9, 0x1e33be4607aad283, 0xaac68c2e866e0167,
+            0x54faaa415a2019f1, 0xa1789fc7b01e925a, 0x687e5d61fbfeed19, 0xcac71660f924b49a,
+        },
+        {
+            0xf2acedc62da8a2a6, 0x03fc8cf82f4a0632, 0xe7ff136b5b82f03a, 0xd5841c4d9e88c421,
+            0x75a4d66f7eef63f0, 0x92091ade2865c14b, 0x7060474c64fe7ba3, 0x4056724cfe30cb3e,
+        },
+        {
+            0x658c2f1a296f3de2, 0x61748c5bd419afe6, 0x2d4d7edec4e42f5b, 0x1073fa5b28e1195c,
+            0x2d34f015db02646e, 0x88117f0cdd07b599, 0x29d8589e26f4e3d7, 0x499e2bf121ec6ae4,
+        },
+        {
+            0x38cf4c6f8d9fceb6, 0x11e85f78ab528f38, 0xe2896d2552303b2b, 0xf929675aed68c605,
+            0xfbd2237410c708a9, 0x4682ca1740d7e5a7, 0x4242b5c59041047f, 0xaf5710530f9c6840,
+        },
+    },
+    {
+        {
+            0x218e68f9e5137d20, 0x79588cba0f7e70ad, 0xb6d37f5258b86b0a, 0xcb281c987cc591fe,
+            0x30e03fed8fe40e06, 0x394ded95ed9ca793, 0xf1d22cddbcd3a3da, 0xcb88cb270c591130,
+        },
+        {
+            0x28c7eb34649966a5, 0x97587f4f26639e19, 0x0724cc000bce0f38, 0x63578add4ae6280a,
+            0xf1beaa57c7fd6a1a, 0x83b1a5337b017e35, 0x01c027e3efdf2ed1, 0xf373d4ead2d31852,
+        },
+        {
+            0x33f1ef5ee49aebb8, 0x9ead51e40fcea2c1, 0x1f800a68f8503f28, 0x7881853134a75f67,
+            0x1aeb3760b70ffb27, 0x1cca590acb6309e9, 0x8d09f3607170d241, 0xbc970b5ba0e0d0f8,
+        },
+        {
+            0xfe8d546827502203, 0x985039d458ade316, 0xefd373f10a687415, 0xefccb79143526774,
+            0xeef8d46e0f4497d9, 0x4152df711601ab9a, 0x4250cd2fe47b2ad1, 0xa2b63fa5fb048180,
+        },
+        {
+            0xa45d74f21ceaba59, 0x0613f09b8e94874e, 0xc281c6877eda11e7, 0x49018ac6b455e204,
+            0x8d4cfe3f5ab41803, 0xef94de5a17b69547, 0x77ee24d61fd78468, 0x86025ade341b1787,
+        },
+        {
+            0xf72e4ab81e6799c9, 0x4c0452b01d148443, 0x4f3d6068b1a73a1b, 0x53d967d8da9183dc,
+            0xc6ba6305308773b3, 0xc5535c5db107d1c4, 0x82492b6d5d2936f7, 0x2207d5e4ba0f0e72,
+        },
+        {
+            0xc5859192235222af, 0xa5542f04f921f899, 0x5d4a90a7db5f8318, 0x3d021272659b888a,
+            0x8ffd64e3a77e15c9, 0x6aebea290654524c, 0x94203fd9f0af7e6a, 0x8049cde950a3042f,
+        },
+        {
+            0xd8a6cb6f787d1f1c, 0x427bac943d219a66, 0x51d7d49f383146b0, 0x8164b77f7863d781,
+            0x1646b0842f9631b8, 0xef5b3aa8849388df, 0x60536422e58cd383, 0xb079d911f43ea3a0,
+        },
+        {
+            0xa148f295bab9e98f, 0x72c441a03d4db5cd, 0xae26e1b8e1f0c093, 0x2ed402dff50b0c3d,
+            0x52b84999db77e357, 0x184a672dd2c3d2e4, 0xc894bcab666c01e7, 0x536e30805538e5dd,
+        },
+        {
+            0x82c1234ea69b16e8, 0xcef457bb31d5e5a7, 0x906b1d3021b57835, 0x98fccf88af260ddf,
+            0x047baf0d389fa01e, 0x920c8f4980e60cca, 0xf9674c7ce3e5dd23, 0x63ba7e5efab841cd,
+        },
+        {
+            0x086df7966ca57872, 0x5de899f753520019, 0x65bc6619434e4866, 0x5a38072b5a76d591,
+            0x48726dbacb49a296, 0x5e30d9be6b64a240, 0x04098fcdba69b448, 0x6d5af00ab26c16db,
+        },
+        {
+            0x3d55329398388469, 0x92a97796c5520813, 0xc2bb329ebfc8b1b2, 0x3c6f15321e83e8e2,
+            0xbe61d963e4290a26, 0xd35af4d09cf40c05, 0xfac154d763e829f7, 0xe1d9debb36dc9a8e,
+        },
+        {
+            0xd8469c0f0148b5ef, 0x66f29f7099813e17, 0xef57d8717b3d942f, 0xb554825592d17983,
+            0xe42bbda0d97650bf, 0x396a6143a2eb0e1d, 0xcfe01eb094b9644a, 0xb4147accbe0d659e,
+        },
+        {
+            0x151363e677bca788, 0xbe8d0aee27d39458, 0x4dbde8185b24e144, 0x123188f4d65e528e,
+            0x0a4f8b9cefe44eb7, 0x31f9f1a13e76be29, 0x01910bc8e462f744, 0xf2e6f9dae037a737,
+        },
+        {
+            0xbd1d65cb8825c654, 0xbd0a4bbb62d5765b, 0x23594350380b921d, 0x1c91c8f3130afc2d,
+            0xd25c2dc2533d6f36, 0x57cf6b702133b998, 0xc1b1c5d1174657d1, 0x917b052f52e2ebdd,
+        },
+        {
+            0x504ac041cb73887e, 0xf878b618c3ce3a33, 0x57ef73d556393e75, 0xe4372d2ed276c08c,
+            0xfd9bc8940924cf58, 0xfa2a4debaaa317e2, 0xe51edccc79608da5, 0xadcc68fa8cd4b960,
+        },
+    },
+    {
+        {
+            0x6f154f09a9e0eeae, 0x2246e6feab05a657, 0x4d7c1c811045b85d, 0xde99ea37d3bb7432,
+            0x058f818763184ff4, 0x2a223421d134bfc3, 0x1560dbed23120320, 0x37243c9576a3de9c,
+        },
+        {
+            0x9f116c8fe256b02b, 0x71495693fa5946e0, 0xeb9696ffc335452a, 0x01ca59294971162e,
+            0xee0a1f50c0f28e72, 0x2baac62c70d8df1a, 0xcf65d297f49110f8, 0x041dbb019a45e16a,
+        },
+        {
+            0x20b19223d39e1ee4, 0xc8832a2c4e3e6c2c, 0x64a8f43da3a45c34, 0x52a05eef21fb291b,
+            0x10d3e24ae4b68e38, 0x5289120aee2d8a40, 0x33836b98425b7da8, 0x5bd418f3b00c64e1,
+        },
+        {
+            0x31a02241cedc2c97, 0xf0f5489b2b632641, 0xb09091ddcbfb588f, 0x5ffd0f385d9478e7,
+            0x13f141a1dae35eda, 0xd25563a662f0b26c, 0x80014b171b9dde18, 0x9fcf8f817da49b36,
+        },
+        {
+            0xbe99380540096f25, 0x900d4bddec820131, 0x2170cfd32a993f9c, 0xa0e3d8942dfe1007,
+            0x600d0b5a0e7df109, 0xc904985a47fde3dd, 0x15597a84cb89816a, 0x8ac8b027b9dfeb9e,
+        },
+        {
+            0x9e3ea4fdf7a2df83, 0x8b68b26b64524d44, 0x74caeeab126aee21, 0x590a00a5915d9e1c,
+            0x5ae2a6ab49b90eff, 0x74b4cb1e2df4fe51, 0x0306ed1107fcb6ed, 0x564ebe2e502f5b30,
+        },
+        {
+            0xb0f7a0c3c0a9d128, 0x2adc34d3aed0d3bd, 0x4ebf577813e778e6, 0xd3b89bd0bb8476ba,
+            0xe09eb52837413953, 0x952b705cd8ba3471, 0xcaa81ade86a79c09, 0xc08eed3d7e0e7b2a,
+        },
+        {
+            0x2ea0c2bc9a8f42ff, 0x629742404a1c029a, 0x5ee5f5f69e4dd41b, 0x5b1bba802e110249,
+            0x5ac4eadb78da8016, 0xc29787801809f79f, 0x39d2dbcee3f8c0de, 0x7fb4b5fc064d3ba9,
+        },
+        {
+            0x029f1cb22e1dc01e, 0x7699d92efc429483, 0xee0e425a154560f0, 0x3f5cdfe6787b6641,
+            0x726d87bbe5f6794e, 0x97d7358823aecad2, 0x47f4f5b909ca351c, 0xd742ef4b57dc5e3b,
+        },
+        {
+            0xbf389d37717381ea, 0xefd9e98406bc5bcb, 0xcc8bc96067ff1110, 0xd3414c0bb05612e4,
+            0x084e5f05927fad1a, 0x999bd581438e241f, 0x0c917602faa4fab8, 0xda0520d295080657,
+        },
+        {
+            0x03713ac5be8110ef, 0xaab1917d50f989d3, 0x0d80fe98358fe8b0, 0xf6e874c5a7a1f8e3,
+            0x05650fd8deb42398, 0xbad3e0851c44de73, 0x5369135f1c27f3c2, 0x14bc04f8a7fc74ac,
+        },
+        {
+            0x44892091e3889cb1, 0x123fc555d45ae338, 0x2bc4a9ef02a63128, 0xb72012c9a1dbb436,
+            0x8c75f7b3556a0b46, 0xe4c6f46c5b7608a4, 0xb36abf6838fce20f, 0xb5a8e657bf6c21e1,
+        },
+        {
+            0x5028a4fd029c247e, 0xd6225a43a5ae3e76, 0xfb3fa71cf970817e, 0x742168099ab4aef1,
+            0xca81ee99a39c2f13, 0xa8336e4286a97827, 0xb75aff99b6489555, 0x005b2338e565435c,
+        },
+        {
+            0xeae495e3394d7a92, 0xcba23153b90faec0, 0xd687c821f6d9d80c, 0x951dada28bff3082,
+            0x4e74f1f0701708ad, 0xa6333cd1dd2134f2, 0xeea276cf04665f7c, 0x527257fcae74c17a,
+        },
+        {
+            0x8392350a7f76462f, 0x659ce7db0c216ccb, 0xe87a78b7047e35d5, 0x307c48616e0862d6,
+            0xd444fb86e70741bd, 0x1138a886fea1abe2, 0x4695397d62b79c4f, 0x11aaf588003130ee,
+        },
+        {
+            0x6607179c7f034ff4, 0xefb8fcd93781eac2, 0xfa57f8a97b022138, 0xc5bb9f1d56ab6039,
+            0xf9027e24e4d2ab7f, 0x3d67ad7177a9e364, 0xc579e70c1f7f487d, 0x7fefc8942a7e6bd0,
+        },
+    },
+    {
+        {
+            0x2cb91662a45cfd31, 0x09dd56d316f65cfe, 0x983e005d14f3de51, 0xb9dc05b0210f64fc,
+            0x22790afd885eafe5, 0xbd5213d37444bdec, 0x289dca928987300a, 0x69fb2ac2b3960b76,
+        },
+        {
+            0xe32748869ae7540f, 0xd73866316131e921, 0x2e3d4fd8f2a360c8, 0xb20a59b63d9d41e0,
+            0x72b67eae99082a34, 0xfad6aa7d51819470, 0x7c299b9aa2d1d007, 0xc1f841e08100bed0,
+        },
+        {
+            0x2c1f7d4c43e90ebd, 0x58b781071fc72b07, 0xda8503e1af94f402, 0xfbb724b759f244b0,
+            0x2fcd2186fcd8755a, 0x7407cdee868482b7, 0x4d62f578349be3d5, 0x4a012544dcc6202c,
+        },
+        {
+            0xb8a414d2151ffc08, 0xaa79acf0740d6b55, 0xeeab0104cdf472ab, 0x5014a8c1a3aa5f1d,
+            0x8c74340533f13425, 0x2b776b4957eb54d4, 0x3a0cc4ac548a723b, 0x65aae6f3c79fe63a,
+        },
+        {
+            0xe8b388f2ee5e579c, 0x31cc9373991c03d4, 0x53eed518567bfa7c, 0x267e282d67f985ed,
+            0xc435fd22b4763ea0, 0xead83837e39b7703, 0x806daad5094ba5b4, 0xa738a84745842672,
+        },
+        {
+            0x99421b429984c4c2, 0x1a3bce27d35c7bbd, 0xe51ae6f63563b09e, 0x8e67853b8d9c9fbf,
+            0xca8784da6b2100b5, 0xe89a24f798879bba, 0xe901b45ce286b039, 0x23dedbb8f50384bd,
+        },
+        {
+            0x4728cbdb5cbf7df2, 0xed274fdf6764329e, 0xc2af1a07642d199a, 0x5d66565917a50e7e,
+            0x7babf4bcfaa5eb82, 0xd3bcfc6799fe4026, 0xaa5d2648607d9f41, 0x7405c071967efac1,
+        },
+        {
+            0x79447ef9dfa782a4, 0x6dadc8e174cd9500, 0x0574020edc38f762, 0x17596d7ee2ee7a14,
+            0x9ef75af79e1f8adc, 0x5ac5f216a4791da0, 0x1583226b7b7b5d80, 0x59f3f053a21c26cc,
+        },
+        {
+            0xd80e7fdcf95e30d9, 0xecf5041c0a3a3616, 0x50b93b8b03043fa6, 0xa31a2aa4ae262ad6,
+            0x1468b370d63cd98d, 0xfb89cc65dc07a367, 0x6cf1df6b4d47b59f, 0xab451a991b6350fe,
+        },
+        {
+            0xeb74554d8c124dff, 0x781a8c4d21be0be0, 0xfaacc154e3510068, 0x16655d65d6238265,
+            0xba46d27b0466134a, 0x1a3f51b93101e283, 0xc08298a9096ec237, 0x46248627c69cfb5b,
+        },
+        {
+            0xf9e7a5a481a0500f, 0x92db27d5bd2e03e7, 0x3dcce4f682899e3c, 0x861f1797f39a39c7,
+            0x175b243069dc8961, 0x93d2a88edc67953e, 0xa40f370492d794d6, 0x607019f03526eeaf,
+        },
+        {
+            0xf20e163b22f37d65, 0x70fd00c832cf180a, 0xff1a97d20b17244e, 0x9a5a141bacedb33a,
+            0xf03dd868cc16bbb4, 0x9b15372da40e44e9, 0xd5ba643615ac397f, 0xb1a886d4c821f6b7,
+        },
+        {
+            0xbe3aacda4b7b4e21, 0xad9829fe66b56729, 0x78965cefd541cc1a, 0x414bfea77d17631e,
+            0xf55835d9c64dd621, 0xa0ebf68bef644d93, 0x01d15340c8a40021, 0x00ae640d42b99aa0,
+        },
+        {
+            0x92321ee26881e64f, 0xaccab5c85267bdd3, 0x0c1f87ea5927647b, 0x0093d07e162c6d86,
+            0x49868df4389c711d, 0xe68d69aec11e1f37, 0xa40e7aa8b4207246, 0x4ae8d126ce832395,
+        },
+        {
+            0x5f9b128a86450cc0, 0x88f76293c8ec07e6, 0x0762f293179702b8, 0xb56961024910006d,
+            0x3951291b35fe0505, 0x70f75a5cce8d7056, 0x4541beaf2eb13369, 0x7060a749a643316c,
+        },
+        {
+            0xee16abd049c879a5, 0x844874a7a47ac42e, 0xee3f8a203c9c2326, 0x99a12054deaed33b,
+            0x4814a15b63b333ae, 0xee9f28a59d923fa0, 0x5b0cd25033b1b1ef, 0x3ccc39b98346d928,
+        },
+    },
+    {
+        {
+            0xf8ea9359d93f6e1a, 0x729005d43d41c118, 0x4c2934107cb641af, 0x6b2b4671895e8e78,
+            0x2a1251d05958fad3, 0xb69bc2be78619fe4, 0xd74df34cd911d318, 0x5def837815102704,
+        },
+        {
+            0xe31575c2a2c539e4, 0x0bac5dcda756daf9, 0xe917cecf91f55a12, 0x1e96433be96f6299,
+            0xeec7c71c3700d8fb, 0x9a1d2965dc9b4444, 0x3d2c6970cf74f19c, 0x3b444c48ac5e0d6b,
+        },
+        {
+            0x9381f2b94250f866, 0x30541dda4e552519, 0xd97e3b25fccd1f5a, 0x0dd747fc3573a83c,
+            0x9aa49586a333fba7, 0xafbe556d470152a9, 0x5fe18e52e46c0cc4, 0x9d90b01c7cd1be75,
+        },
+        {
+            0xe563cefd8ccb854c, 0xf5452cdb65b0c45a, 0xb3c787699c37f743, 0x34e9d19295d444ab,
+            0x2934794652ff26b7, 0x70d6ecfa9b94d642, 0x7d201858fdaffb8f, 0xc288719d45dcdc71,
+        },
+        {
+            0x093ef49f97b5b4d2, 0x3674a533e50617f3, 0x28f2ce0b19be9534, 0x968400365e6ddebf,
+            0x2a3e3fd8438c7099, 0x8ff087c645e6cdd2, 0xf8a61fb73fb672a7, 0x2b461bf6923a48cb,
+        },
+        {
+            0x044c762e3297ea3a, 0x8174d2ca4c4cbd19, 0x058cf60513b966b5, 0x63648f91d8f56070,
+            0x03a667a3eeba94ef, 0x08ee72ed31547eb1, 0x1acc2c5fc02f3914, 0xcf7e7a39500d06a4,
+        },
+        {
+            0x49d8803725d85f62, 0x1330ed2b83007671, 0x324a22fad69cbd5e, 0xb3aaf93959328cfb,
+            0x4dde5486faec230f, 0x193957026bff23fb, 0xefb5536ed2b8f7d6, 0xaaf420b023b98865,
+        },
+        {
+            0xc695469d0728a2eb, 0x7b46244ec433d11c, 0x4a8b99baf106c08e, 0x7989794f63422083,
+            0x82218867d4fc5696, 0x6b021f283c79cdb8, 0x5ff7bbeab26d5049, 0xb78611caa7261628,
+        },
+        {
+            0x7d2e0ecd4ea2da89, 0xfefbf7024c992ac6, 0x0dfb6380fcfc485e, 0xdac6a0c4ffcf6ccb,
+            0xfab0b9e3a733b99e, 0xdf67d324e70bd52a, 0xf622c943f41f3d6c, 0x148c0c5bbd18b1a7,
+        },
+        {
+            0xf34729b0764adf61, 0xa8ee57d70f4ae7db, 0xd4d23283c900c9d3, 0xd6444dc2000bdffe,
+            0xe5418f0825b2da43, 0x2d595306ab2e611e, 0xc3b5c9eb935f8485, 0x62d94e78b5f97330,
+        },
+        {
+            0xd22bb14963ef2fea, 0xf83789c0e98303c0, 0x23fade1ed8aeba65, 0x469854362f6f43ad,
+            0x14c69c998cfad827, 0x6738031b9f9ea8b6, 0xdefd83f12839d1f9, 0xb27a2fd1d029b501,
+        },
+        {
+            0x5a75f961531313d7, 0x85a1f4db66dcdc9e, 0xae3026b96460e991, 0x7d467bef17ecf7cc,
+            0x8a0dbf6705118708, 0x54bfa368f3b2f1c9, 0xa9fc9d5cf2c0e4e0, 0xa8c2ad115e93611b,
+        },
+        {
+            0x3a6d3011fdb5d461, 0x7111950cbe580970, 0xac631066fe934198, 0x3bcacd162c4fc1e0,
+            0x4b275bf5afa3c528, 0xea3f3f4ae0a014b6, 0x6fa6b757b074b0d8, 0xc57db53bb94e587f,
+        },
+        {
+            0xac0695d7f838ffb6, 0xc68e084d1b67fc3e, 0x3c3dde00e5aca24f, 0xcb34cd41bd439434,
+            0xabff9c9342f274d3, 0x37266eafb402e59d, 0x01f7535cceda7b28, 0x99971c74b0f239f5,
+        },
+        {
+            0xab8496d32f5b5373, 0x9f50efbb935cef00, 0xca69937d1e79d090, 0x9fa6401a5063e61a,
+            0x3466090f20406319, 0x8af74a29e8923b46, 0xb2f461c53696785e, 0x4bb08d6b612e60b0,
+        },
+        {
+            0x3ef1faf0aa1256bd, 0x0f2245459e4631de, 0x69cb9800de9c2676, 0x2601981695782b24,
+            0x945c172ca66c0ccd, 0x6c25f635b440719a, 0x917d5dbaa49f681a, 0xc0cad047b2dc5df4,
+        },
+    },
+    {
+        {
+            0x5190fb0feecc2f22, 0x3df210f3698d8e60, 0xcce57d3af5f3ce72, 0xb2fb6223312b8fc6,
+            0x7994700571867c84, 0x141cd92cbe139ebe, 0x415efc9e5de7944e, 0xae9ee91945821058,
+        },
+        {
+            0x6f7b1a6a32f9eaf5, 0x2c440f94acfc13dc, 0x2cf39bc566b18adf, 0xb9939fe89f01533f,
+            0x031c4553383a6450, 0x16d96ad3f0102087, 0xcbd6fa95501f1360, 0x667d3ea065f96c08,
+        },
+        {
+            0x55231d00aea9bd3c, 0x07e107c9fdf3f015, 0xf535947dec9d8fce, 0x8b64ed8abba349a7,
+            0xdd5881fd049301df, 0xefac9c43e6490fd0, 0xd990285273740a78, 0x6eef3724942c326c,
+        },
+        {
+            0xca1fc13ba12fdf41, 0xd798c04b8224f5d2, 0x22f4594e1dd5872b, 0xdee12df51bddfda8,
+            0x96473ff0ed83420a, 0xf41cf1c78daa27f4, 0x2772cd56aecefd8a, 0xd5ddaf184902b47f,
+        },
+        {
+            0xa312a3c0dc85bba1, 0x3328fa8e431ca797, 0x5438bf1c68fd219a, 0x98812c6f85837d74,
+            0xe88c4913f8c96d49, 0xcc62e79cc2442aca, 0x4ef3c7d4046655f1, 0x04a362eddadab1ea,
+        },
+        {
+            0x98e05abf53e86ae1, 0xc1dc4d903850830d, 0xbd7fd806e06bc33c, 0x1ac330d6acf1286f,
+            0x28ce2303e1588c1e, 0xdc25e54b1b7e9c19, 0x11e51e494b7149f2, 0x551b8391b5c7fa25,
+        },
+        {
+            0x789ea49bd2ee8d68, 0x89552b460a84a920, 0xe629d5de1a4ea456, 0xddfefe8722ddd405,
+            0x3d56f6971cdb9e7b, 0x95a861b0a8bf715b, 0xb01248d67896c993, 0x3c4e3d9801a3085c,
+        },
+        {
+            0x23fc5ddf1510a406, 0x475a78f4c9f0e98d, 0xb6d681c4e72843a0, 0xa90af2a44a00c5a6,
+            0x95fc6d45a34f4412, 0x60f9c0e2e7f5d703, 0x2bc0642bad110925, 0x79abfc10be24a4d5,
+        },
+        {
+            0xd9f5121a44282a64, 0x4f8d4e45987af822, 0x722f44a6d32f24c3, 0x0fc68a96f7979de3,
+            0x88edc9477aa47add, 0xe6fafe4b90c699b8, 0xd7fdb8ae35bc5a13, 0xd6980e5ff3e9c88a,
+        },
+        {
+            0x8844ee0691cf6cf0, 0xe05b5ed126b6bb15, 0x049c4bbcb7f77954, 0x9d0f8218fd94a619,
+            0x5369e53617b8a0fd, 0x2f1c014998a163c8, 0xa95975cd724efcc5, 0xebe1aaffe9aa9f9e,
+        },
+        {
+            0xbbde772b2b641804, 0xc7abe5ce5528f3cd, 0xa10288c127cd8719, 0x6bee705abd6b1a8e,
+            0x1db8a94d9be2df7d, 0x4a6858535ef6896f, 0xde2283c9d59fddb2, 0xe4b753630277a735,
+        },
+        {
+            0x64fd0621245e20be, 0x35a502d8234bbfc6, 0x40b56e370b7b3b68, 0xfca24ac66641f5cd,
+            0x329a49d7102ae181, 0xd2205d2fcfe146be, 0x2a432de4b85146a8, 0x5f90d9d716c61963,
+        },
+        {
+            0xcb80d782492ca5e3, 0xaeabbac9aa8873d4, 0x07c73b011a4d8999, 0xae848fd0840aca87,
+            0xeaa8088effd4d8a8, 0x1be20aacb8a8aa0d, 0xfdd0dcca9a4354a0, 0xdeb724d7d039cda7,
+        },
+        {
+            0xc9bd4e18f143aa0f, 0xf3894c55a1cf03d3, 0xd25d055813345f4c, 0xada5c0a07d58089d,
+            0x3988b9b65ddf3b29, 0x39c34385b8afdfa6, 0x1e3c9917906ebe14, 0x3c9efd256ca95d38,
+        },
+        {
+            0xafe984f709d5889e, 0xd0999cce46b9656e, 0x4fdf1c1890001468, 0x9f0d5b09c3d5e26c,
+            0xa999a00726e1b753, 0x962e025e55c7acbe, 0x295709050105401e, 0x79f87e89c934f7a8,
+        },
+        {
+            0x90429ce39b3d6844, 0xaf562e988320f9bf, 0x5fbc2c5d717dc2d2, 0xb6fa79fe5722f5ea,
+            0xc5aa70a079eea8d9, 0x624a2b913377e5ee, 0x30ec06eaf7ad14cb, 0x68d07bdcd5640ac9,
+        },
+    },
+};
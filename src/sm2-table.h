@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef purec_PUREC_SM_2_TABLE_H
+#define purec_PUREC_SM_2_TABLE_H
+#include "common.h"
+
+/**
+ * SM2 基点的固定基表(内部使用, 不安装): 标量按 5 位一个窗口做有符号编码, 每个窗口存 1..16 倍
+ * c_sm2_z256_g_table[i][j] = (j + 1) * 2^(5i) * G, 仿射坐标, Montgomery 形式(R = 2^256), 每项依次为 x 和 y 的 4 个 64 位 limb
+ */
+#define SM2_Z256_G_WINDOW_BITS      5
+#define SM2_Z256_G_WINDOWS          52
+#define SM2_Z256_G_WINDOW_SIZE      16
+
+C_BEGIN_EXTERN_C
+
+extern const uint64_t c_sm2_z256_g_table[SM2_Z256_G_WINDOWS][SM2_Z256_G_WINDOW_SIZE][8] C_HIDDEN;
+
+C_END_EXTERN_C
+
+#endif // purec_PUREC_SM_2_TABLE_H
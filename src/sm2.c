@@ -20,6 +20,7 @@
  * SOFTWARE.
  */
 #include "sm2.h"
+#include "sm2-table.h"
 
 
 #define RAND_MAX_BUF_SIZE   256 // requirement of getentropy()
@@ -71,6 +72,18 @@ const Sm2BN SM2_TWO     = {2,0,0,0,0,0,0,0};
 const Sm2BN SM2_THREE   = {3,0,0,0,0,0,0,0};
 
 
+static int mem_is_zero(const uint8_t *buf, size_t len)
+{
+    size_t i;
+    uint8_t r = 0;
+
+    for (i = 0; i < len; i++) {
+        r |= buf[i];
+    }
+
+    return 0 == r;
+}
+
 static int rand_bytes(uint8_t *buf, size_t len)
 {
     if (!buf) {
@@ -354,113 +367,611 @@ static int sm2_bn_rand_range(Sm2BN r, const Sm2BN range)
     return 1;
 }
 
-static int sm2_fp_rand(Sm2Fp r)
+/**
+ * 4 x 64 位 limb 的 Montgomery 域运算(R = 2^256)
+ * p 的最低 64 位全为 1, -p^-1 mod 2^64 = 1, 所以每轮约减的商就是当前的最低 limb;
+ * 结果不超过 2p, 用掩码做条件减法, 运算时间与数据无关
+ */
+typedef uint64_t Sm2Z256[4];
+
+typedef struct
 {
-    if (sm2_bn_rand_range(r, SM2_P) != 1) {
-        // error_print();
-        return -1;
-    }
-    return 1;
+    Sm2Z256             X;
+    Sm2Z256             Y;
+    Sm2Z256             Z;
+} Sm2Z256Point;         // Montgomery 形式的 Jacobian 坐标, Z = 0 是无穷远点
+
+static const Sm2Z256 SM2_Z256_P = {
+    0xffffffffffffffff, 0xffffffff00000000, 0xffffffffffffffff, 0xfffffffeffffffff,
+};
+
+// R mod p
+static const Sm2Z256 SM2_Z256_MONT_ONE = {
+    0x0000000000000001, 0x00000000ffffffff, 0x0000000000000000, 0x0000000100000000,
+};
+
+// R^2 mod p
+static const Sm2Z256 SM2_Z256_RR = {
+    0x0000000200000003, 0x00000002ffffffff, 0x0000000100000001, 0x0000000400000002,
+};
+
+static const Sm2Z256 SM2_Z256_ONE = {1, 0, 0, 0};
+static const Sm2Z256 SM2_Z256_ZERO = {0, 0, 0, 0};
+
+/**
+ * 返回 a * b + c + d 的低 64 位, 高 64 位写入 hi, 结果不会超过 128 位
+ */
+static uint64_t sm2_z256_mac(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t* hi)
+{
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 t = (unsigned __int128) a * b + c + d;
+
+    *hi = (uint64_t) (t >> 64);
+
+    return (uint64_t) t;
+#else
+    uint64_t ll = (a & 0xffffffff) * (b & 0xffffffff);
+    uint64_t lh = (a & 0xffffffff) * (b >> 32);
+    uint64_t hl = (a >> 32) * (b & 0xffffffff);
+    uint64_t hh = (a >> 32) * (b >> 32);
+    uint64_t mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+    uint64_t lo = (ll & 0xffffffff) | (mid << 32);
+
+    hh += (lh >> 32) + (hl >> 32) + (mid >> 32);
+    lo += c;
+    hh += (lo < c);
+    lo += d;
+    hh += (lo < d);
+    *hi = hh;
+
+    return lo;
+#endif
 }
 
-static void sm2_fp_add(Sm2Fp r, const Sm2Fp a, const Sm2Fp b)
+static uint64_t sm2_z256_add(Sm2Z256 r, const Sm2Z256 a, const Sm2Z256 b)
 {
-    sm2_bn_add(r, a, b);
-    if (sm2_bn_cmp(r, SM2_P) >= 0) {
-        sm2_bn_sub(r, r, SM2_P);
+    int i;
+    uint64_t t, c = 0, carry;
+
+    for (i = 0; i < 4; i++) {
+        t = a[i] + c;
+        carry = (t < c);
+        r[i] = t + b[i];
+        c = carry + (r[i] < t);
     }
+
+    return c;
 }
 
-static void sm2_fp_sub(Sm2Fp r, const Sm2Fp a, const Sm2Fp b)
+static uint64_t sm2_z256_sub(Sm2Z256 r, const Sm2Z256 a, const Sm2Z256 b)
 {
-    if (sm2_bn_cmp(a, b) >= 0) {
-        sm2_bn_sub(r, a, b);
+    int i;
+    uint64_t t, c = 0, borrow;
+
+    for (i = 0; i < 4; i++) {
+        t = a[i] - b[i];
+        borrow = (a[i] < b[i]) | (t < c);
+        r[i] = t - c;
+        c = borrow;
     }
-    else {
-        Sm2BN t;
-        sm2_bn_sub(t, SM2_P, b);
-        sm2_bn_add(r, t, a);
+
+    return c;
+}
+
+/**
+ * mask 为全 1 时 r = a, 为 0 时不变
+ */
+static void sm2_z256_cmov(Sm2Z256 r, const Sm2Z256 a, uint64_t mask)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        r[i] = (r[i] & ~mask) | (a[i] & mask);
     }
 }
 
-static void sm2_fp_dbl(Sm2Fp r, const Sm2Fp a)
+static int sm2_z256_is_zero(const Sm2Z256 a)
 {
-    sm2_fp_add(r, a, a);
+    return 0 == (a[0] | a[1] | a[2] | a[3]);
 }
 
-static void sm2_fp_tri(Sm2Fp r, const Sm2Fp a)
+/**
+ * a 为 0 时返回全 1, 否则返回 0, 不含分支
+ */
+static uint64_t sm2_z256_is_zero_mask(const Sm2Z256 a)
 {
-    Sm2BN t;
-    sm2_fp_dbl(t, a);
-    sm2_fp_add(r, t, a);
+    uint64_t t = a[0] | a[1] | a[2] | a[3];
+
+    return ((t | (0 - t)) >> 63) - 1;
 }
 
-static void sm2_fp_div2(Sm2Fp r, const Sm2Fp a)
+static void sm2_z256_from_bn(Sm2Z256 r, const Sm2BN a)
 {
     int i;
-    sm2_bn_copy(r, a);
-    if (r[0] & 0x01) {
-        sm2_bn_add(r, r, SM2_P);
+
+    for (i = 0; i < 4; i++) {
+        r[i] = (a[2 * i] & 0xffffffff) | (a[2 * i + 1] << 32);
     }
-    for (i = 0; i < 7; i++) {
-        r[i] = (r[i] >> 1) | ((r[i + 1] & 0x01) << 31);
+}
+
+static void sm2_z256_to_bn(Sm2BN r, const Sm2Z256 a)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        r[2 * i] = a[i] & 0xffffffff;
+        r[2 * i + 1] = a[i] >> 32;
     }
-    r[i] >>= 1;
 }
 
-static void sm2_fp_neg(Sm2Fp r, const Sm2Fp a)
+/**
+ * r = (c * 2^256 + r) mod p, 要求输入小于 2p
+ */
+static void sm2_z256_modp_reduce(Sm2Z256 r, uint64_t c)
 {
-    if (sm2_bn_is_zero(a)) {
-        sm2_bn_copy(r, a);
+    uint64_t borrow;
+    Sm2Z256 t;
+
+    borrow = sm2_z256_sub(t, r, SM2_Z256_P);
+    sm2_z256_cmov(r, t, 0 - (c | (borrow ^ 1)));
+}
+
+static void sm2_z256_modp_add(Sm2Z256 r, const Sm2Z256 a, const Sm2Z256 b)
+{
+    sm2_z256_modp_reduce(r, sm2_z256_add(r, a, b));
+}
+
+static void sm2_z256_modp_sub(Sm2Z256 r, const Sm2Z256 a, const Sm2Z256 b)
+{
+    uint64_t mask;
+    Sm2Z256 t;
+
+    mask = 0 - sm2_z256_sub(r, a, b);
+    t[0] = SM2_Z256_P[0] & mask;
+    t[1] = SM2_Z256_P[1] & mask;
+    t[2] = SM2_Z256_P[2] & mask;
+    t[3] = SM2_Z256_P[3] & mask;
+    sm2_z256_add(r, r, t);
+}
+
+static void sm2_z256_modp_dbl(Sm2Z256 r, const Sm2Z256 a)
+{
+    sm2_z256_modp_add(r, a, a);
+}
+
+static void sm2_z256_modp_tri(Sm2Z256 r, const Sm2Z256 a)
+{
+    Sm2Z256 t;
+
+    sm2_z256_modp_add(t, a, a);
+    sm2_z256_modp_add(r, t, a);
+}
+
+static void sm2_z256_modp_neg(Sm2Z256 r, const Sm2Z256 a)
+{
+    sm2_z256_modp_sub(r, SM2_Z256_ZERO, a);
+}
+
+/**
+ * 奇数先加 p 再右移
+ */
+static void sm2_z256_modp_div2(Sm2Z256 r, const Sm2Z256 a)
+{
+    uint64_t c, mask = 0 - (a[0] & 1);
+    Sm2Z256 t;
+
+    t[0] = SM2_Z256_P[0] & mask;
+    t[1] = SM2_Z256_P[1] & mask;
+    t[2] = SM2_Z256_P[2] & mask;
+    t[3] = SM2_Z256_P[3] & mask;
+    c = sm2_z256_add(r, a, t);
+    r[0] = (r[0] >> 1) | (r[1] << 63);
+    r[1] = (r[1] >> 1) | (r[2] << 63);
+    r[2] = (r[2] >> 1) | (r[3] << 63);
+    r[3] = (r[3] >> 1) | (c << 63);
+}
+
+/**
+ * r = a * b * R^-1 mod p (CIOS), 输入不超过 2^256 时结果都小于 p
+ */
+static void sm2_z256_mont_mul(Sm2Z256 r, const Sm2Z256 a, const Sm2Z256 b)
+{
+    int i, j;
+    uint64_t c, m;
+    uint64_t t[6] = {0, 0, 0, 0, 0, 0};
+
+    for (i = 0; i < 4; i++) {
+        c = 0;
+        for (j = 0; j < 4; j++) {
+            t[j] = sm2_z256_mac(a[j], b[i], t[j], c, &c);
+        }
+        t[4] += c;
+        t[5] = (t[4] < c);
+
+        m = t[0];
+        sm2_z256_mac(m, SM2_Z256_P[0], t[0], 0, &c);
+        for (j = 1; j < 4; j++) {
+            t[j - 1] = sm2_z256_mac(m, SM2_Z256_P[j], t[j], c, &c);
+        }
+        t[3] = t[4] + c;
+        t[4] = t[5] + (t[3] < c);
+    }
+
+    r[0] = t[0];
+    r[1] = t[1];
+    r[2] = t[2];
+    r[3] = t[3];
+    sm2_z256_modp_reduce(r, t[4]);
+}
+
+static void sm2_z256_mont_sqr(Sm2Z256 r, const Sm2Z256 a)
+{
+    sm2_z256_mont_mul(r, a, a);
+}
+
+static void sm2_z256_to_mont(Sm2Z256 r, const Sm2Z256 a)
+{
+    sm2_z256_mont_mul(r, a, SM2_Z256_RR);
+}
+
+static void sm2_z256_from_mont(Sm2Z256 r, const Sm2Z256 a)
+{
+    sm2_z256_mont_mul(r, a, SM2_Z256_ONE);
+}
+
+/**
+ * r = a^(p - 2), 费马小定理求逆的固定加法链
+ */
+static void sm2_z256_mont_inv(Sm2Z256 r, const Sm2Z256 a)
+{
+    Sm2Z256 a1;
+    Sm2Z256 a2;
+    Sm2Z256 a3;
+    Sm2Z256 a4;
+    Sm2Z256 a5;
+    int i;
+
+    sm2_z256_mont_sqr(a1, a);
+    sm2_z256_mont_mul(a2, a1, a);
+    sm2_z256_mont_sqr(a3, a2);
+    sm2_z256_mont_sqr(a3, a3);
+    sm2_z256_mont_mul(a3, a3, a2);
+    sm2_z256_mont_sqr(a4, a3);
+    sm2_z256_mont_sqr(a4, a4);
+    sm2_z256_mont_sqr(a4, a4);
+    sm2_z256_mont_sqr(a4, a4);
+    sm2_z256_mont_mul(a4, a4, a3);
+    sm2_z256_mont_sqr(a5, a4);
+    for (i = 1; i < 8; i++)
+        sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_mul(a5, a5, a4);
+    for (i = 0; i < 8; i++)
+        sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_mul(a5, a5, a4);
+    for (i = 0; i < 4; i++)
+        sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_mul(a5, a5, a3);
+    sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_mul(a5, a5, a2);
+    sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_mul(a5, a5, a);
+    sm2_z256_mont_sqr(a4, a5);
+    sm2_z256_mont_mul(a3, a4, a1);
+    sm2_z256_mont_sqr(a5, a4);
+    for (i = 1; i< 31; i++)
+        sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_mul(a4, a5, a4);
+    sm2_z256_mont_sqr(a4, a4);
+    sm2_z256_mont_mul(a4, a4, a);
+    sm2_z256_mont_mul(a3, a4, a2);
+    for (i = 0; i < 33; i++)
+        sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_mul(a2, a5, a3);
+    sm2_z256_mont_mul(a3, a2, a3);
+    for (i = 0; i < 32; i++)
+        sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_mul(a2, a5, a3);
+    sm2_z256_mont_mul(a3, a2, a3);
+    sm2_z256_mont_mul(a4, a2, a4);
+    for (i = 0; i < 32; i++)
+        sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_mul(a2, a5, a3);
+    sm2_z256_mont_mul(a3, a2, a3);
+    sm2_z256_mont_mul(a4, a2, a4);
+    for (i = 0; i < 32; i++)
+        sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_mul(a2, a5, a3);
+    sm2_z256_mont_mul(a3, a2, a3);
+    sm2_z256_mont_mul(a4, a2, a4);
+    for (i = 0; i < 32; i++)
+        sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_mul(a2, a5, a3);
+    sm2_z256_mont_mul(a3, a2, a3);
+    sm2_z256_mont_mul(a4, a2, a4);
+    for (i = 0; i < 32; i++)
+        sm2_z256_mont_sqr(a5, a5);
+    sm2_z256_mont_mul(r, a4, a5);
+
+    memset(a1, 0, sizeof(a1));
+    memset(a2, 0, sizeof(a2));
+    memset(a3, 0, sizeof(a3));
+    memset(a4, 0, sizeof(a4));
+    memset(a5, 0, sizeof(a5));
+}
+
+/**
+ * 取第 i 个窗口的有符号数字: 窗口覆盖 bit[5i - 1, 5i + 4], 结果 |d| <= 16, 符号写入 sign
+ */
+static uint64_t sm2_z256_get_booth(const Sm2Z256 k, int i, uint64_t* sign)
+{
+    int pos = SM2_Z256_G_WINDOW_BITS * i - 1;
+    uint64_t w, s, d;
+
+    if (0 == i) {
+        w = (k[0] << 1) & 0x3f;
     }
     else {
-        sm2_bn_sub(r, SM2_P, a);
+        w = k[pos / 64] >> (pos % 64);
+        if (pos % 64 > 58 && pos / 64 < 3) {
+            w |= k[pos / 64 + 1] << (64 - pos % 64);
+        }
+        w &= 0x3f;
     }
+
+    s = 0 - (w >> SM2_Z256_G_WINDOW_BITS);
+    d = ((((uint64_t) 1 << (SM2_Z256_G_WINDOW_BITS + 1)) - w - 1) & s) | (w & ~s);
+    *sign = s & 1;
+
+    return (d >> 1) + (d & 1);
 }
 
-static void sm2_fp_mul(Sm2Fp r, const Sm2Fp a, const Sm2Fp b)
+static void sm2_z256_point_set_infinity(Sm2Z256Point* R)
 {
-    int i, j;
-    uint64_t s[16] = {0};
-    Sm2BN d = {0};
-    uint64_t u;
+    memcpy(R->X, SM2_Z256_MONT_ONE, sizeof(Sm2Z256));
+    memcpy(R->Y, SM2_Z256_MONT_ONE, sizeof(Sm2Z256));
+    memset(R->Z, 0, sizeof(Sm2Z256));
+}
 
-    // s = a * b
-    for (i = 0; i < 8; i++) {
-        u = 0;
-        for (j = 0; j < 8; j++) {
-            u = s[i + j] + a[i] * b[j] + u;
-            s[i + j] = u & 0xffffffff;
-            u >>= 32;
-        }
-        s[i + 8] = u;
+static void sm2_z256_point_from_jacobian(Sm2Z256Point* R, const Sm2JacobianPoint* P)
+{
+    sm2_z256_from_bn(R->X, P->x);
+    sm2_z256_from_bn(R->Y, P->y);
+    sm2_z256_from_bn(R->Z, P->z);
+    sm2_z256_to_mont(R->X, R->X);
+    sm2_z256_to_mont(R->Y, R->Y);
+    sm2_z256_to_mont(R->Z, R->Z);
+}
+
+static void sm2_z256_point_to_jacobian(Sm2JacobianPoint* R, const Sm2Z256Point* P)
+{
+    Sm2Z256 t;
+
+    if (sm2_z256_is_zero(P->Z)) {
+        c_sm2_jacobian_point_set_infinity(R);
+        return;
     }
 
-    r[0] = s[0] + s[ 8] + s[ 9] + s[10] + s[11] + s[12] + ((s[13] + s[14] + s[15]) << 1);
-    r[1] = s[1] + s[ 9] + s[10] + s[11] + s[12] + s[13] + ((s[14] + s[15]) << 1);
-    r[2] = s[2];
-    r[3] = s[3] + s[ 8] + s[11] + s[12] + s[14] + s[15] + (s[13] << 1);
-    r[4] = s[4] + s[ 9] + s[12] + s[13] + s[15] + (s[14] << 1);
-    r[5] = s[5] + s[10] + s[13] + s[14] + (s[15] << 1);
-    r[6] = s[6] + s[11] + s[14] + s[15];
-    r[7] = s[7] + s[ 8] + s[ 9] + s[10] + s[11] + s[15] + ((s[12] + s[13] + s[14] + s[15]) << 1);
+    sm2_z256_from_mont(t, P->X);
+    sm2_z256_to_bn(R->x, t);
+    sm2_z256_from_mont(t, P->Y);
+    sm2_z256_to_bn(R->y, t);
+    sm2_z256_from_mont(t, P->Z);
+    sm2_z256_to_bn(R->z, t);
+}
 
-    for (i = 1; i < 8; i++) {
-        r[i] += r[i - 1] >> 32;
-        r[i - 1] &= 0xffffffff;
+/**
+ * 转为仿射坐标, 结果仍是 Montgomery 形式
+ */
+static void sm2_z256_point_get_xy(const Sm2Z256Point* P, Sm2Z256 x, Sm2Z256 y)
+{
+    Sm2Z256 zInv;
+
+    sm2_z256_mont_inv(zInv, P->Z);
+    if (y) {
+        sm2_z256_mont_mul(y, P->Y, zInv);
+    }
+    sm2_z256_mont_sqr(zInv, zInv);
+    sm2_z256_mont_mul(x, P->X, zInv);
+    if (y) {
+        sm2_z256_mont_mul(y, y, zInv);
     }
+}
 
-    d[2] = s[8] + s[9] + s[13] + s[14];
-    d[3] = d[2] >> 32;
-    d[2] &= 0xffffffff;
-    sm2_bn_sub(r, r, d);
+static void sm2_z256_point_dbl(Sm2Z256Point* R, const Sm2Z256Point* P)
+{
+    const uint64_t*     X1 = P->X;
+    const uint64_t*     Y1 = P->Y;
+    const uint64_t*     Z1 = P->Z;
+    Sm2Z256             T1;
+    Sm2Z256             T2;
+    Sm2Z256             T3;
+
+    if (sm2_z256_is_zero(Z1)) {
+        *R = *P;
+        return;
+    }
 
-    // max times ?
-    while (sm2_bn_cmp(r, SM2_P) >= 0) {
+    sm2_z256_mont_sqr(T1, Z1);
+    sm2_z256_modp_sub(T2, X1, T1);
+    sm2_z256_modp_add(T1, X1, T1);
+    sm2_z256_mont_mul(T2, T2, T1);
+    sm2_z256_modp_tri(T2, T2);
+    sm2_z256_modp_dbl(R->Y, Y1);
+    sm2_z256_mont_mul(R->Z, R->Y, Z1);
+    sm2_z256_mont_sqr(R->Y, R->Y);
+    sm2_z256_mont_mul(T3, R->Y, X1);
+    sm2_z256_mont_sqr(R->Y, R->Y);
+    sm2_z256_modp_div2(R->Y, R->Y);
+    sm2_z256_mont_sqr(R->X, T2);
+    sm2_z256_modp_dbl(T1, T3);
+    sm2_z256_modp_sub(R->X, R->X, T1);
+    sm2_z256_modp_sub(T1, T3, R->X);
+    sm2_z256_mont_mul(T1, T1, T2);
+    sm2_z256_modp_sub(R->Y, T1, R->Y);
+}
+
+/**
+ * R = P + (x2, y2), 第二个点是仿射坐标
+ */
+static void sm2_z256_point_add_affine(Sm2Z256Point* R, const Sm2Z256Point* P, const Sm2Z256 x2, const Sm2Z256 y2)
+{
+    const uint64_t*     X1 = P->X;
+    const uint64_t*     Y1 = P->Y;
+    const uint64_t*     Z1 = P->Z;
+    Sm2Z256             T1;
+    Sm2Z256             T2;
+    Sm2Z256             T3;
+    Sm2Z256             T4;
+    Sm2Z256Point        Q;
+
+    if (sm2_z256_is_zero(Z1)) {
+        memcpy(R->X, x2, sizeof(Sm2Z256));
+        memcpy(R->Y, y2, sizeof(Sm2Z256));
+        memcpy(R->Z, SM2_Z256_MONT_ONE, sizeof(Sm2Z256));
+        return;
+    }
+
+    sm2_z256_mont_sqr(T1, Z1);
+    sm2_z256_mont_mul(T2, T1, Z1);
+    sm2_z256_mont_mul(T1, T1, x2);
+    sm2_z256_mont_mul(T2, T2, y2);
+    sm2_z256_modp_sub(T1, T1, X1);
+    sm2_z256_modp_sub(T2, T2, Y1);
+    if (sm2_z256_is_zero(T1)) {
+        if (sm2_z256_is_zero(T2)) {
+            memcpy(Q.X, x2, sizeof(Sm2Z256));
+            memcpy(Q.Y, y2, sizeof(Sm2Z256));
+            memcpy(Q.Z, SM2_Z256_MONT_ONE, sizeof(Sm2Z256));
+            sm2_z256_point_dbl(R, &Q);
+        }
+        else {
+            sm2_z256_point_set_infinity(R);
+        }
+        return;
+    }
+    sm2_z256_mont_mul(R->Z, Z1, T1);
+    sm2_z256_mont_sqr(T3, T1);
+    sm2_z256_mont_mul(T4, T3, T1);
+    sm2_z256_mont_mul(T3, T3, X1);
+    sm2_z256_modp_dbl(T1, T3);
+    sm2_z256_mont_sqr(R->X, T2);
+    sm2_z256_modp_sub(R->X, R->X, T1);
+    sm2_z256_modp_sub(R->X, R->X, T4);
+    sm2_z256_modp_sub(T3, T3, R->X);
+    sm2_z256_mont_mul(T3, T3, T2);
+    sm2_z256_mont_mul(T4, T4, Y1);
+    sm2_z256_modp_sub(R->Y, T3, T4);
+}
+
+/**
+ * 与 sm2_z256_point_add_affine 相同, 但不含与数据相关的分支:
+ * 总是按一般情况计算, 再用掩码选出 P 为无穷远点或 P 与第二个点相同时的结果
+ * (P 与第二个点互为相反数时一般公式得到的 Z = 0, 本身就是无穷远点)
+ */
+static void sm2_z256_point_add_affine_ct(Sm2Z256Point* R, const Sm2Z256Point* P, const Sm2Z256 x2, const Sm2Z256 y2)
+{
+    const uint64_t*     X1 = P->X;
+    const uint64_t*     Y1 = P->Y;
+    const uint64_t*     Z1 = P->Z;
+    uint64_t            inf;
+    uint64_t            equ;
+    Sm2Z256             T1;
+    Sm2Z256             T2;
+    Sm2Z256             T3;
+    Sm2Z256             T4;
+    Sm2Z256Point        S;
+    Sm2Z256Point        D;
+
+    sm2_z256_mont_sqr(T1, Z1);
+    sm2_z256_mont_mul(T2, T1, Z1);
+    sm2_z256_mont_mul(T1, T1, x2);
+    sm2_z256_mont_mul(T2, T2, y2);
+    sm2_z256_modp_sub(T1, T1, X1);
+    sm2_z256_modp_sub(T2, T2, Y1);
+    inf = sm2_z256_is_zero_mask(Z1);
+    equ = sm2_z256_is_zero_mask(T1) & sm2_z256_is_zero_mask(T2) & ~inf;
+
+    sm2_z256_mont_mul(S.Z, Z1, T1);
+    sm2_z256_mont_sqr(T3, T1);
+    sm2_z256_mont_mul(T4, T3, T1);
+    sm2_z256_mont_mul(T3, T3, X1);
+    sm2_z256_modp_dbl(T1, T3);
+    sm2_z256_mont_sqr(S.X, T2);
+    sm2_z256_modp_sub(S.X, S.X, T1);
+    sm2_z256_modp_sub(S.X, S.X, T4);
+    sm2_z256_modp_sub(T3, T3, S.X);
+    sm2_z256_mont_mul(T3, T3, T2);
+    sm2_z256_mont_mul(T4, T4, Y1);
+    sm2_z256_modp_sub(S.Y, T3, T4);
+
+    // P 为无穷远点: 结果是第二个点
+    sm2_z256_cmov(S.X, x2, inf);
+    sm2_z256_cmov(S.Y, y2, inf);
+    sm2_z256_cmov(S.Z, SM2_Z256_MONT_ONE, inf);
+
+    // P 与第二个点相同: 结果是第二个点的倍点, 与 sm2_z256_point_dbl 相同但 Z = 1
+    sm2_z256_mont_sqr(T1, x2);
+    sm2_z256_modp_sub(T1, T1, SM2_Z256_MONT_ONE);
+    sm2_z256_modp_tri(T1, T1);
+    sm2_z256_modp_dbl(D.Z, y2);
+    sm2_z256_mont_sqr(D.Y, D.Z);
+    sm2_z256_mont_mul(T3, D.Y, x2);
+    sm2_z256_mont_sqr(D.Y, D.Y);
+    sm2_z256_modp_div2(D.Y, D.Y);
+    sm2_z256_mont_sqr(D.X, T1);
+    sm2_z256_modp_dbl(T2, T3);
+    sm2_z256_modp_sub(D.X, D.X, T2);
+    sm2_z256_modp_sub(T2, T3, D.X);
+    sm2_z256_mont_mul(T2, T2, T1);
+    sm2_z256_modp_sub(D.Y, T2, D.Y);
+    sm2_z256_cmov(S.X, D.X, equ);
+    sm2_z256_cmov(S.Y, D.Y, equ);
+    sm2_z256_cmov(S.Z, D.Z, equ);
+
+    *R = S;
+}
+
+static int sm2_fp_rand(Sm2Fp r)
+{
+    if (sm2_bn_rand_range(r, SM2_P) != 1) {
+        // error_print();
+        return -1;
+    }
+    return 1;
+}
+
+static void sm2_fp_add(Sm2Fp r, const Sm2Fp a, const Sm2Fp b)
+{
+    sm2_bn_add(r, a, b);
+    if (sm2_bn_cmp(r, SM2_P) >= 0) {
         sm2_bn_sub(r, r, SM2_P);
     }
 }
 
+static void sm2_fp_neg(Sm2Fp r, const Sm2Fp a)
+{
+    if (sm2_bn_is_zero(a)) {
+        sm2_bn_copy(r, a);
+    }
+    else {
+        sm2_bn_sub(r, SM2_P, a);
+    }
+}
+
+static void sm2_fp_mul(Sm2Fp r, const Sm2Fp a, const Sm2Fp b)
+{
+    Sm2Z256 x;
+    Sm2Z256 y;
+
+    // a * b * R^-1 * R^2 * R^-1 = a * b
+    sm2_z256_from_bn(x, a);
+    sm2_z256_from_bn(y, b);
+    sm2_z256_mont_mul(x, x, y);
+    sm2_z256_mont_mul(x, x, SM2_Z256_RR);
+    sm2_z256_to_bn(r, x);
+}
+
 static void sm2_fp_sqr(Sm2Fp r, const Sm2Fp a)
 {
     sm2_fp_mul(r, a, a);
@@ -487,84 +998,6 @@ static void sm2_fp_exp(Sm2Fp r, const Sm2Fp a, const Sm2Fp e)
     sm2_bn_copy(r, t);
 }
 
-static void sm2_fp_inv(Sm2Fp r, const Sm2Fp a)
-{
-    Sm2BN a1;
-    Sm2BN a2;
-    Sm2BN a3;
-    Sm2BN a4;
-    Sm2BN a5;
-    int i;
-
-    sm2_fp_sqr(a1, a);
-    sm2_fp_mul(a2, a1, a);
-    sm2_fp_sqr(a3, a2);
-    sm2_fp_sqr(a3, a3);
-    sm2_fp_mul(a3, a3, a2);
-    sm2_fp_sqr(a4, a3);
-    sm2_fp_sqr(a4, a4);
-    sm2_fp_sqr(a4, a4);
-    sm2_fp_sqr(a4, a4);
-    sm2_fp_mul(a4, a4, a3);
-    sm2_fp_sqr(a5, a4);
-    for (i = 1; i < 8; i++)
-        sm2_fp_sqr(a5, a5);
-    sm2_fp_mul(a5, a5, a4);
-    for (i = 0; i < 8; i++)
-        sm2_fp_sqr(a5, a5);
-    sm2_fp_mul(a5, a5, a4);
-    for (i = 0; i < 4; i++)
-        sm2_fp_sqr(a5, a5);
-    sm2_fp_mul(a5, a5, a3);
-    sm2_fp_sqr(a5, a5);
-    sm2_fp_sqr(a5, a5);
-    sm2_fp_mul(a5, a5, a2);
-    sm2_fp_sqr(a5, a5);
-    sm2_fp_mul(a5, a5, a);
-    sm2_fp_sqr(a4, a5);
-    sm2_fp_mul(a3, a4, a1);
-    sm2_fp_sqr(a5, a4);
-    for (i = 1; i< 31; i++)
-        sm2_fp_sqr(a5, a5);
-    sm2_fp_mul(a4, a5, a4);
-    sm2_fp_sqr(a4, a4);
-    sm2_fp_mul(a4, a4, a);
-    sm2_fp_mul(a3, a4, a2);
-    for (i = 0; i < 33; i++)
-        sm2_fp_sqr(a5, a5);
-    sm2_fp_mul(a2, a5, a3);
-    sm2_fp_mul(a3, a2, a3);
-    for (i = 0; i < 32; i++)
-        sm2_fp_sqr(a5, a5);
-    sm2_fp_mul(a2, a5, a3);
-    sm2_fp_mul(a3, a2, a3);
-    sm2_fp_mul(a4, a2, a4);
-    for (i = 0; i < 32; i++)
-        sm2_fp_sqr(a5, a5);
-    sm2_fp_mul(a2, a5, a3);
-    sm2_fp_mul(a3, a2, a3);
-    sm2_fp_mul(a4, a2, a4);
-    for (i = 0; i < 32; i++)
-        sm2_fp_sqr(a5, a5);
-    sm2_fp_mul(a2, a5, a3);
-    sm2_fp_mul(a3, a2, a3);
-    sm2_fp_mul(a4, a2, a4);
-    for (i = 0; i < 32; i++)
-        sm2_fp_sqr(a5, a5);
-    sm2_fp_mul(a2, a5, a3);
-    sm2_fp_mul(a3, a2, a3);
-    sm2_fp_mul(a4, a2, a4);
-    for (i = 0; i < 32; i++)
-        sm2_fp_sqr(a5, a5);
-    sm2_fp_mul(r, a4, a5);
-
-    sm2_bn_clean(a1);
-    sm2_bn_clean(a2);
-    sm2_bn_clean(a3);
-    sm2_bn_clean(a4);
-    sm2_bn_clean(a5);
-}
-
 static int sm2_fp_sqrt(Sm2Fp r, const Sm2Fp a)
 {
     Sm2BN u;
@@ -822,6 +1255,18 @@ void c_sm2_jacobian_point_set_xy(Sm2JacobianPoint* R, const Sm2BN x, const Sm2BN
     sm2_bn_set_one(R->z);
 }
 
+void c_sm2_jacobian_point_set_infinity(Sm2JacobianPoint* R)
+{
+    c_sm2_jacobian_point_init(R);
+}
+
+void c_sm2_jacobian_point_copy(Sm2JacobianPoint* R, const Sm2JacobianPoint* P)
+{
+    if (R != P) {
+        memcpy(R, P, sizeof(Sm2JacobianPoint));
+    }
+}
+
 void c_sm2_jacobian_point_get_xy(const Sm2JacobianPoint* P, Sm2BN x, Sm2BN y)
 {
     if (sm2_bn_is_one(P->z)) {
@@ -831,15 +1276,16 @@ void c_sm2_jacobian_point_get_xy(const Sm2JacobianPoint* P, Sm2BN x, Sm2BN y)
         }
     }
     else {
-        Sm2BN zInv;
-        sm2_fp_inv(zInv, P->z);
-        if (y) {
-            sm2_fp_mul(y, P->y, zInv);
-        }
-        sm2_fp_sqr(zInv, zInv);
-        sm2_fp_mul(x, P->x, zInv);
+        Sm2Z256 x1;
+        Sm2Z256 y1;
+        Sm2Z256Point T;
+        sm2_z256_point_from_jacobian(&T, P);
+        sm2_z256_point_get_xy(&T, x1, y ? y1 : NULL);
+        sm2_z256_from_mont(x1, x1);
+        sm2_z256_to_bn(x, x1);
         if (y) {
-            sm2_fp_mul(y, y, zInv);
+            sm2_z256_from_mont(y1, y1);
+            sm2_z256_to_bn(y, y1);
         }
     }
 }
@@ -853,58 +1299,25 @@ void c_sm2_jacobian_point_neg(Sm2JacobianPoint* R, const Sm2JacobianPoint* P)
 
 void c_sm2_jacobian_point_dbl(Sm2JacobianPoint* R, const Sm2JacobianPoint* P)
 {
-    const uint64_t*     X1 = P->x;
-    const uint64_t*     Y1 = P->y;
-    const uint64_t*     Z1 = P->z;
-    Sm2BN               T1;
-    Sm2BN               T2;
-    Sm2BN               T3;
-    Sm2BN               X3;
-    Sm2BN               Y3;
-    Sm2BN               Z3;
+    Sm2Z256Point T;
 
     if (c_sm2_jacobian_point_is_at_infinity(P)) {
         c_sm2_jacobian_point_copy(R, P);
         return;
     }
 
-    sm2_fp_sqr(T1, Z1);        //printf("T1 = Z1^2    = "); print_bn(T1);
-    sm2_fp_sub(T2, X1, T1);    //printf("T2 = X1 - T1 = "); print_bn(T2);
-    sm2_fp_add(T1, X1, T1);    //printf("T1 = X1 + T1 = "); print_bn(T1);
-    sm2_fp_mul(T2, T2, T1);    //printf("T2 = T2 * T1 = "); print_bn(T2);
-    sm2_fp_tri(T2, T2);        //printf("T2 =  3 * T2 = "); print_bn(T2);
-    sm2_fp_dbl(Y3, Y1);        //printf("Y3 =  2 * Y1 = "); print_bn(Y3);
-    sm2_fp_mul(Z3, Y3, Z1);    //printf("Z3 = Y3 * Z1 = "); print_bn(Z3);
-    sm2_fp_sqr(Y3, Y3);        //printf("Y3 = Y3^2    = "); print_bn(Y3);
-    sm2_fp_mul(T3, Y3, X1);    //printf("T3 = Y3 * X1 = "); print_bn(T3);
-    sm2_fp_sqr(Y3, Y3);        //printf("Y3 = Y3^2    = "); print_bn(Y3);
-    sm2_fp_div2(Y3, Y3);    //printf("Y3 = Y3/2    = "); print_bn(Y3);
-    sm2_fp_sqr(X3, T2);        //printf("X3 = T2^2    = "); print_bn(X3);
-    sm2_fp_dbl(T1, T3);        //printf("T1 =  2 * T1 = "); print_bn(T1);
-    sm2_fp_sub(X3, X3, T1);    //printf("X3 = X3 - T1 = "); print_bn(X3);
-    sm2_fp_sub(T1, T3, X3);    //printf("T1 = T3 - X3 = "); print_bn(T1);
-    sm2_fp_mul(T1, T1, T2);    //printf("T1 = T1 * T2 = "); print_bn(T1);
-    sm2_fp_sub(Y3, T1, Y3);    //printf("Y3 = T1 - Y3 = "); print_bn(Y3);
-
-    sm2_bn_copy(R->x, X3);
-    sm2_bn_copy(R->y, Y3);
-    sm2_bn_copy(R->z, Z3);
+    sm2_z256_point_from_jacobian(&T, P);
+    sm2_z256_point_dbl(&T, &T);
+    sm2_z256_point_to_jacobian(R, &T);
 }
 
 void c_sm2_jacobian_point_add(Sm2JacobianPoint* R, const Sm2JacobianPoint* P, const Sm2JacobianPoint* Q)
 {
-    const uint64_t *X1 = P->x;
-    const uint64_t *Y1 = P->y;
-    const uint64_t *Z1 = P->z;
-    const uint64_t *x2 = Q->x;
-    const uint64_t *y2 = Q->y;
-    Sm2BN T1;
-    Sm2BN T2;
-    Sm2BN T3;
-    Sm2BN T4;
-    Sm2BN X3;
-    Sm2BN Y3;
-    Sm2BN Z3;
+    Sm2BN x;
+    Sm2BN y;
+    Sm2Z256 x2;
+    Sm2Z256 y2;
+    Sm2Z256Point T;
 
     if (c_sm2_jacobian_point_is_at_infinity(Q)) {
         c_sm2_jacobian_point_copy(R, P);
@@ -916,42 +1329,16 @@ void c_sm2_jacobian_point_add(Sm2JacobianPoint* R, const Sm2JacobianPoint* P, co
         return;
     }
 
-    if (!sm2_bn_is_one(Q->z)) { return; }
-
-    sm2_fp_sqr(T1, Z1);
-    sm2_fp_mul(T2, T1, Z1);
-    sm2_fp_mul(T1, T1, x2);
-    sm2_fp_mul(T2, T2, y2);
-    sm2_fp_sub(T1, T1, X1);
-    sm2_fp_sub(T2, T2, Y1);
-    if (sm2_bn_is_zero(T1)) {
-        if (sm2_bn_is_zero(T2)) {
-            Sm2JacobianPoint _Q, *Q = &_Q;
-            c_sm2_jacobian_point_set_xy(Q, x2, y2);
-            c_sm2_jacobian_point_dbl(R, Q);
-            return;
-        }
-        else {
-            c_sm2_jacobian_point_set_infinity(R);
-            return;
-        }
-    }
-    sm2_fp_mul(Z3, Z1, T1);
-    sm2_fp_sqr(T3, T1);
-    sm2_fp_mul(T4, T3, T1);
-    sm2_fp_mul(T3, T3, X1);
-    sm2_fp_dbl(T1, T3);
-    sm2_fp_sqr(X3, T2);
-    sm2_fp_sub(X3, X3, T1);
-    sm2_fp_sub(X3, X3, T4);
-    sm2_fp_sub(T3, T3, X3);
-    sm2_fp_mul(T3, T3, T2);
-    sm2_fp_mul(T4, T4, Y1);
-    sm2_fp_sub(Y3, T3, T4);
+    // 混合加法, Q 先转为仿射坐标
+    c_sm2_jacobian_point_get_xy(Q, x, y);
+    sm2_z256_from_bn(x2, x);
+    sm2_z256_from_bn(y2, y);
+    sm2_z256_to_mont(x2, x2);
+    sm2_z256_to_mont(y2, y2);
 
-    sm2_bn_copy(R->x, X3);
-    sm2_bn_copy(R->y, Y3);
-    sm2_bn_copy(R->z, Z3);
+    sm2_z256_point_from_jacobian(&T, P);
+    sm2_z256_point_add_affine(&T, &T, x2, y2);
+    sm2_z256_point_to_jacobian(R, &T);
 }
 
 void c_sm2_jacobian_point_sub(Sm2JacobianPoint* R, const Sm2JacobianPoint* P, const Sm2JacobianPoint* Q)
@@ -964,28 +1351,34 @@ void c_sm2_jacobian_point_sub(Sm2JacobianPoint* R, const Sm2JacobianPoint* P, co
 void c_sm2_jacobian_point_mul(Sm2JacobianPoint* R, const Sm2BN k, const Sm2JacobianPoint* P)
 {
     char bits[257] = {0};
-    Sm2JacobianPoint _Q, *Q = &_Q;
-    Sm2JacobianPoint _T, *T = &_T;
+    Sm2BN x;
+    Sm2BN y;
+    Sm2Z256 x1;
+    Sm2Z256 y1;
+    Sm2Z256Point Q;
     int i;
 
-    // FIXME: point_add need affine, so we can not use point_add
-    if (!sm2_bn_is_one(P->z)) {
-        Sm2BN x;
-        Sm2BN y;
-        c_sm2_jacobian_point_get_xy(P, x, y);
-        c_sm2_jacobian_point_set_xy(T, x, y);
-        P = T;
+    if (c_sm2_jacobian_point_is_at_infinity(P)) {
+        c_sm2_jacobian_point_set_infinity(R);
+        return;
     }
 
-    c_sm2_jacobian_point_set_infinity(Q);
+    // 整个计算在 Montgomery 域中进行, 只在首尾转换一次
+    c_sm2_jacobian_point_get_xy(P, x, y);
+    sm2_z256_from_bn(x1, x);
+    sm2_z256_from_bn(y1, y);
+    sm2_z256_to_mont(x1, x1);
+    sm2_z256_to_mont(y1, y1);
+
+    sm2_z256_point_set_infinity(&Q);
     sm2_bn_to_bits(k, bits);
     for (i = 0; i < 256; i++) {
-        c_sm2_jacobian_point_dbl(Q, Q);
+        sm2_z256_point_dbl(&Q, &Q);
         if (bits[i] == '1') {
-            c_sm2_jacobian_point_add(Q, Q, P);
+            sm2_z256_point_add_affine(&Q, &Q, x1, y1);
         }
     }
-    c_sm2_jacobian_point_copy(R, Q);
+    sm2_z256_point_to_jacobian(R, &Q);
 }
 
 void c_sm2_jacobian_point_to_bytes(const Sm2JacobianPoint* P, uint8_t out[64])
@@ -1006,7 +1399,42 @@ void c_sm2_jacobian_point_from_bytes(Sm2JacobianPoint* P, const uint8_t in[64])
 
 void c_sm2_jacobian_point_mul_generator(Sm2JacobianPoint* R, const Sm2BN k)
 {
-    c_sm2_jacobian_point_mul(R, k, SM2_G);
+    int i, j;
+    uint64_t sign, digit, mask;
+    Sm2Z256 k64;
+    Sm2Z256 x;
+    Sm2Z256 y;
+    Sm2Z256 t;
+    Sm2Z256Point Q;
+    Sm2Z256Point T;
+
+    // k * G = sum(d_i * 2^(5i) * G), 每个窗口只需一次查表和一次混合加法, 不需要倍点
+    sm2_z256_from_bn(k64, k);
+    sm2_z256_point_set_infinity(&Q);
+    for (i = 0; i < SM2_Z256_G_WINDOWS; i++) {
+        digit = sm2_z256_get_booth(k64, i, &sign);
+
+        // 遍历整个窗口, 按掩码取出 |d| 倍点, 访问模式与 d 无关
+        memset(x, 0, sizeof(x));
+        memset(y, 0, sizeof(y));
+        for (j = 0; j < SM2_Z256_G_WINDOW_SIZE; j++) {
+            mask = 0 - (((digit ^ (uint64_t) (j + 1)) - 1) >> 63);
+            sm2_z256_cmov(x, c_sm2_z256_g_table[i][j], mask);
+            sm2_z256_cmov(y, c_sm2_z256_g_table[i][j] + 4, mask);
+        }
+        sm2_z256_modp_neg(t, y);
+        sm2_z256_cmov(y, t, 0 - sign);
+
+        // d = 0 时同样计算加法, 只是不采用结果; Q 为无穷远点时也不提前返回, 每个窗口耗时相同
+        sm2_z256_point_add_affine_ct(&T, &Q, x, y);
+        mask = ((digit - 1) >> 63) - 1;
+        sm2_z256_cmov(Q.X, T.X, mask);
+        sm2_z256_cmov(Q.Y, T.Y, mask);
+        sm2_z256_cmov(Q.Z, T.Z, mask);
+    }
+    sm2_z256_point_to_jacobian(R, &Q);
+
+    memset(k64, 0, sizeof(k64));
 }
 
 void c_sm2_jacobian_point_mul_sum(Sm2JacobianPoint* R, const Sm2BN t, const Sm2JacobianPoint* P, const Sm2BN s)
@@ -1029,7 +1457,7 @@ void c_sm2_jacobian_point_mul_sum(Sm2JacobianPoint* R, const Sm2BN t, const Sm2J
 
 int c_sm2_jacobian_point_is_at_infinity(const Sm2JacobianPoint* P)
 {
-    return mem_is_zero((uint8_t *)P, sizeof(Sm2Point));
+    return mem_is_zero((const uint8_t *)P->z, sizeof(Sm2BN));
 }
 
 int c_sm2_jacobian_point_is_on_curve(const Sm2JacobianPoint* P)
@@ -59,6 +59,8 @@ typedef struct
 
 
 void c_sm2_jacobian_point_init          (Sm2JacobianPoint* R);
+void c_sm2_jacobian_point_set_infinity  (Sm2JacobianPoint* R);
+void c_sm2_jacobian_point_copy          (Sm2JacobianPoint* R, const Sm2JacobianPoint* P);
 void c_sm2_jacobian_point_set_xy        (Sm2JacobianPoint* R, const Sm2BN x, const Sm2BN y);
 void c_sm2_jacobian_point_get_xy        (const Sm2JacobianPoint* P, Sm2BN x, Sm2BN y);
 void c_sm2_jacobian_point_neg           (Sm2JacobianPoint* R, const Sm2JacobianPoint* P);
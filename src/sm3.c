@@ -21,6 +21,19 @@
  */
 #include "sm3.h"
 
+#include "utils-sys.h"
+
+#ifdef C_SYS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#ifndef __KERNEL_MODULE__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 
 #define IPAD    0x36
 #define OPAD    0x5C
@@ -184,6 +197,10 @@
 #define K62     0x9ea1e762U
 #define K63     0x3d43cec5U
 
+static const uint32_t gsSm3IV[C_SM3_STATE_WORDS] = {
+    0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600, 0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E,
+};
+
 static uint32_t K[64] = {
     K0,  K1,  K2,  K3,  K4,  K5,  K6,  K7,
     K8,  K9,  K10, K11, K12, K13, K14, K15,
@@ -213,7 +230,7 @@ static uint32_t K[64] = {
     */
 };
 
-static void c_sm3_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
+static void sm3_compress_blocks_generic(uint32_t digest[8], const uint8_t *data, size_t blocks)
 {
     uint32_t A;
     uint32_t B;
@@ -269,26 +286,485 @@ static void c_sm3_compress_blocks(uint32_t digest[8], const uint8_t *data, size_
     }
 }
 
-void c_sm3_hmac_init(Sm3HMACContext* ctx, const uint8_t* key, size_t keyLen)
+#ifdef C_SYS_X86_SIMD
+/**
+ * SIMD 实现: 消息扩展每次用向量算出 4 个 W, 同时得到 W' = W[j] ^ W[j + 4], 并与压缩轮交错进行
+ *
+ * W[j] = P1(W[j-16] ^ W[j-9] ^ (W[j-3] <<< 15)) ^ (W[j-13] <<< 7) ^ W[j-6]
+ * 第 4 个字依赖同一组的第 1 个字(W[j+3] 用到 W[j]), 先按 0 计算, 再利用 P1 的线性补上 P1(W[j] <<< 15)
+ */
+#define SM3_RW(A, B, C, D, E, F, G, H, xx) \
+    SS1 = ROL32((ROL32(A, 12) + E + K[j]), 7); \
+    SS2 = SS1 ^ ROL32(A, 12); \
+    TT1 = FF##xx(A, B, C) + D + SS2 + WP[j]; \
+    TT2 = GG##xx(E, F, G) + H + SS1 + W[j]; \
+    B = ROL32(B, 9); \
+    H = TT1; \
+    F = ROL32(F, 19); \
+    D = P0(TT2); \
+    j++
+
+// R8 的前 4 轮和后 4 轮, 中间插入消息扩展
+#define SM3_RW4A(xx) \
+    SM3_RW(A, B, C, D, E, F, G, H, xx); \
+    SM3_RW(H, A, B, C, D, E, F, G, xx); \
+    SM3_RW(G, H, A, B, C, D, E, F, xx); \
+    SM3_RW(F, G, H, A, B, C, D, E, xx)
+
+#define SM3_RW4B(xx) \
+    SM3_RW(E, F, G, H, A, B, C, D, xx); \
+    SM3_RW(D, E, F, G, H, A, B, C, xx); \
+    SM3_RW(C, D, E, F, G, H, A, B, xx); \
+    SM3_RW(B, C, D, E, F, G, H, A, xx)
+
+// 64 轮: 第 g 组(4 轮)之前先扩展出第 g + 4 组 W, 保证 W' 提前就绪
+#define SM3_ROUNDS_EXPAND(EXPAND) \
+    EXPAND( 4); SM3_RW4A(00); EXPAND( 5); SM3_RW4B(00); \
+    EXPAND( 6); SM3_RW4A(00); EXPAND( 7); SM3_RW4B(00); \
+    EXPAND( 8); SM3_RW4A(16); EXPAND( 9); SM3_RW4B(16); \
+    EXPAND(10); SM3_RW4A(16); EXPAND(11); SM3_RW4B(16); \
+    EXPAND(12); SM3_RW4A(16); EXPAND(13); SM3_RW4B(16); \
+    EXPAND(14); SM3_RW4A(16); EXPAND(15); SM3_RW4B(16); \
+    EXPAND(16); SM3_RW4A(16); SM3_RW4B(16); SM3_RW4A(16); SM3_RW4B(16)
+
+#define SM3_ROUNDS_ONLY() \
+    SM3_RW4A(00); SM3_RW4B(00); SM3_RW4A(00); SM3_RW4B(00); \
+    SM3_RW4A(16); SM3_RW4B(16); SM3_RW4A(16); SM3_RW4B(16); \
+    SM3_RW4A(16); SM3_RW4B(16); SM3_RW4A(16); SM3_RW4B(16); \
+    SM3_RW4A(16); SM3_RW4B(16); SM3_RW4A(16); SM3_RW4B(16)
+
+#define SM3_LOAD_STATE() \
+    A = digest[0]; B = digest[1]; C = digest[2]; D = digest[3]; \
+    E = digest[4]; F = digest[5]; G = digest[6]; H = digest[7]; \
+    j = 0
+
+#define SM3_STORE_STATE() \
+    digest[0] ^= A; digest[1] ^= B; digest[2] ^= C; digest[3] ^= D; \
+    digest[4] ^= E; digest[5] ^= F; digest[6] ^= G; digest[7] ^= H
+
+#define SM3_SSE_ROL(x, n)       _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - (n)))
+#define SM3_SSE_P1(x)           _mm_xor_si128(_mm_xor_si128(x, SM3_SSE_ROL(x, 15)), SM3_SSE_ROL(x, 23))
+
+#define SM3_AVX2_ROL(x, n)      _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - (n)))
+#define SM3_AVX2_P1(x)          _mm256_xor_si256(_mm256_xor_si256(x, SM3_AVX2_ROL(x, 15)), SM3_AVX2_ROL(x, 23))
+
+/**
+ * x0..x3 依次为 W[j-16..j-1], 返回 W[j..j+3]
+ */
+C_SYS_TARGET("ssse3")
+static __m128i sm3_sse_expand(__m128i x0, __m128i x1, __m128i x2, __m128i x3)
+{
+    __m128i t, r;
+    const __m128i w13 = _mm_alignr_epi8(x1, x0, 12);   // W[j-13..j-10]
+    const __m128i w9 = _mm_alignr_epi8(x2, x1, 12);    // W[j-9..j-6]
+    const __m128i w6 = _mm_alignr_epi8(x3, x2, 8);     // W[j-6..j-3]
+    const __m128i w3 = _mm_srli_si128(x3, 4);          // W[j-3..j-1], 0
+
+    t = _mm_xor_si128(_mm_xor_si128(x0, w9), SM3_SSE_ROL(w3, 15));
+    r = _mm_xor_si128(_mm_xor_si128(SM3_SSE_P1(t), SM3_SSE_ROL(w13, 7)), w6);
+
+    // 补上第 4 个字中 W[j] 的贡献
+    t = SM3_SSE_ROL(_mm_slli_si128(r, 12), 15);
+
+    return _mm_xor_si128(r, SM3_SSE_P1(t));
+}
+
+#define SM3_SSE_EXPAND(g) \
+    t = sm3_sse_expand(x0, x1, x2, x3); \
+    _mm_store_si128((__m128i*) (W + 4 * (g)), t); \
+    _mm_store_si128((__m128i*) (WP + 4 * (g) - 4), _mm_xor_si128(x3, t)); \
+    x0 = x1; x1 = x2; x2 = x3; x3 = t
+
+C_SYS_TARGET("ssse3")
+static void sm3_compress_blocks_sse(uint32_t digest[8], const uint8_t* data, size_t blocks)
+{
+    int j;
+    uint32_t A, B, C, D, E, F, G, H;
+    uint32_t SS1, SS2, TT1, TT2;
+    uint32_t W[68] C_ALIGNED(16);
+    uint32_t WP[64] C_ALIGNED(16);
+    __m128i x0, x1, x2, x3, t;
+    const __m128i bswap = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+    for (; blocks > 0; blocks--, data += C_SM3_BLOCK_SIZE) {
+        SM3_LOAD_STATE();
+
+        x0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (data +  0)), bswap);
+        x1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (data + 16)), bswap);
+        x2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (data + 32)), bswap);
+        x3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (data + 48)), bswap);
+        _mm_store_si128((__m128i*) (W +  0), x0);
+        _mm_store_si128((__m128i*) (W +  4), x1);
+        _mm_store_si128((__m128i*) (W +  8), x2);
+        _mm_store_si128((__m128i*) (W + 12), x3);
+        _mm_store_si128((__m128i*) (WP + 0), _mm_xor_si128(x0, x1));
+        _mm_store_si128((__m128i*) (WP + 4), _mm_xor_si128(x1, x2));
+        _mm_store_si128((__m128i*) (WP + 8), _mm_xor_si128(x2, x3));
+
+        SM3_ROUNDS_EXPAND(SM3_SSE_EXPAND);
+        SM3_STORE_STATE();
+    }
+}
+
+/**
+ * AVX2: 两个 128 位通道分别扩展相邻两个分组的消息(扩展与链接值无关), 压缩仍逐个分组进行
+ */
+C_SYS_TARGET("avx2")
+static __m256i sm3_avx2_expand(__m256i x0, __m256i x1, __m256i x2, __m256i x3)
+{
+    __m256i t, r;
+    const __m256i w13 = _mm256_alignr_epi8(x1, x0, 12);
+    const __m256i w9 = _mm256_alignr_epi8(x2, x1, 12);
+    const __m256i w6 = _mm256_alignr_epi8(x3, x2, 8);
+    const __m256i w3 = _mm256_srli_si256(x3, 4);
+
+    t = _mm256_xor_si256(_mm256_xor_si256(x0, w9), SM3_AVX2_ROL(w3, 15));
+    r = _mm256_xor_si256(_mm256_xor_si256(SM3_AVX2_P1(t), SM3_AVX2_ROL(w13, 7)), w6);
+    t = SM3_AVX2_ROL(_mm256_slli_si256(r, 12), 15);
+
+    return _mm256_xor_si256(r, SM3_AVX2_P1(t));
+}
+
+#define SM3_AVX2_STORE(g, w, wp) \
+    _mm_store_si128((__m128i*) (Wb[0] + 4 * (g)), _mm256_castsi256_si128(w)); \
+    _mm_store_si128((__m128i*) (Wb[1] + 4 * (g)), _mm256_extracti128_si256(w, 1)); \
+    if ((g) > 0) { \
+        _mm_store_si128((__m128i*) (WPb[0] + 4 * (g) - 4), _mm256_castsi256_si128(wp)); \
+        _mm_store_si128((__m128i*) (WPb[1] + 4 * (g) - 4), _mm256_extracti128_si256(wp, 1)); \
+    }
+
+#define SM3_AVX2_EXPAND(g) \
+    t = sm3_avx2_expand(x0, x1, x2, x3); \
+    SM3_AVX2_STORE(g, t, _mm256_xor_si256(x3, t)); \
+    x0 = x1; x1 = x2; x2 = x3; x3 = t
+
+#define SM3_AVX2_LOAD(i) \
+    _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256( \
+        _mm_loadu_si128((const __m128i*) (data + 16 * (i)))), \
+        _mm_loadu_si128((const __m128i*) (data + C_SM3_BLOCK_SIZE + 16 * (i))), 1), bswap)
+
+C_SYS_TARGET("avx2")
+static void sm3_compress_blocks_avx2(uint32_t digest[8], const uint8_t* data, size_t blocks)
+{
+    int j;
+    uint32_t A, B, C, D, E, F, G, H;
+    uint32_t SS1, SS2, TT1, TT2;
+    uint32_t Wb[2][68] C_ALIGNED(16);
+    uint32_t WPb[2][64] C_ALIGNED(16);
+    uint32_t* W = NULL;
+    uint32_t* WP = NULL;
+    __m256i x0, x1, x2, x3, t;
+    const __m256i bswap = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+                                          12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+    for (; blocks >= 2; blocks -= 2, data += 2 * C_SM3_BLOCK_SIZE) {
+        x0 = SM3_AVX2_LOAD(0);
+        x1 = SM3_AVX2_LOAD(1);
+        x2 = SM3_AVX2_LOAD(2);
+        x3 = SM3_AVX2_LOAD(3);
+        SM3_AVX2_STORE(0, x0, x0);
+        SM3_AVX2_STORE(1, x1, _mm256_xor_si256(x0, x1));
+        SM3_AVX2_STORE(2, x2, _mm256_xor_si256(x1, x2));
+        SM3_AVX2_STORE(3, x3, _mm256_xor_si256(x2, x3));
+
+        // 第一个分组的压缩与两个分组的消息扩展交错, 第二个分组直接使用扩展结果
+        W = Wb[0];
+        WP = WPb[0];
+        SM3_LOAD_STATE();
+        SM3_ROUNDS_EXPAND(SM3_AVX2_EXPAND);
+        SM3_STORE_STATE();
+
+        W = Wb[1];
+        WP = WPb[1];
+        SM3_LOAD_STATE();
+        SM3_ROUNDS_ONLY();
+        SM3_STORE_STATE();
+    }
+    if (blocks > 0) {
+        sm3_compress_blocks_sse(digest, data, blocks);
+    }
+}
+#endif
+
+static void c_sm3_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
+{
+#ifdef C_SYS_X86_SIMD
+    uint32_t f = c_utils_sys_get_cpu_features();
+
+    if (C_FLAG_ON(f, C_SYS_CPU_AVX2) && blocks >= 2) {
+        sm3_compress_blocks_avx2(digest, data, blocks);
+        return;
+    }
+    if (C_FLAG_ON(f, C_SYS_CPU_SSSE3)) {
+        sm3_compress_blocks_sse(digest, data, blocks);
+        return;
+    }
+#endif
+    sm3_compress_blocks_generic(digest, data, blocks);
+}
+
+#ifdef C_SYS_X86_SIMD
+/**
+ * 多缓冲区压缩: 每个通道处理一条独立的消息, 链接值按字交错存放(state[字][通道]),
+ * 消息分组先转置为 M[字][通道] 再载入向量, 之后与单条消息的压缩过程完全相同
+ */
+#define SM3_MB_P0(x)            SM3_MB_XOR3(x, SM3_MB_ROL(x, 9), SM3_MB_ROL(x, 17))
+#define SM3_MB_P1(x)            SM3_MB_XOR3(x, SM3_MB_ROL(x, 15), SM3_MB_ROL(x, 23))
+
+#define SM3_MB_ROUND(FF, GG) \
+    SS1 = SM3_MB_ROL(SM3_MB_ADD(SM3_MB_ADD(SM3_MB_ROL(A, 12), E), SM3_MB_SET1(K[j])), 7); \
+    SS2 = SM3_MB_XOR(SS1, SM3_MB_ROL(A, 12)); \
+    TT1 = SM3_MB_ADD(SM3_MB_ADD(FF(A, B, C), D), SM3_MB_ADD(SS2, SM3_MB_XOR(W[j], W[j + 4]))); \
+    TT2 = SM3_MB_ADD(SM3_MB_ADD(GG(E, F, G), H), SM3_MB_ADD(SS1, W[j])); \
+    D = C; C = SM3_MB_ROL(B, 9); B = A; A = TT1; \
+    H = G; G = SM3_MB_ROL(F, 19); F = E; E = SM3_MB_P0(TT2)
+
+#define SM3_MB_DEFINE(name, isa, V, LANES) \
+C_SYS_TARGET(isa) \
+static void name##_words(uint32_t st[C_SM3_STATE_WORDS][C_SM3_MB_MAX_LANES], const uint32_t M[16][C_SM3_MB_MAX_LANES]) \
+{ \
+    int i, j; \
+    V A, B, C, D, E, F, G, H; \
+    V SS1, SS2, TT1, TT2; \
+    V W[68]; \
+    for (i = 0; i < 16; i++) { \
+        W[i] = SM3_MB_LOAD(M[i]); \
+    } \
+    for (; i < 68; i++) { \
+        W[i] = SM3_MB_XOR3(SM3_MB_P1(SM3_MB_XOR3(W[i - 16], W[i - 9], SM3_MB_ROL(W[i - 3], 15))), \
+                           SM3_MB_ROL(W[i - 13], 7), W[i - 6]); \
+    } \
+    A = SM3_MB_LOAD(st[0]); B = SM3_MB_LOAD(st[1]); C = SM3_MB_LOAD(st[2]); D = SM3_MB_LOAD(st[3]); \
+    E = SM3_MB_LOAD(st[4]); F = SM3_MB_LOAD(st[5]); G = SM3_MB_LOAD(st[6]); H = SM3_MB_LOAD(st[7]); \
+    for (j = 0; j < 16; j++) { \
+        SM3_MB_ROUND(SM3_MB_XOR3, SM3_MB_XOR3); \
+    } \
+    for (; j < 64; j++) { \
+        SM3_MB_ROUND(SM3_MB_FF16, SM3_MB_GG16); \
+    } \
+    SM3_MB_STORE(st[0], SM3_MB_XOR(A, SM3_MB_LOAD(st[0]))); \
+    SM3_MB_STORE(st[1], SM3_MB_XOR(B, SM3_MB_LOAD(st[1]))); \
+    SM3_MB_STORE(st[2], SM3_MB_XOR(C, SM3_MB_LOAD(st[2]))); \
+    SM3_MB_STORE(st[3], SM3_MB_XOR(D, SM3_MB_LOAD(st[3]))); \
+    SM3_MB_STORE(st[4], SM3_MB_XOR(E, SM3_MB_LOAD(st[4]))); \
+    SM3_MB_STORE(st[5], SM3_MB_XOR(F, SM3_MB_LOAD(st[5]))); \
+    SM3_MB_STORE(st[6], SM3_MB_XOR(G, SM3_MB_LOAD(st[6]))); \
+    SM3_MB_STORE(st[7], SM3_MB_XOR(H, SM3_MB_LOAD(st[7]))); \
+} \
+C_SYS_TARGET(isa) \
+static void name(uint32_t st[C_SM3_STATE_WORDS][C_SM3_MB_MAX_LANES], const uint8_t* const p[], size_t blocks) \
+{ \
+    int i, l; \
+    size_t n; \
+    uint32_t M[16][C_SM3_MB_MAX_LANES] C_ALIGNED(64); \
+    for (n = 0; n < blocks; n++) { \
+        for (i = 0; i < 16; i++) { \
+            for (l = 0; l < (LANES); l++) { \
+                M[i][l] = GETU32(p[l] + n * C_SM3_BLOCK_SIZE + 4 * i); \
+            } \
+        } \
+        name##_words(st, (const uint32_t (*)[C_SM3_MB_MAX_LANES]) M); \
+    } \
+}
+
+// SSE2: 4 路
+#define SM3_MB_LOAD(m)          _mm_load_si128((const __m128i*) (m))
+#define SM3_MB_STORE(m, x)      _mm_store_si128((__m128i*) (m), x)
+#define SM3_MB_SET1(k)          _mm_set1_epi32((int) (k))
+#define SM3_MB_ADD(a, b)        _mm_add_epi32(a, b)
+#define SM3_MB_XOR(a, b)        _mm_xor_si128(a, b)
+#define SM3_MB_XOR3(a, b, c)    _mm_xor_si128(_mm_xor_si128(a, b), c)
+#define SM3_MB_ROL(x, n)        _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - (n)))
+#define SM3_MB_FF16(x, y, z)    _mm_or_si128(_mm_and_si128(x, y), _mm_and_si128(_mm_or_si128(x, y), z))
+#define SM3_MB_GG16(x, y, z)    _mm_xor_si128(_mm_and_si128(_mm_xor_si128(y, z), x), z)
+SM3_MB_DEFINE(sm3_mb_compress_sse2, "sse2", __m128i, 4)
+#undef SM3_MB_LOAD
+#undef SM3_MB_STORE
+#undef SM3_MB_SET1
+#undef SM3_MB_ADD
+#undef SM3_MB_XOR
+#undef SM3_MB_XOR3
+#undef SM3_MB_ROL
+#undef SM3_MB_FF16
+#undef SM3_MB_GG16
+
+// AVX2: 8 路
+#define SM3_MB_LOAD(m)          _mm256_load_si256((const __m256i*) (m))
+#define SM3_MB_STORE(m, x)      _mm256_store_si256((__m256i*) (m), x)
+#define SM3_MB_SET1(k)          _mm256_set1_epi32((int) (k))
+#define SM3_MB_ADD(a, b)        _mm256_add_epi32(a, b)
+#define SM3_MB_XOR(a, b)        _mm256_xor_si256(a, b)
+#define SM3_MB_XOR3(a, b, c)    _mm256_xor_si256(_mm256_xor_si256(a, b), c)
+#define SM3_MB_ROL(x, n)        _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - (n)))
+#define SM3_MB_FF16(x, y, z)    _mm256_or_si256(_mm256_and_si256(x, y), _mm256_and_si256(_mm256_or_si256(x, y), z))
+#define SM3_MB_GG16(x, y, z)    _mm256_xor_si256(_mm256_and_si256(_mm256_xor_si256(y, z), x), z)
+SM3_MB_DEFINE(sm3_mb_compress_avx2, "avx2", __m256i, 8)
+#undef SM3_MB_LOAD
+#undef SM3_MB_STORE
+#undef SM3_MB_SET1
+#undef SM3_MB_ADD
+#undef SM3_MB_XOR
+#undef SM3_MB_XOR3
+#undef SM3_MB_ROL
+#undef SM3_MB_FF16
+#undef SM3_MB_GG16
+
+// AVX-512: 16 路, 三输入逻辑运算用 vpternlogd
+#define SM3_MB_LOAD(m)          _mm512_load_si512((const void*) (m))
+#define SM3_MB_STORE(m, x)      _mm512_store_si512((void*) (m), x)
+#define SM3_MB_SET1(k)          _mm512_set1_epi32((int) (k))
+#define SM3_MB_ADD(a, b)        _mm512_add_epi32(a, b)
+#define SM3_MB_XOR(a, b)        _mm512_xor_si512(a, b)
+#define SM3_MB_XOR3(a, b, c)    _mm512_ternarylogic_epi32(a, b, c, 0x96)
+#define SM3_MB_ROL(x, n)        _mm512_rol_epi32(x, n)
+#define SM3_MB_FF16(x, y, z)    _mm512_ternarylogic_epi32(x, y, z, 0xe8)
+#define SM3_MB_GG16(x, y, z)    _mm512_ternarylogic_epi32(x, y, z, 0xca)
+SM3_MB_DEFINE(sm3_mb_compress_avx512, "avx512f", __m512i, 16)
+#undef SM3_MB_LOAD
+#undef SM3_MB_STORE
+#undef SM3_MB_SET1
+#undef SM3_MB_ADD
+#undef SM3_MB_XOR
+#undef SM3_MB_XOR3
+#undef SM3_MB_ROL
+#undef SM3_MB_FF16
+#undef SM3_MB_GG16
+#endif
+
+typedef void (*Sm3MbWordsFunc) (uint32_t st[C_SM3_STATE_WORDS][C_SM3_MB_MAX_LANES], const uint32_t M[16][C_SM3_MB_MAX_LANES]);
+
+/**
+ * 单通道: 只压缩第 0 个通道
+ */
+static void sm3_mb_words_generic(uint32_t st[C_SM3_STATE_WORDS][C_SM3_MB_MAX_LANES], const uint32_t M[16][C_SM3_MB_MAX_LANES])
 {
     int i;
+    uint8_t block[C_SM3_BLOCK_SIZE];
+    uint32_t digest[C_SM3_STATE_WORDS];
+
+    for (i = 0; i < 16; i++) {
+        PUTU32(block + 4 * i, M[i][0]);
+    }
+    for (i = 0; i < C_SM3_STATE_WORDS; i++) {
+        digest[i] = st[i][0];
+    }
+    c_sm3_compress_blocks(digest, block, 1);
+    for (i = 0; i < C_SM3_STATE_WORDS; i++) {
+        st[i][0] = digest[i];
+    }
+}
+
+/**
+ * 压缩已经转置好的一个分组(M[字][通道]), 用于消息本身就是字的场景(如 PBKDF2 的迭代)
+ */
+static Sm3MbWordsFunc sm3_mb_words_func(uint32_t lanes)
+{
+    switch (lanes) {
+#ifdef C_SYS_X86_SIMD
+        case 16: {
+            return sm3_mb_compress_avx512_words;
+        }
+        case 8: {
+            return sm3_mb_compress_avx2_words;
+        }
+        case 4: {
+            return sm3_mb_compress_sse2_words;
+        }
+#endif
+        default: {
+            break;
+        }
+    }
+
+    return sm3_mb_words_generic;
+}
+
+static void sm3_mb_compress(uint32_t state[][HASH_MB_MAX_LANES], uint32_t lanes, const uint8_t* const p[], size_t blocks)
+{
+    int i;
+    uint32_t digest[C_SM3_STATE_WORDS];
+
+#ifdef C_SYS_X86_SIMD
+    switch (lanes) {
+        case 16: {
+            sm3_mb_compress_avx512(state, p, blocks);
+            return;
+        }
+        case 8: {
+            sm3_mb_compress_avx2(state, p, blocks);
+            return;
+        }
+        case 4: {
+            sm3_mb_compress_sse2(state, p, blocks);
+            return;
+        }
+        default: {
+            break;
+        }
+    }
+#endif
+
+    // 单通道
+    for (i = 0; i < C_SM3_STATE_WORDS; i++) {
+        digest[i] = state[i][0];
+    }
+    c_sm3_compress_blocks(digest, p[0], blocks);
+    for (i = 0; i < C_SM3_STATE_WORDS; i++) {
+        state[i][0] = digest[i];
+    }
+}
+
+static const HashMbAlgo gsSm3MbAlgo = { sm3_mb_compress, C_SM3_STATE_WORDS, true };
+
+/**
+ * 从已吸收一个分组(ipad 或 opad)后的链接值继续
+ */
+static void sm3_hmac_restore(Sm3Context* ctx, const uint32_t state[C_SM3_STATE_WORDS])
+{
+    memcpy(ctx->digest, state, C_SM3_STATE_WORDS * sizeof(uint32_t));
+    ctx->nBlocks = 1;
+    ctx->num = 0;
+}
+
+void c_sm3_hmac_key_setup(Sm3HMACKey* hk, const uint8_t* key, size_t keyLen)
+{
+    int i;
+    uint8_t block[C_SM3_BLOCK_SIZE];
 
     if (keyLen <= C_SM3_BLOCK_SIZE) {
-        memcpy(ctx->key, key, keyLen);
-        memset(ctx->key + keyLen, 0, C_SM3_BLOCK_SIZE - keyLen);
+        memcpy(block, key, keyLen);
+        memset(block + keyLen, 0, C_SM3_BLOCK_SIZE - keyLen);
     }
     else {
-        c_sm3_init(&ctx->sm3Ctx);
-        c_sm3_update(&ctx->sm3Ctx, key, keyLen);
-        c_sm3_finish(&ctx->sm3Ctx, ctx->key);
-        memset(ctx->key + C_SM3_DIGEST_SIZE, 0, C_SM3_BLOCK_SIZE - C_SM3_DIGEST_SIZE);
+        c_sm3_digest(key, keyLen, block);
+        memset(block + C_SM3_DIGEST_SIZE, 0, C_SM3_BLOCK_SIZE - C_SM3_DIGEST_SIZE);
     }
+
     for (i = 0; i < C_SM3_BLOCK_SIZE; i++) {
-        ctx->key[i] ^= IPAD;
+        block[i] ^= IPAD;
     }
+    memcpy(hk->ipad, gsSm3IV, sizeof(gsSm3IV));
+    c_sm3_compress_blocks(hk->ipad, block, 1);
 
-    c_sm3_init(&ctx->sm3Ctx);
-    c_sm3_update(&ctx->sm3Ctx, ctx->key, C_SM3_BLOCK_SIZE);
+    for (i = 0; i < C_SM3_BLOCK_SIZE; i++) {
+        block[i] ^= (IPAD ^ OPAD);
+    }
+    memcpy(hk->opad, gsSm3IV, sizeof(gsSm3IV));
+    c_sm3_compress_blocks(hk->opad, block, 1);
+
+    memset(block, 0, sizeof(block));
+}
+
+void c_sm3_hmac_init_key(Sm3HMACContext* ctx, const Sm3HMACKey* hk)
+{
+    ctx->key = *hk;
+    sm3_hmac_restore(&ctx->sm3Ctx, hk->ipad);
+}
+
+void c_sm3_hmac_init(Sm3HMACContext* ctx, const uint8_t* key, size_t keyLen)
+{
+    c_sm3_hmac_key_setup(&ctx->key, key, keyLen);
+    sm3_hmac_restore(&ctx->sm3Ctx, ctx->key.ipad);
 }
 
 void c_sm3_hmac_update(Sm3HMACContext* ctx, const uint8_t* data, size_t dataLen)
@@ -298,14 +774,8 @@ void c_sm3_hmac_update(Sm3HMACContext* ctx, const uint8_t* data, size_t dataLen)
 
 void c_sm3_hmac_finish(Sm3HMACContext* ctx, uint8_t mac[32])
 {
-    int i;
-    for (i = 0; i < C_SM3_BLOCK_SIZE; i++) {
-        ctx->key[i] ^= (IPAD ^ OPAD);
-    }
-
     c_sm3_finish(&ctx->sm3Ctx, mac);
-    c_sm3_init(&ctx->sm3Ctx);
-    c_sm3_update(&ctx->sm3Ctx, ctx->key, C_SM3_BLOCK_SIZE);
+    sm3_hmac_restore(&ctx->sm3Ctx, ctx->key.opad);
     c_sm3_update(&ctx->sm3Ctx, mac, C_SM3_DIGEST_SIZE);
     c_sm3_finish(&ctx->sm3Ctx, mac);
     memset(ctx, 0, sizeof(*ctx));
@@ -319,10 +789,68 @@ void c_sm3_hmac(const uint8_t* key, size_t keyLen, const uint8_t* data, size_t d
     c_sm3_hmac_finish(&ctx, mac);
 }
 
+void c_sm3_hmac_with_key(const Sm3HMACKey* hk, const uint8_t* data, size_t dataLen, uint8_t mac[32])
+{
+    Sm3HMACContext ctx;
+    c_sm3_hmac_init_key(&ctx, hk);
+    c_sm3_hmac_update(&ctx, data, dataLen);
+    c_sm3_hmac_finish(&ctx, mac);
+}
+
+/**
+ * 计算从 counter 开始的 n 个(不超过通道数)输出块: 各块的前缀相同, 只有计数器不同,
+ * 所以从同一个链接值出发, 把各自的最后一两个分组放在多缓冲区的不同通道中同时压缩
+ */
+static void sm3_kdf_blocks(const Sm3KDFContext* ctx, uint32_t counter, uint32_t n, uint8_t* out)
+{
+    int w;
+    uint32_t b, l, lanes = c_hash_mb_lanes();
+    uint32_t num = ctx->sm3Ctx.num & 0x3f;
+    uint32_t tailBlocks = (num + 4 <= C_SM3_BLOCK_SIZE - 9) ? 1 : 2;
+    uint64_t bits = (ctx->sm3Ctx.nBlocks * C_SM3_BLOCK_SIZE + num + 4) << 3;
+    uint8_t tail[2 * C_SM3_BLOCK_SIZE];
+    uint32_t st[C_SM3_STATE_WORDS][C_SM3_MB_MAX_LANES] C_ALIGNED(64);
+    uint32_t M[16][C_SM3_MB_MAX_LANES] C_ALIGNED(64);
+    Sm3MbWordsFunc words = sm3_mb_words_func(lanes);
+
+    // 与 c_sm3_finish 相同的填充, 计数器之外的部分对所有块都一样
+    memset(tail, 0, sizeof(tail));
+    memcpy(tail, ctx->sm3Ctx.block, num);
+    tail[num + 4] = 0x80;
+    PUTU64(tail + tailBlocks * C_SM3_BLOCK_SIZE - 8, bits);
+
+    for (w = 0; w < C_SM3_STATE_WORDS; w++) {
+        for (l = 0; l < lanes; l++) {
+            st[w][l] = ctx->sm3Ctx.digest[w];
+        }
+    }
+    for (b = 0; b < tailBlocks; b++) {
+        for (l = 0; l < lanes; l++) {
+            PUTU32(tail + num, counter + C_MIN(l, n - 1));
+            for (w = 0; w < 16; w++) {
+                M[w][l] = GETU32(tail + b * C_SM3_BLOCK_SIZE + 4 * w);
+            }
+        }
+        words(st, (const uint32_t (*)[C_SM3_MB_MAX_LANES]) M);
+    }
+
+    for (l = 0; l < n; l++) {
+        for (w = 0; w < C_SM3_STATE_WORDS; w++) {
+            PUTU32(out + l * C_SM3_DIGEST_SIZE + 4 * w, st[w][l]);
+        }
+    }
+
+    memset(tail, 0, sizeof(tail));
+    memset(st, 0, sizeof(st));
+    memset(M, 0, sizeof(M));
+}
+
 void c_sm3_kdf_init(Sm3KDFContext* ctx, size_t outLen)
 {
     c_sm3_init(&ctx->sm3Ctx);
     ctx->outLen = outLen;
+    ctx->counter = 1;
+    ctx->bufPos = C_SM3_DIGEST_SIZE;
 }
 
 void c_sm3_kdf_update(Sm3KDFContext* ctx, const uint8_t* data, size_t dataLen)
@@ -330,31 +858,57 @@ void c_sm3_kdf_update(Sm3KDFContext* ctx, const uint8_t* data, size_t dataLen)
     c_sm3_update(&ctx->sm3Ctx, data, dataLen);
 }
 
-void c_sm3_kdf_finish(Sm3KDFContext* ctx, uint8_t* out)
+bool c_sm3_kdf_read(Sm3KDFContext* ctx, uint8_t* out, size_t outLen)
 {
-    Sm3Context sm3Ctx;
-    size_t outlen = ctx->outLen;
-    uint8_t counterBE[4];
-    uint8_t dgst[C_SM3_DIGEST_SIZE];
-    uint32_t counter = 1;
     size_t len;
+    uint32_t n, lanes = c_hash_mb_lanes();
+    uint64_t avail = 0;
 
-    while (outlen) {
-        PUTU32(counterBE, counter);
-        counter++;
+    // 上次剩余的输出
+    len = C_MIN(outLen, (size_t) (C_SM3_DIGEST_SIZE - ctx->bufPos));
 
-        sm3Ctx = ctx->sm3Ctx;
-        c_sm3_update(&sm3Ctx, counterBE, sizeof(counterBE));
-        c_sm3_finish(&sm3Ctx, dgst);
+    // 32 位计数器, 最多输出 (2^32 - 1) 个块; 计数器回绕为 0 表示已经用完
+    // 先检查再输出, 失败时不改变上下文
+    avail = ctx->counter ? 0x100000000ULL - ctx->counter : 0;
+    if ((uint64_t) ((outLen - len) / C_SM3_DIGEST_SIZE + (0 != (outLen - len) % C_SM3_DIGEST_SIZE)) > avail) {
+        return false;
+    }
 
-        len = outlen < C_SM3_DIGEST_SIZE ? outlen : C_SM3_DIGEST_SIZE;
-        memcpy(out, dgst, len);
-        out += len;
-        outlen -= len;
+    memcpy(out, ctx->buf + ctx->bufPos, len);
+    ctx->bufPos += len;
+    out += len;
+    outLen -= len;
+
+    while (outLen >= C_SM3_DIGEST_SIZE) {
+        n = (uint32_t) C_MIN(outLen / C_SM3_DIGEST_SIZE, (size_t) lanes);
+        sm3_kdf_blocks(ctx, ctx->counter, n, out);
+        ctx->counter += n;
+        out += n * C_SM3_DIGEST_SIZE;
+        outLen -= n * C_SM3_DIGEST_SIZE;
+    }
+    if (outLen > 0) {
+        sm3_kdf_blocks(ctx, ctx->counter, 1, ctx->buf);
+        ctx->counter++;
+        memcpy(out, ctx->buf, outLen);
+        ctx->bufPos = (uint32_t) outLen;
     }
 
-    memset(&sm3Ctx, 0, sizeof(Sm3Context));
-    memset(dgst, 0, sizeof(dgst));
+    return true;
+}
+
+bool c_sm3_kdf_finish(Sm3KDFContext* ctx, uint8_t* out)
+{
+    bool ret;
+    Sm3KDFContext kdf = *ctx;
+
+    // 与之前的 read 无关, 总是从计数器 1 开始输出 outLen 字节
+    kdf.counter = 1;
+    kdf.bufPos = C_SM3_DIGEST_SIZE;
+    ret = c_sm3_kdf_read(&kdf, out, ctx->outLen);
+
+    memset(&kdf, 0, sizeof(kdf));
+
+    return ret;
 }
 
 
@@ -362,15 +916,7 @@ void c_sm3_kdf_finish(Sm3KDFContext* ctx, uint8_t* out)
 void c_sm3_init(Sm3Context* ctx)
 {
     memset(ctx, 0, sizeof(*ctx));
-
-    ctx->digest[0] = 0x7380166F;
-    ctx->digest[1] = 0x4914B2B9;
-    ctx->digest[2] = 0x172442D7;
-    ctx->digest[3] = 0xDA8A0600;
-    ctx->digest[4] = 0xA96F30BC;
-    ctx->digest[5] = 0x163138AA;
-    ctx->digest[6] = 0xE38DEE4D;
-    ctx->digest[7] = 0xB0FB0E4E;
+    memcpy(ctx->digest, gsSm3IV, sizeof(gsSm3IV));
 }
 
 void c_sm3_update(Sm3Context* ctx, const uint8_t* data, size_t dataLen)
@@ -441,3 +987,581 @@ void c_sm3_digest(const uint8_t* data, size_t dataLen, uint8_t dGst[32])
     memset(&ctx, 0, sizeof(ctx));
 }
 
+void c_sm3_mb_init(Sm3MbManager* mgr)
+{
+    c_hash_mb_init(mgr, &gsSm3MbAlgo);
+}
+
+Sm3Job* c_sm3_mb_submit(Sm3MbManager* mgr, Sm3Job* job)
+{
+    return c_hash_mb_submit(mgr, job, job->data, job->dataLen, gsSm3IV, 0);
+}
+
+Sm3Job* c_sm3_mb_flush(Sm3MbManager* mgr)
+{
+    return c_hash_mb_flush(mgr);
+}
+
+void c_sm3_digest_batch(Sm3Job* jobs, size_t count)
+{
+    size_t i;
+    Sm3MbManager mgr;
+
+    c_sm3_mb_init(&mgr);
+    for (i = 0; i < count; i++) {
+        c_sm3_mb_submit(&mgr, &jobs[i]);
+    }
+    while (c_sm3_mb_flush(&mgr)) {
+    }
+    memset(&mgr, 0, sizeof(mgr));
+}
+
+void c_sm3_hmac_batch(const Sm3HMACKey* hk, Sm3Job* jobs, size_t count)
+{
+    size_t i;
+    Sm3MbManager mgr;
+
+    // 内层: 从 ipad 链接值开始, 内层摘要先写到 dgst
+    c_sm3_mb_init(&mgr);
+    for (i = 0; i < count; i++) {
+        c_hash_mb_submit(&mgr, &jobs[i], jobs[i].data, jobs[i].dataLen, hk->ipad, C_SM3_BLOCK_SIZE);
+    }
+    while (c_sm3_mb_flush(&mgr)) {
+    }
+
+    // 外层: 32 字节的内层摘要在提交时就已复制到填充缓冲区, 所以结果可以直接覆盖 dgst
+    for (i = 0; i < count; i++) {
+        c_hash_mb_submit(&mgr, &jobs[i], jobs[i].dgst, C_SM3_DIGEST_SIZE, hk->opad, C_SM3_BLOCK_SIZE);
+    }
+    while (c_sm3_mb_flush(&mgr)) {
+    }
+    memset(&mgr, 0, sizeof(mgr));
+}
+
+/**
+ * PBKDF2 的一组输出分组, 每个分组占一个通道, 所有通道同步迭代
+ */
+typedef struct
+{
+    const Sm3HMACKey*   hk;
+    const uint8_t*      salt;
+    size_t              saltLen;
+    uint32_t            iterations;
+    uint8_t*            out;
+    size_t              outLen;
+    size_t              nBlocks;
+    size_t              groupSize;          // 每组的分组数, 不超过通道数
+    uint32_t            lanes;              // 1 表示逐个分组用单路压缩函数计算
+} Sm3Pbkdf2;
+
+/**
+ * 单路计算第 index 个输出分组, 直接在 ipad/opad 链接值上压缩, 不做通道转置
+ */
+static void sm3_pbkdf2_block(const Sm3Pbkdf2* p, size_t index)
+{
+    int w;
+    uint32_t i;
+    size_t len;
+    uint8_t u[C_SM3_DIGEST_SIZE], counter[4];
+    uint8_t block[C_SM3_BLOCK_SIZE];
+    uint32_t st[C_SM3_STATE_WORDS];
+    uint32_t T[C_SM3_STATE_WORDS];
+    Sm3HMACContext ctx;
+
+    PUTU32(counter, (uint32_t) (index + 1));
+    c_sm3_hmac_init_key(&ctx, p->hk);
+    c_sm3_hmac_update(&ctx, p->salt, p->saltLen);
+    c_sm3_hmac_update(&ctx, counter, sizeof(counter));
+    c_sm3_hmac_finish(&ctx, u);
+
+    // 与多通道实现相同的固定填充, 分组的前 32 字节是上一次的结果
+    memset(block, 0, sizeof(block));
+    memcpy(block, u, sizeof(u));
+    block[C_SM3_DIGEST_SIZE] = 0x80;
+    PUTU32(block + C_SM3_BLOCK_SIZE - 4, (C_SM3_BLOCK_SIZE + C_SM3_DIGEST_SIZE) * 8);
+    for (w = 0; w < C_SM3_STATE_WORDS; w++) {
+        T[w] = GETU32(u + 4 * w);
+    }
+
+    for (i = 1; i < p->iterations; i++) {
+        memcpy(st, p->hk->ipad, sizeof(st));
+        c_sm3_compress_blocks(st, block, 1);
+        for (w = 0; w < C_SM3_STATE_WORDS; w++) {
+            PUTU32(block + 4 * w, st[w]);
+        }
+        memcpy(st, p->hk->opad, sizeof(st));
+        c_sm3_compress_blocks(st, block, 1);
+        for (w = 0; w < C_SM3_STATE_WORDS; w++) {
+            PUTU32(block + 4 * w, st[w]);
+            T[w] ^= st[w];
+        }
+    }
+
+    for (w = 0; w < C_SM3_STATE_WORDS; w++) {
+        PUTU32(u + 4 * w, T[w]);
+    }
+    len = C_MIN((size_t) C_SM3_DIGEST_SIZE, p->outLen - index * C_SM3_DIGEST_SIZE);
+    memcpy(p->out + index * C_SM3_DIGEST_SIZE, u, len);
+
+    memset(u, 0, sizeof(u));
+    memset(block, 0, sizeof(block));
+    memset(st, 0, sizeof(st));
+    memset(T, 0, sizeof(T));
+}
+
+static void sm3_pbkdf2_group(void* data, size_t index)
+{
+    int w;
+    uint32_t i, l, n;
+    size_t first, len;
+    uint8_t u[C_SM3_DIGEST_SIZE], counter[4];
+    uint32_t st[C_SM3_STATE_WORDS][C_SM3_MB_MAX_LANES] C_ALIGNED(64);
+    uint32_t T[C_SM3_STATE_WORDS][C_SM3_MB_MAX_LANES] C_ALIGNED(64);
+    uint32_t M[16][C_SM3_MB_MAX_LANES] C_ALIGNED(64);
+    uint32_t ipad[C_SM3_STATE_WORDS][C_SM3_MB_MAX_LANES] C_ALIGNED(64);
+    uint32_t opad[C_SM3_STATE_WORDS][C_SM3_MB_MAX_LANES] C_ALIGNED(64);
+    Sm3HMACContext ctx;
+    const Sm3Pbkdf2* p = (const Sm3Pbkdf2*) data;
+    Sm3MbWordsFunc words = sm3_mb_words_func(p->lanes);
+
+    first = index * p->groupSize;
+    n = (uint32_t) C_MIN(p->groupSize, p->nBlocks - first);
+    if (1 == p->lanes) {
+        for (l = 0; l < n; l++) {
+            sm3_pbkdf2_block(p, first + l);
+        }
+        return;
+    }
+
+    // U1 = HMAC(P, S || INT(i)), 多余的通道重复第 0 个分组, 结果丢弃
+    memset(M, 0, sizeof(M));
+    for (l = 0; l < p->lanes; l++) {
+        if (l < n) {
+            PUTU32(counter, (uint32_t) (first + l + 1));
+            c_sm3_hmac_init_key(&ctx, p->hk);
+            c_sm3_hmac_update(&ctx, p->salt, p->saltLen);
+            c_sm3_hmac_update(&ctx, counter, sizeof(counter));
+            c_sm3_hmac_finish(&ctx, u);
+        }
+        for (w = 0; w < C_SM3_STATE_WORDS; w++) {
+            M[w][l] = T[w][l] = GETU32(u + 4 * w);
+            ipad[w][l] = p->hk->ipad[w];
+            opad[w][l] = p->hk->opad[w];
+        }
+        // 之后每次 HMAC 的输入都是 32 字节, 内外层都只有一个分组, 填充固定(总长度含 ipad/opad 分组)
+        M[8][l] = 0x80000000;
+        M[15][l] = (C_SM3_BLOCK_SIZE + C_SM3_DIGEST_SIZE) * 8;
+    }
+
+    for (i = 1; i < p->iterations; i++) {
+        memcpy(st, ipad, sizeof(st));
+        words(st, (const uint32_t (*)[C_SM3_MB_MAX_LANES]) M);
+        memcpy(M, st, sizeof(st));
+        memcpy(st, opad, sizeof(st));
+        words(st, (const uint32_t (*)[C_SM3_MB_MAX_LANES]) M);
+        memcpy(M, st, sizeof(st));
+        for (w = 0; w < C_SM3_STATE_WORDS; w++) {
+            for (l = 0; l < p->lanes; l++) {
+                T[w][l] ^= st[w][l];
+            }
+        }
+    }
+
+    for (l = 0; l < n; l++) {
+        for (w = 0; w < C_SM3_STATE_WORDS; w++) {
+            PUTU32(u + 4 * w, T[w][l]);
+        }
+        len = C_MIN((size_t) C_SM3_DIGEST_SIZE, p->outLen - (first + l) * C_SM3_DIGEST_SIZE);
+        memcpy(p->out + (first + l) * C_SM3_DIGEST_SIZE, u, len);
+    }
+
+    memset(u, 0, sizeof(u));
+    memset(st, 0, sizeof(st));
+    memset(T, 0, sizeof(T));
+    memset(M, 0, sizeof(M));
+    memset(ipad, 0, sizeof(ipad));
+    memset(opad, 0, sizeof(opad));
+}
+
+bool c_sm3_pbkdf2(const uint8_t* pass, size_t passLen, const uint8_t* salt, size_t saltLen, uint32_t iterations, uint32_t parallelThreads, uint8_t* out, size_t outLen)
+{
+    size_t i, groups;
+    Sm3HMACKey hk;
+    Sm3Pbkdf2 p;
+#ifndef __KERNEL_MODULE__
+    ThreadPool* pool = NULL;
+#endif
+
+    if (0 == iterations || 0 == outLen || (uint64_t) outLen > 0xffffffffULL * C_SM3_DIGEST_SIZE) {
+        return false;
+    }
+
+    c_sm3_hmac_key_setup(&hk, pass, passLen);
+
+    memset(&p, 0, sizeof(p));
+    p.hk = &hk;
+    p.salt = salt;
+    p.saltLen = saltLen;
+    p.iterations = iterations;
+    p.out = out;
+    p.outLen = outLen;
+    p.nBlocks = (outLen + C_SM3_DIGEST_SIZE - 1) / C_SM3_DIGEST_SIZE;
+    p.lanes = c_hash_mb_lanes();
+
+    // 分组尽量平均分给各线程, 每个线程内再占满通道
+    parallelThreads = (uint32_t) C_MAX(C_MIN((size_t) parallelThreads, p.nBlocks), 1);
+    p.groupSize = C_MIN((p.nBlocks + parallelThreads - 1) / parallelThreads, (size_t) p.lanes);
+    groups = (p.nBlocks + p.groupSize - 1) / p.groupSize;
+
+    // 每组只有一个分组时(如 LUKS 常用的 32 字节密钥)多通道实现大部分通道空转, 比单路压缩更慢
+    if (1 == p.groupSize) {
+        p.lanes = 1;
+    }
+
+#ifndef __KERNEL_MODULE__
+    if (parallelThreads > 1) {
+        pool = c_thread_pool_new(parallelThreads - 1);
+    }
+    if (pool) {
+        c_thread_pool_map(pool, sm3_pbkdf2_group, &p, groups);
+        c_thread_pool_free(pool);
+        memset(&hk, 0, sizeof(hk));
+        return true;
+    }
+#endif
+    for (i = 0; i < groups; i++) {
+        sm3_pbkdf2_group(&p, i);
+    }
+    memset(&hk, 0, sizeof(hk));
+
+    return true;
+}
+
+#ifndef __KERNEL_MODULE__
+uint32_t c_sm3_pbkdf2_benchmark(size_t outLen, uint32_t parallelThreads, uint32_t timeMs)
+{
+    double ms = 0;
+    uint64_t iterations = C_SM3_PBKDF2_MIN_ITERATIONS;
+    uint8_t* out = NULL;
+    struct timespec start, end;
+    static const uint8_t pass[] = "foo";
+    static const uint8_t salt[C_SM3_DIGEST_SIZE] = { 0 };
+
+    out = (uint8_t*) malloc(outLen ? outLen : 1);
+    if (NULL == out || 0 == outLen) {
+        free(out);
+        return 0;
+    }
+
+    // 迭代次数加倍直到耗时足够长, 再按比例换算到 timeMs
+    while (true) {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        c_sm3_pbkdf2(pass, sizeof(pass) - 1, salt, sizeof(salt), (uint32_t) iterations, parallelThreads, out, outLen);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        ms = (double) (end.tv_sec - start.tv_sec) * 1000.0 + (double) (end.tv_nsec - start.tv_nsec) / 1000000.0;
+        if (ms >= C_MAX(timeMs / 8, 20U) || iterations >= 0x7fffffffULL) {
+            break;
+        }
+        iterations *= 2;
+    }
+    free(out);
+
+    iterations = (uint64_t) ((double) iterations * timeMs / (ms > 0 ? ms : 1));
+
+    return (uint32_t) C_MIN(C_MAX(iterations, (uint64_t) C_SM3_PBKDF2_MIN_ITERATIONS), 0xffffffffULL);
+}
+#endif
+
+#ifndef __KERNEL_MODULE__
+typedef struct
+{
+    const uint8_t*  data;
+    uint64_t        length;             // data 的长度, 最后一个叶子可以不满
+    size_t          leafSize;
+    uint8_t*        out;
+} Sm3TreeLeaves;
+
+static void sm3_tree_leaf(const uint8_t* data, size_t dataLen, uint8_t out[C_SM3_DIGEST_SIZE])
+{
+    Sm3Context ctx;
+    static const uint8_t prefix = 0x00;
+
+    c_sm3_init(&ctx);
+    c_sm3_update(&ctx, &prefix, 1);
+    c_sm3_update(&ctx, data, dataLen);
+    c_sm3_finish(&ctx, out);
+}
+
+static void sm3_tree_leaf_task(void* data, size_t index)
+{
+    Sm3TreeLeaves* l = (Sm3TreeLeaves*) data;
+    uint64_t off = (uint64_t) index * l->leafSize;
+
+    sm3_tree_leaf(l->data + off, (size_t) C_MIN((uint64_t) l->leafSize, l->length - off), l->out + index * C_SM3_DIGEST_SIZE);
+}
+
+static size_t sm3_tree_leaf_count(const Sm3TreeContext* ctx, uint64_t length)
+{
+    return (size_t) ((length + ctx->leafSize - 1) / ctx->leafSize);
+}
+
+/**
+ * 并行计算 data 中的所有叶子(最后一个可以不满), 追加到叶子哈希表
+ */
+static bool sm3_tree_add_leaves(Sm3TreeContext* ctx, const uint8_t* data, uint64_t length)
+{
+    size_t cap;
+    uint8_t* leaves = NULL;
+    Sm3TreeLeaves l;
+    size_t n = sm3_tree_leaf_count(ctx, length);
+
+    if (ctx->nLeaves + n > ctx->capLeaves) {
+        cap = C_MAX(ctx->capLeaves * 2, ctx->nLeaves + n);
+        leaves = (uint8_t*) realloc(ctx->leaves, cap * C_SM3_DIGEST_SIZE);
+        if (NULL == leaves) {
+            return false;
+        }
+        ctx->leaves = leaves;
+        ctx->capLeaves = cap;
+    }
+
+    l.data = data;
+    l.length = length;
+    l.leafSize = ctx->leafSize;
+    l.out = ctx->leaves + ctx->nLeaves * C_SM3_DIGEST_SIZE;
+    c_thread_pool_map(ctx->pool, sm3_tree_leaf_task, &l, n);
+    ctx->nLeaves += n;
+
+    return true;
+}
+
+void c_sm3_tree_init(Sm3TreeContext* ctx, ThreadPool* pool, size_t leafSize)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->pool = pool;
+    ctx->leafSize = leafSize ? leafSize : C_SM3_TREE_LEAF_SIZE;
+}
+
+bool c_sm3_tree_update(Sm3TreeContext* ctx, const uint8_t* data, size_t dataLen)
+{
+    size_t n;
+
+    if (ctx->finished) {
+        return false;
+    }
+
+    // 缓冲区容纳每个线程一个叶子, 调用者每次只给少量数据时也能并行
+    if (NULL == ctx->buf && dataLen > 0) {
+        ctx->bufCap = ctx->leafSize * C_MAX(c_thread_pool_get_threads(ctx->pool), 1);
+        ctx->buf = (uint8_t*) malloc(ctx->bufCap);
+        if (NULL == ctx->buf) {
+            return false;
+        }
+    }
+
+    // length 只计入已经处理的部分, 失败时上下文仍与已哈希的叶子一致
+    while (dataLen > 0) {
+        if (0 == ctx->bufLen && dataLen >= ctx->leafSize) {
+            n = dataLen - dataLen % ctx->leafSize;
+            if (!sm3_tree_add_leaves(ctx, data, n)) {
+                return false;
+            }
+        }
+        else {
+            n = C_MIN(dataLen, ctx->bufCap - ctx->bufLen);
+            memcpy(ctx->buf + ctx->bufLen, data, n);
+            ctx->bufLen += n;
+            if (ctx->bufLen == ctx->bufCap) {
+                if (!sm3_tree_add_leaves(ctx, ctx->buf, ctx->bufLen)) {
+                    ctx->bufLen -= n;
+                    return false;
+                }
+                ctx->bufLen = 0;
+            }
+        }
+        ctx->length += n;
+        data += n;
+        dataLen -= n;
+    }
+
+    return true;
+}
+
+bool c_sm3_tree_finish(Sm3TreeContext* ctx, uint8_t dGst[C_SM3_DIGEST_SIZE])
+{
+    if (ctx->finished) {
+        return false;
+    }
+
+    if (ctx->bufLen > 0 && !sm3_tree_add_leaves(ctx, ctx->buf, ctx->bufLen)) {
+        return false;
+    }
+    if (0 == ctx->nLeaves) {
+        ctx->leaves = (uint8_t*) malloc(C_SM3_DIGEST_SIZE);
+        if (NULL == ctx->leaves) {
+            return false;
+        }
+        ctx->capLeaves = 1;
+        ctx->nLeaves = 1;
+        sm3_tree_leaf((const uint8_t*) "", 0, ctx->leaves);
+    }
+
+    free(ctx->buf);
+    ctx->buf = NULL;
+    ctx->bufLen = 0;
+    ctx->bufCap = 0;
+    ctx->finished = true;
+
+    return c_sm3_tree_root(ctx, dGst);
+}
+
+bool c_sm3_tree_set_leaf(Sm3TreeContext* ctx, size_t index, const uint8_t* data, size_t dataLen)
+{
+    uint64_t off = (uint64_t) index * ctx->leafSize;
+
+    if (!ctx->finished || index >= ctx->nLeaves
+        || dataLen != (size_t) C_MIN((uint64_t) ctx->leafSize, ctx->length - off)) {
+        return false;
+    }
+
+    sm3_tree_leaf(data, dataLen, ctx->leaves + index * C_SM3_DIGEST_SIZE);
+
+    return true;
+}
+
+bool c_sm3_tree_root(const Sm3TreeContext* ctx, uint8_t dGst[C_SM3_DIGEST_SIZE])
+{
+    size_t i, n;
+    uint8_t* nodes = NULL;
+    uint8_t buf[1 + 2 * C_SM3_DIGEST_SIZE];
+
+    if (!ctx->finished) {
+        return false;
+    }
+
+    n = ctx->nLeaves;
+    nodes = (uint8_t*) malloc(n * C_SM3_DIGEST_SIZE);
+    if (NULL == nodes) {
+        return false;
+    }
+    memcpy(nodes, ctx->leaves, n * C_SM3_DIGEST_SIZE);
+
+    // 逐层合并, 写入位置 i 不超过读取位置 2i, 可以原地进行
+    buf[0] = 0x01;
+    while (n > 1) {
+        for (i = 0; i < n / 2; i++) {
+            memcpy(buf + 1, nodes + 2 * i * C_SM3_DIGEST_SIZE, 2 * C_SM3_DIGEST_SIZE);
+            c_sm3_digest(buf, sizeof(buf), nodes + i * C_SM3_DIGEST_SIZE);
+        }
+        if (n & 1) {
+            memmove(nodes + i * C_SM3_DIGEST_SIZE, nodes + (n - 1) * C_SM3_DIGEST_SIZE, C_SM3_DIGEST_SIZE);
+        }
+        n = (n + 1) / 2;
+    }
+
+    buf[0] = 0x02;
+    memcpy(buf + 1, nodes, C_SM3_DIGEST_SIZE);
+    PUTU64(buf + 1 + C_SM3_DIGEST_SIZE, ctx->length);
+    PUTU64(buf + 1 + C_SM3_DIGEST_SIZE + 8, (uint64_t) ctx->leafSize);
+    c_sm3_digest(buf, 1 + C_SM3_DIGEST_SIZE + 16, dGst);
+
+    free(nodes);
+
+    return true;
+}
+
+void c_sm3_tree_free(Sm3TreeContext* ctx)
+{
+    free(ctx->leaves);
+    free(ctx->buf);
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+/**
+ * 只读映射整个文件, 空文件不映射
+ */
+static bool sm3_tree_map_file(const char* path, const uint8_t** map, uint64_t* size)
+{
+    int fd;
+    struct stat st;
+    void* addr = NULL;
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    if (0 != fstat(fd, &st) || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return false;
+    }
+
+    *map = NULL;
+    *size = (uint64_t) st.st_size;
+    if (st.st_size > 0) {
+        addr = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (MAP_FAILED == addr) {
+            close(fd);
+            return false;
+        }
+        *map = (const uint8_t*) addr;
+    }
+    close(fd);
+
+    return true;
+}
+
+bool c_sm3_tree_file(Sm3TreeContext* ctx, const char* path, uint8_t dGst[C_SM3_DIGEST_SIZE])
+{
+    bool ret = false;
+    uint64_t size = 0;
+    const uint8_t* map = NULL;
+
+    if (ctx->finished || ctx->length > 0 || !sm3_tree_map_file(path, &map, &size)) {
+        return false;
+    }
+
+    ctx->length = size;
+    ret = (0 == size || sm3_tree_add_leaves(ctx, map, size)) && c_sm3_tree_finish(ctx, dGst);
+
+    if (map) {
+        munmap((void*) map, (size_t) size);
+    }
+
+    return ret;
+}
+
+bool c_sm3_tree_file_update(Sm3TreeContext* ctx, const char* path, uint64_t offset, uint64_t length, uint8_t dGst[C_SM3_DIGEST_SIZE])
+{
+    size_t first, last;
+    uint64_t size = 0;
+    const uint8_t* map = NULL;
+    Sm3TreeLeaves l;
+
+    if (!ctx->finished || offset > ctx->length || length > ctx->length - offset) {
+        return false;
+    }
+    if (0 == length || 0 == ctx->length) {
+        return c_sm3_tree_root(ctx, dGst);
+    }
+    if (!sm3_tree_map_file(path, &map, &size)) {
+        return false;
+    }
+    if (size != ctx->length) {
+        munmap((void*) map, (size_t) size);
+        return false;
+    }
+
+    first = (size_t) (offset / ctx->leafSize);
+    last = (size_t) ((offset + length - 1) / ctx->leafSize);
+
+    l.data = map + (uint64_t) first * ctx->leafSize;
+    l.length = size - (uint64_t) first * ctx->leafSize;
+    l.leafSize = ctx->leafSize;
+    l.out = ctx->leaves + first * C_SM3_DIGEST_SIZE;
+    c_thread_pool_map(ctx->pool, sm3_tree_leaf_task, &l, last - first + 1);
+
+    munmap((void*) map, (size_t) size);
+
+    return c_sm3_tree_root(ctx, dGst);
+}
+#endif
@@ -22,6 +22,8 @@
 #ifndef purec_PUREC_SM_3_H
 #define purec_PUREC_SM_3_H
 #include "common.h"
+#include "hash-mb.h"
+#include "thread-pool.h"
 
 #define C_SM3_IS_BIG_ENDIAN         1
 
@@ -29,6 +31,9 @@
 #define C_SM3_BLOCK_SIZE            64
 #define C_SM3_STATE_WORDS           8
 #define C_SM3_HMAC_SIZE             (C_SM3_DIGEST_SIZE)
+#define C_SM3_MB_MAX_LANES          (HASH_MB_MAX_LANES)
+#define C_SM3_TREE_LEAF_SIZE        (1024 * 1024)
+#define C_SM3_PBKDF2_MIN_ITERATIONS 1000
 
 C_BEGIN_EXTERN_C
 
@@ -40,18 +45,61 @@ typedef struct
     uint32_t        num;
 } Sm3Context;
 
+/**
+ * 预处理的 HMAC 密钥: 分别吸收 ipad 和 opad 分组之后的链接值, 同一密钥计算多条消息时不必重复压缩这两个分组
+ */
+typedef struct
+{
+    uint32_t        ipad[C_SM3_STATE_WORDS];
+    uint32_t        opad[C_SM3_STATE_WORDS];
+} Sm3HMACKey;
+
 typedef struct
 {
     Sm3Context      sm3Ctx;
-    uint8_t         key[C_SM3_BLOCK_SIZE];
+    Sm3HMACKey      key;
 } Sm3HMACContext;
 
 typedef struct
 {
     Sm3Context      sm3Ctx;
     size_t          outLen;
+    uint32_t        counter;                    // 下一个输出块的计数器
+    uint32_t        bufPos;                     // buf 中已经输出的字节数
+    uint8_t         buf[C_SM3_DIGEST_SIZE];     // c_sm3_kdf_read 剩余的部分输出块
 } Sm3KDFContext;
 
+/**
+ * 多缓冲区计算的一个任务(dgst 为 C_SM3_DIGEST_SIZE 字节)和管理器, 通道调度见 hash-mb.h
+ */
+typedef HashMbJob       Sm3Job;
+typedef HashMbManager   Sm3MbManager;
+
+#ifndef __KERNEL_MODULE__
+/**
+ * 树模式 SM3, 用于多核并行计算大文件的摘要. 注意: 与普通 SM3 是不同的摘要, 结果不能与 c_sm3_digest 比较
+ *
+ *   叶子 i   = SM3(0x00 || 第 i 段数据), 每段 leafSize 字节, 最后一段可以更短, 空消息为一个空叶子
+ *   内部节点 = SM3(0x01 || 左 || 右), 每层从左到右两两合并, 落单的节点直接进入上一层
+ *   摘要     = SM3(0x02 || 根 || 总长度(64 位大端) || leafSize(64 位大端))
+ *
+ * 叶子哈希保存在上下文中, finish 之后修改少数叶子只需重新计算这些叶子(c_sm3_tree_set_leaf)
+ */
+typedef struct
+{
+    ThreadPool*     pool;               // 为 NULL 时在调用线程中计算
+    size_t          leafSize;
+    uint64_t        length;
+    uint8_t*        leaves;             // nLeaves 个叶子哈希
+    size_t          nLeaves;
+    size_t          capLeaves;
+    uint8_t*        buf;                // 尚未计算的数据, 攒够一批叶子后并行计算
+    size_t          bufLen;
+    size_t          bufCap;
+    bool            finished;
+} Sm3TreeContext;
+#endif
+
 
 /**
  * @brief 初始化 SM3(用来计算Hash) 上下文结构
@@ -82,6 +130,94 @@ void c_sm3_finish           (Sm3Context* ctx, uint8_t dGst[C_SM3_DIGEST_SIZE]);
  */
 void c_sm3_digest           (const uint8_t* data, size_t dataLen, uint8_t dGst[C_SM3_DIGEST_SIZE]);
 
+/**
+ * @brief 初始化多缓冲区管理器, 根据 CPU 特性选择通道数
+ */
+void c_sm3_mb_init          (Sm3MbManager* mgr);
+
+/**
+ * @brief 提交一个任务; 通道已满时先压缩直到有任务完成
+ * @return 已完成的任务(不一定是刚提交的), 没有则返回 NULL
+ * @note 任务完成前 job 及其 data 必须保持有效
+ */
+Sm3Job* c_sm3_mb_submit     (Sm3MbManager* mgr, Sm3Job* job);
+
+/**
+ * @brief 不再提交新任务时调用, 压缩剩余通道直到有任务完成
+ * @return 已完成的任务, 所有任务都已返回时为 NULL
+ */
+Sm3Job* c_sm3_mb_flush      (Sm3MbManager* mgr);
+
+/**
+ * @brief 同步计算 count 条消息的摘要, 结果与逐条调用 c_sm3_digest 相同
+ */
+void c_sm3_digest_batch     (Sm3Job* jobs, size_t count);
+
+/**
+ * @brief 用同一个预处理密钥同时计算多条消息的 HMAC(多缓冲区), 结果写入各任务的 dgst
+ */
+void c_sm3_hmac_batch       (const Sm3HMACKey* hk, Sm3Job* jobs, size_t count);
+
+/**
+ * @brief PBKDF2-HMAC-SM3 (RFC 8018), 例如用于 LUKS 密钥槽
+ * @note 各输出分组互相独立: 同一线程内的分组放在 SIMD 通道中同步迭代, parallelThreads 大于 1 时再分给多个线程;
+ *       迭代使用预处理的 ipad/opad 链接值, 每次迭代只需两次压缩
+ * @return 参数不合法(iterations 为 0, outLen 为 0 或过长)返回 false
+ */
+bool c_sm3_pbkdf2           (const uint8_t* pass, size_t passLen, const uint8_t* salt, size_t saltLen,
+                             uint32_t iterations, uint32_t parallelThreads, uint8_t* out, size_t outLen);
+
+#ifndef __KERNEL_MODULE__
+/**
+ * @brief 与 cryptsetup 类似, 测量本机速度并换算出耗时约 timeMs 毫秒的迭代次数(不少于 C_SM3_PBKDF2_MIN_ITERATIONS)
+ * @return 失败返回 0
+ */
+uint32_t c_sm3_pbkdf2_benchmark (size_t outLen, uint32_t parallelThreads, uint32_t timeMs);
+#endif
+
+#ifndef __KERNEL_MODULE__
+/**
+ * @brief 初始化树模式 SM3
+ * @param pool 计算叶子哈希使用的线程池, 可以为 NULL
+ * @param leafSize 叶子大小, 为 0 时使用 C_SM3_TREE_LEAF_SIZE
+ */
+void c_sm3_tree_init        (Sm3TreeContext* ctx, ThreadPool* pool, size_t leafSize);
+
+/**
+ * @brief 添加数据, 完整的叶子直接从 data 并行计算, 其余数据缓存在上下文中
+ * @return 内存不足或已经 finish 返回 false
+ */
+bool c_sm3_tree_update      (Sm3TreeContext* ctx, const uint8_t* data, size_t dataLen);
+
+/**
+ * @brief 计算剩余的叶子并输出摘要, 之后叶子哈希仍然保留, 直到 c_sm3_tree_free
+ */
+bool c_sm3_tree_finish      (Sm3TreeContext* ctx, uint8_t dGst[C_SM3_DIGEST_SIZE]);
+
+/**
+ * @brief finish 之后替换第 index 个叶子的数据, dataLen 必须与原叶子长度相同
+ */
+bool c_sm3_tree_set_leaf    (Sm3TreeContext* ctx, size_t index, const uint8_t* data, size_t dataLen);
+
+/**
+ * @brief 由保存的叶子哈希重新计算摘要(用于 set_leaf 之后)
+ */
+bool c_sm3_tree_root        (const Sm3TreeContext* ctx, uint8_t dGst[C_SM3_DIGEST_SIZE]);
+
+void c_sm3_tree_free        (Sm3TreeContext* ctx);
+
+/**
+ * @brief 以 mmap 方式读取整个文件计算树模式摘要, ctx 需要刚初始化
+ */
+bool c_sm3_tree_file        (Sm3TreeContext* ctx, const char* path, uint8_t dGst[C_SM3_DIGEST_SIZE]);
+
+/**
+ * @brief 文件中 [offset, offset + length) 被修改(文件大小不变)后, 只重新计算涉及的叶子并输出新摘要
+ * @note ctx 必须是之前对同一文件调用 c_sm3_tree_file 的结果
+ */
+bool c_sm3_tree_file_update (Sm3TreeContext* ctx, const char* path, uint64_t offset, uint64_t length, uint8_t dGst[C_SM3_DIGEST_SIZE]);
+#endif
+
 
 /**
  * @brief (HMAC, Hash-based Message Authentication Code), 一种基于hash函数的消息认证码, 初始化并生成 ipad和opad
@@ -94,16 +230,31 @@ void c_sm3_hmac_update      (Sm3HMACContext* ctx, const uint8_t* data, size_t da
 void c_sm3_hmac_finish      (Sm3HMACContext* ctx, uint8_t mac[C_SM3_HMAC_SIZE]);
 void c_sm3_hmac             (const uint8_t* key, size_t keyLen, const uint8_t* data, size_t dataLen, uint8_t mac[C_SM3_HMAC_SIZE]);
 
+/**
+ * @brief 预处理 HMAC 密钥, 之后每条短消息(不超过 55 字节)只需两次压缩
+ */
+void c_sm3_hmac_key_setup   (Sm3HMACKey* hk, const uint8_t* key, size_t keyLen);
+void c_sm3_hmac_init_key    (Sm3HMACContext* ctx, const Sm3HMACKey* hk);
+void c_sm3_hmac_with_key    (const Sm3HMACKey* hk, const uint8_t* data, size_t dataLen, uint8_t mac[C_SM3_HMAC_SIZE]);
+
 
 /**
  * @brief KDF(Key Derivation Function, 密钥派生函数);
  * 从一个主密钥/共享密钥(比如:SM2握手得到的Z值)派生出一个指定长度的密钥流/密钥材料(比如:128-bit、256-bit)
  * @param ctx
  * @param outLen
+ * @note finish 在 outLen 超过 32 位计数器能输出的长度时返回 false, 不写 out
  */
 void c_sm3_kdf_init         (Sm3KDFContext* ctx, size_t outLen);
 void c_sm3_kdf_update       (Sm3KDFContext* ctx, const uint8_t *data, size_t dataLen);
-void c_sm3_kdf_finish       (Sm3KDFContext* ctx, uint8_t *out);
+bool c_sm3_kdf_finish       (Sm3KDFContext* ctx, uint8_t *out);
+
+/**
+ * @brief 流式输出 KDF 结果, 可以多次调用, 各次输出首尾相接; 输出总长度不需要预先知道
+ * @note 调用之后不能再 update; 多个计数器块放在多缓冲区通道中同时计算
+ * @return 超过 32 位计数器能输出的长度时返回 false, 此时不输出任何数据, 上下文不变
+ */
+bool c_sm3_kdf_read         (Sm3KDFContext* ctx, uint8_t* out, size_t outLen);
 
 
 C_END_EXTERN_C
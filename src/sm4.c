@@ -21,6 +21,16 @@
  */
 #include "sm4.h"
 
+#include "utils-sys.h"
+
+#ifdef C_SYS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#ifndef __KERNEL_MODULE__
+#include <pthread.h>
+#endif
+
 #ifndef GET_ULONG_BE
 #define GET_ULONG_BE(n,b,i) \
 { \
@@ -45,6 +55,8 @@
 #define ROTL(x,n) (SHL((x),n) | ((x) >> (32 - n)))
 #define SWAP(a,b) { uint32_t t = a; a = b; b = t; t = 0; }
 
+#define SM4_CBC_BATCH_BLOCKS    32          // CBC 解密/多消息 CBC 加密每批处理的分组数
+
 
 static const uint8_t sboxTable[16][16] = {
     {0xd6,0x90,0xe9,0xfe,0xcc,0xe1,0x3d,0xb7,0x16,0xb6,0x14,0xc2,0x28,0xfb,0x2c,0x05},
@@ -80,6 +92,150 @@ static const uint32_t CK[32] = {
     0x10171e25,0x2c333a41,0x484f565d,0x646b7279
 };
 
+/**
+ * 轮函数 T(x) = L(τ(x)) 的查表实现: Ti[b] = L(Sbox(b) << (24 - 8 * i))
+ * L 是线性变换, 因此 T(x) = T0[x >> 24] ^ T1[(x >> 16) & 0xff] ^ T2[(x >> 8) & 0xff] ^ T3[x & 0xff]
+ */
+static const uint32_t T0[256] = {
+    0x8ed55b5b, 0xd0924242, 0x4deaa7a7, 0x06fdfbfb, 0xfccf3333, 0x65e28787, 0xc93df4f4, 0x6bb5dede,
+    0x4e165858, 0x6eb4dada, 0x44145050, 0xcac10b0b, 0x8828a0a0, 0x17f8efef, 0x9c2cb0b0, 0x11051414,
+    0x872bacac, 0xfb669d9d, 0xf2986a6a, 0xae77d9d9, 0x822aa8a8, 0x46bcfafa, 0x14041010, 0xcfc00f0f,
+    0x02a8aaaa, 0x54451111, 0x5f134c4c, 0xbe269898, 0x6d482525, 0x9e841a1a, 0x1e061818, 0xfd9b6666,
+    0xec9e7272, 0x4a430909, 0x10514141, 0x24f7d3d3, 0xd5934646, 0x53ecbfbf, 0xf89a6262, 0x927be9e9,
+    0xff33cccc, 0x04555151, 0x270b2c2c, 0x4f420d0d, 0x59eeb7b7, 0xf3cc3f3f, 0x1caeb2b2, 0xea638989,
+    0x74e79393, 0x7fb1cece, 0x6c1c7070, 0x0daba6a6, 0xedca2727, 0x28082020, 0x48eba3a3, 0xc1975656,
+    0x80820202, 0xa3dc7f7f, 0xc4965252, 0x12f9ebeb, 0xa174d5d5, 0xb38d3e3e, 0xc33ffcfc, 0x3ea49a9a,
+    0x5b461d1d, 0x1b071c1c, 0x3ba59e9e, 0x0cfff3f3, 0x3ff0cfcf, 0xbf72cdcd, 0x4b175c5c, 0x52b8eaea,
+    0x8f810e0e, 0x3d586565, 0xcc3cf0f0, 0x7d196464, 0x7ee59b9b, 0x91871616, 0x734e3d3d, 0x08aaa2a2,
+    0xc869a1a1, 0xc76aadad, 0x85830606, 0x7ab0caca, 0xb570c5c5, 0xf4659191, 0xb2d96b6b, 0xa7892e2e,
+    0x18fbe3e3, 0x47e8afaf, 0x330f3c3c, 0x674a2d2d, 0xb071c1c1, 0x0e575959, 0xe99f7676, 0xe135d4d4,
+    0x661e7878, 0xb4249090, 0x360e3838, 0x265f7979, 0xef628d8d, 0x38596161, 0x95d24747, 0x2aa08a8a,
+    0xb1259494, 0xaa228888, 0x8c7df1f1, 0xd73becec, 0x05010404, 0xa5218484, 0x9879e1e1, 0x9b851e1e,
+    0x84d75353, 0x00000000, 0x5e471919, 0x0b565d5d, 0xe39d7e7e, 0x9fd04f4f, 0xbb279c9c, 0x1a534949,
+    0x7c4d3131, 0xee36d8d8, 0x0a020808, 0x7be49f9f, 0x20a28282, 0xd4c71313, 0xe8cb2323, 0xe69c7a7a,
+    0x42e9abab, 0x43bdfefe, 0xa2882a2a, 0x9ad14b4b, 0x40410101, 0xdbc41f1f, 0xd838e0e0, 0x61b7d6d6,
+    0x2fa18e8e, 0x2bf4dfdf, 0x3af1cbcb, 0xf6cd3b3b, 0x1dfae7e7, 0xe5608585, 0x41155454, 0x25a38686,
+    0x60e38383, 0x16acbaba, 0x295c7575, 0x34a69292, 0xf7996e6e, 0xe434d0d0, 0x721a6868, 0x01545555,
+    0x19afb6b6, 0xdf914e4e, 0xfa32c8c8, 0xf030c0c0, 0x21f6d7d7, 0xbc8e3232, 0x75b3c6c6, 0x6fe08f8f,
+    0x691d7474, 0x2ef5dbdb, 0x6ae18b8b, 0x962eb8b8, 0x8a800a0a, 0xfe679999, 0xe2c92b2b, 0xe0618181,
+    0xc0c30303, 0x8d29a4a4, 0xaf238c8c, 0x07a9aeae, 0x390d3434, 0x1f524d4d, 0x764f3939, 0xd36ebdbd,
+    0x81d65757, 0xb7d86f6f, 0xeb37dcdc, 0x51441515, 0xa6dd7b7b, 0x09fef7f7, 0xb68c3a3a, 0x932fbcbc,
+    0x0f030c0c, 0x03fcffff, 0xc26ba9a9, 0xba73c9c9, 0xd96cb5b5, 0xdc6db1b1, 0x375a6d6d, 0x15504545,
+    0xb98f3636, 0x771b6c6c, 0x13adbebe, 0xda904a4a, 0x57b9eeee, 0xa9de7777, 0x4cbef2f2, 0x837efdfd,
+    0x55114444, 0xbdda6767, 0x2c5d7171, 0x45400505, 0x631f7c7c, 0x50104040, 0x325b6969, 0xb8db6363,
+    0x220a2828, 0xc5c20707, 0xf531c4c4, 0xa88a2222, 0x31a79696, 0xf9ce3737, 0x977aeded, 0x49bff6f6,
+    0x992db4b4, 0xa475d1d1, 0x90d34343, 0x5a124848, 0x58bae2e2, 0x71e69797, 0x64b6d2d2, 0x70b2c2c2,
+    0xad8b2626, 0xcd68a5a5, 0xcb955e5e, 0x624b2929, 0x3c0c3030, 0xce945a5a, 0xab76dddd, 0x867ff9f9,
+    0xf1649595, 0x5dbbe6e6, 0x35f2c7c7, 0x2d092424, 0xd1c61717, 0xd66fb9b9, 0xdec51b1b, 0x94861212,
+    0x78186060, 0x30f3c3c3, 0x897cf5f5, 0x5cefb3b3, 0xd23ae8e8, 0xacdf7373, 0x794c3535, 0xa0208080,
+    0x9d78e5e5, 0x56edbbbb, 0x235e7d7d, 0xc63ef8f8, 0x8bd45f5f, 0xe7c82f2f, 0xdd39e4e4, 0x68492121,
+};
+
+static const uint32_t T1[256] = {
+    0x5b8ed55b, 0x42d09242, 0xa74deaa7, 0xfb06fdfb, 0x33fccf33, 0x8765e287, 0xf4c93df4, 0xde6bb5de,
+    0x584e1658, 0xda6eb4da, 0x50441450, 0x0bcac10b, 0xa08828a0, 0xef17f8ef, 0xb09c2cb0, 0x14110514,
+    0xac872bac, 0x9dfb669d, 0x6af2986a, 0xd9ae77d9, 0xa8822aa8, 0xfa46bcfa, 0x10140410, 0x0fcfc00f,
+    0xaa02a8aa, 0x11544511, 0x4c5f134c, 0x98be2698, 0x256d4825, 0x1a9e841a, 0x181e0618, 0x66fd9b66,
+    0x72ec9e72, 0x094a4309, 0x41105141, 0xd324f7d3, 0x46d59346, 0xbf53ecbf, 0x62f89a62, 0xe9927be9,
+    0xccff33cc, 0x51045551, 0x2c270b2c, 0x0d4f420d, 0xb759eeb7, 0x3ff3cc3f, 0xb21caeb2, 0x89ea6389,
+    0x9374e793, 0xce7fb1ce, 0x706c1c70, 0xa60daba6, 0x27edca27, 0x20280820, 0xa348eba3, 0x56c19756,
+    0x02808202, 0x7fa3dc7f, 0x52c49652, 0xeb12f9eb, 0xd5a174d5, 0x3eb38d3e, 0xfcc33ffc, 0x9a3ea49a,
+    0x1d5b461d, 0x1c1b071c, 0x9e3ba59e, 0xf30cfff3, 0xcf3ff0cf, 0xcdbf72cd, 0x5c4b175c, 0xea52b8ea,
+    0x0e8f810e, 0x653d5865, 0xf0cc3cf0, 0x647d1964, 0x9b7ee59b, 0x16918716, 0x3d734e3d, 0xa208aaa2,
+    0xa1c869a1, 0xadc76aad, 0x06858306, 0xca7ab0ca, 0xc5b570c5, 0x91f46591, 0x6bb2d96b, 0x2ea7892e,
+    0xe318fbe3, 0xaf47e8af, 0x3c330f3c, 0x2d674a2d, 0xc1b071c1, 0x590e5759, 0x76e99f76, 0xd4e135d4,
+    0x78661e78, 0x90b42490, 0x38360e38, 0x79265f79, 0x8def628d, 0x61385961, 0x4795d247, 0x8a2aa08a,
+    0x94b12594, 0x88aa2288, 0xf18c7df1, 0xecd73bec, 0x04050104, 0x84a52184, 0xe19879e1, 0x1e9b851e,
+    0x5384d753, 0x00000000, 0x195e4719, 0x5d0b565d, 0x7ee39d7e, 0x4f9fd04f, 0x9cbb279c, 0x491a5349,
+    0x317c4d31, 0xd8ee36d8, 0x080a0208, 0x9f7be49f, 0x8220a282, 0x13d4c713, 0x23e8cb23, 0x7ae69c7a,
+    0xab42e9ab, 0xfe43bdfe, 0x2aa2882a, 0x4b9ad14b, 0x01404101, 0x1fdbc41f, 0xe0d838e0, 0xd661b7d6,
+    0x8e2fa18e, 0xdf2bf4df, 0xcb3af1cb, 0x3bf6cd3b, 0xe71dfae7, 0x85e56085, 0x54411554, 0x8625a386,
+    0x8360e383, 0xba16acba, 0x75295c75, 0x9234a692, 0x6ef7996e, 0xd0e434d0, 0x68721a68, 0x55015455,
+    0xb619afb6, 0x4edf914e, 0xc8fa32c8, 0xc0f030c0, 0xd721f6d7, 0x32bc8e32, 0xc675b3c6, 0x8f6fe08f,
+    0x74691d74, 0xdb2ef5db, 0x8b6ae18b, 0xb8962eb8, 0x0a8a800a, 0x99fe6799, 0x2be2c92b, 0x81e06181,
+    0x03c0c303, 0xa48d29a4, 0x8caf238c, 0xae07a9ae, 0x34390d34, 0x4d1f524d, 0x39764f39, 0xbdd36ebd,
+    0x5781d657, 0x6fb7d86f, 0xdceb37dc, 0x15514415, 0x7ba6dd7b, 0xf709fef7, 0x3ab68c3a, 0xbc932fbc,
+    0x0c0f030c, 0xff03fcff, 0xa9c26ba9, 0xc9ba73c9, 0xb5d96cb5, 0xb1dc6db1, 0x6d375a6d, 0x45155045,
+    0x36b98f36, 0x6c771b6c, 0xbe13adbe, 0x4ada904a, 0xee57b9ee, 0x77a9de77, 0xf24cbef2, 0xfd837efd,
+    0x44551144, 0x67bdda67, 0x712c5d71, 0x05454005, 0x7c631f7c, 0x40501040, 0x69325b69, 0x63b8db63,
+    0x28220a28, 0x07c5c207, 0xc4f531c4, 0x22a88a22, 0x9631a796, 0x37f9ce37, 0xed977aed, 0xf649bff6,
+    0xb4992db4, 0xd1a475d1, 0x4390d343, 0x485a1248, 0xe258bae2, 0x9771e697, 0xd264b6d2, 0xc270b2c2,
+    0x26ad8b26, 0xa5cd68a5, 0x5ecb955e, 0x29624b29, 0x303c0c30, 0x5ace945a, 0xddab76dd, 0xf9867ff9,
+    0x95f16495, 0xe65dbbe6, 0xc735f2c7, 0x242d0924, 0x17d1c617, 0xb9d66fb9, 0x1bdec51b, 0x12948612,
+    0x60781860, 0xc330f3c3, 0xf5897cf5, 0xb35cefb3, 0xe8d23ae8, 0x73acdf73, 0x35794c35, 0x80a02080,
+    0xe59d78e5, 0xbb56edbb, 0x7d235e7d, 0xf8c63ef8, 0x5f8bd45f, 0x2fe7c82f, 0xe4dd39e4, 0x21684921,
+};
+
+static const uint32_t T2[256] = {
+    0x5b5b8ed5, 0x4242d092, 0xa7a74dea, 0xfbfb06fd, 0x3333fccf, 0x878765e2, 0xf4f4c93d, 0xdede6bb5,
+    0x58584e16, 0xdada6eb4, 0x50504414, 0x0b0bcac1, 0xa0a08828, 0xefef17f8, 0xb0b09c2c, 0x14141105,
+    0xacac872b, 0x9d9dfb66, 0x6a6af298, 0xd9d9ae77, 0xa8a8822a, 0xfafa46bc, 0x10101404, 0x0f0fcfc0,
+    0xaaaa02a8, 0x11115445, 0x4c4c5f13, 0x9898be26, 0x25256d48, 0x1a1a9e84, 0x18181e06, 0x6666fd9b,
+    0x7272ec9e, 0x09094a43, 0x41411051, 0xd3d324f7, 0x4646d593, 0xbfbf53ec, 0x6262f89a, 0xe9e9927b,
+    0xccccff33, 0x51510455, 0x2c2c270b, 0x0d0d4f42, 0xb7b759ee, 0x3f3ff3cc, 0xb2b21cae, 0x8989ea63,
+    0x939374e7, 0xcece7fb1, 0x70706c1c, 0xa6a60dab, 0x2727edca, 0x20202808, 0xa3a348eb, 0x5656c197,
+    0x02028082, 0x7f7fa3dc, 0x5252c496, 0xebeb12f9, 0xd5d5a174, 0x3e3eb38d, 0xfcfcc33f, 0x9a9a3ea4,
+    0x1d1d5b46, 0x1c1c1b07, 0x9e9e3ba5, 0xf3f30cff, 0xcfcf3ff0, 0xcdcdbf72, 0x5c5c4b17, 0xeaea52b8,
+    0x0e0e8f81, 0x65653d58, 0xf0f0cc3c, 0x64647d19, 0x9b9b7ee5, 0x16169187, 0x3d3d734e, 0xa2a208aa,
+    0xa1a1c869, 0xadadc76a, 0x06068583, 0xcaca7ab0, 0xc5c5b570, 0x9191f465, 0x6b6bb2d9, 0x2e2ea789,
+    0xe3e318fb, 0xafaf47e8, 0x3c3c330f, 0x2d2d674a, 0xc1c1b071, 0x59590e57, 0x7676e99f, 0xd4d4e135,
+    0x7878661e, 0x9090b424, 0x3838360e, 0x7979265f, 0x8d8def62, 0x61613859, 0x474795d2, 0x8a8a2aa0,
+    0x9494b125, 0x8888aa22, 0xf1f18c7d, 0xececd73b, 0x04040501, 0x8484a521, 0xe1e19879, 0x1e1e9b85,
+    0x535384d7, 0x00000000, 0x19195e47, 0x5d5d0b56, 0x7e7ee39d, 0x4f4f9fd0, 0x9c9cbb27, 0x49491a53,
+    0x31317c4d, 0xd8d8ee36, 0x08080a02, 0x9f9f7be4, 0x828220a2, 0x1313d4c7, 0x2323e8cb, 0x7a7ae69c,
+    0xabab42e9, 0xfefe43bd, 0x2a2aa288, 0x4b4b9ad1, 0x01014041, 0x1f1fdbc4, 0xe0e0d838, 0xd6d661b7,
+    0x8e8e2fa1, 0xdfdf2bf4, 0xcbcb3af1, 0x3b3bf6cd, 0xe7e71dfa, 0x8585e560, 0x54544115, 0x868625a3,
+    0x838360e3, 0xbaba16ac, 0x7575295c, 0x929234a6, 0x6e6ef799, 0xd0d0e434, 0x6868721a, 0x55550154,
+    0xb6b619af, 0x4e4edf91, 0xc8c8fa32, 0xc0c0f030, 0xd7d721f6, 0x3232bc8e, 0xc6c675b3, 0x8f8f6fe0,
+    0x7474691d, 0xdbdb2ef5, 0x8b8b6ae1, 0xb8b8962e, 0x0a0a8a80, 0x9999fe67, 0x2b2be2c9, 0x8181e061,
+    0x0303c0c3, 0xa4a48d29, 0x8c8caf23, 0xaeae07a9, 0x3434390d, 0x4d4d1f52, 0x3939764f, 0xbdbdd36e,
+    0x575781d6, 0x6f6fb7d8, 0xdcdceb37, 0x15155144, 0x7b7ba6dd, 0xf7f709fe, 0x3a3ab68c, 0xbcbc932f,
+    0x0c0c0f03, 0xffff03fc, 0xa9a9c26b, 0xc9c9ba73, 0xb5b5d96c, 0xb1b1dc6d, 0x6d6d375a, 0x45451550,
+    0x3636b98f, 0x6c6c771b, 0xbebe13ad, 0x4a4ada90, 0xeeee57b9, 0x7777a9de, 0xf2f24cbe, 0xfdfd837e,
+    0x44445511, 0x6767bdda, 0x71712c5d, 0x05054540, 0x7c7c631f, 0x40405010, 0x6969325b, 0x6363b8db,
+    0x2828220a, 0x0707c5c2, 0xc4c4f531, 0x2222a88a, 0x969631a7, 0x3737f9ce, 0xeded977a, 0xf6f649bf,
+    0xb4b4992d, 0xd1d1a475, 0x434390d3, 0x48485a12, 0xe2e258ba, 0x979771e6, 0xd2d264b6, 0xc2c270b2,
+    0x2626ad8b, 0xa5a5cd68, 0x5e5ecb95, 0x2929624b, 0x30303c0c, 0x5a5ace94, 0xddddab76, 0xf9f9867f,
+    0x9595f164, 0xe6e65dbb, 0xc7c735f2, 0x24242d09, 0x1717d1c6, 0xb9b9d66f, 0x1b1bdec5, 0x12129486,
+    0x60607818, 0xc3c330f3, 0xf5f5897c, 0xb3b35cef, 0xe8e8d23a, 0x7373acdf, 0x3535794c, 0x8080a020,
+    0xe5e59d78, 0xbbbb56ed, 0x7d7d235e, 0xf8f8c63e, 0x5f5f8bd4, 0x2f2fe7c8, 0xe4e4dd39, 0x21216849,
+};
+
+static const uint32_t T3[256] = {
+    0xd55b5b8e, 0x924242d0, 0xeaa7a74d, 0xfdfbfb06, 0xcf3333fc, 0xe2878765, 0x3df4f4c9, 0xb5dede6b,
+    0x1658584e, 0xb4dada6e, 0x14505044, 0xc10b0bca, 0x28a0a088, 0xf8efef17, 0x2cb0b09c, 0x05141411,
+    0x2bacac87, 0x669d9dfb, 0x986a6af2, 0x77d9d9ae, 0x2aa8a882, 0xbcfafa46, 0x04101014, 0xc00f0fcf,
+    0xa8aaaa02, 0x45111154, 0x134c4c5f, 0x269898be, 0x4825256d, 0x841a1a9e, 0x0618181e, 0x9b6666fd,
+    0x9e7272ec, 0x4309094a, 0x51414110, 0xf7d3d324, 0x934646d5, 0xecbfbf53, 0x9a6262f8, 0x7be9e992,
+    0x33ccccff, 0x55515104, 0x0b2c2c27, 0x420d0d4f, 0xeeb7b759, 0xcc3f3ff3, 0xaeb2b21c, 0x638989ea,
+    0xe7939374, 0xb1cece7f, 0x1c70706c, 0xaba6a60d, 0xca2727ed, 0x08202028, 0xeba3a348, 0x975656c1,
+    0x82020280, 0xdc7f7fa3, 0x965252c4, 0xf9ebeb12, 0x74d5d5a1, 0x8d3e3eb3, 0x3ffcfcc3, 0xa49a9a3e,
+    0x461d1d5b, 0x071c1c1b, 0xa59e9e3b, 0xfff3f30c, 0xf0cfcf3f, 0x72cdcdbf, 0x175c5c4b, 0xb8eaea52,
+    0x810e0e8f, 0x5865653d, 0x3cf0f0cc, 0x1964647d, 0xe59b9b7e, 0x87161691, 0x4e3d3d73, 0xaaa2a208,
+    0x69a1a1c8, 0x6aadadc7, 0x83060685, 0xb0caca7a, 0x70c5c5b5, 0x659191f4, 0xd96b6bb2, 0x892e2ea7,
+    0xfbe3e318, 0xe8afaf47, 0x0f3c3c33, 0x4a2d2d67, 0x71c1c1b0, 0x5759590e, 0x9f7676e9, 0x35d4d4e1,
+    0x1e787866, 0x249090b4, 0x0e383836, 0x5f797926, 0x628d8def, 0x59616138, 0xd2474795, 0xa08a8a2a,
+    0x259494b1, 0x228888aa, 0x7df1f18c, 0x3bececd7, 0x01040405, 0x218484a5, 0x79e1e198, 0x851e1e9b,
+    0xd7535384, 0x00000000, 0x4719195e, 0x565d5d0b, 0x9d7e7ee3, 0xd04f4f9f, 0x279c9cbb, 0x5349491a,
+    0x4d31317c, 0x36d8d8ee, 0x0208080a, 0xe49f9f7b, 0xa2828220, 0xc71313d4, 0xcb2323e8, 0x9c7a7ae6,
+    0xe9abab42, 0xbdfefe43, 0x882a2aa2, 0xd14b4b9a, 0x41010140, 0xc41f1fdb, 0x38e0e0d8, 0xb7d6d661,
+    0xa18e8e2f, 0xf4dfdf2b, 0xf1cbcb3a, 0xcd3b3bf6, 0xfae7e71d, 0x608585e5, 0x15545441, 0xa3868625,
+    0xe3838360, 0xacbaba16, 0x5c757529, 0xa6929234, 0x996e6ef7, 0x34d0d0e4, 0x1a686872, 0x54555501,
+    0xafb6b619, 0x914e4edf, 0x32c8c8fa, 0x30c0c0f0, 0xf6d7d721, 0x8e3232bc, 0xb3c6c675, 0xe08f8f6f,
+    0x1d747469, 0xf5dbdb2e, 0xe18b8b6a, 0x2eb8b896, 0x800a0a8a, 0x679999fe, 0xc92b2be2, 0x618181e0,
+    0xc30303c0, 0x29a4a48d, 0x238c8caf, 0xa9aeae07, 0x0d343439, 0x524d4d1f, 0x4f393976, 0x6ebdbdd3,
+    0xd6575781, 0xd86f6fb7, 0x37dcdceb, 0x44151551, 0xdd7b7ba6, 0xfef7f709, 0x8c3a3ab6, 0x2fbcbc93,
+    0x030c0c0f, 0xfcffff03, 0x6ba9a9c2, 0x73c9c9ba, 0x6cb5b5d9, 0x6db1b1dc, 0x5a6d6d37, 0x50454515,
+    0x8f3636b9, 0x1b6c6c77, 0xadbebe13, 0x904a4ada, 0xb9eeee57, 0xde7777a9, 0xbef2f24c, 0x7efdfd83,
+    0x11444455, 0xda6767bd, 0x5d71712c, 0x40050545, 0x1f7c7c63, 0x10404050, 0x5b696932, 0xdb6363b8,
+    0x0a282822, 0xc20707c5, 0x31c4c4f5, 0x8a2222a8, 0xa7969631, 0xce3737f9, 0x7aeded97, 0xbff6f649,
+    0x2db4b499, 0x75d1d1a4, 0xd3434390, 0x1248485a, 0xbae2e258, 0xe6979771, 0xb6d2d264, 0xb2c2c270,
+    0x8b2626ad, 0x68a5a5cd, 0x955e5ecb, 0x4b292962, 0x0c30303c, 0x945a5ace, 0x76ddddab, 0x7ff9f986,
+    0x649595f1, 0xbbe6e65d, 0xf2c7c735, 0x0924242d, 0xc61717d1, 0x6fb9b9d6, 0xc51b1bde, 0x86121294,
+    0x18606078, 0xf3c3c330, 0x7cf5f589, 0xefb3b35c, 0x3ae8e8d2, 0xdf7373ac, 0x4c353579, 0x208080a0,
+    0x78e5e59d, 0xedbbbb56, 0x5e7d7d23, 0x3ef8f8c6, 0xd45f5f8b, 0xc82f2fe7, 0x39e4e4dd, 0x49212168,
+};
+
 
 static uint8_t sm4_sbox(uint8_t inch)
 {
@@ -89,10 +245,10 @@ static uint8_t sm4_sbox(uint8_t inch)
     return retVal;
 }
 
-static uint32_t sm4Lt(uint32_t ka)
+static uint32_t sm4CalciRK(uint32_t ka)
 {
     uint32_t bb = 0;
-    uint32_t c = 0;
+    uint32_t rk = 0;
     uint8_t a[4];
     uint8_t b[4];
     PUT_ULONG_BE(ka, a, 0)
@@ -101,33 +257,418 @@ static uint32_t sm4Lt(uint32_t ka)
     b[2] = sm4_sbox(a[2]);
     b[3] = sm4_sbox(a[3]);
     GET_ULONG_BE(bb, b, 0)
-    c = bb ^ (ROTL(bb, 2)) ^ (ROTL(bb, 10)) ^ (ROTL(bb, 18)) ^ (ROTL(bb, 24));
+    rk = bb ^ (ROTL(bb, 13)) ^ (ROTL(bb, 23));
 
-    return c;
+    return rk;
 }
 
-static uint32_t sm4F (uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3, uint32_t rk)
+
+#define SM4_T(x)                (T0[(x) >> 24] ^ T1[((x) >> 16) & 0xff] ^ T2[((x) >> 8) & 0xff] ^ T3[(x) & 0xff])
+
+#define SM4_ROUNDS4(rk, i) \
+{ \
+    x0 ^= SM4_T(x1 ^ x2 ^ x3 ^ (rk)[(i)    ]); \
+    x1 ^= SM4_T(x2 ^ x3 ^ x0 ^ (rk)[(i) + 1]); \
+    x2 ^= SM4_T(x3 ^ x0 ^ x1 ^ (rk)[(i) + 2]); \
+    x3 ^= SM4_T(x0 ^ x1 ^ x2 ^ (rk)[(i) + 3]); \
+}
+
+/**
+ * 单个分组的 32 轮, 状态只在寄存器中, 完全展开
+ */
+static void sm4_crypt_block(const uint32_t rk[32], const uint8_t input[16], uint8_t output[16])
 {
-    return (x0 ^ sm4Lt(x1 ^ x2 ^ x3 ^ rk));
+    uint32_t x0, x1, x2, x3;
+
+    GET_ULONG_BE(x0, input, 0)
+    GET_ULONG_BE(x1, input, 4)
+    GET_ULONG_BE(x2, input, 8)
+    GET_ULONG_BE(x3, input, 12)
+
+    SM4_ROUNDS4(rk, 0)
+    SM4_ROUNDS4(rk, 4)
+    SM4_ROUNDS4(rk, 8)
+    SM4_ROUNDS4(rk, 12)
+    SM4_ROUNDS4(rk, 16)
+    SM4_ROUNDS4(rk, 20)
+    SM4_ROUNDS4(rk, 24)
+    SM4_ROUNDS4(rk, 28)
+
+    PUT_ULONG_BE(x3, output, 0)
+    PUT_ULONG_BE(x2, output, 4)
+    PUT_ULONG_BE(x1, output, 8)
+    PUT_ULONG_BE(x0, output, 12)
 }
 
-static uint32_t sm4CalciRK(uint32_t ka)
+#ifdef C_SYS_X86_SIMD
+/**
+ * SIMD 实现: 多个分组按字转置到向量的各个通道中, 32 轮对所有通道并行执行
+ *
+ * SM4 与 AES 的 S 盒都是 GF(2^8) 上的求逆加仿射变换, 两个域同构, 因此
+ *   Sbox_sm4(x) = Post(SubBytes_aes(Pre(x)))
+ * Pre/Post 是 GF(2) 上的仿射变换, 用两次 4 位查表(pshufb)实现, SubBytes 用 AESENCLAST(轮密钥为 0);
+ * AESENCLAST 附带的 ShiftRows 与循环移位一起用 pshufb 抵消.
+ * 支持 GFNI 时 Pre 用 GF2P8AFFINEQB, 求逆与 Post 用 GF2P8AFFINEINVQB 完成
+ */
+static const uint64_t gsSm4PreLo[2]    = { 0x9197e2e474720701ULL, 0xc7c1b4b222245157ULL };
+static const uint64_t gsSm4PreHi[2]    = { 0xe240ab09eb49a200ULL, 0xf052b91bf95bb012ULL };
+static const uint64_t gsSm4PostLo[2]   = { 0x5b67f2cea19d0834ULL, 0xedd14478172bbe82ULL };
+static const uint64_t gsSm4PostHi[2]   = { 0xae7201dd73afdc00ULL, 0x11cdbe62cc1063bfULL };
+
+// 逆 ShiftRows 后再按 32 位字循环左移 0/8/16/24 位
+static const uint64_t gsSm4IsrRol0[2]  = { 0x0b0e0104070a0d00ULL, 0x0306090c0f020508ULL };
+static const uint64_t gsSm4IsrRol8[2]  = { 0x0e01040b0a0d0007ULL, 0x06090c030205080fULL };
+static const uint64_t gsSm4IsrRol16[2] = { 0x01040b0e0d00070aULL, 0x090c030605080f02ULL };
+static const uint64_t gsSm4IsrRol24[2] = { 0x040b0e0100070a0dULL, 0x0c030609080f0205ULL };
+
+// 按 32 位字循环左移 8/16/24 位, 以及大端字节序转换
+static const uint64_t gsSm4Rol8[2]     = { 0x0605040702010003ULL, 0x0e0d0c0f0a09080bULL };
+static const uint64_t gsSm4Rol16[2]    = { 0x0504070601000302ULL, 0x0d0c0f0e09080b0aULL };
+static const uint64_t gsSm4Rol24[2]    = { 0x0407060500030201ULL, 0x0c0f0e0d080b0a09ULL };
+static const uint64_t gsSm4Bswap32[2]  = { 0x0405060700010203ULL, 0x0c0d0e0f08090a0bULL };
+
+// GFNI: 8x8 比特矩阵与常量
+#define SM4_GFNI_PRE            0x669b0d608a162e14ULL
+#define SM4_GFNI_PRE_C          0x01
+#define SM4_GFNI_POST           0x598edb70229ca40eULL
+#define SM4_GFNI_POST_C         0xd3
+
+#define SM4_C128(c)             _mm_loadu_si128((const __m128i*) (c))
+#define SM4_C256(c)             _mm256_broadcastsi128_si256(SM4_C128(c))
+#define SM4_C512(c)             _mm512_broadcast_i32x4(SM4_C128(c))
+
+#define SM4_SIMD_SSE            (1 << 0)        // SSSE3 + AES-NI, 2 x 4 分组
+#define SM4_SIMD_AVX2           (1 << 1)        // AVX2 + AES-NI, 2 x 8 分组
+#define SM4_SIMD_AVX2_GFNI      (1 << 2)        // AVX2 + GFNI, 2 x 8 分组
+#define SM4_SIMD_AVX512         (1 << 3)        // AVX-512BW + GFNI, 2 x 16 分组
+
+#define SM4_HAS(f, m)           (((f) & (m)) == (m))
+
+/**
+ * 4x4 的 32 位字转置(每个 128 位通道内独立进行)
+ */
+#define SM4_TRANSPOSE(p, x0, x1, x2, x3) \
+{ \
+    t0 = p##_unpacklo_epi32(x0, x1); \
+    t1 = p##_unpacklo_epi32(x2, x3); \
+    t2 = p##_unpackhi_epi32(x0, x1); \
+    t3 = p##_unpackhi_epi32(x2, x3); \
+    x0 = p##_unpacklo_epi64(t0, t1); \
+    x1 = p##_unpackhi_epi64(t0, t1); \
+    x2 = p##_unpacklo_epi64(t2, t3); \
+    x3 = p##_unpackhi_epi64(t2, t3); \
+}
+
+C_SYS_TARGET("aes,ssse3")
+static __m128i sm4_sse_t(__m128i x)
 {
-    uint32_t bb = 0;
-    uint32_t rk = 0;
-    uint8_t a[4];
-    uint8_t b[4];
-    PUT_ULONG_BE(ka, a, 0)
-    b[0] = sm4_sbox(a[0]);
-    b[1] = sm4_sbox(a[1]);
-    b[2] = sm4_sbox(a[2]);
-    b[3] = sm4_sbox(a[3]);
-    GET_ULONG_BE(bb, b, 0)
-    rk = bb ^ (ROTL(bb, 13)) ^ (ROTL(bb, 23));
+    __m128i t, s;
+    const __m128i m0f = _mm_set1_epi8(0x0f);
 
-    return rk;
+    x = _mm_xor_si128(_mm_shuffle_epi8(SM4_C128(gsSm4PreLo), _mm_and_si128(x, m0f)),
+                      _mm_shuffle_epi8(SM4_C128(gsSm4PreHi), _mm_and_si128(_mm_srli_epi32(x, 4), m0f)));
+    x = _mm_aesenclast_si128(x, _mm_setzero_si128());
+    x = _mm_xor_si128(_mm_shuffle_epi8(SM4_C128(gsSm4PostLo), _mm_and_si128(x, m0f)),
+                      _mm_shuffle_epi8(SM4_C128(gsSm4PostHi), _mm_and_si128(_mm_srli_epi32(x, 4), m0f)));
+
+    // L(t) = t ^ (t <<< 24) ^ ((t ^ (t <<< 8) ^ (t <<< 16)) <<< 2)
+    t = _mm_shuffle_epi8(x, SM4_C128(gsSm4IsrRol0));
+    s = _mm_xor_si128(t, _mm_xor_si128(_mm_shuffle_epi8(x, SM4_C128(gsSm4IsrRol8)), _mm_shuffle_epi8(x, SM4_C128(gsSm4IsrRol16))));
+    s = _mm_or_si128(_mm_slli_epi32(s, 2), _mm_srli_epi32(s, 30));
+
+    return _mm_xor_si128(_mm_xor_si128(t, _mm_shuffle_epi8(x, SM4_C128(gsSm4IsrRol24))), s);
+}
+
+C_SYS_TARGET("ssse3")
+static void sm4_sse_load(const uint8_t* input, __m128i* x0, __m128i* x1, __m128i* x2, __m128i* x3)
+{
+    __m128i t0, t1, t2, t3;
+    const __m128i bswap = SM4_C128(gsSm4Bswap32);
+
+    *x0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (input +  0)), bswap);
+    *x1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (input + 16)), bswap);
+    *x2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (input + 32)), bswap);
+    *x3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (input + 48)), bswap);
+    SM4_TRANSPOSE(_mm, *x0, *x1, *x2, *x3)
+}
+
+C_SYS_TARGET("ssse3")
+static void sm4_sse_store(uint8_t* output, __m128i x0, __m128i x1, __m128i x2, __m128i x3)
+{
+    __m128i t0, t1, t2, t3;
+    const __m128i bswap = SM4_C128(gsSm4Bswap32);
+
+    SM4_TRANSPOSE(_mm, x3, x2, x1, x0)
+    _mm_storeu_si128((__m128i*) (output +  0), _mm_shuffle_epi8(x3, bswap));
+    _mm_storeu_si128((__m128i*) (output + 16), _mm_shuffle_epi8(x2, bswap));
+    _mm_storeu_si128((__m128i*) (output + 32), _mm_shuffle_epi8(x1, bswap));
+    _mm_storeu_si128((__m128i*) (output + 48), _mm_shuffle_epi8(x0, bswap));
+}
+
+#define SM4_SSE_XOR3K(a, b, c, k)       _mm_xor_si128(_mm_xor_si128(a, b), _mm_xor_si128(c, _mm_set1_epi32((int) (k))))
+
+/**
+ * 两组(各 4 个分组)交错执行, 隐藏轮函数的延迟
+ */
+C_SYS_TARGET("aes,ssse3")
+static void sm4_sse_blocks8(const uint32_t rk[32], const uint8_t* input, uint8_t* output)
+{
+    int i;
+    __m128i x0, x1, x2, x3, y0, y1, y2, y3;
+
+    sm4_sse_load(input, &x0, &x1, &x2, &x3);
+    sm4_sse_load(input + 64, &y0, &y1, &y2, &y3);
+    for (i = 0; i < 32; i += 4) {
+        x0 = _mm_xor_si128(x0, sm4_sse_t(SM4_SSE_XOR3K(x1, x2, x3, rk[i    ])));
+        y0 = _mm_xor_si128(y0, sm4_sse_t(SM4_SSE_XOR3K(y1, y2, y3, rk[i    ])));
+        x1 = _mm_xor_si128(x1, sm4_sse_t(SM4_SSE_XOR3K(x2, x3, x0, rk[i + 1])));
+        y1 = _mm_xor_si128(y1, sm4_sse_t(SM4_SSE_XOR3K(y2, y3, y0, rk[i + 1])));
+        x2 = _mm_xor_si128(x2, sm4_sse_t(SM4_SSE_XOR3K(x3, x0, x1, rk[i + 2])));
+        y2 = _mm_xor_si128(y2, sm4_sse_t(SM4_SSE_XOR3K(y3, y0, y1, rk[i + 2])));
+        x3 = _mm_xor_si128(x3, sm4_sse_t(SM4_SSE_XOR3K(x0, x1, x2, rk[i + 3])));
+        y3 = _mm_xor_si128(y3, sm4_sse_t(SM4_SSE_XOR3K(y0, y1, y2, rk[i + 3])));
+    }
+    sm4_sse_store(output, x0, x1, x2, x3);
+    sm4_sse_store(output + 64, y0, y1, y2, y3);
+}
+
+C_SYS_TARGET("avx2,aes")
+static __m256i sm4_avx2_t(__m256i x)
+{
+    __m128i lo, hi;
+    __m256i t, s;
+    const __m256i m0f = _mm256_set1_epi8(0x0f);
+
+    x = _mm256_xor_si256(_mm256_shuffle_epi8(SM4_C256(gsSm4PreLo), _mm256_and_si256(x, m0f)),
+                         _mm256_shuffle_epi8(SM4_C256(gsSm4PreHi), _mm256_and_si256(_mm256_srli_epi32(x, 4), m0f)));
+    // 不依赖 VAES: 两个 128 位通道分别做 AESENCLAST
+    lo = _mm_aesenclast_si128(_mm256_castsi256_si128(x), _mm_setzero_si128());
+    hi = _mm_aesenclast_si128(_mm256_extracti128_si256(x, 1), _mm_setzero_si128());
+    x = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    x = _mm256_xor_si256(_mm256_shuffle_epi8(SM4_C256(gsSm4PostLo), _mm256_and_si256(x, m0f)),
+                         _mm256_shuffle_epi8(SM4_C256(gsSm4PostHi), _mm256_and_si256(_mm256_srli_epi32(x, 4), m0f)));
+
+    t = _mm256_shuffle_epi8(x, SM4_C256(gsSm4IsrRol0));
+    s = _mm256_xor_si256(t, _mm256_xor_si256(_mm256_shuffle_epi8(x, SM4_C256(gsSm4IsrRol8)), _mm256_shuffle_epi8(x, SM4_C256(gsSm4IsrRol16))));
+    s = _mm256_or_si256(_mm256_slli_epi32(s, 2), _mm256_srli_epi32(s, 30));
+
+    return _mm256_xor_si256(_mm256_xor_si256(t, _mm256_shuffle_epi8(x, SM4_C256(gsSm4IsrRol24))), s);
+}
+
+C_SYS_TARGET("avx2,gfni")
+static __m256i sm4_avx2_gfni_t(__m256i x)
+{
+    __m256i s;
+
+    x = _mm256_gf2p8affine_epi64_epi8(x, _mm256_set1_epi64x((long long) SM4_GFNI_PRE), SM4_GFNI_PRE_C);
+    x = _mm256_gf2p8affineinv_epi64_epi8(x, _mm256_set1_epi64x((long long) SM4_GFNI_POST), SM4_GFNI_POST_C);
+
+    s = _mm256_xor_si256(x, _mm256_xor_si256(_mm256_shuffle_epi8(x, SM4_C256(gsSm4Rol8)), _mm256_shuffle_epi8(x, SM4_C256(gsSm4Rol16))));
+    s = _mm256_or_si256(_mm256_slli_epi32(s, 2), _mm256_srli_epi32(s, 30));
+
+    return _mm256_xor_si256(_mm256_xor_si256(x, _mm256_shuffle_epi8(x, SM4_C256(gsSm4Rol24))), s);
+}
+
+C_SYS_TARGET("avx2")
+static void sm4_avx2_load(const uint8_t* input, __m256i* x0, __m256i* x1, __m256i* x2, __m256i* x3)
+{
+    __m256i t0, t1, t2, t3;
+    const __m256i bswap = SM4_C256(gsSm4Bswap32);
+
+    *x0 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*) (input +  0)), bswap);
+    *x1 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*) (input + 32)), bswap);
+    *x2 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*) (input + 64)), bswap);
+    *x3 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*) (input + 96)), bswap);
+    SM4_TRANSPOSE(_mm256, *x0, *x1, *x2, *x3)
+}
+
+C_SYS_TARGET("avx2")
+static void sm4_avx2_store(uint8_t* output, __m256i x0, __m256i x1, __m256i x2, __m256i x3)
+{
+    __m256i t0, t1, t2, t3;
+    const __m256i bswap = SM4_C256(gsSm4Bswap32);
+
+    SM4_TRANSPOSE(_mm256, x3, x2, x1, x0)
+    _mm256_storeu_si256((__m256i*) (output +  0), _mm256_shuffle_epi8(x3, bswap));
+    _mm256_storeu_si256((__m256i*) (output + 32), _mm256_shuffle_epi8(x2, bswap));
+    _mm256_storeu_si256((__m256i*) (output + 64), _mm256_shuffle_epi8(x1, bswap));
+    _mm256_storeu_si256((__m256i*) (output + 96), _mm256_shuffle_epi8(x0, bswap));
 }
 
+#define SM4_AVX2_XOR3K(a, b, c, k)   _mm256_xor_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(c, _mm256_set1_epi32((int) (k))))
+
+C_SYS_TARGET("avx2,aes")
+static void sm4_avx2_blocks16(const uint32_t rk[32], const uint8_t* input, uint8_t* output)
+{
+    int i;
+    __m256i x0, x1, x2, x3, y0, y1, y2, y3;
+
+    sm4_avx2_load(input, &x0, &x1, &x2, &x3);
+    sm4_avx2_load(input + 128, &y0, &y1, &y2, &y3);
+    for (i = 0; i < 32; i += 4) {
+        x0 = _mm256_xor_si256(x0, sm4_avx2_t(SM4_AVX2_XOR3K(x1, x2, x3, rk[i    ])));
+        y0 = _mm256_xor_si256(y0, sm4_avx2_t(SM4_AVX2_XOR3K(y1, y2, y3, rk[i    ])));
+        x1 = _mm256_xor_si256(x1, sm4_avx2_t(SM4_AVX2_XOR3K(x2, x3, x0, rk[i + 1])));
+        y1 = _mm256_xor_si256(y1, sm4_avx2_t(SM4_AVX2_XOR3K(y2, y3, y0, rk[i + 1])));
+        x2 = _mm256_xor_si256(x2, sm4_avx2_t(SM4_AVX2_XOR3K(x3, x0, x1, rk[i + 2])));
+        y2 = _mm256_xor_si256(y2, sm4_avx2_t(SM4_AVX2_XOR3K(y3, y0, y1, rk[i + 2])));
+        x3 = _mm256_xor_si256(x3, sm4_avx2_t(SM4_AVX2_XOR3K(x0, x1, x2, rk[i + 3])));
+        y3 = _mm256_xor_si256(y3, sm4_avx2_t(SM4_AVX2_XOR3K(y0, y1, y2, rk[i + 3])));
+    }
+    sm4_avx2_store(output, x0, x1, x2, x3);
+    sm4_avx2_store(output + 128, y0, y1, y2, y3);
+}
+
+C_SYS_TARGET("avx2,gfni")
+static void sm4_avx2_gfni_blocks16(const uint32_t rk[32], const uint8_t* input, uint8_t* output)
+{
+    int i;
+    __m256i x0, x1, x2, x3, y0, y1, y2, y3;
+
+    sm4_avx2_load(input, &x0, &x1, &x2, &x3);
+    sm4_avx2_load(input + 128, &y0, &y1, &y2, &y3);
+    for (i = 0; i < 32; i += 4) {
+        x0 = _mm256_xor_si256(x0, sm4_avx2_gfni_t(SM4_AVX2_XOR3K(x1, x2, x3, rk[i    ])));
+        y0 = _mm256_xor_si256(y0, sm4_avx2_gfni_t(SM4_AVX2_XOR3K(y1, y2, y3, rk[i    ])));
+        x1 = _mm256_xor_si256(x1, sm4_avx2_gfni_t(SM4_AVX2_XOR3K(x2, x3, x0, rk[i + 1])));
+        y1 = _mm256_xor_si256(y1, sm4_avx2_gfni_t(SM4_AVX2_XOR3K(y2, y3, y0, rk[i + 1])));
+        x2 = _mm256_xor_si256(x2, sm4_avx2_gfni_t(SM4_AVX2_XOR3K(x3, x0, x1, rk[i + 2])));
+        y2 = _mm256_xor_si256(y2, sm4_avx2_gfni_t(SM4_AVX2_XOR3K(y3, y0, y1, rk[i + 2])));
+        x3 = _mm256_xor_si256(x3, sm4_avx2_gfni_t(SM4_AVX2_XOR3K(x0, x1, x2, rk[i + 3])));
+        y3 = _mm256_xor_si256(y3, sm4_avx2_gfni_t(SM4_AVX2_XOR3K(y0, y1, y2, rk[i + 3])));
+    }
+    sm4_avx2_store(output, x0, x1, x2, x3);
+    sm4_avx2_store(output + 128, y0, y1, y2, y3);
+}
+
+C_SYS_TARGET("avx512f,avx512bw,gfni")
+static __m512i sm4_avx512_t(__m512i x)
+{
+    x = _mm512_gf2p8affine_epi64_epi8(x, _mm512_set1_epi64((long long) SM4_GFNI_PRE), SM4_GFNI_PRE_C);
+    x = _mm512_gf2p8affineinv_epi64_epi8(x, _mm512_set1_epi64((long long) SM4_GFNI_POST), SM4_GFNI_POST_C);
+
+    return _mm512_ternarylogic_epi32(
+        _mm512_ternarylogic_epi32(x, _mm512_rol_epi32(x, 2), _mm512_rol_epi32(x, 10), 0x96),
+        _mm512_rol_epi32(x, 18), _mm512_rol_epi32(x, 24), 0x96);
+}
+
+C_SYS_TARGET("avx512f,avx512bw,gfni")
+static void sm4_avx512_load(const uint8_t* input, __m512i* x0, __m512i* x1, __m512i* x2, __m512i* x3)
+{
+    __m512i t0, t1, t2, t3;
+    const __m512i bswap = SM4_C512(gsSm4Bswap32);
+
+    *x0 = _mm512_shuffle_epi8(_mm512_loadu_si512((const void*) (input +   0)), bswap);
+    *x1 = _mm512_shuffle_epi8(_mm512_loadu_si512((const void*) (input +  64)), bswap);
+    *x2 = _mm512_shuffle_epi8(_mm512_loadu_si512((const void*) (input + 128)), bswap);
+    *x3 = _mm512_shuffle_epi8(_mm512_loadu_si512((const void*) (input + 192)), bswap);
+    SM4_TRANSPOSE(_mm512, *x0, *x1, *x2, *x3)
+}
+
+C_SYS_TARGET("avx512f,avx512bw,gfni")
+static void sm4_avx512_store(uint8_t* output, __m512i x0, __m512i x1, __m512i x2, __m512i x3)
+{
+    __m512i t0, t1, t2, t3;
+    const __m512i bswap = SM4_C512(gsSm4Bswap32);
+
+    SM4_TRANSPOSE(_mm512, x3, x2, x1, x0)
+    _mm512_storeu_si512((void*) (output +   0), _mm512_shuffle_epi8(x3, bswap));
+    _mm512_storeu_si512((void*) (output +  64), _mm512_shuffle_epi8(x2, bswap));
+    _mm512_storeu_si512((void*) (output + 128), _mm512_shuffle_epi8(x1, bswap));
+    _mm512_storeu_si512((void*) (output + 192), _mm512_shuffle_epi8(x0, bswap));
+}
+
+// 0x96: 三输入异或
+#define SM4_AVX512_XOR3K(a, b, c, k)    _mm512_ternarylogic_epi32(a, b, _mm512_xor_si512(c, _mm512_set1_epi32((int) (k))), 0x96)
+
+C_SYS_TARGET("avx512f,avx512bw,gfni")
+static void sm4_avx512_blocks32(const uint32_t rk[32], const uint8_t* input, uint8_t* output)
+{
+    int i;
+    __m512i x0, x1, x2, x3, y0, y1, y2, y3;
+
+    sm4_avx512_load(input, &x0, &x1, &x2, &x3);
+    sm4_avx512_load(input + 256, &y0, &y1, &y2, &y3);
+    for (i = 0; i < 32; i += 4) {
+        x0 = _mm512_xor_si512(x0, sm4_avx512_t(SM4_AVX512_XOR3K(x1, x2, x3, rk[i    ])));
+        y0 = _mm512_xor_si512(y0, sm4_avx512_t(SM4_AVX512_XOR3K(y1, y2, y3, rk[i    ])));
+        x1 = _mm512_xor_si512(x1, sm4_avx512_t(SM4_AVX512_XOR3K(x2, x3, x0, rk[i + 1])));
+        y1 = _mm512_xor_si512(y1, sm4_avx512_t(SM4_AVX512_XOR3K(y2, y3, y0, rk[i + 1])));
+        x2 = _mm512_xor_si512(x2, sm4_avx512_t(SM4_AVX512_XOR3K(x3, x0, x1, rk[i + 2])));
+        y2 = _mm512_xor_si512(y2, sm4_avx512_t(SM4_AVX512_XOR3K(y3, y0, y1, rk[i + 2])));
+        x3 = _mm512_xor_si512(x3, sm4_avx512_t(SM4_AVX512_XOR3K(x0, x1, x2, rk[i + 3])));
+        y3 = _mm512_xor_si512(y3, sm4_avx512_t(SM4_AVX512_XOR3K(y0, y1, y2, rk[i + 3])));
+    }
+    sm4_avx512_store(output, x0, x1, x2, x3);
+    sm4_avx512_store(output + 256, y0, y1, y2, y3);
+}
+
+static uint8_t sm4_simd_features(void)
+{
+    uint8_t simd = 0;
+    uint32_t f = c_utils_sys_get_cpu_features();
+
+    if (SM4_HAS(f, C_SYS_CPU_SSSE3 | C_SYS_CPU_AESNI)) {
+        simd |= SM4_SIMD_SSE;
+    }
+    if (SM4_HAS(f, C_SYS_CPU_AVX2 | C_SYS_CPU_AESNI)) {
+        simd |= SM4_SIMD_AVX2;
+    }
+    if (SM4_HAS(f, C_SYS_CPU_AVX2 | C_SYS_CPU_GFNI)) {
+        simd |= SM4_SIMD_AVX2_GFNI;
+    }
+    if (SM4_HAS(f, C_SYS_CPU_AVX512F | C_SYS_CPU_AVX512BW | C_SYS_CPU_GFNI)) {
+        simd |= SM4_SIMD_AVX512;
+    }
+
+    return simd;
+}
+#endif
+
+/**
+ * 批量处理: 先用最宽的 SIMD 实现, 剩余不足 4 个的分组用查表实现
+ */
+static void sm4_crypt_blocks(const Sm4Context* ctx, const uint32_t rk[32], const uint8_t* input, uint8_t* output, size_t nBlocks)
+{
+#ifdef C_SYS_X86_SIMD
+    uint8_t buf[8 * SM4_BLOCK_SIZE];
+
+    if (C_FLAG_ON(ctx->simd, SM4_SIMD_AVX512)) {
+        for (; nBlocks >= 32; nBlocks -= 32, input += 512, output += 512) {
+            sm4_avx512_blocks32(rk, input, output);
+        }
+    }
+    if (C_FLAG_ON(ctx->simd, SM4_SIMD_AVX2_GFNI)) {
+        for (; nBlocks >= 16; nBlocks -= 16, input += 256, output += 256) {
+            sm4_avx2_gfni_blocks16(rk, input, output);
+        }
+    }
+    else if (C_FLAG_ON(ctx->simd, SM4_SIMD_AVX2)) {
+        for (; nBlocks >= 16; nBlocks -= 16, input += 256, output += 256) {
+            sm4_avx2_blocks16(rk, input, output);
+        }
+    }
+    if (C_FLAG_ON(ctx->simd, SM4_SIMD_SSE)) {
+        for (; nBlocks >= 8; nBlocks -= 8, input += 128, output += 128) {
+            sm4_sse_blocks8(rk, input, output);
+        }
+        // 剩余 4~7 个分组补齐到 8 个, 仍比查表快
+        if (nBlocks >= 4) {
+            memset(buf, 0, sizeof(buf));
+            memcpy(buf, input, nBlocks * SM4_BLOCK_SIZE);
+            sm4_sse_blocks8(rk, buf, buf);
+            memcpy(output, buf, nBlocks * SM4_BLOCK_SIZE);
+            memset(buf, 0, sizeof(buf));
+            return;
+        }
+    }
+#else
+    (void) ctx;
+#endif
+    for (; nBlocks > 0; nBlocks--, input += SM4_BLOCK_SIZE, output += SM4_BLOCK_SIZE) {
+        sm4_crypt_block(rk, input, output);
+    }
+}
 
 void c_sm4_set_key(uint32_t SK[32], const uint8_t key[16])
 {
@@ -149,28 +690,20 @@ void c_sm4_set_key(uint32_t SK[32], const uint8_t key[16])
     }
 }
 
-void c_sm4_one_round(uint32_t sk[32], uint8_t input[16], uint8_t output[16], Sm4Context * ctx)
+void c_sm4_one_round(const uint32_t sk[32], const uint8_t input[16], uint8_t output[16], Sm4Context * ctx)
 {
-    uint32_t i = 0;
-
-    GET_ULONG_BE(ctx->ulBuf[0], input, 0)
-    GET_ULONG_BE(ctx->ulBuf[1], input, 4)
-    GET_ULONG_BE(ctx->ulBuf[2], input, 8)
-    GET_ULONG_BE(ctx->ulBuf[3], input, 12)
-
-    while (i < 32) {
-        ctx->ulBuf[i + 4] = sm4F(ctx->ulBuf[i], ctx->ulBuf[i + 1], ctx->ulBuf[i + 2], ctx->ulBuf[i + 3], sk[i]);
-        i++;
-    }
-    PUT_ULONG_BE(ctx->ulBuf[35], output, 0);
-    PUT_ULONG_BE(ctx->ulBuf[34], output, 4);
-    PUT_ULONG_BE(ctx->ulBuf[33], output, 8);
-    PUT_ULONG_BE(ctx->ulBuf[32], output, 12);
+    (void) ctx;
+    sm4_crypt_block(sk, input, output);
 }
 
 void c_sm4_setup(Sm4Context * ctx, const uint8_t key[16])
 {
     int i;
+#ifdef C_SYS_X86_SIMD
+    ctx->simd = sm4_simd_features();
+#else
+    ctx->simd = 0;
+#endif
     c_sm4_set_key(ctx->enKey, key);
     c_sm4_set_key(ctx->deKey, key);
     for (i = 0; i < SM4_BLOCK_SIZE; i++) {
@@ -178,45 +711,45 @@ void c_sm4_setup(Sm4Context * ctx, const uint8_t key[16])
     }
 }
 
-void c_sm4_encrypt_block(Sm4Context * ctx, uint8_t input[16], uint8_t output[16])
+void c_sm4_encrypt_block(const Sm4Context * ctx, const uint8_t input[16], uint8_t output[16])
 {
-    c_sm4_one_round(ctx->enKey, input, output,ctx);
+    sm4_crypt_block(ctx->enKey, input, output);
 }
 
-void c_sm4_decrypt_block(Sm4Context * ctx, uint8_t input[16], uint8_t output[16])
+void c_sm4_decrypt_block(const Sm4Context * ctx, const uint8_t input[16], uint8_t output[16])
 {
-    c_sm4_one_round(ctx->deKey, input, output,ctx);
+    sm4_crypt_block(ctx->deKey, input, output);
 }
 
-void c_sm4_encrypt(Sm4Context * ctx, uint8_t * input, uint8_t * output, int length)
+void c_sm4_encrypt_blocks(const Sm4Context* ctx, const uint8_t* input, uint8_t* output, size_t nBlocks)
 {
-    while (length > SM4_BLOCK_SIZE) {
-        c_sm4_one_round(ctx->enKey, input, output,ctx);
-        input += SM4_BLOCK_SIZE;
-        output += SM4_BLOCK_SIZE;
-        length -= SM4_BLOCK_SIZE;
-    }
+    sm4_crypt_blocks(ctx, ctx->enKey, input, output, nBlocks);
 }
 
-void c_sm4_decrypt(Sm4Context * ctx, uint8_t * input, uint8_t * output, int length)
+void c_sm4_decrypt_blocks(const Sm4Context* ctx, const uint8_t* input, uint8_t* output, size_t nBlocks)
 {
-    while (length > SM4_BLOCK_SIZE) {
-        c_sm4_one_round(ctx->deKey, input, output,ctx);
-        input += SM4_BLOCK_SIZE;
-        output += SM4_BLOCK_SIZE;
-        length -= SM4_BLOCK_SIZE;
+    sm4_crypt_blocks(ctx, ctx->deKey, input, output, nBlocks);
+}
+
+void c_sm4_encrypt(const Sm4Context * ctx, const uint8_t * input, uint8_t * output, int length)
+{
+    if (length > 0) {
+        sm4_crypt_blocks(ctx, ctx->enKey, input, output, (size_t) length / SM4_BLOCK_SIZE);
     }
 }
 
-void c_sm4_encrypt_cbc(Sm4Context * ctx, uint8_t iv[16], uint8_t * input, uint8_t * output, int length)
+void c_sm4_decrypt(const Sm4Context * ctx, const uint8_t * input, uint8_t * output, int length)
 {
-    int i = 0;
-    while (length > SM4_BLOCK_SIZE) {
-        for (i = 0; i < SM4_BLOCK_SIZE; i++) {
-            output[i] = (uint8_t)(input[i] ^ iv[i]);
-        }
+    if (length > 0) {
+        sm4_crypt_blocks(ctx, ctx->deKey, input, output, (size_t) length / SM4_BLOCK_SIZE);
+    }
+}
 
-        c_sm4_one_round(ctx->enKey, output, output,ctx);
+void c_sm4_encrypt_cbc(const Sm4Context * ctx, uint8_t iv[16], const uint8_t * input, uint8_t * output, int length)
+{
+    while (length >= SM4_BLOCK_SIZE) {
+        c_cipher_mode_xor(output, input, iv, SM4_BLOCK_SIZE);
+        sm4_crypt_block(ctx->enKey, output, output);
         memcpy(iv, output, SM4_BLOCK_SIZE);
 
         input += SM4_BLOCK_SIZE;
@@ -225,23 +758,389 @@ void c_sm4_encrypt_cbc(Sm4Context * ctx, uint8_t iv[16], uint8_t * input, uint8_
     }
 }
 
-void c_sm4_decrypt_cbc(Sm4Context * ctx, uint8_t iv[16], uint8_t * input, uint8_t * output, int length)
+void c_sm4_decrypt_cbc(const Sm4Context * ctx, uint8_t iv[16], const uint8_t * input, uint8_t * output, int length)
+{
+    size_t n, nBlocks;
+    uint8_t temp[SM4_CBC_BATCH_BLOCKS * SM4_BLOCK_SIZE];
+
+    // 各分组的解密互不依赖: 每批先整体解密, 再与前一个密文分组异或
+    // 密文先复制到 temp, 因此 input 与 output 可以相同
+    nBlocks = (length > 0) ? (size_t) length / SM4_BLOCK_SIZE : 0;
+    for (; nBlocks > 0; nBlocks -= n) {
+        n = C_MIN(nBlocks, SM4_CBC_BATCH_BLOCKS);
+        memcpy(temp, input, n * SM4_BLOCK_SIZE);
+        sm4_crypt_blocks(ctx, ctx->deKey, temp, output, n);
+        c_cipher_mode_xor(output, output, iv, SM4_BLOCK_SIZE);
+        c_cipher_mode_xor(output + SM4_BLOCK_SIZE, output + SM4_BLOCK_SIZE, temp, (n - 1) * SM4_BLOCK_SIZE);
+        memcpy(iv, temp + (n - 1) * SM4_BLOCK_SIZE, SM4_BLOCK_SIZE);
+
+        input += n * SM4_BLOCK_SIZE;
+        output += n * SM4_BLOCK_SIZE;
+    }
+    memset(temp, 0, sizeof(temp));
+}
+
+void c_sm4_encrypt_cbc_multi(const Sm4Context* ctx, Sm4CbcStream* streams, size_t nStreams)
 {
-    int i = 0;
-    uint8_t temp[16];
-    while (length > SM4_BLOCK_SIZE) {
-        memcpy(temp, input, SM4_BLOCK_SIZE);
-        c_sm4_one_round(ctx->deKey, input, output,ctx);
+    size_t i, n, active;
+    size_t offset;
+    size_t index[SM4_CBC_BATCH_BLOCKS];
+    uint8_t temp[SM4_CBC_BATCH_BLOCKS * SM4_BLOCK_SIZE];
 
-        for (i = 0; i < 16; i++) {
-            output[i] = (uint8_t)(output[i] ^ iv[i]);
+    // 每次取至多 SM4_CBC_BATCH_BLOCKS 条消息, 把每条消息的当前分组拼成一批交给批量接口,
+    // 较短的消息处理完后从本批中移除
+    for (; nStreams > 0; nStreams -= n, streams += n) {
+        n = C_MIN(nStreams, SM4_CBC_BATCH_BLOCKS);
+        for (active = 0, i = 0; i < n; i++) {
+            if (streams[i].length >= SM4_BLOCK_SIZE) {
+                index[active++] = i;
+            }
         }
+        for (offset = 0; active > 0; offset += SM4_BLOCK_SIZE) {
+            for (i = 0; i < active; i++) {
+                Sm4CbcStream* s = streams + index[i];
+                c_cipher_mode_xor(temp + i * SM4_BLOCK_SIZE, s->input + offset, s->iv, SM4_BLOCK_SIZE);
+            }
+            sm4_crypt_blocks(ctx, ctx->enKey, temp, temp, active);
+            for (i = 0; i < active;) {
+                Sm4CbcStream* s = streams + index[i];
+                memcpy(s->output + offset, temp + i * SM4_BLOCK_SIZE, SM4_BLOCK_SIZE);
+                memcpy(s->iv, temp + i * SM4_BLOCK_SIZE, SM4_BLOCK_SIZE);
+                if (s->length - offset < 2 * SM4_BLOCK_SIZE) {
+                    // 该消息已结束: 用最后一个仍在处理的消息填补它的位置
+                    --active;
+                    index[i] = index[active];
+                    memcpy(temp + i * SM4_BLOCK_SIZE, temp + active * SM4_BLOCK_SIZE, SM4_BLOCK_SIZE);
+                    continue;
+                }
+                i++;
+            }
+        }
+    }
+    memset(temp, 0, sizeof(temp));
+}
 
-        memcpy(iv, temp, SM4_BLOCK_SIZE);
+static void sm4_encrypt_blocks_cb(const void* key, const uint8_t* input, uint8_t* output, size_t nBlocks)
+{
+    c_sm4_encrypt_blocks((const Sm4Context*) key, input, output, nBlocks);
+}
 
-        input += SM4_BLOCK_SIZE;
-        output += SM4_BLOCK_SIZE;
-        length -= SM4_BLOCK_SIZE;
+static void sm4_decrypt_blocks_cb(const void* key, const uint8_t* input, uint8_t* output, size_t nBlocks)
+{
+    c_sm4_decrypt_blocks((const Sm4Context*) key, input, output, nBlocks);
+}
+
+void c_sm4_encrypt_ctr(const Sm4Context* ctx, const uint8_t iv[SM4_BLOCK_SIZE], uint64_t blockOffset, const uint8_t* input, uint8_t* output, size_t length)
+{
+    CipherCtrContext ctr;
+
+    c_cipher_mode_ctr_init(&ctr, iv, blockOffset);
+    c_cipher_mode_ctr_update(&ctr, ctx, sm4_encrypt_blocks_cb, input, output, length);
+    memset(&ctr, 0, sizeof(ctr));
+}
+
+void c_sm4_ctr_init(Sm4CtrContext* ctx, const Sm4Context* sm4, const uint8_t iv[SM4_BLOCK_SIZE], uint64_t blockOffset)
+{
+    ctx->sm4 = sm4;
+    c_cipher_mode_ctr_init(&ctx->ctr, iv, blockOffset);
+}
+
+void c_sm4_ctr_seek(Sm4CtrContext* ctx, uint64_t byteOffset)
+{
+    c_cipher_mode_ctr_seek(&ctx->ctr, ctx->sm4, sm4_encrypt_blocks_cb, byteOffset);
+}
+
+void c_sm4_ctr_update(Sm4CtrContext* ctx, const uint8_t* input, uint8_t* output, size_t length)
+{
+    c_cipher_mode_ctr_update(&ctx->ctr, ctx->sm4, sm4_encrypt_blocks_cb, input, output, length);
+}
+
+void c_sm4_gcm_init(Sm4GcmContext* ctx, const Sm4Context* sm4, const uint8_t* iv, size_t ivLen)
+{
+    ctx->sm4 = sm4;
+    c_gcm_init(&ctx->gcm, sm4, sm4_encrypt_blocks_cb, iv, ivLen);
+}
+
+bool c_sm4_gcm_aad(Sm4GcmContext* ctx, const uint8_t* aad, size_t length)
+{
+    return c_gcm_aad(&ctx->gcm, aad, length);
+}
+
+bool c_sm4_gcm_encrypt_update(Sm4GcmContext* ctx, const uint8_t* input, uint8_t* output, size_t length)
+{
+    return c_gcm_encrypt_update(&ctx->gcm, ctx->sm4, sm4_encrypt_blocks_cb, input, output, length);
+}
+
+bool c_sm4_gcm_decrypt_update(Sm4GcmContext* ctx, const uint8_t* input, uint8_t* output, size_t length)
+{
+    return c_gcm_decrypt_update(&ctx->gcm, ctx->sm4, sm4_encrypt_blocks_cb, input, output, length);
+}
+
+void c_sm4_gcm_final(Sm4GcmContext* ctx, uint8_t* tag, size_t tagLen)
+{
+    c_gcm_final(&ctx->gcm, tag, tagLen);
+}
+
+bool c_sm4_gcm_verify(Sm4GcmContext* ctx, const uint8_t* tag, size_t tagLen)
+{
+    return c_gcm_verify(&ctx->gcm, tag, tagLen);
+}
+
+void c_sm4_gcm_encrypt(const Sm4Context* sm4, const uint8_t* iv, size_t ivLen, const uint8_t* aad, size_t aadLen, const uint8_t* input, uint8_t* output, size_t length, uint8_t* tag, size_t tagLen)
+{
+    Sm4GcmContext ctx;
+
+    c_sm4_gcm_init(&ctx, sm4, iv, ivLen);
+    c_sm4_gcm_aad(&ctx, aad, aadLen);
+    c_sm4_gcm_encrypt_update(&ctx, input, output, length);
+    c_sm4_gcm_final(&ctx, tag, tagLen);
+    memset(&ctx, 0, sizeof(ctx));
+}
+
+bool c_sm4_gcm_decrypt(const Sm4Context* sm4, const uint8_t* iv, size_t ivLen, const uint8_t* aad, size_t aadLen, const uint8_t* input, uint8_t* output, size_t length, const uint8_t* tag, size_t tagLen)
+{
+    bool ret;
+    Sm4GcmContext ctx;
+
+    c_sm4_gcm_init(&ctx, sm4, iv, ivLen);
+    c_sm4_gcm_aad(&ctx, aad, aadLen);
+    c_sm4_gcm_decrypt_update(&ctx, input, output, length);
+    ret = c_sm4_gcm_verify(&ctx, tag, tagLen);
+    memset(&ctx, 0, sizeof(ctx));
+    if (!ret) {
+        memset(output, 0, length);
     }
+
+    return ret;
 }
 
+bool c_sm4_xts_setup(Sm4XtsContext* ctx, const uint8_t* key, uint32_t keyLen)
+{
+    if (32 != keyLen) {
+        return false;
+    }
+
+    c_sm4_setup(&ctx->data, key);
+    c_sm4_setup(&ctx->tweak, key + 16);
+
+    return true;
+}
+
+bool c_sm4_xts_encrypt_sectors(const Sm4XtsContext* ctx, const uint8_t* input, uint8_t* output, size_t length, size_t sectorSize, uint64_t startSector)
+{
+    return c_cipher_mode_xts_sectors(&ctx->data, sm4_encrypt_blocks_cb, &ctx->tweak, sm4_encrypt_blocks_cb, input, output, length, sectorSize, startSector);
+}
+
+bool c_sm4_xts_decrypt_sectors(const Sm4XtsContext* ctx, const uint8_t* input, uint8_t* output, size_t length, size_t sectorSize, uint64_t startSector)
+{
+    return c_cipher_mode_xts_sectors(&ctx->data, sm4_decrypt_blocks_cb, &ctx->tweak, sm4_encrypt_blocks_cb, input, output, length, sectorSize, startSector);
+}
+
+#ifndef __KERNEL_MODULE__
+typedef struct _Sm4KeyCacheEntry Sm4KeyCacheEntry;
+
+/**
+ * ctx 必须是第一个成员: release 时由上下文指针直接得到缓存项
+ */
+struct _Sm4KeyCacheEntry
+{
+    Sm4Context              ctx;
+    uint8_t                 key[16];
+    uint64_t                hash;
+    uint32_t                refs;
+    Sm4KeyCacheEntry*       next;               // 哈希桶链表
+    Sm4KeyCacheEntry*       lruPrev;            // 最近使用的在表头
+    Sm4KeyCacheEntry*       lruNext;
+};
+
+struct _Sm4KeyCache
+{
+    pthread_mutex_t         lock;
+    Sm4KeyCacheEntry**      buckets;
+    size_t                  nBuckets;           // 2 的幂
+    size_t                  count;
+    size_t                  capacity;
+    uint64_t                seed;               // 哈希种子, 避免外部构造大量冲突的密钥
+    Sm4KeyCacheEntry*       lruHead;
+    Sm4KeyCacheEntry*       lruTail;
+};
+
+static uint64_t sm4_key_cache_mix(uint64_t x)
+{
+    x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+
+    return x;
+}
+
+static uint64_t sm4_key_cache_hash(const Sm4KeyCache* cache, const uint8_t key[16])
+{
+    uint64_t lo, hi;
+
+    memcpy(&lo, key, sizeof(lo));
+    memcpy(&hi, key + 8, sizeof(hi));
+
+    return sm4_key_cache_mix(sm4_key_cache_mix(lo ^ cache->seed) ^ hi);
+}
+
+static void sm4_key_cache_lru_unlink(Sm4KeyCache* cache, Sm4KeyCacheEntry* e)
+{
+    if (e->lruPrev) { e->lruPrev->lruNext = e->lruNext; } else { cache->lruHead = e->lruNext; }
+    if (e->lruNext) { e->lruNext->lruPrev = e->lruPrev; } else { cache->lruTail = e->lruPrev; }
+    e->lruPrev = e->lruNext = NULL;
+}
+
+static void sm4_key_cache_lru_push(Sm4KeyCache* cache, Sm4KeyCacheEntry* e)
+{
+    e->lruPrev = NULL;
+    e->lruNext = cache->lruHead;
+    if (cache->lruHead) { cache->lruHead->lruPrev = e; } else { cache->lruTail = e; }
+    cache->lruHead = e;
+}
+
+static void sm4_key_cache_entry_free(Sm4KeyCacheEntry* e)
+{
+    memset(e, 0, sizeof(*e));
+    free(e);
+}
+
+/**
+ * 淘汰最久未使用且没有被引用的一项, 调用方持有锁
+ */
+static void sm4_key_cache_evict(Sm4KeyCache* cache)
+{
+    Sm4KeyCacheEntry* e = NULL;
+    Sm4KeyCacheEntry** p = NULL;
+
+    for (e = cache->lruTail; NULL != e && e->refs > 0; e = e->lruPrev);
+    if (NULL == e) {
+        return;
+    }
+
+    for (p = &cache->buckets[e->hash & (cache->nBuckets - 1)]; *p != e; p = &(*p)->next);
+    *p = e->next;
+    sm4_key_cache_lru_unlink(cache, e);
+    --cache->count;
+    sm4_key_cache_entry_free(e);
+}
+
+Sm4KeyCache* c_sm4_key_cache_new(size_t capacity)
+{
+    size_t n = 16;
+    Sm4KeyCache* cache = NULL;
+
+    if (0 == capacity) {
+        return NULL;
+    }
+
+    cache = (Sm4KeyCache*) calloc(1, sizeof(Sm4KeyCache));
+    if (NULL == cache) {
+        return NULL;
+    }
+    while (n < capacity) {
+        n <<= 1;
+    }
+    cache->buckets = (Sm4KeyCacheEntry**) calloc(n, sizeof(Sm4KeyCacheEntry*));
+    if (NULL == cache->buckets) {
+        free(cache);
+        return NULL;
+    }
+    cache->nBuckets = n;
+    cache->capacity = capacity;
+    cache->seed = sm4_key_cache_mix((uint64_t) (uintptr_t) cache ^ (uint64_t) time(NULL) ^ ((uint64_t) clock() << 32));
+    pthread_mutex_init(&cache->lock, NULL);
+
+    return cache;
+}
+
+void c_sm4_key_cache_free(Sm4KeyCache* cache)
+{
+    Sm4KeyCacheEntry* e = NULL;
+    Sm4KeyCacheEntry* next = NULL;
+
+    if (NULL == cache) {
+        return;
+    }
+
+    for (e = cache->lruHead; NULL != e; e = next) {
+        next = e->lruNext;
+        sm4_key_cache_entry_free(e);
+    }
+    pthread_mutex_destroy(&cache->lock);
+    free(cache->buckets);
+    memset(cache, 0, sizeof(*cache));
+    free(cache);
+}
+
+const Sm4Context* c_sm4_key_cache_acquire(Sm4KeyCache* cache, const uint8_t key[16])
+{
+    void* mem = NULL;
+    uint64_t hash = 0;
+    Sm4KeyCacheEntry* e = NULL;
+    Sm4KeyCacheEntry** bucket = NULL;
+
+    if (NULL == cache || NULL == key) {
+        return NULL;
+    }
+
+    hash = sm4_key_cache_hash(cache, key);
+    bucket = &cache->buckets[hash & (cache->nBuckets - 1)];
+
+    pthread_mutex_lock(&cache->lock);
+    for (e = *bucket; NULL != e; e = e->next) {
+        if (e->hash == hash && 0 == memcmp(e->key, key, sizeof(e->key))) {
+            ++e->refs;
+            sm4_key_cache_lru_unlink(cache, e);
+            sm4_key_cache_lru_push(cache, e);
+            pthread_mutex_unlock(&cache->lock);
+            return &e->ctx;
+        }
+    }
+
+    // 未命中: 密钥展开在锁内完成, 同一密钥不会被并发展开两次; 展开本身只需约 1 微秒
+    if (cache->count >= cache->capacity) {
+        sm4_key_cache_evict(cache);
+    }
+    if (0 != posix_memalign(&mem, C_CACHE_LINE_SIZE, sizeof(Sm4KeyCacheEntry))) {
+        pthread_mutex_unlock(&cache->lock);
+        return NULL;
+    }
+    e = (Sm4KeyCacheEntry*) mem;
+    memset(e, 0, sizeof(*e));
+    c_sm4_setup(&e->ctx, key);
+    memcpy(e->key, key, sizeof(e->key));
+    e->hash = hash;
+    e->refs = 1;
+    e->next = *bucket;
+    *bucket = e;
+    sm4_key_cache_lru_push(cache, e);
+    ++cache->count;
+    pthread_mutex_unlock(&cache->lock);
+
+    return &e->ctx;
+}
+
+void c_sm4_key_cache_release(Sm4KeyCache* cache, const Sm4Context* ctx)
+{
+    Sm4KeyCacheEntry* e = (Sm4KeyCacheEntry*) ctx;
+
+    if (NULL == cache || NULL == ctx) {
+        return;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    if (e->refs > 0) {
+        --e->refs;
+    }
+    // 超出容量时(所有项都曾被占用)在这里收回
+    while (cache->count > cache->capacity && NULL != cache->lruTail) {
+        size_t before = cache->count;
+        sm4_key_cache_evict(cache);
+        if (before == cache->count) {
+            break;
+        }
+    }
+    pthread_mutex_unlock(&cache->lock);
+}
+#endif
@@ -22,6 +22,8 @@
 #ifndef purec_PUREC_SM_4_H
 #define purec_PUREC_SM_4_H
 #include "common.h"
+#include "cipher-mode.h"
+#include "gcm.h"
 
 
 C_BEGIN_EXTERN_C
@@ -31,28 +33,143 @@ C_BEGIN_EXTERN_C
 typedef struct _Sm4Context Sm4Context;
 
 
+/**
+ * c_sm4_setup 之后只读: 加解密不修改上下文, 同一个上下文可以被多个线程同时使用
+ */
 struct _Sm4Context
 {
-    uint32_t    enKey[32];  // encrypt key
+    uint32_t    enKey[32] C_ALIGNED(C_CACHE_LINE_SIZE); // encrypt key
     uint32_t    deKey[32];  // decrypt key
-    uint32_t    ulBuf[36];  // used in round
     uint8_t     IV[16];     // initialized value
     uint8_t     iMode;      // ECB/CBC etc
+    uint8_t     simd;       // 可用的 SIMD 实现(运行时检测), 0 表示只用查表实现
 };
 
+/**
+ * 流式 CTR 上下文: 密钥只读引用, 多个流(或多个线程)可以共用同一个 Sm4Context
+ */
+typedef struct
+{
+    const Sm4Context*       sm4;
+    CipherCtrContext        ctr;
+} Sm4CtrContext;
+
+typedef struct
+{
+    const Sm4Context*       sm4;
+    GcmContext              gcm;
+} Sm4GcmContext;
+
+/**
+ * 多消息 CBC 加密中的一条消息, 每条消息有自己的 IV
+ */
+typedef struct
+{
+    uint8_t                 iv[SM4_BLOCK_SIZE];     // 完成后更新为最后一个密文分组
+    const uint8_t*          input;
+    uint8_t*                output;
+    size_t                  length;                 // 只处理完整的分组
+} Sm4CbcStream;
+
+/**
+ * XTS 需要两个独立的 SM4 密钥: 数据密钥与调整值密钥
+ */
+typedef struct
+{
+    Sm4Context              data;
+    Sm4Context              tweak;
+} Sm4XtsContext;
+
 void c_sm4_set_key       (uint32_t SK[32], const uint8_t key[16]);
-void c_sm4_one_round     (uint32_t sk[32], uint8_t input[16], uint8_t output[16], Sm4Context* ctx);
+void c_sm4_one_round     (const uint32_t sk[32], const uint8_t input[16], uint8_t output[16], Sm4Context* ctx);
 
 void c_sm4_setup         (Sm4Context* ctx, const uint8_t key[16]);
-void c_sm4_encrypt_block (Sm4Context* ctx, uint8_t input[16], uint8_t output[16]);
-void c_sm4_decrypt_block (Sm4Context* ctx, uint8_t input[16], uint8_t output[16]);
+void c_sm4_encrypt_block (const Sm4Context* ctx, const uint8_t input[16], uint8_t output[16]);
+void c_sm4_decrypt_block (const Sm4Context* ctx, const uint8_t input[16], uint8_t output[16]);
 
-void c_sm4_encrypt       (Sm4Context* ctx, uint8_t* input, uint8_t* output, int length);
-void c_sm4_decrypt       (Sm4Context* ctx, uint8_t* input, uint8_t* output, int length);
+/**
+ * @brief 批量 ECB 加/解密 nBlocks 个分组, 支持时自动使用 AES-NI/AVX2/GFNI/AVX-512 并行实现
+ * @note input 与 output 可以相同
+ */
+void c_sm4_encrypt_blocks(const Sm4Context* ctx, const uint8_t* input, uint8_t* output, size_t nBlocks);
+void c_sm4_decrypt_blocks(const Sm4Context* ctx, const uint8_t* input, uint8_t* output, size_t nBlocks);
+
+void c_sm4_encrypt       (const Sm4Context* ctx, const uint8_t* input, uint8_t* output, int length);
+void c_sm4_decrypt       (const Sm4Context* ctx, const uint8_t* input, uint8_t* output, int length);
 
-void c_sm4_encrypt_cbc   (Sm4Context* ctx, uint8_t iv[16], uint8_t* input, uint8_t* output, int length);
-void c_sm4_decrypt_cbc   (Sm4Context* ctx, uint8_t iv[16], uint8_t* input, uint8_t* output, int length);
+void c_sm4_encrypt_cbc   (const Sm4Context* ctx, uint8_t iv[16], const uint8_t* input, uint8_t* output, int length);
+void c_sm4_decrypt_cbc   (const Sm4Context* ctx, uint8_t iv[16], const uint8_t* input, uint8_t* output, int length);
+
+/**
+ * @brief 同时 CBC 加密多条互不相关的消息
+ * @note 单条消息的 CBC 加密只能逐分组串行, 这里把不同消息的分组交错成一批交给 SIMD 实现,
+ *       适合批量加密大量短记录; 各消息的长度可以不同
+ */
+void c_sm4_encrypt_cbc_multi    (const Sm4Context* ctx, Sm4CbcStream* streams, size_t nStreams);
+
+/**
+ * @brief SM4-CTR 加/解密(同一操作), 从第 blockOffset 个分组开始, 长度任意
+ * @note 计数器为 128 位大端整数, 第 N 个分组使用 iv + N, 可随机访问
+ */
+void c_sm4_encrypt_ctr          (const Sm4Context* ctx, const uint8_t iv[SM4_BLOCK_SIZE], uint64_t blockOffset, const uint8_t* input, uint8_t* output, size_t length);
+
+/**
+ * @brief 流式 SM4-CTR, 每次 update 的长度任意, 不足一个分组的密钥流保留到下次
+ */
+void c_sm4_ctr_init             (Sm4CtrContext* ctx, const Sm4Context* sm4, const uint8_t iv[SM4_BLOCK_SIZE], uint64_t blockOffset);
+void c_sm4_ctr_seek             (Sm4CtrContext* ctx, uint64_t byteOffset);
+void c_sm4_ctr_update           (Sm4CtrContext* ctx, const uint8_t* input, uint8_t* output, size_t length);
+
+/**
+ * @brief SM4-GCM 认证加密(GB/T 36624), 用法与 c_aes_gcm_* 相同
+ * @note verify 对标签做常数时间比较(tagLen 须为 12 到 16), 失败时调用方必须丢弃已解密的数据
+ */
+void c_sm4_gcm_init             (Sm4GcmContext* ctx, const Sm4Context* sm4, const uint8_t* iv, size_t ivLen);
+bool c_sm4_gcm_aad              (Sm4GcmContext* ctx, const uint8_t* aad, size_t length);
+bool c_sm4_gcm_encrypt_update   (Sm4GcmContext* ctx, const uint8_t* input, uint8_t* output, size_t length);
+bool c_sm4_gcm_decrypt_update   (Sm4GcmContext* ctx, const uint8_t* input, uint8_t* output, size_t length);
+void c_sm4_gcm_final            (Sm4GcmContext* ctx, uint8_t* tag, size_t tagLen);
+bool c_sm4_gcm_verify           (Sm4GcmContext* ctx, const uint8_t* tag, size_t tagLen);
+
+/**
+ * @brief 一次完成的 SM4-GCM
+ * @return 解密时标签不一致返回 false, 并清零 output
+ */
+void c_sm4_gcm_encrypt          (const Sm4Context* sm4, const uint8_t* iv, size_t ivLen, const uint8_t* aad, size_t aadLen, const uint8_t* input, uint8_t* output, size_t length, uint8_t* tag, size_t tagLen);
+bool c_sm4_gcm_decrypt          (const Sm4Context* sm4, const uint8_t* iv, size_t ivLen, const uint8_t* aad, size_t aadLen, const uint8_t* input, uint8_t* output, size_t length, const uint8_t* tag, size_t tagLen);
+
+/**
+ * @brief SM4-XTS 初始化
+ * @param key 数据密钥在前, 调整值密钥在后
+ * @param keyLen 必须为 32
+ * @return 其它长度返回 false
+ */
+bool c_sm4_xts_setup            (Sm4XtsContext* ctx, const uint8_t* key, uint32_t keyLen);
+
+/**
+ * @brief SM4-XTS 按扇区加/解密, 一次可以处理多个连续扇区
+ * @param length 必须是 sectorSize 的整数倍
+ * @param startSector 第一个扇区的扇区号(plain64)
+ * @return 参数不合法返回 false
+ */
+bool c_sm4_xts_encrypt_sectors  (const Sm4XtsContext* ctx, const uint8_t* input, uint8_t* output, size_t length, size_t sectorSize, uint64_t startSector);
+bool c_sm4_xts_decrypt_sectors  (const Sm4XtsContext* ctx, const uint8_t* input, uint8_t* output, size_t length, size_t sectorSize, uint64_t startSector);
+
+#ifndef __KERNEL_MODULE__
+/**
+ * 密钥编排缓存: 以密钥字节为索引共享已展开的 Sm4Context, 避免多租户服务对同一密钥反复展开
+ *
+ * 用法: acquire 返回的上下文只读, 可以被多个线程同时使用, 用完后 release;
+ *       缓存满时淘汰最久未使用且无人引用的项, 所有项都在使用中时允许暂时超出容量
+ * @note 缓存内部加锁, 所有接口都是线程安全的; free 时所有上下文都必须已经 release
+ */
+typedef struct _Sm4KeyCache Sm4KeyCache;
 
+Sm4KeyCache*        c_sm4_key_cache_new         (size_t capacity);
+void                c_sm4_key_cache_free        (Sm4KeyCache* cache);
+const Sm4Context*   c_sm4_key_cache_acquire     (Sm4KeyCache* cache, const uint8_t key[16]);
+void                c_sm4_key_cache_release     (Sm4KeyCache* cache, const Sm4Context* ctx);
+#endif
 
 C_END_EXTERN_C
 
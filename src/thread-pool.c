@@ -19,4 +19,293 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#include "thread-pool.h"
\ No newline at end of file
+#include "thread-pool.h"
+
+#ifndef __KERNEL_MODULE__
+#include <unistd.h>
+#include <pthread.h>
+
+typedef struct _ThreadPoolTask ThreadPoolTask;
+typedef struct _ThreadPoolMap ThreadPoolMap;
+
+struct _ThreadPoolTask
+{
+    ThreadPoolFunc          func;
+    void*                   data;
+    ThreadPoolTask*         next;
+};
+
+struct _ThreadPool
+{
+    pthread_mutex_t         lock;
+    pthread_cond_t          workCond;           // 有新任务或需要退出
+    pthread_cond_t          idleCond;           // 所有任务都已完成
+    ThreadPoolTask*         head;
+    ThreadPoolTask*         tail;
+    size_t                  pending;            // 排队及正在执行的任务数
+    bool                    stop;
+    uint32_t                nThreads;
+    pthread_t*              threads;
+};
+
+/**
+ * 一次 map 调用的共享状态; 下标的分配和完成计数都在 lock 保护下进行.
+ * 调用线程只等待所有下标完成, 不等待排队中的工作线程任务(它们可能因为工作线程都在等待嵌套的 map 而无法执行),
+ * 所以结构体按引用计数释放
+ */
+struct _ThreadPoolMap
+{
+    pthread_mutex_t         lock;
+    pthread_cond_t          doneCond;
+    ThreadPoolMapFunc       func;
+    void*                   data;
+    size_t                  count;
+    size_t                  next;
+    size_t                  done;
+    uint32_t                refs;               // 调用线程及尚未结束的工作线程任务
+};
+
+static void* thread_pool_worker(void* arg)
+{
+    ThreadPool* pool = (ThreadPool*) arg;
+    ThreadPoolTask* task = NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    while (true) {
+        while (NULL == pool->head && !pool->stop) {
+            pthread_cond_wait(&pool->workCond, &pool->lock);
+        }
+        if (NULL == pool->head) {
+            break;
+        }
+        task = pool->head;
+        pool->head = task->next;
+        if (NULL == pool->head) {
+            pool->tail = NULL;
+        }
+        pthread_mutex_unlock(&pool->lock);
+
+        task->func(task->data);
+        free(task);
+
+        pthread_mutex_lock(&pool->lock);
+        if (0 == --pool->pending) {
+            pthread_cond_broadcast(&pool->idleCond);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+/**
+ * 取下标执行直到分完
+ */
+static void thread_pool_map_run(ThreadPoolMap* map)
+{
+    size_t index;
+
+    pthread_mutex_lock(&map->lock);
+    while (map->next < map->count) {
+        index = map->next++;
+        pthread_mutex_unlock(&map->lock);
+
+        map->func(map->data, index);
+
+        pthread_mutex_lock(&map->lock);
+        if (++map->done == map->count) {
+            pthread_cond_broadcast(&map->doneCond);
+        }
+    }
+    pthread_mutex_unlock(&map->lock);
+}
+
+static void thread_pool_map_unref(ThreadPoolMap* map)
+{
+    uint32_t refs;
+
+    pthread_mutex_lock(&map->lock);
+    refs = --map->refs;
+    pthread_mutex_unlock(&map->lock);
+
+    if (0 == refs) {
+        pthread_cond_destroy(&map->doneCond);
+        pthread_mutex_destroy(&map->lock);
+        free(map);
+    }
+}
+
+static void thread_pool_map_task(void* data)
+{
+    ThreadPoolMap* map = (ThreadPoolMap*) data;
+
+    thread_pool_map_run(map);
+    thread_pool_map_unref(map);
+}
+
+ThreadPool* c_thread_pool_new(uint32_t nThreads)
+{
+    long n = 0;
+    uint32_t i;
+    ThreadPool* pool = NULL;
+
+    if (0 == nThreads) {
+        n = sysconf(_SC_NPROCESSORS_ONLN);
+        nThreads = (n > 0) ? (uint32_t) n : 1;
+    }
+
+    pool = (ThreadPool*) calloc(1, sizeof(ThreadPool));
+    if (NULL == pool) {
+        return NULL;
+    }
+    pool->threads = (pthread_t*) calloc(nThreads, sizeof(pthread_t));
+    if (NULL == pool->threads) {
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->workCond, NULL);
+    pthread_cond_init(&pool->idleCond, NULL);
+
+    for (i = 0; i < nThreads; i++) {
+        if (0 != pthread_create(&pool->threads[i], NULL, thread_pool_worker, pool)) {
+            break;
+        }
+    }
+    pool->nThreads = i;
+    if (0 == pool->nThreads) {
+        c_thread_pool_free(pool);
+        return NULL;
+    }
+
+    return pool;
+}
+
+void c_thread_pool_free(ThreadPool* pool)
+{
+    uint32_t i;
+
+    if (NULL == pool) {
+        return;
+    }
+
+    c_thread_pool_wait(pool);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->workCond);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < pool->nThreads; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->idleCond);
+    pthread_cond_destroy(&pool->workCond);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+uint32_t c_thread_pool_get_threads(const ThreadPool* pool)
+{
+    return pool ? pool->nThreads : 0;
+}
+
+bool c_thread_pool_submit(ThreadPool* pool, ThreadPoolFunc func, void* data)
+{
+    ThreadPoolTask* task = NULL;
+
+    if (NULL == pool || NULL == func) {
+        return false;
+    }
+
+    task = (ThreadPoolTask*) malloc(sizeof(ThreadPoolTask));
+    if (NULL == task) {
+        return false;
+    }
+    task->func = func;
+    task->data = data;
+    task->next = NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->tail) {
+        pool->tail->next = task;
+    }
+    else {
+        pool->head = task;
+    }
+    pool->tail = task;
+    ++pool->pending;
+    pthread_cond_signal(&pool->workCond);
+    pthread_mutex_unlock(&pool->lock);
+
+    return true;
+}
+
+void c_thread_pool_wait(ThreadPool* pool)
+{
+    if (NULL == pool) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->idleCond, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void c_thread_pool_map(ThreadPool* pool, ThreadPoolMapFunc func, void* data, size_t count)
+{
+    uint32_t i, n;
+    size_t index;
+    ThreadPoolMap* map = NULL;
+
+    if (NULL == func || 0 == count) {
+        return;
+    }
+
+    // 调用线程自己也执行, 所以最多再需要 count - 1 个工作线程
+    n = pool ? (uint32_t) C_MIN((size_t) pool->nThreads, count - 1) : 0;
+    if (n > 0) {
+        map = (ThreadPoolMap*) calloc(1, sizeof(ThreadPoolMap));
+    }
+    if (NULL == map) {
+        for (index = 0; index < count; index++) {
+            func(data, index);
+        }
+        return;
+    }
+
+    map->func = func;
+    map->data = data;
+    map->count = count;
+    map->refs = 1;
+    pthread_mutex_init(&map->lock, NULL);
+    pthread_cond_init(&map->doneCond, NULL);
+
+    // 提交失败的部分由调用线程完成
+    for (i = 0; i < n; i++) {
+        pthread_mutex_lock(&map->lock);
+        ++map->refs;
+        pthread_mutex_unlock(&map->lock);
+        if (!c_thread_pool_submit(pool, thread_pool_map_task, map)) {
+            pthread_mutex_lock(&map->lock);
+            --map->refs;
+            pthread_mutex_unlock(&map->lock);
+            break;
+        }
+    }
+
+    thread_pool_map_run(map);
+
+    pthread_mutex_lock(&map->lock);
+    while (map->done < map->count) {
+        pthread_cond_wait(&map->doneCond, &map->lock);
+    }
+    pthread_mutex_unlock(&map->lock);
+
+    thread_pool_map_unref(map);
+}
+#endif
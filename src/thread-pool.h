@@ -27,6 +27,49 @@
 
 C_BEGIN_EXTERN_C
 
+/**
+ * 固定数量工作线程的线程池
+ *
+ * 用法: submit 提交的任务按先进先出顺序由任一工作线程执行, wait 等待所有已提交的任务完成;
+ *       map 把 [0, count) 的下标分给工作线程与调用线程共同执行, 返回时全部完成.
+ * @note 所有接口都是线程安全的; map 可以在任务内部调用(调用线程自己也会取下标执行, 不会死锁)
+ */
+typedef struct _ThreadPool ThreadPool;
+
+typedef void (*ThreadPoolFunc)      (void* data);
+typedef void (*ThreadPoolMapFunc)   (void* data, size_t index);
+
+/**
+ * @brief 创建线程池
+ * @param nThreads 工作线程数, 为 0 时使用在线 CPU 数
+ * @return 失败返回 NULL
+ */
+ThreadPool*     c_thread_pool_new           (uint32_t nThreads);
+
+/**
+ * @brief 等待所有已提交的任务完成后销毁线程池
+ */
+void            c_thread_pool_free          (ThreadPool* pool);
+
+uint32_t        c_thread_pool_get_threads   (const ThreadPool* pool);
+
+/**
+ * @brief 提交一个异步任务
+ * @return 内存不足返回 false
+ */
+bool            c_thread_pool_submit        (ThreadPool* pool, ThreadPoolFunc func, void* data);
+
+/**
+ * @brief 等待所有已提交的任务完成
+ */
+void            c_thread_pool_wait          (ThreadPool* pool);
+
+/**
+ * @brief 并行执行 func(data, 0) ... func(data, count - 1), 全部完成后返回
+ * @note pool 为 NULL 时在调用线程中依次执行
+ */
+void            c_thread_pool_map           (ThreadPool* pool, ThreadPoolMapFunc func, void* data, size_t count);
+
 C_END_EXTERN_C
 
 #endif
@@ -21,16 +21,218 @@
  */
 #include "utils-str.h"
 
+#include "utils-sys.h"
 
-void c_utils_str_hex2str(uint8_t* dest, const uint8_t* hex, uint32_t hexBytes)
+#ifdef C_SYS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+static const char gsHexDigits[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+};
+
+static void hex_encode_generic(char* dest, const uint8_t* src, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        dest[2 * i] = gsHexDigits[src[i] >> 4];
+        dest[2 * i + 1] = gsHexDigits[src[i] & 0x0F];
+    }
+}
+
+/**
+ * 非十六进制字符返回 -1
+ */
+static int hex_value(uint8_t c)
 {
-    uint32_t i = 0;
-    for (i = 0; i < hexBytes; i++) {
-        sprintf((char*) dest, "%02x", *(uint8_t*) hex);
-        ++hex;
-        dest += 2;
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    c |= 0x20;
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
     }
-    *dest = '\0';
+
+    return -1;
+}
+
+static bool hex_decode_generic(uint8_t* dest, const char* src, size_t len)
+{
+    int hi, lo;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        hi = hex_value((uint8_t) src[2 * i]);
+        lo = hex_value((uint8_t) src[2 * i + 1]);
+        if (hi < 0 || lo < 0) {
+            return false;
+        }
+        dest[i] = (uint8_t) ((hi << 4) | lo);
+    }
+
+    return true;
+}
+
+#ifdef C_SYS_X86_SIMD
+/**
+ * 编码: 高低半字节用 pshufb 查表得到字符再交错
+ * 解码: 分别判断数字和字母, pmaddubsw 把相邻两个半字节合成一个字节
+ */
+C_SYS_TARGET("ssse3")
+static size_t hex_encode_ssse3(char* dest, const uint8_t* src, size_t len)
+{
+    size_t i;
+    __m128i x, hi, lo;
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i lut = _mm_loadu_si128((const __m128i*) gsHexDigits);
+
+    for (i = 0; i + 16 <= len; i += 16) {
+        x = _mm_loadu_si128((const __m128i*) (src + i));
+        hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+        lo = _mm_shuffle_epi8(lut, _mm_and_si128(x, mask));
+        _mm_storeu_si128((__m128i*) (dest + 2 * i), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i*) (dest + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+
+    return i;
+}
+
+C_SYS_TARGET("ssse3")
+static __m128i hex_decode_ssse3_16(const char* src, int* valid)
+{
+    __m128i c, d, l, dm, lm;
+
+    c = _mm_loadu_si128((const __m128i*) src);
+    d = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    l = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    dm = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+    lm = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+    *valid &= (0xFFFF == _mm_movemask_epi8(_mm_or_si128(dm, lm)));
+    d = _mm_or_si128(_mm_and_si128(dm, d), _mm_and_si128(lm, _mm_add_epi8(l, _mm_set1_epi8(10))));
+
+    return _mm_maddubs_epi16(d, _mm_set1_epi16(0x0110));
+}
+
+C_SYS_TARGET("ssse3")
+static size_t hex_decode_ssse3(uint8_t* dest, const char* src, size_t len, bool* ok)
+{
+    size_t i;
+    int valid = 1;
+    __m128i a, b;
+
+    for (i = 0; valid && i + 16 <= len; i += 16) {
+        a = hex_decode_ssse3_16(src + 2 * i, &valid);
+        b = hex_decode_ssse3_16(src + 2 * i + 16, &valid);
+        _mm_storeu_si128((__m128i*) (dest + i), _mm_packus_epi16(a, b));
+    }
+    *ok = valid;
+
+    return i;
+}
+
+C_SYS_TARGET("avx2")
+static size_t hex_encode_avx2(char* dest, const uint8_t* src, size_t len)
+{
+    size_t i;
+    __m256i x, hi, lo, a, b;
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) gsHexDigits));
+
+    for (i = 0; i + 32 <= len; i += 32) {
+        x = _mm256_loadu_si256((const __m256i*) (src + i));
+        hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(x, 4), mask));
+        lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(x, mask));
+        // unpack 在 128 位内进行, 结果是 [0..7 | 16..23] 和 [8..15 | 24..31]
+        a = _mm256_unpacklo_epi8(hi, lo);
+        b = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256((__m256i*) (dest + 2 * i), _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256((__m256i*) (dest + 2 * i + 32), _mm256_permute2x128_si256(a, b, 0x31));
+    }
+
+    return i;
+}
+
+C_SYS_TARGET("avx2")
+static __m256i hex_decode_avx2_32(const char* src, int* valid)
+{
+    __m256i c, d, l, dm, lm;
+
+    c = _mm256_loadu_si256((const __m256i*) src);
+    d = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+    l = _mm256_sub_epi8(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    dm = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+    lm = _mm256_cmpeq_epi8(_mm256_min_epu8(l, _mm256_set1_epi8(5)), l);
+    *valid &= (-1 == _mm256_movemask_epi8(_mm256_or_si256(dm, lm)));
+    d = _mm256_or_si256(_mm256_and_si256(dm, d), _mm256_and_si256(lm, _mm256_add_epi8(l, _mm256_set1_epi8(10))));
+
+    return _mm256_maddubs_epi16(d, _mm256_set1_epi16(0x0110));
+}
+
+C_SYS_TARGET("avx2")
+static size_t hex_decode_avx2(uint8_t* dest, const char* src, size_t len, bool* ok)
+{
+    size_t i;
+    int valid = 1;
+    __m256i a, b;
+
+    for (i = 0; valid && i + 32 <= len; i += 32) {
+        a = hex_decode_avx2_32(src + 2 * i, &valid);
+        b = hex_decode_avx2_32(src + 2 * i + 32, &valid);
+        // pack 同样在 128 位内进行, 调整为 64 位单元的 0 2 1 3 顺序
+        _mm256_storeu_si256((__m256i*) (dest + i), _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+    }
+    *ok = valid;
+
+    return i;
+}
+#endif
+
+void c_utils_str_hex_encode(char* dest, const uint8_t* src, size_t len)
+{
+    size_t done = 0;
+#ifdef C_SYS_X86_SIMD
+    uint32_t f = c_utils_sys_get_cpu_features();
+
+    if (len >= 32 && C_FLAG_ON(f, C_SYS_CPU_AVX2)) {
+        done = hex_encode_avx2(dest, src, len);
+    }
+    else if (len >= 16 && C_FLAG_ON(f, C_SYS_CPU_SSSE3)) {
+        done = hex_encode_ssse3(dest, src, len);
+    }
+#endif
+
+    hex_encode_generic(dest + 2 * done, src + done, len - done);
+}
+
+bool c_utils_str_hex_decode(uint8_t* dest, const char* src, size_t srcLen)
+{
+    size_t done = 0, len = srcLen / 2;
+    bool ok = true;
+#ifdef C_SYS_X86_SIMD
+    uint32_t f = c_utils_sys_get_cpu_features();
+#endif
+
+    if (srcLen & 1) {
+        return false;
+    }
+
+#ifdef C_SYS_X86_SIMD
+    if (len >= 32 && C_FLAG_ON(f, C_SYS_CPU_AVX2)) {
+        done = hex_decode_avx2(dest, src, len, &ok);
+    }
+    else if (len >= 16 && C_FLAG_ON(f, C_SYS_CPU_SSSE3)) {
+        done = hex_decode_ssse3(dest, src, len, &ok);
+    }
+#endif
+
+    return ok && hex_decode_generic(dest + done, src + 2 * done, len - done);
+}
+
+void c_utils_str_hex2str(uint8_t* dest, const uint8_t* hex, uint32_t hexBytes)
+{
+    c_utils_str_hex_encode((char*) dest, hex, hexBytes);
+    dest[2 * (size_t) hexBytes] = '\0';
 }
 
 int c_utils_str_get_file_name_and_dir (C_IN const uint8_t* filePath, C_IN_OUT uint8_t* fileName, C_IN uint32_t fileNameLen, C_IN_OUT uint8_t* dirPath, C_IN uint32_t dirPathLen)
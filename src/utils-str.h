@@ -35,6 +35,18 @@ C_BEGIN_EXTERN_C
  */
 void        c_utils_str_hex2str                 (C_OUT uint8_t* dest, C_IN const uint8_t* hex, C_IN uint32_t hexBytes);
 
+/**
+ * @brief 十六进制编码(小写), 向 dest 写入 2 * len 个字符, 不写结尾的 '\0'
+ * @note 长数据使用 SSSE3/AVX2 实现
+ */
+void        c_utils_str_hex_encode              (C_OUT char* dest, C_IN const uint8_t* src, C_IN size_t len);
+
+/**
+ * @brief 十六进制解码(大小写均可), 向 dest 写入 srcLen / 2 个字节
+ * @return srcLen 为奇数或包含非十六进制字符时返回 false, 此时 dest 的内容不确定
+ */
+bool        c_utils_str_hex_decode              (C_OUT uint8_t* dest, C_IN const char* src, C_IN size_t srcLen);
+
 /**
  * @brief 获取路径中的文件夹和文件
  * @param filePath
@@ -27,6 +27,16 @@
 #include <sys/mman.h>
 #include <sys/resource.h>
 
+#ifdef C_SYS_X86_SIMD
+#include <cpuid.h>
+#endif
+
+#define CPU_FEATURES_UNKNOWN        0xFFFFFFFFU
+
+static uint32_t gsCpuFeatures       = CPU_FEATURES_UNKNOWN;
+static uint32_t gsCpuFeaturesReal   = CPU_FEATURES_UNKNOWN;
+
+static uint32_t cpu_features_detect (void);
 
 uint64_t c_utils_sys_get_page_size (void)
 {
@@ -34,4 +44,92 @@ uint64_t c_utils_sys_get_page_size (void)
     return r <= 0 ? 4096 : (size_t)r;
 }
 
+uint32_t c_utils_sys_get_cpu_features (void)
+{
+    if (CPU_FEATURES_UNKNOWN == gsCpuFeatures) {
+        if (CPU_FEATURES_UNKNOWN == gsCpuFeaturesReal) {
+            gsCpuFeaturesReal = cpu_features_detect();
+        }
+        gsCpuFeatures = gsCpuFeaturesReal;
+    }
+
+    return gsCpuFeatures;
+}
+
+void c_utils_sys_set_cpu_features (uint32_t features)
+{
+    if (CPU_FEATURES_UNKNOWN == gsCpuFeaturesReal) {
+        gsCpuFeaturesReal = cpu_features_detect();
+    }
+    gsCpuFeatures = features & gsCpuFeaturesReal;
+}
+
+#ifdef C_SYS_X86_SIMD
+C_SYS_TARGET("xsave")
+static uint64_t cpu_xgetbv (void)
+{
+    uint32_t eax = 0, edx = 0;
+    __asm__ volatile ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t) edx << 32) | eax;
+}
+#endif
+
+static uint32_t cpu_features_detect (void)
+{
+    uint32_t features = 0;
+#ifdef C_SYS_X86_SIMD
+    uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+    uint32_t maxLeaf = 0;
+    uint64_t xcr0 = 0;
+    bool osAvx = false;
+    bool osAvx512 = false;
+
+    maxLeaf = __get_cpuid_max(0, NULL);
+    if (maxLeaf < 1) {
+        return 0;
+    }
+
+    __cpuid(1, eax, ebx, ecx, edx);
+    if (edx & (1U << 26)) { features |= C_SYS_CPU_SSE2; }
+    if (ecx & (1U << 9))  { features |= C_SYS_CPU_SSSE3; }
+    if (ecx & (1U << 19)) { features |= C_SYS_CPU_SSE41; }
+    if (ecx & (1U << 25)) { features |= C_SYS_CPU_AESNI; }
+    if (ecx & (1U << 1))  { features |= C_SYS_CPU_PCLMUL; }
+
+    // OSXSAVE: 操作系统负责保存 YMM/ZMM 状态, 否则不能使用 AVX 系列指令
+    if (ecx & (1U << 27)) {
+        xcr0 = cpu_xgetbv();
+        osAvx = ((xcr0 & 0x06) == 0x06);
+        osAvx512 = osAvx && ((xcr0 & 0xE0) == 0xE0);
+    }
+    if (osAvx && (ecx & (1U << 28))) {
+        features |= C_SYS_CPU_AVX;
+    }
+
+    if (maxLeaf >= 7) {
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        if ((features & C_SYS_CPU_AVX) && (ebx & (1U << 5))) {
+            features |= C_SYS_CPU_AVX2;
+        }
+        if (osAvx512 && (ebx & (1U << 16))) {
+            features |= C_SYS_CPU_AVX512F;
+            if (ebx & (1U << 30)) {
+                features |= C_SYS_CPU_AVX512BW;
+            }
+        }
+        if (ebx & (1U << 8))  { features |= C_SYS_CPU_BMI2; }
+        if (ebx & (1U << 19)) { features |= C_SYS_CPU_ADX; }
+        if (ecx & (1U << 8))  { features |= C_SYS_CPU_GFNI; }
+        if ((features & C_SYS_CPU_AVX) && (ecx & (1U << 9))) {
+            features |= C_SYS_CPU_VAES;
+        }
+        if ((features & C_SYS_CPU_AVX) && (ecx & (1U << 10))) {
+            features |= C_SYS_CPU_VPCLMUL;
+        }
+    }
+#endif
+
+    return features;
+}
+
 #endif
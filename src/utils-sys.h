@@ -23,13 +23,49 @@
 #define purec_PUREC_UTILS_SYS_H
 #include "common.h"
 
+/* x86 SIMD 加速路径: 只在用户态 + GCC/Clang 下启用, 运行时再通过 CPUID 选择 */
+#if !defined(__KERNEL_MODULE__) && (defined(__x86_64__) || defined(__i386__)) && (C_GNUC_CHECK_VERSION(4, 9) || defined(__clang__))
+#define C_SYS_X86_SIMD                              1
+#define C_SYS_TARGET(_isa)                          __attribute__((target(_isa)))
+#endif
+
+/* CPU 特性 -- start */
+#define C_SYS_CPU_SSE2                              (1U << 0)
+#define C_SYS_CPU_SSSE3                             (1U << 1)
+#define C_SYS_CPU_SSE41                             (1U << 2)
+#define C_SYS_CPU_AESNI                             (1U << 3)
+#define C_SYS_CPU_PCLMUL                            (1U << 4)
+#define C_SYS_CPU_AVX                               (1U << 5)
+#define C_SYS_CPU_AVX2                              (1U << 6)
+#define C_SYS_CPU_AVX512F                           (1U << 7)
+#define C_SYS_CPU_AVX512BW                          (1U << 8)
+#define C_SYS_CPU_GFNI                              (1U << 9)
+#define C_SYS_CPU_VAES                              (1U << 10)
+#define C_SYS_CPU_VPCLMUL                           (1U << 11)
+#define C_SYS_CPU_BMI2                              (1U << 12)
+#define C_SYS_CPU_ADX                               (1U << 13)
+/* CPU 特性 -- end   */
+
 #ifndef __KERNEL_MODULE__
 
 C_BEGIN_EXTERN_C
 
 uint64_t    c_utils_sys_get_page_size               (void);
 
+/**
+ * @brief 获取当前 CPU 支持的指令集特性(C_SYS_CPU_*), 结果只检测一次并缓存
+ * @note 对 AVX/AVX-512 同时检查了操作系统是否保存对应寄存器(XGETBV)
+ * @return 特性位掩码, 非 x86 平台返回 0
+ */
+uint32_t    c_utils_sys_get_cpu_features            (void);
+
+/**
+ * @brief 覆盖 c_utils_sys_get_cpu_features() 的返回值, 用于测试或基准比较(如强制走软件实现)
+ * @param features 只会保留 CPU 真实支持的位
+ */
+void        c_utils_sys_set_cpu_features            (uint32_t features);
+
 C_END_EXTERN_C
 #endif
 
-#endif // purec_PUREC_UTILS_SYS_H
\ No newline at end of file
+#endif // purec_PUREC_UTILS_SYS_H
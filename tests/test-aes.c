@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+
+#include "../src/aes.h"
+#include "../src/encrypt.h"
+#include "../src/utils-sys.h"
+
+static int check (const char* name, const uint8_t* out, const uint8_t* expect, size_t len)
+{
+    if (0 != memcmp(out, expect, len)) {
+        printf("%s: FAILED\n", name);
+        return 1;
+    }
+    printf("%s: OK\n", name);
+    return 0;
+}
+
+static int test_fips197 (void)
+{
+    static const uint8_t pt[16] = {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+    };
+    static const uint8_t ct[3][16] = {
+        { 0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a },
+        { 0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0, 0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91 },
+        { 0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf, 0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89 },
+    };
+    int i, err = 0;
+    uint8_t key[32];
+    uint8_t buf[16];
+    AesContext ctx;
+
+    for (i = 0; i < 32; i++) {
+        key[i] = (uint8_t) i;
+    }
+
+    for (i = 0; i < 3; i++) {
+        c_aes_setup(&ctx, key, 16 + 8 * i);
+        c_aes_encrypt_block(&ctx, (uint8_t*) pt, buf);
+        err += check("FIPS-197 encrypt", buf, ct[i], 16);
+        c_aes_decrypt_block(&ctx, buf, buf);
+        err += check("FIPS-197 decrypt", buf, pt, 16);
+    }
+
+    return err;
+}
+
+static int test_key_schedule (uint32_t features)
+{
+    int i, n, err = 0;
+    uint8_t key[32];
+    AesContext hw, sw;
+
+    for (n = 0; n < 3; n++) {
+        for (i = 0; i < 32; i++) {
+            key[i] = (uint8_t) (i * 37 + n * 11 + 5);
+        }
+        c_utils_sys_set_cpu_features(features);
+        c_aes_setup(&hw, key, 16 + 8 * n);
+        c_utils_sys_set_cpu_features(0);
+        c_aes_setup(&sw, key, 16 + 8 * n);
+        err += check("key schedule (enKey)", (uint8_t*) hw.enKey, (uint8_t*) sw.enKey, 4 * 4 * (sw.nRound + 1));
+        err += check("key schedule (deKey)", (uint8_t*) hw.deKey, (uint8_t*) sw.deKey, 4 * 4 * (sw.nRound + 1));
+        err += check("key schedule (IV)", hw.IV, sw.IV, AES_BLOCK_SIZE);
+    }
+    c_utils_sys_set_cpu_features(features);
+
+    return err;
+}
+
+static int test_bulk (void)
+{
+    int n, k, err = 0;
+    uint8_t key[32];
+    uint8_t iv[16];
+    uint8_t in[40 * 16 + 7];
+    uint8_t out[40 * 16 + 7];
+    uint8_t ref[40 * 16 + 7];
+    AesContext ctx;
+
+    for (n = 0; n < (int) sizeof(in); n++) {
+        in[n] = (uint8_t) (n * 7 + 3);
+    }
+    for (n = 0; n < 32; n++) {
+        key[n] = (uint8_t) (n * 13 + 1);
+    }
+    memset(iv, 0x5a, sizeof(iv));
+
+    for (k = 16; k <= 32; k += 8) {
+        c_aes_setup(&ctx, key, k);
+        for (n = 0; n < 40; n++) {
+            int i;
+            for (i = 0; i < n; i++) {
+                c_aes_encrypt_block(&ctx, in + 16 * i, ref + 16 * i);
+            }
+            c_aes_encrypt_blocks(&ctx, in, out, n);
+            err += (0 != memcmp(out, ref, 16 * n));
+            c_aes_decrypt_blocks(&ctx, out, out, n);
+            err += (0 != memcmp(out, in, 16 * n));
+        }
+
+        memcpy(out, in, sizeof(in));
+        c_encrypt_encode_aes_real(out, sizeof(out), key, k, iv, ENC_MODE_CBC);
+        c_encrypt_decode_aes_real(out, sizeof(out), key, k, iv, ENC_MODE_CBC);
+        err += (0 != memcmp(out, in, sizeof(in)));
+
+        memcpy(out, in, sizeof(in));
+        c_encrypt_encode_aes_ecb(out, sizeof(out), key, k);
+        c_encrypt_decode_aes_ecb(out, sizeof(out), key, k);
+        err += (0 != memcmp(out, in, sizeof(in)));
+    }
+    printf("bulk ECB / CBC: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+static int test_ctr (void)
+{
+    static const uint8_t key[16] = {
+        0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c,
+    };
+    static const uint8_t iv[16] = {
+        0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+    };
+    // NIST SP 800-38A F.5.1
+    static const uint8_t pt[64] = {
+        0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+        0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+        0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+        0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10,
+    };
+    static const uint8_t ct[64] = {
+        0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26, 0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+        0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff, 0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+        0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e, 0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+        0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1, 0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee,
+    };
+    int i, n, err = 0;
+    uint8_t buf[64], all[1000], part[1000];
+    AesContext ctx;
+    AesCtrContext stream;
+
+    c_aes_setup_real(&ctx, key, 16, NULL, ENC_MODE_CTR);
+
+    c_aes_encrypt_ctr(&ctx, iv, 0, pt, buf, sizeof(pt));
+    err += check("AES-128-CTR", buf, ct, sizeof(ct));
+
+    // 从第 2 个分组开始单独解密
+    c_aes_encrypt_ctr(&ctx, iv, 2, ct + 32, buf, 32);
+    err += check("AES-128-CTR offset", buf, pt + 32, 32);
+
+    memcpy(buf, pt, sizeof(pt));
+    err += !c_encrypt_encode_aes_ctr(buf, sizeof(buf), key, 16, iv, 0);
+    err += check("c_encrypt_encode_aes_ctr", buf, ct, sizeof(ct));
+    err += c_encrypt_encode_aes_ctr(buf, sizeof(buf), key, 16, NULL, 0);
+    err += check("c_encrypt_encode_aes_ctr without iv", buf, ct, sizeof(ct));
+    err += c_encrypt_decode_aes_real(buf, sizeof(buf), key, 16, NULL, ENC_MODE_CTR);
+    err += check("c_encrypt_decode_aes_real CTR without iv", buf, ct, sizeof(ct));
+    err += !c_encrypt_decode_aes_real(buf, sizeof(buf), key, 16, (uint8_t*) iv, ENC_MODE_CTR);
+    err += check("c_encrypt_decode_aes_real CTR", buf, pt, sizeof(pt));
+    err += !c_encrypt_encode_aes_real(buf, sizeof(buf), key, 16, (uint8_t*) iv, ENC_MODE_CTR);
+    err += check("c_encrypt_encode_aes_real CTR", buf, ct, sizeof(ct));
+
+    // 流式: 任意切分长度结果与一次处理相同
+    for (i = 0; i < (int) sizeof(all); i++) {
+        all[i] = (uint8_t) (i * 7);
+    }
+    c_aes_encrypt_ctr(&ctx, iv, 0, all, all, sizeof(all));
+    for (n = 1; n < 40; n += 3) {
+        for (i = 0; i < (int) sizeof(part); i++) {
+            part[i] = (uint8_t) (i * 7);
+        }
+        c_aes_ctr_init(&stream, &ctx, iv, 0);
+        for (i = 0; i < (int) sizeof(part); i += n) {
+            c_aes_ctr_update(&stream, part + i, part + i, C_MIN(n, (int) sizeof(part) - i));
+        }
+        err += (0 != memcmp(part, all, sizeof(all)));
+    }
+
+    // seek 到任意字节位置
+    for (n = 0; n < 100; n += 7) {
+        for (i = 0; i < (int) sizeof(part); i++) {
+            part[i] = (uint8_t) (i * 7);
+        }
+        c_aes_ctr_init(&stream, &ctx, iv, 0);
+        c_aes_ctr_seek(&stream, n);
+        c_aes_ctr_update(&stream, part + n, part + n, sizeof(part) - n);
+        err += (0 != memcmp(part + n, all + n, sizeof(all) - n));
+    }
+    printf("AES-CTR stream / seek: %s\n", err ? "FAILED" : "OK");
+
+    // 计数器按 128 位进位
+    memset(buf, 0xff, 16);
+    c_aes_encrypt_ctr(&ctx, buf, 1, pt, buf + 16, 16);
+    memset(buf, 0, 16);
+    c_aes_encrypt_ctr(&ctx, buf, 0, pt, buf + 32, 16);
+    err += check("AES-CTR counter wrap", buf + 16, buf + 32, 16);
+
+    return err;
+}
+
+static int test_gcm (void)
+{
+    // The Galois/Counter Mode of Operation (GCM), 测试用例 2 / 4 / 6
+    static const uint8_t c2[16] = {
+        0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92, 0xf3, 0x28, 0xc2, 0xb9, 0x71, 0xb2, 0xfe, 0x78,
+    };
+    static const uint8_t t2[16] = {
+        0xab, 0x6e, 0x47, 0xd4, 0x2c, 0xec, 0x13, 0xbd, 0xf5, 0x3a, 0x67, 0xb2, 0x12, 0x57, 0xbd, 0xdf,
+    };
+    static const uint8_t key[16] = {
+        0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+    };
+    static const uint8_t pt[60] = {
+        0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+        0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda, 0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+        0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+        0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57, 0xba, 0x63, 0x7b, 0x39,
+    };
+    static const uint8_t aad[20] = {
+        0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+        0xab, 0xad, 0xda, 0xd2,
+    };
+    static const uint8_t iv4[12] = {
+        0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88,
+    };
+    static const uint8_t c4[60] = {
+        0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+        0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0, 0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+        0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c, 0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+        0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91,
+    };
+    static const uint8_t t4[16] = {
+        0x5b, 0xc9, 0x4f, 0xbc, 0x32, 0x21, 0xa5, 0xdb, 0x94, 0xfa, 0xe9, 0x5a, 0xe7, 0x12, 0x1a, 0x47,
+    };
+    static const uint8_t iv6[60] = {
+        0x93, 0x13, 0x22, 0x5d, 0xf8, 0x84, 0x06, 0xe5, 0x55, 0x90, 0x9c, 0x5a, 0xff, 0x52, 0x69, 0xaa,
+        0x6a, 0x7a, 0x95, 0x38, 0x53, 0x4f, 0x7d, 0xa1, 0xe4, 0xc3, 0x03, 0xd2, 0xa3, 0x18, 0xa7, 0x28,
+        0xc3, 0xc0, 0xc9, 0x51, 0x56, 0x80, 0x95, 0x39, 0xfc, 0xf0, 0xe2, 0x42, 0x9a, 0x6b, 0x52, 0x54,
+        0x16, 0xae, 0xdb, 0xf5, 0xa0, 0xde, 0x6a, 0x57, 0xa6, 0x37, 0xb3, 0x9b,
+    };
+    static const uint8_t c6[60] = {
+        0x8c, 0xe2, 0x49, 0x98, 0x62, 0x56, 0x15, 0xb6, 0x03, 0xa0, 0x33, 0xac, 0xa1, 0x3f, 0xb8, 0x94,
+        0xbe, 0x91, 0x12, 0xa5, 0xc3, 0xa2, 0x11, 0xa8, 0xba, 0x26, 0x2a, 0x3c, 0xca, 0x7e, 0x2c, 0xa7,
+        0x01, 0xe4, 0xa9, 0xa4, 0xfb, 0xa4, 0x3c, 0x90, 0xcc, 0xdc, 0xb2, 0x81, 0xd4, 0x8c, 0x7c, 0x6f,
+        0xd6, 0x28, 0x75, 0xd2, 0xac, 0xa4, 0x17, 0x03, 0x4c, 0x34, 0xae, 0xe5,
+    };
+    static const uint8_t t6[16] = {
+        0x61, 0x9c, 0xc5, 0xae, 0xff, 0xfe, 0x0b, 0xfa, 0x46, 0x2a, 0xf4, 0x3c, 0x16, 0x99, 0xd0, 0x50,
+    };
+    int i, n, err = 0;
+    uint32_t features;
+    uint8_t zero[16], buf[64], tag[16], tag2[16], all[1000], part[1000];
+    AesContext ctx;
+    AesGcmContext gcm;
+
+    memset(zero, 0, sizeof(zero));
+    c_aes_setup(&ctx, zero, 16);
+    c_aes_gcm_encrypt(&ctx, zero, 12, NULL, 0, zero, buf, 16, tag, 16);
+    err += check("AES-GCM case 2", buf, c2, 16);
+    err += check("AES-GCM case 2 tag", tag, t2, 16);
+
+    c_aes_setup(&ctx, key, 16);
+    c_aes_gcm_encrypt(&ctx, iv4, 12, aad, sizeof(aad), pt, buf, sizeof(pt), tag, 16);
+    err += check("AES-GCM case 4", buf, c4, sizeof(c4));
+    err += check("AES-GCM case 4 tag", tag, t4, 16);
+
+    c_aes_gcm_encrypt(&ctx, iv6, sizeof(iv6), aad, sizeof(aad), pt, buf, sizeof(pt), tag, 16);
+    err += check("AES-GCM case 6", buf, c6, sizeof(c6));
+    err += check("AES-GCM case 6 tag", tag, t6, 16);
+
+    err += !c_aes_gcm_decrypt(&ctx, iv4, 12, aad, sizeof(aad), c4, buf, sizeof(c4), t4, 16);
+    err += check("AES-GCM decrypt", buf, pt, sizeof(pt));
+    memcpy(tag, t4, 16);
+    tag[15] ^= 1;
+    err += c_aes_gcm_decrypt(&ctx, iv4, 12, aad, sizeof(aad), c4, buf, sizeof(c4), tag, 16);
+    err += c_aes_gcm_decrypt(&ctx, iv4, 12, aad, sizeof(aad) - 1, c4, buf, sizeof(c4), t4, 16);
+
+    // 截断标签: 12 字节可以, 更短的一律拒绝
+    err += !c_aes_gcm_decrypt(&ctx, iv4, 12, aad, sizeof(aad), c4, buf, sizeof(c4), t4, 12);
+    err += c_aes_gcm_decrypt(&ctx, iv4, 12, aad, sizeof(aad), c4, buf, sizeof(c4), t4, 11);
+    err += c_aes_gcm_decrypt(&ctx, iv4, 12, aad, sizeof(aad), c4, buf, sizeof(c4), t4, 1);
+    err += c_aes_gcm_decrypt(&ctx, iv4, 12, aad, sizeof(aad), c4, buf, sizeof(c4), t4, 0);
+
+    // 流式: 任意切分与一次处理结果相同
+    for (i = 0; i < (int) sizeof(all); i++) {
+        all[i] = (uint8_t) (i * 13);
+    }
+    c_aes_gcm_encrypt(&ctx, iv4, 12, all, 37, all, part, sizeof(all), tag, 16);
+    for (n = 1; n < 70; n += 5) {
+        memcpy(buf, all, 37);
+        c_aes_gcm_init(&gcm, &ctx, iv4, 12);
+        for (i = 0; i < 37; i += n) {
+            c_aes_gcm_aad(&gcm, buf + i, C_MIN(n, 37 - i));
+        }
+        for (i = 0; i < (int) sizeof(all); i += n) {
+            c_aes_gcm_encrypt_update(&gcm, all + i, all + i, C_MIN(n, (int) sizeof(all) - i));
+        }
+        c_aes_gcm_final(&gcm, tag2, 16);
+        err += (0 != memcmp(all, part, sizeof(all))) + (0 != memcmp(tag, tag2, 16));
+
+        // 重复 final 或 final 之后 verify 得到同一标签
+        memset(tag2, 0, sizeof(tag2));
+        c_aes_gcm_final(&gcm, tag2, 16);
+        err += (0 != memcmp(tag, tag2, 16)) + !c_aes_gcm_verify(&gcm, tag, 16);
+        err += c_aes_gcm_encrypt_update(&gcm, tag2, tag2, 16) + (0 != memcmp(tag, tag2, 16));
+
+        c_aes_gcm_init(&gcm, &ctx, iv4, 12);
+        c_aes_gcm_aad(&gcm, buf, 37);
+        for (i = 0; i < (int) sizeof(all); i += n) {
+            c_aes_gcm_decrypt_update(&gcm, all + i, all + i, C_MIN(n, (int) sizeof(all) - i));
+        }
+        err += !c_aes_gcm_verify(&gcm, tag, 16);
+        err += c_aes_gcm_aad(&gcm, buf, 1);
+        err += c_aes_gcm_decrypt_update(&gcm, tag2, tag2, 16) + (0 != memcmp(tag, tag2, 16));
+        for (i = 0; i < (int) sizeof(all); i++) {
+            err += (all[i] != (uint8_t) (i * 13));
+        }
+    }
+
+    // GHASH 的 PCLMULQDQ 与查表实现结果一致
+    features = c_utils_sys_get_cpu_features();
+    c_utils_sys_set_cpu_features(0);
+    c_aes_gcm_encrypt(&ctx, iv4, 12, all, 37, all, part, sizeof(all), tag2, 16);
+    c_utils_sys_set_cpu_features(features);
+    err += (0 != memcmp(tag, tag2, 16));
+    printf("AES-GCM stream / verify: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+static int test_xts (void)
+{
+    // IEEE P1619 附录 B 向量 1 / 2
+    static const uint8_t c1[32] = {
+        0x91, 0x7c, 0xf6, 0x9e, 0xbd, 0x68, 0xb2, 0xec, 0x9b, 0x9f, 0xe9, 0xa3, 0xea, 0xdd, 0xa6, 0x92,
+        0xcd, 0x43, 0xd2, 0xf5, 0x95, 0x98, 0xed, 0x85, 0x8c, 0x02, 0xc2, 0x65, 0x2f, 0xbf, 0x92, 0x2e,
+    };
+    static const uint8_t c2[32] = {
+        0xc4, 0x54, 0x18, 0x5e, 0x6a, 0x16, 0x93, 0x6e, 0x39, 0x33, 0x40, 0x38, 0xac, 0xef, 0x83, 0x8b,
+        0xfb, 0x18, 0x6f, 0xff, 0x74, 0x80, 0xad, 0xc4, 0x28, 0x93, 0x82, 0xec, 0xd6, 0xd3, 0x94, 0xf0,
+    };
+    int i, err = 0;
+    uint8_t key[64], buf[32], in[4096 * 3], out[4096 * 3], one[4096 * 3];
+    AesXtsContext ctx;
+
+    memset(key, 0, sizeof(key));
+    memset(buf, 0, sizeof(buf));
+    err += c_aes_xts_setup(&ctx, key, 16);
+    err += c_aes_xts_setup(&ctx, key, 48);
+    err += c_aes_xts_setup(&ctx, key, 0);
+    err += !c_aes_xts_setup(&ctx, key, 32);
+    c_aes_xts_encrypt_sectors(&ctx, buf, buf, sizeof(buf), sizeof(buf), 0);
+    err += check("AES-XTS vector 1", buf, c1, sizeof(c1));
+
+    memset(key, 0x11, 16);
+    memset(key + 16, 0x22, 16);
+    memset(buf, 0x44, sizeof(buf));
+    c_aes_xts_setup(&ctx, key, 32);
+    c_aes_xts_encrypt_sectors(&ctx, buf, buf, sizeof(buf), sizeof(buf), 0x3333333333ULL);
+    err += check("AES-XTS vector 2", buf, c2, sizeof(c2));
+    c_aes_xts_decrypt_sectors(&ctx, buf, buf, sizeof(buf), sizeof(buf), 0x3333333333ULL);
+    memset(key, 0x44, sizeof(buf));
+    err += check("AES-XTS vector 2 decrypt", buf, key, sizeof(buf));
+
+    // 一次处理多个扇区与逐扇区处理一致, 并能解密回原文
+    for (i = 0; i < (int) sizeof(key); i++) {
+        key[i] = (uint8_t) (i * 5 + 1);
+    }
+    for (i = 0; i < (int) sizeof(in); i++) {
+        in[i] = (uint8_t) (i * 3);
+    }
+    err += !c_aes_xts_setup(&ctx, key, 64);
+    err += !c_aes_xts_encrypt_sectors(&ctx, in, out, sizeof(in), 512, 100);
+    for (i = 0; i < (int) sizeof(in) / 512; i++) {
+        c_aes_xts_encrypt_sectors(&ctx, in + i * 512, one + i * 512, 512, 512, 100 + i);
+    }
+    err += (0 != memcmp(out, one, sizeof(out)));
+    c_aes_xts_decrypt_sectors(&ctx, out, out, sizeof(out), 512, 100);
+    err += (0 != memcmp(out, in, sizeof(in)));
+
+    err += !c_aes_xts_encrypt_sectors(&ctx, in, out, sizeof(in), 4096, 7);
+    c_aes_xts_decrypt_sectors(&ctx, out, out, sizeof(out), 4096, 7);
+    err += (0 != memcmp(out, in, sizeof(in)));
+
+    err += c_aes_xts_encrypt_sectors(&ctx, in, out, 1000, 512, 0);
+    err += c_aes_xts_encrypt_sectors(&ctx, in, out, 1000, 500, 0);
+    printf("AES-XTS sectors: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+int main (int argc, char* argv[])
+{
+    int err = 0;
+    uint32_t features = c_utils_sys_get_cpu_features();
+
+    printf("Start test....\n");
+
+    printf("AES (cpu features: 0x%x)\n", features);
+    err += test_fips197();
+    err += test_bulk();
+    err += test_ctr();
+    err += test_gcm();
+    err += test_xts();
+
+    printf("AES 硬件/软件轮密钥一致性\n");
+    err += test_key_schedule(features);
+
+    printf("AES (T 表实现)\n");
+    c_utils_sys_set_cpu_features(0);
+    err += test_fips197();
+    err += test_bulk();
+    err += test_ctr();
+    err += test_gcm();
+    err += test_xts();
+    c_utils_sys_set_cpu_features(features);
+
+    printf("Finished!\n");
+
+    return err;
+}
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+
+#include "../src/encrypt.h"
+
+#define TEST_LEN            300
+
+static const uint32_t gsAriths[] = {
+    C_ENCRYPT_ARITH_RC4,
+    C_ENCRYPT_ARITH_EN_RC4,
+    C_ENCRYPT_ARITH_AES_ECB,
+    C_ENCRYPT_ARITH_SM4,
+};
+
+/**
+ * 不经过 CEncryptContext 的参考实现
+ */
+static void reference_encrypt (uint32_t arith, const uint8_t* key, uint64_t keyLen, uint8_t* buffer, uint64_t bufLen)
+{
+    uint64_t i;
+    Rc4Context rc4;
+    Sm4Context sm4;
+
+    switch (arith) {
+        case C_ENCRYPT_ARITH_RC4: {
+            c_rc4_setup(&rc4, key, keyLen);
+            c_rc4_crypt(&rc4, buffer, bufLen);
+            break;
+        }
+        case C_ENCRYPT_ARITH_EN_RC4: {
+            c_rc4_setup(&rc4, key, keyLen);
+            c_en_rc4_encrypt(&rc4, buffer, bufLen);
+            break;
+        }
+        case C_ENCRYPT_ARITH_AES_ECB: {
+            c_encrypt_encode_aes_real(buffer, bufLen, key, keyLen, NULL, ENC_MODE_ECB);
+            break;
+        }
+        case C_ENCRYPT_ARITH_SM4: {
+            c_sm4_setup(&sm4, key);
+            for (; bufLen >= SM4_BLOCK_SIZE; bufLen -= SM4_BLOCK_SIZE, buffer += SM4_BLOCK_SIZE) {
+                c_sm4_encrypt_block(&sm4, buffer, buffer);
+            }
+            for (i = 0; i < bufLen; i++) {
+                *buffer++ ^= (uint8_t) i;
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+static int test_context (void)
+{
+    int err = 0;
+    uint32_t a, len, i;
+    uint8_t key[32], in[TEST_LEN], ref[TEST_LEN], out[TEST_LEN];
+    CEncryptContext ctx;
+
+    for (i = 0; i < sizeof(key); i++) {
+        key[i] = (uint8_t) (i * 11 + 3);
+    }
+    for (i = 0; i < sizeof(in); i++) {
+        in[i] = (uint8_t) (i * 7);
+    }
+
+    for (a = 0; a < sizeof(gsAriths) / sizeof(gsAriths[0]); a++) {
+        if (!c_encrypt_context_init(&ctx, gsAriths[a], key, sizeof(key))) {
+            printf("arith %u: init FAILED\n", gsAriths[a]);
+            err++;
+            continue;
+        }
+        // 同一个上下文反复使用, 结果与每次重新扩展密钥相同
+        for (len = 0; len <= TEST_LEN; len += 13) {
+            memcpy(ref, in, len);
+            reference_encrypt(gsAriths[a], key, sizeof(key), ref, len);
+
+            memcpy(out, in, len);
+            c_encrypt_context_encrypt(&ctx, out, len);
+            err += (0 != memcmp(out, ref, len));
+
+            memcpy(out, in, len);
+            c_encrypt_encrypt_buffer(out, len, key, sizeof(key), gsAriths[a]);
+            err += (0 != memcmp(out, ref, len));
+
+            c_encrypt_context_decrypt(&ctx, out, len);
+            err += (0 != memcmp(out, in, len));
+        }
+        c_encrypt_context_clear(&ctx);
+        printf("arith %u: %s\n", gsAriths[a], err ? "FAILED" : "OK");
+    }
+
+    err += c_encrypt_context_init(&ctx, C_ENCRYPT_ARITH_DES, key, sizeof(key));
+
+    return err;
+}
+
+/**
+ * 流式接口按不同的分块长度处理, 结果与一次处理整个缓冲区相同
+ */
+static int test_stream (void)
+{
+    int err = 0;
+    uint32_t a, i, chunk;
+    uint64_t off, outLen;
+    uint8_t key[16], in[TEST_LEN], ref[TEST_LEN], out[TEST_LEN + 16], back[TEST_LEN + 16];
+    CEncryptContext ctx;
+    CEncryptStream stream;
+
+    for (i = 0; i < sizeof(key); i++) {
+        key[i] = (uint8_t) (i * 29 + 1);
+    }
+    for (i = 0; i < sizeof(in); i++) {
+        in[i] = (uint8_t) (i * 5 + 2);
+    }
+
+    for (a = 0; a < sizeof(gsAriths) / sizeof(gsAriths[0]); a++) {
+        c_encrypt_context_init(&ctx, gsAriths[a], key, sizeof(key));
+        memcpy(ref, in, sizeof(in));
+        c_encrypt_context_encrypt(&ctx, ref, sizeof(ref));
+
+        for (chunk = 1; chunk < 50; chunk += 3) {
+            outLen = 0;
+            c_encrypt_stream_init(&stream, &ctx, false);
+            for (off = 0; off < sizeof(in); off += chunk) {
+                outLen += c_encrypt_stream_update(&stream, in + off, C_MIN(chunk, sizeof(in) - off), out + outLen);
+            }
+            outLen += c_encrypt_stream_final(&stream, out + outLen);
+            err += (outLen != sizeof(in)) || (0 != memcmp(out, ref, sizeof(ref)));
+
+            outLen = 0;
+            c_encrypt_stream_init(&stream, &ctx, true);
+            for (off = 0; off < sizeof(in); off += chunk + 7) {
+                outLen += c_encrypt_stream_update(&stream, out + off, C_MIN(chunk + 7, sizeof(in) - off), back + outLen);
+            }
+            outLen += c_encrypt_stream_final(&stream, back + outLen);
+            err += (outLen != sizeof(in)) || (0 != memcmp(back, in, sizeof(in)));
+        }
+        c_encrypt_context_clear(&ctx);
+        printf("stream arith %u: %s\n", gsAriths[a], err ? "FAILED" : "OK");
+    }
+
+    return err;
+}
+
+int main (int argc, char* argv[])
+{
+    int err = 0;
+
+    printf("Start test....\n");
+
+    err += test_context();
+    err += test_stream();
+
+    printf("Finished!\n");
+
+    return err;
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "../src/md5.h"
+#include "../src/utils-sys.h"
+
+#define JOBS            45
+
+/**
+ * RFC 1321 A.5
+ */
+static int test_standard (void)
+{
+    int i, err = 0;
+    uint8_t dgst[16];
+    static const char* msg[] = {
+        "",
+        "abc",
+        "message digest",
+        "12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+    };
+    static const uint8_t expect[][16] = {
+        { 0xd4, 0x1d, 0x8c, 0xd9, 0x8f, 0x00, 0xb2, 0x04, 0xe9, 0x80, 0x09, 0x98, 0xec, 0xf8, 0x42, 0x7e },
+        { 0x90, 0x01, 0x50, 0x98, 0x3c, 0xd2, 0x4f, 0xb0, 0xd6, 0x96, 0x3f, 0x7d, 0x28, 0xe1, 0x7f, 0x72 },
+        { 0xf9, 0x6b, 0x69, 0x7d, 0x7c, 0xb7, 0x93, 0x8d, 0x52, 0x5a, 0x2f, 0x31, 0xaa, 0xf1, 0x61, 0xd0 },
+        { 0x57, 0xed, 0xf4, 0xa2, 0x2b, 0xe3, 0xc9, 0x55, 0xac, 0x49, 0xda, 0x2e, 0x21, 0x07, 0xb6, 0x7a },
+    };
+
+    for (i = 0; i < (int) (sizeof(msg) / sizeof(msg[0])); i++) {
+        c_md5_get_result((const uint8_t*) msg[i], strlen(msg[i]), dgst);
+        if (0 != memcmp(dgst, expect[i], sizeof(dgst))) {
+            printf("MD5 \"%s\": FAILED\n", msg[i]);
+            err++;
+        }
+    }
+    printf("MD5 standard: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+/**
+ * 多缓冲区计算与 c_md5_starts/update/finish 的结果一致, submit/flush 每个任务恰好返回一次
+ */
+static int test_batch (uint32_t features)
+{
+    int i, err = 0;
+    static uint8_t data[5000];
+    uint8_t dgst[JOBS][16], ref[16];
+    int seen[JOBS];
+    uint64_t lens[JOBS];
+    const uint8_t* bufs[JOBS];
+    uint32_t saved = c_utils_sys_get_cpu_features();
+    Md5Job jobs[JOBS];
+    Md5Job* job = NULL;
+    Md5MbManager mgr;
+
+    c_utils_sys_set_cpu_features(features);
+
+    for (i = 0; i < (int) sizeof(data); i++) {
+        data[i] = (uint8_t) (i * 7 + 3);
+    }
+    for (i = 0; i < JOBS; i++) {
+        jobs[i].data = data + i;
+        jobs[i].dataLen = (size_t) ((i * 397) % 4001) % (sizeof(data) - JOBS);
+        jobs[i].dgst = dgst[i];
+        jobs[i].userData = &seen[i];
+        seen[i] = 0;
+    }
+    jobs[1].dataLen = 55;
+    jobs[2].dataLen = 56;
+    jobs[3].dataLen = 64;
+
+    c_md5_digest_batch(jobs, JOBS);
+    for (i = 0; i < JOBS; i++) {
+        c_md5_get_result(jobs[i].data, jobs[i].dataLen, ref);
+        err += (0 != memcmp(dgst[i], ref, sizeof(ref)));
+    }
+
+    memset(dgst, 0, sizeof(dgst));
+    c_md5_mb_init(&mgr);
+    for (i = 0; i < JOBS; i++) {
+        job = c_md5_mb_submit(&mgr, &jobs[i]);
+        if (job) {
+            (*(int*) job->userData)++;
+        }
+    }
+    while (NULL != (job = c_md5_mb_flush(&mgr))) {
+        (*(int*) job->userData)++;
+    }
+    for (i = 0; i < JOBS; i++) {
+        c_md5_get_result(jobs[i].data, jobs[i].dataLen, ref);
+        err += (0 != memcmp(dgst[i], ref, sizeof(ref))) || (1 != seen[i]);
+    }
+
+    memset(dgst, 0, sizeof(dgst));
+    for (i = 0; i < JOBS; i++) {
+        bufs[i] = jobs[i].data;
+        lens[i] = jobs[i].dataLen;
+    }
+    c_md5_get_results(bufs, lens, dgst, JOBS);
+    for (i = 0; i < JOBS; i++) {
+        c_md5_get_result(bufs[i], lens[i], ref);
+        err += (0 != memcmp(dgst[i], ref, sizeof(ref)));
+    }
+
+    printf("MD5 batch (cpu features 0x%x): %s\n", c_utils_sys_get_cpu_features(), err ? "FAILED" : "OK");
+    c_utils_sys_set_cpu_features(saved);
+
+    return err;
+}
+
+/**
+ * 文件接口与内存接口一致(空文件, 非整分组长度), 打不开的文件返回 false
+ */
+static int test_file (void)
+{
+    int err = 0, fd;
+    size_t i;
+    static uint8_t data[64 * 1000 + 37];
+    uint8_t dgst[16], ref[16];
+    char path[] = "/tmp/test-md5-XXXXXX";
+
+    for (i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t) (i * 13 + 1);
+    }
+
+    fd = mkstemp(path);
+    err += (fd < 0);
+
+    err += !c_md5_file(path, dgst);
+    c_md5_get_result(data, 0, ref);
+    err += (0 != memcmp(dgst, ref, sizeof(ref)));
+
+    err += (sizeof(data) != (size_t) write(fd, data, sizeof(data)));
+    err += !c_md5_file(path, dgst);
+    c_md5_get_result(data, sizeof(data), ref);
+    err += (0 != memcmp(dgst, ref, sizeof(ref)));
+
+    close(fd);
+    unlink(path);
+    err += c_md5_file(path, dgst);
+    printf("MD5 file: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+int main (int argc, char* argv[])
+{
+    int err = 0;
+
+    printf("Start test....\n");
+
+    err += test_standard();
+    err += test_batch(0xffffffff);
+    err += test_batch(C_SYS_CPU_SSE2 | C_SYS_CPU_SSSE3 | C_SYS_CPU_AVX | C_SYS_CPU_AVX2);
+    err += test_batch(C_SYS_CPU_SSE2);
+    err += test_batch(0);
+    err += test_file();
+
+    printf("Finished!\n");
+
+    return err;
+}
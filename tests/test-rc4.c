@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+
+#include "../src/rc4.h"
+
+#define STREAMS     13
+
+typedef void (*Rc4MultiFunc) (Rc4Buffer* buffers, size_t count);
+typedef void (*Rc4Func) (Rc4Context* ctx, uint8_t* data, uint64_t length);
+
+/**
+ * 逐字节的参考实现(原始算法), mode: 0 RC4, 1 增强型加密, 2 增强型解密
+ */
+static void ref_crypt (Rc4Context* ctx, uint8_t* data, size_t length, int mode)
+{
+    size_t i;
+    uint8_t a, b, k;
+
+    for (i = 0; i < length; i++) {
+        ctx->x = (uint8_t) (ctx->x + 1); a = ctx->m[ctx->x];
+        ctx->y = (uint8_t) (ctx->y + a);
+        ctx->m[ctx->x] = b = ctx->m[ctx->y];
+        ctx->m[ctx->y] = a;
+        k = ctx->m[(uint8_t) (a + b)];
+        if (0 == mode) {
+            data[i] ^= k;
+        }
+        else if (1 == mode) {
+            data[i] = (uint8_t) ((data[i] ^ k) + ctx->m[b]);
+        }
+        else {
+            data[i] = (uint8_t) ((data[i] - ctx->m[b]) ^ k);
+        }
+    }
+}
+
+/**
+ * 按 8 字节处理的实现与逐字节参考实现一致(各种长度, 连续多次调用)
+ */
+static int test_words (void)
+{
+    static const Rc4Func funcs[3] = { c_rc4_crypt, c_en_rc4_encrypt, c_en_rc4_decrypt };
+    int i, mode, len, err = 0;
+    uint8_t key[7] = { 1, 2, 3, 4, 5, 6, 7 };
+    uint8_t data[400], ref[400];
+    Rc4Context ctx, refCtx;
+
+    for (mode = 0; mode < 3; mode++) {
+        c_rc4_setup(&ctx, key, sizeof(key));
+        refCtx = ctx;
+        for (len = 0; len <= 300; len += 13) {
+            for (i = 0; i < len; i++) {
+                data[i] = ref[i] = (uint8_t) (i * 5 + len);
+            }
+            funcs[mode](&ctx, data, len);
+            ref_crypt(&refCtx, ref, len, mode);
+            err += (0 != memcmp(data, ref, len)) || (0 != memcmp(&ctx, &refCtx, sizeof(ctx)));
+        }
+    }
+    printf("RC4 word-at-a-time: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+/**
+ * 批量接口与逐条调用的结果(数据和之后的状态)一致
+ */
+static int test_multi (const char* name, Rc4MultiFunc multi, Rc4Func one)
+{
+    int i, j, err = 0;
+    uint8_t key[16];
+    static uint8_t data[STREAMS][3000], ref[STREAMS][3000];
+    Rc4Context ctx[STREAMS], refCtx[STREAMS];
+    Rc4Buffer bufs[STREAMS];
+
+    for (i = 0; i < STREAMS; i++) {
+        for (j = 0; j < (int) sizeof(key); j++) {
+            key[j] = (uint8_t) (i * 31 + j);
+        }
+        c_rc4_setup(&ctx[i], key, 5 + i);
+        refCtx[i] = ctx[i];
+        for (j = 0; j < (int) sizeof(data[i]); j++) {
+            data[i][j] = ref[i][j] = (uint8_t) (i + j * 3);
+        }
+        bufs[i].ctx = &ctx[i];
+        bufs[i].data = data[i];
+        bufs[i].length = (size_t) ((i * 397) % 3001);
+        one(&refCtx[i], ref[i], bufs[i].length);
+    }
+
+    // 两次调用: 第二次从第一次结束的状态继续
+    multi(bufs, STREAMS);
+    for (i = 0; i < STREAMS; i++) {
+        bufs[i].data = data[i];
+        bufs[i].length = 100;
+        one(&refCtx[i], ref[i], 100);
+    }
+    multi(bufs, STREAMS);
+
+    for (i = 0; i < STREAMS; i++) {
+        err += (0 != memcmp(data[i], ref[i], sizeof(data[i])));
+        err += (0 != memcmp(&ctx[i], &refCtx[i], sizeof(Rc4Context)));
+    }
+    printf("%s: %s\n", name, err ? "FAILED" : "OK");
+
+    return err;
+}
+
+int main (int argc, char* argv[])
+{
+    int err = 0;
+
+    printf("Start test....\n");
+
+    err += test_words();
+    err += test_multi("RC4 multi", c_rc4_crypt_multi, c_rc4_crypt);
+    err += test_multi("EN-RC4 encrypt multi", c_en_rc4_encrypt_multi, c_en_rc4_encrypt);
+    err += test_multi("EN-RC4 decrypt multi", c_en_rc4_decrypt_multi, c_en_rc4_decrypt);
+
+    printf("Finished!\n");
+
+    return err;
+}
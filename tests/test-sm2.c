@@ -21,12 +21,319 @@
  */
 
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../src/sm2.h"
+#include "../src/sm2-table.h"
+
+static const char* gsG =
+        "32c4ae2c1f1981195f9904466a39c9948fe30bbff2660be1715a4589334c74c7"
+        "bc3736a2f4f6779c59bdcee36b692153d0a9877cc62a474002df32e52139f0a0";
+static const char* gs2G =
+        "56cefd60d7c87c000d58ef57fa73ba4d9c0dfa08c08a7331495c2e1da3f2bd52"
+        "31b7e7e6cc8189f668535ce0f8eaf1bd6de84c182f6c8e716f780d3a970a23c3";
+static const char* gs3G =
+        "a97f7cd4b3c993b4be2daa8cdb41e24ca13f6bd945302244e26918f1d0509ebf"
+        "530b5dd88c688ef5ccc5cec08a72150f7c400ee5cd045292aaacdd037458f6e6";
+
+/**
+ * 倍点, 加法(包括非仿射坐标的加数), 曲线方程, 与无穷远点相关的特殊情况
+ */
+static int test_point (void)
+{
+    int err = 0;
+    Sm2JacobianPoint G, P, Q, R;
+
+    c_sm2_jacobian_point_from_hex(&G, gsG);
+    err += (1 != c_sm2_jacobian_point_is_on_curve(&G));
+
+    c_sm2_jacobian_point_dbl(&P, &G);
+    err += !c_sm2_jacobian_point_equ_hex(&P, gs2G);
+    err += (1 != c_sm2_jacobian_point_is_on_curve(&P));
+
+    c_sm2_jacobian_point_add(&Q, &P, &G);
+    err += !c_sm2_jacobian_point_equ_hex(&Q, gs3G);
+    c_sm2_jacobian_point_add(&Q, &G, &P);
+    err += !c_sm2_jacobian_point_equ_hex(&Q, gs3G);
+    c_sm2_jacobian_point_add(&Q, &G, &G);
+    err += !c_sm2_jacobian_point_equ_hex(&Q, gs2G);
+
+    c_sm2_jacobian_point_sub(&R, &Q, &G);
+    err += !c_sm2_jacobian_point_equ_hex(&R, gsG);
+    c_sm2_jacobian_point_sub(&R, &G, &G);
+    err += !c_sm2_jacobian_point_is_at_infinity(&R);
+
+    c_sm2_jacobian_point_set_infinity(&R);
+    err += !c_sm2_jacobian_point_is_at_infinity(&R);
+    c_sm2_jacobian_point_dbl(&Q, &R);
+    err += !c_sm2_jacobian_point_is_at_infinity(&Q);
+    c_sm2_jacobian_point_add(&Q, &R, &P);
+    err += !c_sm2_jacobian_point_equ_hex(&Q, gs2G);
+    c_sm2_jacobian_point_add(&Q, &G, &R);
+    err += !c_sm2_jacobian_point_equ_hex(&Q, gsG);
+
+    c_sm2_jacobian_point_copy(&Q, &G);
+    err += !c_sm2_jacobian_point_equ_hex(&Q, gsG);
+
+    printf("SM2 point: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+/**
+ * 标量乘(参考值由独立实现计算), n * G 为无穷远点, (n - 1) * G = -G, 基点标量乘与通用标量乘一致
+ */
+static int test_mul (void)
+{
+    int i, j, err = 0;
+    uint8_t buf[64], ref[64];
+    Sm2BN e;
+    static const Sm2BN k = {0x52e6b438, 0xf2a74de4, 0x269e0d37, 0x6513270e, 0xa6a3a450, 0x0c5c7fd0, 0x128b2f33, 0xd23f0824};
+    static const Sm2BN t = {0x892f902b, 0x1818e811, 0x5d9dc9f8, 0x9531985d, 0x0ed90475, 0xe8e25d94, 0x81e74ef5, 0x36f675cc};
+    static const Sm2BN s = {0x099950d8, 0x1600a35a, 0x6f03675a, 0x6b0d549b, 0x11e20b8f, 0x3d9c1724, 0x1738f7d9, 0x8d116ece};
+    static const Sm2BN n = {0x39d54123, 0x53bbf409, 0x21c6052b, 0x7203df6b, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffffe};
+    static const Sm2BN nSub1 = {0x39d54122, 0x53bbf409, 0x21c6052b, 0x7203df6b, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffffe};
+    static const char* kG =
+        "74a48828b72949ff34b333acb6aff7fbf10cfcf1f4a6a2768f40f195f86a4170"
+        "73a8f358be2ad986901cfd65bf2ba2a6752a26a59e48efd1cb9a7a8c291a6b1b";
+    static const char* tP =
+        "f0de492291d3e10b0cf35f102e12d65137b883fffeb85a1245b78e92864ff961"
+        "1f0e8e65d3d9bc093ca2960fd31c37b8875b0ca19a890a315cfc0486d02c1ed1";
+    static const char* sGtP =
+        "10247d35de1c71c4979d75fab5e31ee8be58c9c670921d0428d1be2b57aeb04a"
+        "4361fc59cac5ba37b680ed46c30a362f68a5b2ad3ea10631d6ee6f291ca5fa40";
+    static const char* negG =
+        "32c4ae2c1f1981195f9904466a39c9948fe30bbff2660be1715a4589334c74c7"
+        "43c8c95c0b098863a642311c9496deac2f56788239d5b8c0fd20cd1adec60f5f";
+    Sm2JacobianPoint G, P, Q, R;
+
+    c_sm2_jacobian_point_from_hex(&G, gsG);
+
+    c_sm2_jacobian_point_mul_generator(&P, k);
+    err += !c_sm2_jacobian_point_equ_hex(&P, kG);
+    c_sm2_jacobian_point_mul(&Q, k, &G);
+    err += !c_sm2_jacobian_point_equ_hex(&Q, kG);
+
+    // P 不是仿射坐标
+    c_sm2_jacobian_point_mul(&Q, t, &P);
+    err += !c_sm2_jacobian_point_equ_hex(&Q, tP);
+
+    c_sm2_jacobian_point_to_bytes(&P, buf);
+    c_sm2_jacobian_point_from_bytes(&R, buf);
+    err += !c_sm2_jacobian_point_equ_hex(&R, kG);
+    c_sm2_jacobian_point_mul_sum(&Q, t, &R, s);
+    err += !c_sm2_jacobian_point_equ_hex(&Q, sGtP);
+
+    c_sm2_jacobian_point_mul_generator(&Q, n);
+    err += !c_sm2_jacobian_point_is_at_infinity(&Q);
+    c_sm2_jacobian_point_mul_generator(&Q, nSub1);
+    err += !c_sm2_jacobian_point_equ_hex(&Q, negG);
+
+    // 固定基表与通用标量乘一致: 小标量, 每个 limb 只有一位的标量, 以及各窗口数字为 ±16 附近的标量
+    for (i = 0; i < 40; i++) {
+        memset(e, 0, sizeof(e));
+        if (i < 8) {
+            e[0] = i;
+        }
+        else if (i < 16) {
+            e[i - 8] = 0x80000001;
+        }
+        else {
+            for (j = 0; j < 8; j++) {
+                e[j] = (0x7bdef7bdU >> (i % 5)) ^ (uint32_t) (i * 0x9e3779b9U * (j + 1));
+            }
+            e[7] &= 0x7fffffff;
+        }
+        c_sm2_jacobian_point_mul_generator(&P, e);
+        c_sm2_jacobian_point_mul(&Q, e, &G);
+        if (c_sm2_jacobian_point_is_at_infinity(&Q)) {
+            err += !c_sm2_jacobian_point_is_at_infinity(&P);
+            continue;
+        }
+        c_sm2_jacobian_point_to_bytes(&P, buf);
+        c_sm2_jacobian_point_to_bytes(&Q, ref);
+        err += (0 != memcmp(buf, ref, sizeof(buf)));
+    }
+
+    printf("SM2 mul: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+/**
+ * 单次 k * G 的最短耗时(纳秒), 取多轮中的最小值以减少调度干扰
+ */
+static double mul_generator_ns (const Sm2BN k)
+{
+    int i, r;
+    double t, best = 0;
+    struct timespec a, b;
+    Sm2JacobianPoint P;
+
+    for (r = 0; r < 7; r++) {
+        clock_gettime(CLOCK_MONOTONIC, &a);
+        for (i = 0; i < 50; i++) {
+            c_sm2_jacobian_point_mul_generator(&P, k);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &b);
+        t = ((b.tv_sec - a.tv_sec) * 1e9 + (b.tv_nsec - a.tv_nsec)) / 50;
+        if (0 == r || t < best) {
+            best = t;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * k * G 的每个窗口都做完整的加法: 低位窗口全为 0 的标量(只有高位非零, 或 k = 0)结果正确,
+ * 且耗时与随机标量相当(原来无穷远点会提前返回, 耗时泄露 k 低位连续 0 窗口的个数)
+ */
+static int test_mul_generator_ct (void)
+{
+    int i, err = 0;
+    double ref, t;
+    uint8_t buf[64], exp[64];
+    Sm2JacobianPoint G, P, Q;
+    static const Sm2BN r = {0x52e6b438, 0xf2a74de4, 0x269e0d37, 0x6513270e, 0xa6a3a450, 0x0c5c7fd0, 0x128b2f33, 0xd23f0824};
+    static const Sm2BN ks[] = {
+        {0, 0, 0, 0, 0, 0, 0, 0xd23f0824},
+        {0, 0, 0, 0, 0, 0, 0, 0x40000000},
+        {0, 0, 0, 0, 0, 0, 0, 0x80000000},
+        {0, 0, 0, 0, 0x00010000, 0, 0, 0},
+        {0, 0, 0, 0, 0, 0, 0, 0},
+    };
+
+    c_sm2_jacobian_point_from_hex(&G, gsG);
+    for (i = 0; i < (int) C_ARRAY_COUNT(ks); i++) {
+        c_sm2_jacobian_point_mul_generator(&P, ks[i]);
+        c_sm2_jacobian_point_mul(&Q, ks[i], &G);
+        if (c_sm2_jacobian_point_is_at_infinity(&Q)) {
+            err += !c_sm2_jacobian_point_is_at_infinity(&P);
+            continue;
+        }
+        c_sm2_jacobian_point_to_bytes(&P, buf);
+        c_sm2_jacobian_point_to_bytes(&Q, exp);
+        err += (0 != memcmp(buf, exp, sizeof(buf)));
+    }
+
+    // 提前返回时这些标量只需随机标量 1/5 到 1/10 的时间, 阈值留出足够的测量误差
+    ref = mul_generator_ns(r);
+    for (i = 0; i < (int) C_ARRAY_COUNT(ks); i++) {
+        t = mul_generator_ns(ks[i]);
+        if (t < ref * 0.6) {
+            printf("SM2 mul generator: k[%d] %.0f ns, random k %.0f ns\n", i, t, ref);
+            err++;
+        }
+    }
+
+    printf("SM2 mul generator constant time: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+/**
+ * 与 src/sm2-table.c 中的固定基表对照; 表项为仿射坐标的 Montgomery 形式 x * 2^256 mod p
+ */
+static void z256_to_mont_from_bytes (uint64_t r[4], const uint8_t in[32])
+{
+    static const uint64_t p[4] = {0xffffffffffffffffULL, 0xffffffff00000000ULL, 0xffffffffffffffffULL, 0xfffffffeffffffffULL};
+    int i, j;
+    uint64_t c, t, b;
+
+    for (i = 0; i < 4; i++) {
+        r[i] = 0;
+        for (j = 0; j < 8; j++) {
+            r[i] = (r[i] << 8) | in[(3 - i) * 8 + j];
+        }
+    }
+
+    // 逐位加倍, 每次 2r < 2p, 最多减一次 p
+    for (i = 0; i < 256; i++) {
+        c = r[3] >> 63;
+        r[3] = (r[3] << 1) | (r[2] >> 63);
+        r[2] = (r[2] << 1) | (r[1] >> 63);
+        r[1] = (r[1] << 1) | (r[0] >> 63);
+        r[0] <<= 1;
+        if (!c) {
+            for (j = 3; j >= 0 && r[j] == p[j]; j--);
+            c = (j < 0 || r[j] > p[j]);
+        }
+        if (c) {
+            for (b = 0, j = 0; j < 4; j++) {
+                t = r[j] - p[j] - b;
+                b = (r[j] < p[j]) || (r[j] == p[j] && b);
+                r[j] = t;
+            }
+        }
+    }
+}
+
+/**
+ * 用通用点加/倍点重新计算整张 c_sm2_z256_g_table 并逐项比较
+ * out 不为 NULL 时同时按 src/sm2-table.c 的格式输出表体, 用于重新生成该文件
+ */
+static int test_g_table (FILE* out)
+{
+    int i, j, k, err = 0;
+    uint8_t buf[64];
+    uint64_t v[8];
+    Sm2JacobianPoint B, P;
+
+    c_sm2_jacobian_point_from_hex(&B, gsG);
+    for (i = 0; i < SM2_Z256_G_WINDOWS; i++) {
+        if (out) {
+            fprintf(out, "    {\n");
+        }
+        c_sm2_jacobian_point_copy(&P, &B);
+        for (j = 0; j < SM2_Z256_G_WINDOW_SIZE; j++) {
+            c_sm2_jacobian_point_to_bytes(&P, buf);
+            z256_to_mont_from_bytes(v, buf);
+            z256_to_mont_from_bytes(v + 4, buf + 32);
+            err += (0 != memcmp(v, c_sm2_z256_g_table[i][j], sizeof(v)));
+            if (out) {
+                fprintf(out, "        {\n");
+                for (k = 0; k < 8; k++) {
+                    fprintf(out, "%s0x%016llx,%s", (k % 4) ? " " : "            ", (unsigned long long) v[k], (k % 4 == 3) ? "\n" : "");
+                }
+                fprintf(out, "        },\n");
+            }
+            c_sm2_jacobian_point_add(&P, &P, &B);
+        }
+        if (out) {
+            fprintf(out, "    },\n");
+        }
+        for (k = 0; k < SM2_Z256_G_WINDOW_BITS; k++) {
+            c_sm2_jacobian_point_dbl(&B, &B);
+        }
+    }
+
+    if (!out) {
+        printf("SM2 G table: %s\n", err ? "FAILED" : "OK");
+    }
+
+    return err;
+}
 
 int main (int argc, char* argv[])
 {
+    int err = 0;
+
+    // test-sm2 --g-table 输出 c_sm2_z256_g_table 的表体
+    if (argc > 1 && 0 == strcmp(argv[1], "--g-table")) {
+        test_g_table(stdout);
+        return 0;
+    }
+
     printf("Start test....\n");
 
+    err += test_point();
+    err += test_mul();
+    err += test_g_table(NULL);
+    err += test_mul_generator_ct();
+
     printf("Finished!\n");
 
-    return 0;
-}
\ No newline at end of file
+    return err;
+}
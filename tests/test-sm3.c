@@ -0,0 +1,446 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include "../src/sm3.h"
+#include "../src/utils-sys.h"
+
+#define JOBS            45
+#define TREE_LEAF       1000
+#define TREE_LEAVES_MAX 64
+#define KDF_OUT         1001
+
+static int check (const char* name, const uint8_t* out, const uint8_t* expect, size_t len)
+{
+    if (0 != memcmp(out, expect, len)) {
+        printf("%s: FAILED\n", name);
+        return 1;
+    }
+    printf("%s: OK\n", name);
+    return 0;
+}
+
+/**
+ * GB/T 32905-2016 附录 A
+ */
+static int test_standard (void)
+{
+    int err = 0;
+    uint8_t dgst[C_SM3_DIGEST_SIZE];
+    static const uint8_t dgst1[C_SM3_DIGEST_SIZE] = {
+        0x66, 0xc7, 0xf0, 0xf4, 0x62, 0xee, 0xed, 0xd9, 0xd1, 0xf2, 0xd4, 0x6b, 0xdc, 0x10, 0xe4, 0xe2,
+        0x41, 0x67, 0xc4, 0x87, 0x5c, 0xf2, 0xf7, 0xa2, 0x29, 0x7d, 0xa0, 0x2b, 0x8f, 0x4b, 0xa8, 0xe0,
+    };
+    static const uint8_t dgst2[C_SM3_DIGEST_SIZE] = {
+        0xde, 0xbe, 0x9f, 0xf9, 0x22, 0x75, 0xb8, 0xa1, 0x38, 0x60, 0x48, 0x89, 0xc1, 0x8e, 0x5a, 0x4d,
+        0x6f, 0xdb, 0x70, 0xe5, 0x38, 0x7e, 0x57, 0x65, 0x29, 0x3d, 0xcb, 0xa3, 0x9c, 0x0c, 0x57, 0x32,
+    };
+    static const char* msg2 = "abcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcd";
+
+    c_sm3_digest((const uint8_t*) "abc", 3, dgst);
+    err += check("SM3 abc", dgst, dgst1, sizeof(dgst));
+
+    c_sm3_digest((const uint8_t*) msg2, strlen(msg2), dgst);
+    err += check("SM3 abcd x 16", dgst, dgst2, sizeof(dgst));
+
+    return err;
+}
+
+/**
+ * HMAC-SM3 (与 openssl dgst -sm3 -hmac 的结果对比), 包括超过分组长度的密钥
+ */
+static int test_hmac (void)
+{
+    int err = 0;
+    uint8_t key[100], mac[C_SM3_HMAC_SIZE];
+    Sm3HMACKey hk;
+    static const char* msg2 = "The quick brown fox jumps over the lazy dog";
+    static const uint8_t mac1[C_SM3_HMAC_SIZE] = {
+        0x28, 0xe6, 0x32, 0x56, 0xe7, 0xc5, 0xa0, 0x87, 0xb1, 0xf0, 0x73, 0x26, 0x5d, 0xc5, 0x30, 0x92,
+        0x16, 0x3f, 0x7b, 0x82, 0x72, 0x97, 0x35, 0xd0, 0x6f, 0x28, 0xf1, 0x0a, 0xf9, 0xd5, 0x23, 0x93,
+    };
+    static const uint8_t mac2[C_SM3_HMAC_SIZE] = {
+        0x4d, 0x93, 0x49, 0xab, 0x32, 0x6a, 0x5e, 0x78, 0x3a, 0x6c, 0x94, 0x4a, 0x76, 0x2b, 0x56, 0x65,
+        0xaf, 0x92, 0x50, 0xc2, 0x4c, 0x87, 0x3a, 0x59, 0x4b, 0xbf, 0xda, 0xf7, 0x61, 0xc0, 0xc2, 0x76,
+    };
+
+    c_sm3_hmac((const uint8_t*) "key", 3, (const uint8_t*) "abc", 3, mac);
+    err += check("HMAC-SM3", mac, mac1, sizeof(mac));
+
+    memset(key, 'k', sizeof(key));
+    c_sm3_hmac_key_setup(&hk, key, sizeof(key));
+    c_sm3_hmac_with_key(&hk, (const uint8_t*) msg2, strlen(msg2), mac);
+    err += check("HMAC-SM3 prepared long key", mac, mac2, sizeof(mac));
+
+    return err;
+}
+
+/**
+ * PBKDF2-HMAC-SM3 (与 openssl kdf PBKDF2 的结果对比), 各通道数及多线程
+ */
+static int test_pbkdf2 (uint32_t features)
+{
+    int err = 0;
+    uint32_t threads;
+    uint8_t out[100];
+    uint32_t saved = c_utils_sys_get_cpu_features();
+    static const uint8_t dk1[32] = {
+        0x46, 0x12, 0xf9, 0x22, 0xa1, 0xfd, 0xce, 0xfa, 0xf4, 0x31, 0x2f, 0xc6, 0xf8, 0xf3, 0x32, 0x2b,
+        0x48, 0x9c, 0xbf, 0x24, 0xf2, 0xea, 0x36, 0x1b, 0x44, 0xc2, 0xbd, 0x8f, 0xa2, 0xc6, 0xdc, 0xb0,
+    };
+    static const uint8_t dk1000[100] = {
+        0xe8, 0xb6, 0x35, 0xa4, 0x1d, 0xfe, 0x5a, 0xaa, 0xb7, 0xcf, 0x82, 0x8c, 0xff, 0x6f, 0x36, 0x08,
+        0xe2, 0x2c, 0xac, 0x59, 0xba, 0x16, 0xed, 0xd7, 0x0e, 0x00, 0x0b, 0x29, 0x3d, 0x00, 0xbc, 0x91,
+        0x18, 0x50, 0x4f, 0x57, 0xab, 0x46, 0x67, 0x3d, 0xce, 0xe7, 0xc5, 0x41, 0xf9, 0x33, 0xad, 0x28,
+        0x73, 0x3c, 0xfa, 0x26, 0x1f, 0xd1, 0xcc, 0x23, 0xb6, 0xd4, 0x97, 0x5b, 0x01, 0x81, 0xe5, 0x1b,
+        0xa7, 0x35, 0xab, 0xf6, 0xff, 0x8e, 0xc6, 0x5a, 0xdb, 0xed, 0xff, 0x28, 0xcd, 0x33, 0x8d, 0xe3,
+        0x5b, 0x21, 0x5b, 0xa4, 0x60, 0x49, 0x5e, 0x5c, 0x10, 0xe4, 0xa1, 0x59, 0xe5, 0xde, 0xaa, 0xd5,
+        0xb4, 0xc4, 0xfc, 0x8c,
+    };
+
+    c_utils_sys_set_cpu_features(features);
+
+    // 5 个线程时每个线程只有一个分组, 与单线程 32 字节输出一样走单路实现
+    for (threads = 1; threads <= 5; threads += 2) {
+        err += !c_sm3_pbkdf2((const uint8_t*) "password", 8, (const uint8_t*) "salt", 4, 1, threads, out, 32);
+        err += (0 != memcmp(out, dk1, sizeof(dk1)));
+        err += !c_sm3_pbkdf2((const uint8_t*) "password", 8, (const uint8_t*) "salt", 4, 1000, threads, out, 32);
+        err += (0 != memcmp(out, dk1000, 32));
+        err += !c_sm3_pbkdf2((const uint8_t*) "password", 8, (const uint8_t*) "salt", 4, 1000, threads, out, sizeof(out));
+        err += (0 != memcmp(out, dk1000, sizeof(dk1000)));
+    }
+    err += c_sm3_pbkdf2((const uint8_t*) "password", 8, (const uint8_t*) "salt", 4, 0, 1, out, 32);
+
+    printf("PBKDF2-HMAC-SM3 (cpu features 0x%x): %s\n", c_utils_sys_get_cpu_features(), err ? "FAILED" : "OK");
+    c_utils_sys_set_cpu_features(saved);
+
+    return err;
+}
+
+/**
+ * KDF: 按定义 SM3(Z || ct) 逐块计算作为参考, finish 与分段 read 的结果都与之一致
+ */
+static int test_kdf (uint32_t features)
+{
+    int err = 0;
+    size_t i, j, zLen, len, chunk;
+    uint8_t z[200], buf[200], ct[4];
+    static uint8_t ref[KDF_OUT], out[KDF_OUT];
+    uint32_t saved = c_utils_sys_get_cpu_features();
+    Sm3Context sm3;
+    Sm3KDFContext kdf;
+
+    c_utils_sys_set_cpu_features(features);
+
+    for (i = 0; i < sizeof(z); i++) {
+        z[i] = (uint8_t) (i * 29 + 3);
+    }
+
+    for (zLen = 0; zLen < sizeof(z); zLen += 7) {
+        for (i = 0; i < KDF_OUT; i += C_SM3_DIGEST_SIZE) {
+            j = i / C_SM3_DIGEST_SIZE + 1;
+            ct[0] = (uint8_t) (j >> 24); ct[1] = (uint8_t) (j >> 16); ct[2] = (uint8_t) (j >> 8); ct[3] = (uint8_t) j;
+            c_sm3_init(&sm3);
+            c_sm3_update(&sm3, z, zLen);
+            c_sm3_update(&sm3, ct, sizeof(ct));
+            c_sm3_finish(&sm3, buf);
+            memcpy(ref + i, buf, C_MIN(C_SM3_DIGEST_SIZE, KDF_OUT - i));
+        }
+
+        c_sm3_kdf_init(&kdf, KDF_OUT);
+        c_sm3_kdf_update(&kdf, z, zLen);
+        err += !c_sm3_kdf_finish(&kdf, out);
+        err += (0 != memcmp(out, ref, KDF_OUT));
+
+        chunk = zLen % 70 + 1;
+        memset(out, 0, sizeof(out));
+        for (i = 0; i < KDF_OUT; i += len) {
+            len = C_MIN(chunk, KDF_OUT - i);
+            err += !c_sm3_kdf_read(&kdf, out + i, len);
+        }
+        err += (0 != memcmp(out, ref, KDF_OUT));
+
+        // 计数器只剩一块: 超出的 read 失败且不消耗上次剩余的输出
+        c_sm3_kdf_init(&kdf, KDF_OUT);
+        c_sm3_kdf_update(&kdf, z, zLen);
+        err += !c_sm3_kdf_read(&kdf, out, 10);
+        kdf.counter = 0xffffffff;
+        err += c_sm3_kdf_read(&kdf, out + 10, 22 + 2 * C_SM3_DIGEST_SIZE);
+        err += !c_sm3_kdf_read(&kdf, out + 10, 22);
+        err += (0 != memcmp(out, ref, C_SM3_DIGEST_SIZE));
+        err += !c_sm3_kdf_read(&kdf, out, C_SM3_DIGEST_SIZE);
+        err += c_sm3_kdf_read(&kdf, out, 1);
+
+        // finish 超出计数器范围时报错
+        if (sizeof(size_t) > 4) {
+            kdf.outLen = (size_t) 0x100000000ULL * C_SM3_DIGEST_SIZE;
+            err += c_sm3_kdf_finish(&kdf, out);
+        }
+    }
+
+    printf("SM3 KDF (cpu features 0x%x): %s\n", c_utils_sys_get_cpu_features(), err ? "FAILED" : "OK");
+    c_utils_sys_set_cpu_features(saved);
+
+    return err;
+}
+
+/**
+ * 各 SIMD 实现与纯软件实现的结果一致(不同长度, 单次或分段 update)
+ */
+static int test_compress (uint32_t features)
+{
+    int i, len, err = 0;
+    static uint8_t data[64 * 11 + 7];
+    uint8_t dgst[C_SM3_DIGEST_SIZE], ref[C_SM3_DIGEST_SIZE];
+    uint32_t saved = c_utils_sys_get_cpu_features();
+    Sm3Context ctx;
+
+    for (i = 0; i < (int) sizeof(data); i++) {
+        data[i] = (uint8_t) (i * 131 + 17);
+    }
+
+    for (len = 0; len <= (int) sizeof(data); len += 29) {
+        c_utils_sys_set_cpu_features(0);
+        c_sm3_digest(data, len, ref);
+
+        c_utils_sys_set_cpu_features(features);
+        c_sm3_digest(data, len, dgst);
+        err += (0 != memcmp(dgst, ref, sizeof(ref)));
+
+        c_sm3_init(&ctx);
+        for (i = 0; i < len; i += 100) {
+            c_sm3_update(&ctx, data + i, C_MIN(100, len - i));
+        }
+        c_sm3_finish(&ctx, dgst);
+        err += (0 != memcmp(dgst, ref, sizeof(ref)));
+    }
+
+    printf("SM3 compress (cpu features 0x%x): %s\n", c_utils_sys_get_cpu_features(), err ? "FAILED" : "OK");
+    c_utils_sys_set_cpu_features(saved);
+
+    return err;
+}
+
+/**
+ * 多缓冲区接口与逐条计算的结果一致, 每个任务恰好完成一次
+ */
+static int test_batch (uint32_t features)
+{
+    int i, err = 0;
+    static uint8_t data[5000];
+    uint8_t dgst[JOBS][C_SM3_DIGEST_SIZE], ref[C_SM3_DIGEST_SIZE];
+    int seen[JOBS];
+    uint32_t saved = c_utils_sys_get_cpu_features();
+    Sm3Job jobs[JOBS];
+    Sm3Job* job = NULL;
+    Sm3MbManager mgr;
+    Sm3HMACKey hk;
+
+    c_utils_sys_set_cpu_features(features);
+
+    for (i = 0; i < (int) sizeof(data); i++) {
+        data[i] = (uint8_t) (i * 7 + 3);
+    }
+    for (i = 0; i < JOBS; i++) {
+        jobs[i].data = data + i;
+        jobs[i].dataLen = (size_t) ((i * 397) % 4001) % (sizeof(data) - JOBS);
+        jobs[i].dgst = dgst[i];
+        jobs[i].userData = &seen[i];
+        seen[i] = 0;
+    }
+    jobs[1].dataLen = 55;
+    jobs[2].dataLen = 56;
+    jobs[3].dataLen = 64;
+
+    c_sm3_digest_batch(jobs, JOBS);
+    for (i = 0; i < JOBS; i++) {
+        c_sm3_digest(jobs[i].data, jobs[i].dataLen, ref);
+        err += (0 != memcmp(dgst[i], ref, sizeof(ref)));
+    }
+
+    memset(dgst, 0, sizeof(dgst));
+    c_sm3_mb_init(&mgr);
+    for (i = 0; i < JOBS; i++) {
+        job = c_sm3_mb_submit(&mgr, &jobs[i]);
+        if (job) {
+            (*(int*) job->userData)++;
+        }
+    }
+    while (NULL != (job = c_sm3_mb_flush(&mgr))) {
+        (*(int*) job->userData)++;
+    }
+    for (i = 0; i < JOBS; i++) {
+        c_sm3_digest(jobs[i].data, jobs[i].dataLen, ref);
+        err += (0 != memcmp(dgst[i], ref, sizeof(ref))) || (1 != seen[i]);
+    }
+
+    // 同一预处理密钥的批量 HMAC
+    c_sm3_hmac_key_setup(&hk, data, 20);
+    c_sm3_hmac_batch(&hk, jobs, JOBS);
+    for (i = 0; i < JOBS; i++) {
+        c_sm3_hmac(data, 20, jobs[i].data, jobs[i].dataLen, ref);
+        err += (0 != memcmp(dgst[i], ref, sizeof(ref)));
+    }
+
+    printf("SM3 batch (%u lanes): %s\n", mgr.lanes, err ? "FAILED" : "OK");
+    c_utils_sys_set_cpu_features(saved);
+
+    return err;
+}
+
+/**
+ * 按树模式的定义逐层计算, 作为参考
+ */
+static void tree_ref (const uint8_t* data, size_t len, size_t leafSize, uint8_t dgst[C_SM3_DIGEST_SIZE])
+{
+    size_t i, n, nLeaves = len ? (len + leafSize - 1) / leafSize : 1;
+    static uint8_t nodes[TREE_LEAVES_MAX][C_SM3_DIGEST_SIZE];
+    uint8_t buf[1 + 2 * C_SM3_DIGEST_SIZE + 16];
+    Sm3Context ctx;
+
+    for (i = 0; i < nLeaves; i++) {
+        buf[0] = 0x00;
+        c_sm3_init(&ctx);
+        c_sm3_update(&ctx, buf, 1);
+        c_sm3_update(&ctx, data + i * leafSize, C_MIN(leafSize, len - i * leafSize));
+        c_sm3_finish(&ctx, nodes[i]);
+    }
+    for (n = nLeaves; n > 1; n = (n + 1) / 2) {
+        for (i = 0; i < n / 2; i++) {
+            buf[0] = 0x01;
+            memcpy(buf + 1, nodes[2 * i], C_SM3_DIGEST_SIZE);
+            memcpy(buf + 1 + C_SM3_DIGEST_SIZE, nodes[2 * i + 1], C_SM3_DIGEST_SIZE);
+            c_sm3_digest(buf, 1 + 2 * C_SM3_DIGEST_SIZE, nodes[i]);
+        }
+        if (n & 1) {
+            memcpy(nodes[i], nodes[n - 1], C_SM3_DIGEST_SIZE);
+        }
+    }
+    buf[0] = 0x02;
+    memcpy(buf + 1, nodes[0], C_SM3_DIGEST_SIZE);
+    for (i = 0; i < 8; i++) {
+        buf[1 + C_SM3_DIGEST_SIZE + i] = (uint8_t) ((uint64_t) len >> (56 - 8 * i));
+        buf[1 + C_SM3_DIGEST_SIZE + 8 + i] = (uint8_t) ((uint64_t) leafSize >> (56 - 8 * i));
+    }
+    c_sm3_digest(buf, 1 + C_SM3_DIGEST_SIZE + 16, dgst);
+}
+
+/**
+ * 树模式: 任意分段 update 与参考实现一致, 修改叶子后增量计算与重新计算一致, 文件接口与内存接口一致
+ */
+static int test_tree (void)
+{
+    int err = 0, fd, n = 0;
+    size_t i, len, chunk;
+    static uint8_t data[TREE_LEAF * 37 + 11];
+    uint8_t dgst[C_SM3_DIGEST_SIZE], ref[C_SM3_DIGEST_SIZE];
+    char path[] = "/tmp/test-sm3-XXXXXX";
+    ThreadPool* pool = c_thread_pool_new(4);
+    Sm3TreeContext ctx;
+
+    for (i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t) (i * 13 + 1);
+    }
+
+    for (len = 0; len <= sizeof(data); len += TREE_LEAF * 5 + 7) {
+        tree_ref(data, len, TREE_LEAF, ref);
+        // 每个长度有奇数种分段, n 跨长度交替, 每种分段都会分别用线程池和 NULL 计算
+        for (chunk = 1; chunk <= TREE_LEAF * 9; chunk *= 7, n++) {
+            c_sm3_tree_init(&ctx, (n & 1) ? pool : NULL, TREE_LEAF);
+            for (i = 0; i < len; i += chunk) {
+                err += !c_sm3_tree_update(&ctx, data + i, C_MIN(chunk, len - i));
+            }
+            err += !c_sm3_tree_finish(&ctx, dgst);
+            err += (0 != memcmp(dgst, ref, sizeof(ref)));
+            c_sm3_tree_free(&ctx);
+        }
+    }
+
+    // 整个数据写入文件
+    fd = mkstemp(path);
+    err += (fd < 0) || (sizeof(data) != (size_t) write(fd, data, sizeof(data)));
+
+    c_sm3_tree_init(&ctx, pool, TREE_LEAF);
+    err += !c_sm3_tree_file(&ctx, path, dgst);
+    tree_ref(data, sizeof(data), TREE_LEAF, ref);
+    err += (0 != memcmp(dgst, ref, sizeof(ref)));
+
+    // 修改第 3 个叶子
+    data[TREE_LEAF * 3 + 5] ^= 0xff;
+    tree_ref(data, sizeof(data), TREE_LEAF, ref);
+    err += !c_sm3_tree_set_leaf(&ctx, 3, data + TREE_LEAF * 3, TREE_LEAF);
+    err += !c_sm3_tree_root(&ctx, dgst);
+    err += (0 != memcmp(dgst, ref, sizeof(ref)));
+
+    // 修改文件中跨越叶子 20 和 21 的范围, 以及最后一个不满的叶子
+    data[TREE_LEAF * 21 - 2] ^= 0x55;
+    data[TREE_LEAF * 21 + 2] ^= 0x55;
+    data[sizeof(data) - 1] ^= 0x55;
+    tree_ref(data, sizeof(data), TREE_LEAF, ref);
+    err += (sizeof(data) != (size_t) pwrite(fd, data, sizeof(data), 0));
+    err += !c_sm3_tree_file_update(&ctx, path, TREE_LEAF * 21 - 2, 5, dgst);
+    err += !c_sm3_tree_file_update(&ctx, path, sizeof(data) - 1, 1, dgst);
+    err += (0 != memcmp(dgst, ref, sizeof(ref)));
+    c_sm3_tree_free(&ctx);
+
+    // 与普通 SM3 不同
+    c_sm3_digest(data, sizeof(data), ref);
+    err += (0 == memcmp(dgst, ref, sizeof(ref)));
+
+    close(fd);
+    unlink(path);
+    c_thread_pool_free(pool);
+    printf("SM3 tree: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+int main (int argc, char* argv[])
+{
+    int err = 0;
+
+    printf("Start test....\n");
+
+    err += test_standard();
+    err += test_hmac();
+    err += test_compress(0xffffffff);
+    err += test_compress(C_SYS_CPU_SSE2 | C_SYS_CPU_SSSE3);
+    err += test_batch(0xffffffff);
+    err += test_batch(C_SYS_CPU_SSE2 | C_SYS_CPU_SSSE3 | C_SYS_CPU_AVX | C_SYS_CPU_AVX2);
+    err += test_batch(C_SYS_CPU_SSE2);
+    err += test_batch(0);
+    err += test_tree();
+    err += test_kdf(0xffffffff);
+    err += test_kdf(C_SYS_CPU_SSE2 | C_SYS_CPU_SSSE3 | C_SYS_CPU_AVX | C_SYS_CPU_AVX2);
+    err += test_kdf(0);
+    err += test_pbkdf2(0xffffffff);
+    err += test_pbkdf2(C_SYS_CPU_SSE2 | C_SYS_CPU_SSSE3 | C_SYS_CPU_AVX | C_SYS_CPU_AVX2);
+    err += test_pbkdf2(C_SYS_CPU_SSE2);
+    err += test_pbkdf2(0);
+    err += (c_sm3_pbkdf2_benchmark(32, 1, 50) < C_SM3_PBKDF2_MIN_ITERATIONS);
+
+    printf("Finished!\n");
+
+    return err;
+}
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <pthread.h>
+
+#include "../src/sm4.h"
+#include "../src/utils-sys.h"
+
+static int check (const char* name, const uint8_t* out, const uint8_t* expect, size_t len)
+{
+    if (0 != memcmp(out, expect, len)) {
+        printf("%s: FAILED\n", name);
+        return 1;
+    }
+    printf("%s: OK\n", name);
+    return 0;
+}
+
+/**
+ * GB/T 32907-2016 附录 A
+ */
+static int test_standard (void)
+{
+    static const uint8_t key[16] = {
+        0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+    };
+    static const uint8_t ct1[16] = {
+        0x68, 0x1e, 0xdf, 0x34, 0xd2, 0x06, 0x96, 0x5e, 0x86, 0xb3, 0xe9, 0x4f, 0x53, 0x6e, 0x42, 0x46,
+    };
+    static const uint8_t ctN[16] = {
+        0x59, 0x52, 0x98, 0xc7, 0xc6, 0xfd, 0x27, 0x1f, 0x04, 0x02, 0xf8, 0x04, 0xc3, 0x3d, 0x3f, 0x66,
+    };
+    int i, err = 0;
+    uint8_t buf[16];
+    Sm4Context ctx;
+
+    c_sm4_setup(&ctx, key);
+
+    c_sm4_encrypt_block(&ctx, (uint8_t*) key, buf);
+    err += check("SM4 encrypt", buf, ct1, 16);
+    c_sm4_decrypt_block(&ctx, buf, buf);
+    err += check("SM4 decrypt", buf, key, 16);
+
+    memcpy(buf, key, 16);
+    for (i = 0; i < 1000000; i++) {
+        c_sm4_encrypt_block(&ctx, buf, buf);
+    }
+    err += check("SM4 encrypt x 1000000", buf, ctN, 16);
+
+    return err;
+}
+
+/**
+ * 批量接口(各 SIMD 实现)与逐分组的查表实现结果一致
+ */
+static int test_blocks (uint32_t features)
+{
+    int i, n, err = 0;
+    uint8_t key[16], in[16 * 40], out[16 * 40], ref[16 * 40];
+    uint32_t saved = c_utils_sys_get_cpu_features();
+    Sm4Context ctx;
+
+    c_utils_sys_set_cpu_features(features);
+
+    for (i = 0; i < (int) sizeof(key); i++) {
+        key[i] = (uint8_t) (i * 17 + 5);
+    }
+    for (i = 0; i < (int) sizeof(in); i++) {
+        in[i] = (uint8_t) (i * 31 + 7);
+    }
+    c_sm4_setup(&ctx, key);
+
+    for (i = 0; i < 40; i++) {
+        c_sm4_encrypt_block(&ctx, in + i * 16, ref + i * 16);
+    }
+    for (n = 0; n <= 40; n++) {
+        memset(out, 0, sizeof(out));
+        c_sm4_encrypt_blocks(&ctx, in, out, n);
+        err += (0 != memcmp(out, ref, n * 16));
+        c_sm4_decrypt_blocks(&ctx, out, out, n);
+        err += (0 != memcmp(out, in, n * 16));
+    }
+
+    // c_sm4_encrypt 处理所有完整的分组
+    c_sm4_encrypt(&ctx, in, out, 32);
+    err += (0 != memcmp(out, ref, 32));
+
+    printf("SM4 blocks (cpu features 0x%x): %s\n", c_utils_sys_get_cpu_features(), err ? "FAILED" : "OK");
+    c_utils_sys_set_cpu_features(saved);
+
+    return err;
+}
+
+/**
+ * SM4-CTR: 结果与 OpenSSL sm4-ctr 一致, 流式/seek 与一次处理一致
+ */
+static int test_ctr (void)
+{
+    static const uint8_t key[16] = {
+        0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+    };
+    static const uint8_t iv[16] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    };
+    static const uint8_t expect[64] = {
+        0xac, 0x32, 0x36, 0xcb, 0x97, 0x0c, 0xc2, 0x07, 0x80, 0x27, 0x5d, 0x28, 0x4b, 0x02, 0x53, 0xc0,
+        0xd4, 0xbc, 0xb6, 0xf0, 0xfb, 0x18, 0x47, 0xba, 0x61, 0x2a, 0xa8, 0x5e, 0x3a, 0xbb, 0x16, 0xa1,
+        0xd0, 0x16, 0x9e, 0x2c, 0x06, 0xe3, 0x3b, 0xa2, 0xce, 0x21, 0xb5, 0x02, 0x3f, 0xd0, 0x48, 0xa1,
+        0x19, 0x75, 0x8b, 0xa7, 0x8d, 0xd7, 0xcd, 0x84, 0xed, 0x4f, 0x55, 0xe3, 0x7b, 0xe4, 0x23, 0x72,
+    };
+    int i, err = 0;
+    uint8_t in[1000], out[1000], buf[1000];
+    Sm4Context ctx;
+    Sm4CtrContext ctr;
+
+    c_sm4_setup(&ctx, key);
+
+    memset(in, 0xaa, 16);
+    memset(in + 16, 0xbb, 16);
+    memset(in + 32, 0xcc, 16);
+    memset(in + 48, 0xdd, 16);
+    c_sm4_encrypt_ctr(&ctx, iv, 0, in, out, 64);
+    err += check("SM4-CTR", out, expect, sizeof(expect));
+
+    for (i = 0; i < (int) sizeof(in); i++) {
+        in[i] = (uint8_t) (i * 7 + 3);
+    }
+    c_sm4_encrypt_ctr(&ctx, iv, 0, in, out, sizeof(in));
+
+    // 任意长度分段
+    c_sm4_ctr_init(&ctr, &ctx, iv, 0);
+    for (i = 0; i < (int) sizeof(in); i += 37) {
+        c_sm4_ctr_update(&ctr, in + i, buf + i, C_MIN(37, (int) sizeof(in) - i));
+    }
+    err += check("SM4-CTR stream", buf, out, sizeof(out));
+
+    // 随机访问
+    c_sm4_ctr_seek(&ctr, 333);
+    c_sm4_ctr_update(&ctr, in + 333, buf, 500);
+    err += check("SM4-CTR seek", buf, out + 333, 500);
+    c_sm4_encrypt_ctr(&ctx, iv, 10, in + 160, buf, 200);
+    err += check("SM4-CTR block offset", buf, out + 160, 200);
+
+    return err;
+}
+
+/**
+ * SM4-GCM: RFC 8998 附录 A.1
+ */
+static int test_gcm (void)
+{
+    static const uint8_t key[16] = {
+        0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+    };
+    static const uint8_t iv[12] = {
+        0x00, 0x00, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x00, 0x00, 0xab, 0xcd,
+    };
+    static const uint8_t aad[20] = {
+        0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+        0xab, 0xad, 0xda, 0xd2,
+    };
+    static const uint8_t expect[64] = {
+        0x17, 0xf3, 0x99, 0xf0, 0x8c, 0x67, 0xd5, 0xee, 0x19, 0xd0, 0xdc, 0x99, 0x69, 0xc4, 0xbb, 0x7d,
+        0x5f, 0xd4, 0x6f, 0xd3, 0x75, 0x64, 0x89, 0x06, 0x91, 0x57, 0xb2, 0x82, 0xbb, 0x20, 0x07, 0x35,
+        0xd8, 0x27, 0x10, 0xca, 0x5c, 0x22, 0xf0, 0xcc, 0xfa, 0x7c, 0xbf, 0x93, 0xd4, 0x96, 0xac, 0x15,
+        0xa5, 0x68, 0x34, 0xcb, 0xcf, 0x98, 0xc3, 0x97, 0xb4, 0x02, 0x4a, 0x26, 0x91, 0x23, 0x3b, 0x8d,
+    };
+    static const uint8_t expectTag[16] = {
+        0x83, 0xde, 0x35, 0x41, 0xe4, 0xc2, 0xb5, 0x81, 0x77, 0xe0, 0x65, 0xa9, 0xbf, 0x7b, 0x62, 0xec,
+    };
+    int err = 0;
+    uint8_t in[64], out[64], tag[16];
+    Sm4Context ctx;
+
+    memset(in, 0xaa, 8);
+    memset(in + 8, 0xbb, 8);
+    memset(in + 16, 0xcc, 8);
+    memset(in + 24, 0xdd, 8);
+    memset(in + 32, 0xee, 8);
+    memset(in + 40, 0xff, 8);
+    memset(in + 48, 0xee, 8);
+    memset(in + 56, 0xaa, 8);
+
+    c_sm4_setup(&ctx, key);
+    c_sm4_gcm_encrypt(&ctx, iv, sizeof(iv), aad, sizeof(aad), in, out, sizeof(in), tag, sizeof(tag));
+    err += check("SM4-GCM encrypt", out, expect, sizeof(expect));
+    err += check("SM4-GCM tag", tag, expectTag, sizeof(expectTag));
+
+    err += !c_sm4_gcm_decrypt(&ctx, iv, sizeof(iv), aad, sizeof(aad), out, out, sizeof(out), tag, sizeof(tag));
+    err += check("SM4-GCM decrypt", out, in, sizeof(in));
+
+    tag[15] ^= 1;
+    err += c_sm4_gcm_decrypt(&ctx, iv, sizeof(iv), aad, sizeof(aad), expect, out, sizeof(out), tag, sizeof(tag));
+    err += c_sm4_gcm_decrypt(&ctx, iv, sizeof(iv), aad, sizeof(aad), expect, out, sizeof(out), expectTag, 1);
+    printf("SM4-GCM tamper: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+/**
+ * SM4-XTS: 与按 IEEE P1619 逐分组计算的结果一致, 多扇区与逐扇区一致
+ */
+static int test_xts (void)
+{
+    int i, j, err = 0;
+    uint8_t key[32], t[16], blk[16], in[512 * 5], out[512 * 5], ref[512 * 5];
+    uint64_t sector = 0x0123456789ULL;
+    Sm4XtsContext ctx;
+
+    for (i = 0; i < (int) sizeof(key); i++) {
+        key[i] = (uint8_t) (i * 13 + 1);
+    }
+    for (i = 0; i < (int) sizeof(in); i++) {
+        in[i] = (uint8_t) (i * 5 + 2);
+    }
+    err += c_sm4_xts_setup(&ctx, key, 16);
+    err += c_sm4_xts_setup(&ctx, key, 64);
+    err += !c_sm4_xts_setup(&ctx, key, sizeof(key));
+
+    for (i = 0; i < (int) sizeof(in) / 512; i++, sector++) {
+        memset(blk, 0, sizeof(blk));
+        for (j = 0; j < 8; j++) {
+            blk[j] = (uint8_t) (sector >> (8 * j));
+        }
+        c_sm4_encrypt_block(&ctx.tweak, blk, t);
+        for (j = 0; j < 512; j += 16) {
+            int k, carry;
+            c_cipher_mode_xor(blk, in + i * 512 + j, t, 16);
+            c_sm4_encrypt_block(&ctx.data, blk, blk);
+            c_cipher_mode_xor(ref + i * 512 + j, blk, t, 16);
+            // t *= alpha
+            carry = t[15] >> 7;
+            for (k = 15; k > 0; k--) {
+                t[k] = (uint8_t) ((t[k] << 1) | (t[k - 1] >> 7));
+            }
+            t[0] = (uint8_t) ((t[0] << 1) ^ (carry ? 0x87 : 0));
+        }
+    }
+
+    err += !c_sm4_xts_encrypt_sectors(&ctx, in, out, sizeof(in), 512, 0x0123456789ULL);
+    err += check("SM4-XTS", out, ref, sizeof(ref));
+    err += !c_sm4_xts_decrypt_sectors(&ctx, out, out, sizeof(out), 512, 0x0123456789ULL);
+    err += check("SM4-XTS decrypt", out, in, sizeof(in));
+
+    err += c_sm4_xts_encrypt_sectors(&ctx, in, out, 1000, 512, 0);
+
+    return err;
+}
+
+/**
+ * SM4-CBC: 结果与 OpenSSL sm4-cbc 一致; 批量解密(原地)与多消息加密与逐条处理一致
+ */
+static int test_cbc (void)
+{
+    static const uint8_t key[16] = {
+        0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+    };
+    static const uint8_t iv0[16] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    };
+    static const uint8_t expect[64] = {
+        0xd9, 0x8a, 0x04, 0xa5, 0xd8, 0xfd, 0xc4, 0x65, 0x03, 0x1e, 0xf3, 0xd8, 0xd2, 0xc7, 0x46, 0x03,
+        0xf5, 0x78, 0xea, 0x6f, 0xf4, 0xa8, 0x46, 0x22, 0xe5, 0xad, 0x0a, 0x21, 0x29, 0xcb, 0x3e, 0x45,
+        0xcb, 0x7c, 0x98, 0xc4, 0x01, 0x32, 0xc2, 0x4e, 0x94, 0x3a, 0x7a, 0x6a, 0xaf, 0xff, 0xed, 0x43,
+        0xa7, 0x8f, 0xbd, 0x67, 0xed, 0x89, 0xad, 0x46, 0x42, 0x5e, 0xee, 0xdc, 0x7c, 0xfa, 0x53, 0x2d,
+    };
+    int i, n, err = 0;
+    uint8_t iv[16], in[16 * 100], out[16 * 100], ref[16 * 100];
+    Sm4Context ctx;
+    Sm4CbcStream streams[40];
+
+    c_sm4_setup(&ctx, key);
+
+    memset(in, 0xaa, 16);
+    memset(in + 16, 0xbb, 16);
+    memset(in + 32, 0xcc, 16);
+    memset(in + 48, 0xdd, 16);
+    memcpy(iv, iv0, 16);
+    c_sm4_encrypt_cbc(&ctx, iv, in, out, 64);
+    err += check("SM4-CBC encrypt", out, expect, sizeof(expect));
+    err += check("SM4-CBC iv", iv, expect + 48, 16);
+
+    for (i = 0; i < (int) sizeof(in); i++) {
+        in[i] = (uint8_t) (i * 11 + 9);
+    }
+    memcpy(iv, iv0, 16);
+    c_sm4_encrypt_cbc(&ctx, iv, in, ref, sizeof(in));
+    for (n = 0; n <= 70; n++) {
+        memcpy(out, ref, sizeof(out));
+        memcpy(iv, iv0, 16);
+        c_sm4_decrypt_cbc(&ctx, iv, out, out, n * 16);
+        err += (0 != memcmp(out, in, n * 16)) || (0 != memcmp(out + n * 16, ref + n * 16, sizeof(out) - n * 16));
+        err += (0 != memcmp(iv, n ? ref + (n - 1) * 16 : iv0, 16));
+    }
+    printf("SM4-CBC decrypt: %s\n", err ? "FAILED" : "OK");
+
+    // 40 条长度不同的消息(含空消息), 跨越一批 32 条的边界
+    for (i = 0, n = 0; i < 40; i++) {
+        memcpy(streams[i].iv, iv0, 16);
+        streams[i].iv[0] = (uint8_t) i;
+        streams[i].input = in + n;
+        streams[i].output = out + n;
+        streams[i].length = (size_t) ((i * 7) % 5) * 16 + (i % 3);
+        n += (int) streams[i].length - (i % 3);
+    }
+    c_sm4_encrypt_cbc_multi(&ctx, streams, 40);
+    for (i = 0, n = 0; i < 40; i++) {
+        int len = (int) streams[i].length - (i % 3);
+        memcpy(iv, iv0, 16);
+        iv[0] = (uint8_t) i;
+        c_sm4_encrypt_cbc(&ctx, iv, in + n, ref, len);
+        err += (0 != memcmp(out + n, ref, len)) || (0 != memcmp(streams[i].iv, iv, 16));
+        n += len;
+    }
+    printf("SM4-CBC multi stream: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+static Sm4KeyCache* gsCache = NULL;
+
+static void* key_cache_thread (void* arg)
+{
+    int i, bad = 0;
+    uint8_t key[16], buf[16], ref[16];
+    const Sm4Context* ctx = NULL;
+    Sm4Context local;
+
+    (void) arg;
+    for (i = 0; i < 2000; i++) {
+        memset(key, 0, sizeof(key));
+        key[0] = (uint8_t) (i % 24);
+        ctx = c_sm4_key_cache_acquire(gsCache, key);
+        c_sm4_setup(&local, key);
+        c_sm4_encrypt_block(ctx, key, buf);
+        c_sm4_encrypt_block(&local, key, ref);
+        bad += (0 != memcmp(buf, ref, 16));
+        c_sm4_key_cache_release(gsCache, ctx);
+    }
+
+    return bad ? (void*) 1 : NULL;
+}
+
+/**
+ * 密钥编排缓存: 同一密钥共享同一个上下文, 满时淘汰, 多线程并发使用
+ */
+static int test_key_cache (void)
+{
+    int i, err = 0;
+    void* ret = NULL;
+    uint8_t key[16];
+    pthread_t threads[4];
+    const Sm4Context* a = NULL;
+    const Sm4Context* b = NULL;
+    const Sm4Context* c = NULL;
+
+    gsCache = c_sm4_key_cache_new(16);
+
+    memset(key, 0x11, sizeof(key));
+    a = c_sm4_key_cache_acquire(gsCache, key);
+    b = c_sm4_key_cache_acquire(gsCache, key);
+    key[15] ^= 1;
+    c = c_sm4_key_cache_acquire(gsCache, key);
+    err += (NULL == a || a != b || a == c);
+    err += (0 != ((uintptr_t) a->enKey & (C_CACHE_LINE_SIZE - 1)));
+    c_sm4_key_cache_release(gsCache, a);
+    c_sm4_key_cache_release(gsCache, b);
+    c_sm4_key_cache_release(gsCache, c);
+
+    for (i = 0; i < 4; i++) {
+        pthread_create(&threads[i], NULL, key_cache_thread, NULL);
+    }
+    for (i = 0; i < 4; i++) {
+        pthread_join(threads[i], &ret);
+        err += (NULL != ret);
+    }
+
+    c_sm4_key_cache_free(gsCache);
+    gsCache = NULL;
+    printf("SM4 key cache: %s\n", err ? "FAILED" : "OK");
+
+    return err;
+}
+
+int main (int argc, char* argv[])
+{
+    int err = 0;
+
+    printf("Start test....\n");
+
+    err += test_standard();
+    err += test_blocks(0xffffffff);
+    err += test_blocks(C_SYS_CPU_SSE2 | C_SYS_CPU_SSSE3 | C_SYS_CPU_AESNI | C_SYS_CPU_AVX | C_SYS_CPU_AVX2);
+    err += test_blocks(C_SYS_CPU_SSE2 | C_SYS_CPU_AVX | C_SYS_CPU_AVX2 | C_SYS_CPU_GFNI);
+    err += test_blocks(C_SYS_CPU_SSE2 | C_SYS_CPU_SSSE3 | C_SYS_CPU_AESNI);
+    err += test_blocks(0);
+    err += test_ctr();
+    err += test_gcm();
+    err += test_xts();
+    err += test_cbc();
+    err += test_key_cache();
+
+    printf("Finished!\n");
+
+    return err;
+}
@@ -23,11 +23,65 @@
 #include <stdio.h>
 
 #include "../src/utils-str.h"
+#include "../src/utils-sys.h"
+
+/**
+ * 各 SIMD 实现与纯软件实现的结果一致, 包括非法字符的位置在向量部分和尾部
+ */
+static int test_hex (uint32_t features)
+{
+    int err = 0;
+    size_t i, len;
+    static uint8_t data[300], back[300];
+    static char hex[601], ref[601];
+    uint32_t saved = c_utils_sys_get_cpu_features();
+
+    for (i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t) (i * 37 + 11);
+    }
+
+    for (len = 0; len <= sizeof(data); len += 13) {
+        c_utils_sys_set_cpu_features(0);
+        c_utils_str_hex_encode(ref, data, len);
+
+        c_utils_sys_set_cpu_features(features);
+        memset(hex, 0, sizeof(hex));
+        c_utils_str_hex_encode(hex, data, len);
+        err += (0 != memcmp(hex, ref, 2 * len)) || (0 != hex[2 * len]);
+
+        for (i = 0; i < 2 * len; i++) {
+            if (hex[i] >= 'a' && (i % 3)) {
+                hex[i] -= 32;
+            }
+        }
+        err += !c_utils_str_hex_decode(back, hex, 2 * len);
+        err += (0 != memcmp(back, data, len));
+
+        if (len > 0) {
+            hex[len / 3 * 2 + 1] = 'g';
+            err += c_utils_str_hex_decode(back, hex, 2 * len);
+            hex[len / 3 * 2 + 1] = '0';
+            hex[2 * len - 1] = '/';
+            err += c_utils_str_hex_decode(back, hex, 2 * len);
+            err += c_utils_str_hex_decode(back, hex, 2 * len - 1);
+        }
+    }
+
+    printf("十六进制编解码 (cpu features 0x%x): %s\n", c_utils_sys_get_cpu_features(), err ? "FAILED" : "OK");
+    c_utils_sys_set_cpu_features(saved);
+
+    return err;
+}
 
 int main (int argc, char* argv[])
 {
+    int err = 0;
+
     printf("Start test....\n");
 
+    err += test_hex(0xffffffff);
+    err += test_hex(C_SYS_CPU_SSE2 | C_SYS_CPU_SSSE3);
+
     printf("十六进制转为字符串");
     {
         const char hex[] = {0x01, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
@@ -109,5 +163,5 @@ int main (int argc, char* argv[])
 
     printf("Finished!\n");
 
-    return 0;
+    return err;
 }
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 dingjing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <pthread.h>
+
+#include "../src/thread-pool.h"
+
+#define TASKS       1000
+
+static pthread_mutex_t gsLock = PTHREAD_MUTEX_INITIALIZER;
+static size_t gsSum = 0;
+
+static void add_task (void* data)
+{
+    pthread_mutex_lock(&gsLock);
+    gsSum += (size_t) (uintptr_t) data;
+    pthread_mutex_unlock(&gsLock);
+}
+
+static void square_task (void* data, size_t index)
+{
+    ((size_t*) data)[index] = index * index;
+}
+
+typedef struct
+{
+    ThreadPool*     pool;
+    size_t          out[TASKS];
+} NestedMap;
+
+/**
+ * 在工作线程内部再调用 map: 所有工作线程都在等待时调用线程会自己完成全部下标
+ */
+static void nested_task (void* data, size_t index)
+{
+    NestedMap* m = (NestedMap*) data + index;
+
+    c_thread_pool_map(m->pool, square_task, m->out, TASKS);
+}
+
+/**
+ * submit/wait 执行全部任务; map 覆盖每个下标恰好一次, 嵌套调用不会死锁
+ */
+static int test_pool (uint32_t nThreads)
+{
+    size_t i, j, expect = 0;
+    int err = 0;
+    static size_t out[TASKS];
+    static NestedMap nested[8];
+    ThreadPool* pool = c_thread_pool_new(nThreads);
+
+    if (NULL == pool) {
+        printf("thread pool (%u threads): FAILED\n", nThreads);
+        return 1;
+    }
+
+    gsSum = 0;
+    for (i = 1; i <= TASKS; i++) {
+        err += !c_thread_pool_submit(pool, add_task, (void*) (uintptr_t) i);
+        expect += i;
+    }
+    c_thread_pool_wait(pool);
+    err += (gsSum != expect);
+
+    memset(out, 0, sizeof(out));
+    c_thread_pool_map(pool, square_task, out, TASKS);
+    for (i = 0; i < TASKS; i++) {
+        err += (out[i] != i * i);
+    }
+
+    memset(nested, 0, sizeof(nested));
+    for (i = 0; i < 8; i++) {
+        nested[i].pool = pool;
+    }
+    c_thread_pool_map(pool, nested_task, nested, 8);
+    for (i = 0; i < 8; i++) {
+        for (j = 0; j < TASKS; j++) {
+            err += (nested[i].out[j] != j * j);
+        }
+    }
+
+    printf("thread pool (%u threads): %s\n", c_thread_pool_get_threads(pool), err ? "FAILED" : "OK");
+    c_thread_pool_free(pool);
+
+    return err;
+}
+
+int main (int argc, char* argv[])
+{
+    int err = 0;
+
+    printf("Start test....\n");
+
+    err += test_pool(1);
+    err += test_pool(4);
+    err += test_pool(0);
+
+    printf("Finished!\n");
+
+    return err;
+}